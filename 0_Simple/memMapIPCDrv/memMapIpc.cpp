@@ -18,6 +18,7 @@
 #include <string.h>
 #include <cstring>
 #include <iostream>
+#include <thread>
 #include "cuda.h"
 
 #include "helper_multiprocess.h"
@@ -552,8 +553,213 @@ static void parentProcess(char *app) {
   sharedMemoryClose(&info);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Shared-memory ring benchmark (-ring_benchmark [-consumers=<n>]): the parent
+// produces frames into a ring (see shmRing* in helper_multiprocess.h) and
+// spawned consumer processes take them. Host only, no GPU is needed.
+////////////////////////////////////////////////////////////////////////////////
+#define RING_MAX_CONSUMERS 16
+#define RING_SLOTS 16
+#define RING_MAX_FRAME (1 << 20)
+#define RING_LATENCY_FRAMES 20000
+#define RING_LATENCY_PERIOD_NS 20000ULL
+
+static const char ringName[] = "memmap_ipc_ring";
+static const char ringStatsName[] = "memmap_ipc_ring_stats";
+
+enum { RING_PHASE_THROUGHPUT = 0, RING_PHASE_LATENCY = 1 };
+
+// Header of every frame, the rest of a frame is filled with value.
+typedef struct ringFrame_st {
+  unsigned long long stamp;
+  unsigned int phase;
+  unsigned int value;
+} ringFrame;
+
+typedef struct ringStats_st {
+  int ready;
+  unsigned long long frames[RING_MAX_CONSUMERS];
+  unsigned long long errors[RING_MAX_CONSUMERS];
+  double latencyUs[RING_MAX_CONSUMERS][3];  // median, 99th percentile, max
+} ringStats;
+
+static void ringConsumerProcess(int id) {
+  sharedMemoryInfo info;
+  shmRingInfo ring;
+  std::vector<double> latencies;
+  const void *data;
+  size_t size;
+
+  if (id < 0 || id >= RING_MAX_CONSUMERS ||
+      sharedMemoryOpen(ringStatsName, sizeof(ringStats), &info) != 0 ||
+      shmRingOpen(ringName, &ring) != 0) {
+    printf("Failed to open the ring\n");
+    exit(EXIT_FAILURE);
+  }
+
+  volatile ringStats *stats = (volatile ringStats *)info.addr;
+  latencies.reserve(RING_LATENCY_FRAMES);
+  cpu_atomic_add32(&stats->ready, 1);
+
+  while ((data = shmRingAcquire(&ring, &size)) != NULL) {
+    unsigned long long now = sdkGetTimeNs();
+    const ringFrame *frame = (const ringFrame *)data;
+    const unsigned char *bytes = (const unsigned char *)data;
+    const unsigned char value = (unsigned char)frame->value;
+
+    if (frame->phase == RING_PHASE_LATENCY) {
+      latencies.push_back((double)(now - frame->stamp) * 1e-3);
+    }
+
+    if (size > sizeof(ringFrame) &&
+        (bytes[sizeof(ringFrame)] != value || bytes[size - 1] != value)) {
+      stats->errors[id]++;
+    }
+
+    stats->frames[id]++;
+    shmRingRelease(&ring);
+  }
+
+  if (!latencies.empty()) {
+    std::sort(latencies.begin(), latencies.end());
+    stats->latencyUs[id][0] = latencies[latencies.size() / 2];
+    stats->latencyUs[id][1] = latencies[latencies.size() * 99 / 100];
+    stats->latencyUs[id][2] = latencies.back();
+  }
+
+  shmRingClose(&ring);
+  sharedMemoryClose(&info);
+}
+
+static void ringProduce(shmRingInfo *ring, size_t size, unsigned int phase,
+                        unsigned int value) {
+  unsigned char *bytes = (unsigned char *)shmRingReserve(ring);
+  ringFrame *frame = (ringFrame *)bytes;
+
+  memset(bytes + sizeof(ringFrame), (unsigned char)value,
+         size - sizeof(ringFrame));
+  frame->phase = phase;
+  frame->value = value;
+  frame->stamp = sdkGetTimeNs();
+  shmRingCommit(ring, size);
+}
+
+static void ringBenchmarkParent(char *app, int consumers) {
+  static const size_t frameSizes[] = {64, 4096, 65536, RING_MAX_FRAME};
+  sharedMemoryInfo info;
+  shmRingInfo ring;
+  std::vector<Process> processes;
+  int i;
+
+  if (sharedMemoryCreate(ringStatsName, sizeof(ringStats), &info) != 0 ||
+      shmRingCreate(ringName, RING_MAX_FRAME, RING_SLOTS, &ring) != 0) {
+    printf("Failed to create the ring\n");
+    exit(EXIT_FAILURE);
+  }
+
+  volatile ringStats *stats = (volatile ringStats *)info.addr;
+  memset((void *)stats, 0, sizeof(*stats));
+
+  for (i = 0; i < consumers; i++) {
+    char consumerArg[32];
+    char *const args[] = {app, consumerArg, NULL};
+    Process process;
+
+    SPRINTF(consumerArg, "-ring_consumer=%d", i);
+
+    if (spawnProcess(&process, app, args)) {
+      printf("Failed to create process\n");
+      exit(EXIT_FAILURE);
+    }
+
+    processes.push_back(process);
+  }
+
+  while (stats->ready < consumers) {
+    std::this_thread::yield();
+  }
+
+  printf("Shared-memory ring, %d slots, 1 producer, %d consumer processes\n",
+         RING_SLOTS, consumers);
+
+  for (i = 0; i < (int)(sizeof(frameSizes) / sizeof(frameSizes[0])); i++) {
+    const size_t size = frameSizes[i];
+    const unsigned int frames =
+        std::max<unsigned int>(1024, (unsigned int)((256 << 20) / size));
+
+    unsigned long long start = sdkGetTimeNs();
+
+    for (unsigned int f = 0; f < frames; f++) {
+      ringProduce(&ring, size, RING_PHASE_THROUGHPUT, f);
+    }
+
+    double seconds = (double)(sdkGetTimeNs() - start) * 1e-9;
+    printf("  %8zu-byte frames: %10.0f frames/s %10.1f MB/s\n", size,
+           frames / seconds, frames * (double)size / seconds * 1e-6);
+  }
+
+  // one frame at a time, the consumers time the hand-off
+  unsigned long long sent = 0;
+
+  for (i = 0; i < RING_LATENCY_FRAMES; i++) {
+    while (sdkGetTimeNs() - sent < RING_LATENCY_PERIOD_NS) {
+    }
+
+    sent = sdkGetTimeNs();
+    ringProduce(&ring, sizeof(ringFrame), RING_PHASE_LATENCY, i);
+  }
+
+  shmRingShutdown(&ring);
+
+  for (i = 0; i < (int)processes.size(); i++) {
+    if (waitProcess(&processes[i]) != EXIT_SUCCESS) {
+      printf("Process %d failed!\n", i);
+      exit(EXIT_FAILURE);
+    }
+  }
+
+  bool failed = false;
+
+  for (i = 0; i < consumers; i++) {
+    printf("  consumer %d: %llu frames, latency median %.2f us, p99 %.2f us, "
+           "max %.2f us\n",
+           i, stats->frames[i], stats->latencyUs[i][0], stats->latencyUs[i][1],
+           stats->latencyUs[i][2]);
+
+    if (stats->errors[i] != 0) {
+      printf("  consumer %d: %llu corrupted frames\n", i, stats->errors[i]);
+      failed = true;
+    }
+  }
+
+  shmRingClose(&ring);
+  sharedMemoryClose(&info);
+
+  if (failed) {
+    exit(EXIT_FAILURE);
+  }
+}
+
 // Host code
 int main(int argc, char **argv) {
+  if (checkCmdLineFlag(argc, (const char **)argv, "ring_consumer")) {
+    ringConsumerProcess(
+        getCmdLineArgumentInt(argc, (const char **)argv, "ring_consumer"));
+    return EXIT_SUCCESS;
+  }
+
+  if (checkCmdLineFlag(argc, (const char **)argv, "ring_benchmark")) {
+    int consumers = 2;
+
+    if (checkCmdLineFlag(argc, (const char **)argv, "consumers")) {
+      consumers = getCmdLineArgumentInt(argc, (const char **)argv, "consumers");
+      consumers = std::min(std::max(consumers, 1), RING_MAX_CONSUMERS);
+    }
+
+    ringBenchmarkParent(argv[0], consumers);
+    return EXIT_SUCCESS;
+  }
+
 #if defined(__arm__) || defined(__aarch64__)
   printf("Not supported on ARM\n");
   return EXIT_WAIVED;
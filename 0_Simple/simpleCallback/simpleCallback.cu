@@ -14,38 +14,47 @@
  * Together with the thread safety of the CUDA API implementing heterogeneous workloads that float between CPU threads and GPUs has become simple and efficient.
  *
  * The workloads in the sample follow the form CPU preprocess -> GPU process -> CPU postprocess.
- * Each CPU processing step is handled by its own dedicated thread. GPU workloads are sent to all available GPUs in the system.
+ * The three steps are declared once as a dataflow graph (helper_dataflow.h): the CPU steps run as tasks on a persistent
+ * work-stealing thread pool, the GPU step (H2D, kernel, D2H) is a device stage that reports completion from a stream callback.
+ * Any number of workloads is pipelined through the graph with a bounded number of buffers in flight, each with its own
+ * stream, so the CPU steps of some workloads overlap the GPU step of others. GPU workloads are sent to all available GPUs
+ * in the system.
+ *
+ * -workloads=<n> : number of workloads, 8 by default
+ * -inflight=<n>  : buffers (and streams) in flight, 4 by default
+ * -cpu           : replace the GPU step by its CPU stand-in, no GPU needed
  *
  */
 
 // System includes
 #include <stdio.h>
 
+#include <memory>
+#include <vector>
+
 // helper functions and utilities to work with CUDA
 #include <helper_functions.h>
 #include <helper_cuda.h>
+#include <helper_dataflow.h>
 
-#include "multithreading.h"
-
-const int N_workloads  = 8;
+int N_workloads  = 8;
+int N_inflight = 4;
 const int N_elements_per_workload = 100000;
 
-CUTBarrier thread_barrier;
-
 void CUDART_CB myStreamCallback(cudaStream_t event, cudaError_t status, void *data);
 
+// the buffers of one workload in flight, reused by the next workload
 struct heterogeneous_workload
 {
-    int id;
     int cudaDeviceID;
 
     int *h_data;
     int *d_data;
     cudaStream_t stream;
-
-    bool success;
 };
 
+std::vector<char> success;
+
 __global__
 void incKernel(int *data, int N)
 {
@@ -55,88 +64,95 @@ void incKernel(int *data, int N)
         data[i]++;
 }
 
-CUT_THREADPROC launch(void *void_arg)
+void preprocess(int64_t id, heterogeneous_workload &workload)
 {
-
-    heterogeneous_workload *workload = (heterogeneous_workload *) void_arg;
-
-    // Select GPU for this CPU thread
-    checkCudaErrors(cudaSetDevice(workload->cudaDeviceID));
-
-    // Allocate Resources
-    checkCudaErrors(cudaStreamCreate(&workload->stream));
-    checkCudaErrors(cudaMalloc(&workload->d_data, N_elements_per_workload * sizeof(int)));
-    checkCudaErrors(cudaHostAlloc(&workload->h_data, N_elements_per_workload * sizeof(int), cudaHostAllocPortable));
-
-    // CPU thread generates data
+    // CPU task generates data
     for (int i=0; i < N_elements_per_workload; ++i)
     {
-        workload->h_data[i] = workload->id + i;
+        workload.h_data[i] = (int)id + i;
     }
-
-    // Schedule work for GPU in CUDA stream without blocking the CPU thread
-    // Note: Dedicated streams enable concurrent execution of workloads on the GPU
-    dim3 block(512);
-    dim3 grid((N_elements_per_workload + block.x-1) / block.x);
-
-    checkCudaErrors(cudaMemcpyAsync(workload->d_data, workload->h_data, N_elements_per_workload * sizeof(int), cudaMemcpyHostToDevice, workload->stream));
-    incKernel<<<grid, block,0,workload->stream>>>(workload->d_data, N_elements_per_workload);
-    checkCudaErrors(cudaMemcpyAsync(workload->h_data, workload->d_data, N_elements_per_workload * sizeof(int), cudaMemcpyDeviceToHost, workload->stream));
-
-    // New in CUDA 5.0: Add a CPU callback which is called once all currently pending operations in the CUDA stream have finished
-    checkCudaErrors(cudaStreamAddCallback(workload->stream, myStreamCallback, workload, 0));
-
-    CUT_THREADEND;
-    // CPU thread end of life, GPU continues to process data...
 }
 
-CUT_THREADPROC postprocess(void *void_arg)
+// GPU step: schedules the work in the CUDA stream of the buffer without blocking the CPU thread
+class GpuStage : public SdkDeviceStage<heterogeneous_workload>
 {
-    heterogeneous_workload *workload = (heterogeneous_workload *) void_arg;
-    // ... GPU is done with processing, continue on new CPU thread...
-
-    // Select GPU for this CPU thread
-    checkCudaErrors(cudaSetDevice(workload->cudaDeviceID));
-
-    // CPU thread consumes results from GPU
-    workload->success = true;
+    public:
+        int lanes() const
+        {
+            // Note: Dedicated streams enable concurrent execution of workloads on the GPU
+            return N_inflight;
+        }
 
-    for (int i=0; i< N_workloads; ++i)
-    {
-        workload->success &= workload->h_data[i] == i + workload->id + 1;
-    }
+        void submit(int lane, int64_t id, heterogeneous_workload &workload, std::function<void()> done)
+        {
+            // Select GPU for this CPU thread
+            checkCudaErrors(cudaSetDevice(workload.cudaDeviceID));
 
-    // Free Resources
-    checkCudaErrors(cudaFree(workload->d_data));
-    checkCudaErrors(cudaFreeHost(workload->h_data));
-    checkCudaErrors(cudaStreamDestroy(workload->stream));
+            dim3 block(512);
+            dim3 grid((N_elements_per_workload + block.x-1) / block.x);
 
-    // Signal the end of the heterogeneous workload to main thread
-    cutIncrementBarrier(&thread_barrier);
+            checkCudaErrors(cudaMemcpyAsync(workload.d_data, workload.h_data, N_elements_per_workload * sizeof(int), cudaMemcpyHostToDevice, workload.stream));
+            incKernel<<<grid, block,0,workload.stream>>>(workload.d_data, N_elements_per_workload);
+            checkCudaErrors(cudaMemcpyAsync(workload.h_data, workload.d_data, N_elements_per_workload * sizeof(int), cudaMemcpyDeviceToHost, workload.stream));
 
-    CUT_THREADEND;
-}
+            // New in CUDA 5.0: Add a CPU callback which is called once all currently pending operations in the CUDA stream have finished
+            checkCudaErrors(cudaStreamAddCallback(workload.stream, myStreamCallback, new std::function<void()>(done), 0));
 
+            // CPU task ends, its pool thread moves on while the GPU continues to process data...
+        }
+};
 
 void CUDART_CB myStreamCallback(cudaStream_t stream, cudaError_t status, void *data)
 {
     // Check status of GPU after stream operations are done
     checkCudaErrors(status);
 
-    // Spawn new CPU worker thread and continue processing on the CPU
-    cutStartThread(postprocess, data);
+    // Hand the workload on to its CPU postprocess step. CUDA calls are not allowed
+    // in the callback itself, the executor queues the step on a pool thread
+    std::function<void()> *done = (std::function<void()> *) data;
+    (*done)();
+    delete done;
+}
+
+void postprocess(int64_t id, heterogeneous_workload &workload)
+{
+    // ... GPU is done with processing, continue on a pool thread...
+
+    // CPU task consumes results from GPU
+    bool result = true;
+
+    for (int i=0; i< N_elements_per_workload; ++i)
+    {
+        result &= workload.h_data[i] == i + (int)id + 1;
+    }
+
+    success[id] = result;
 }
 
 
 int main(int argc, char **argv)
 {
-    int N_gpus, max_gpus = 0;
+    int N_gpus = 0, max_gpus = 0;
     int gpuInfo[32]; // assume a maximum of 32 GPUs in a system configuration
+    const bool useCpu = checkCmdLineFlag(argc, (const char **)argv, "cpu");
 
     printf("Starting simpleCallback\n");
 
-    checkCudaErrors(cudaGetDeviceCount(&N_gpus));
-    printf("Found %d CUDA capable GPUs\n", N_gpus);
+    if (checkCmdLineFlag(argc, (const char **)argv, "workloads"))
+    {
+        N_workloads = std::max(1, getCmdLineArgumentInt(argc, (const char **)argv, "workloads"));
+    }
+
+    if (checkCmdLineFlag(argc, (const char **)argv, "inflight"))
+    {
+        N_inflight = std::max(1, getCmdLineArgumentInt(argc, (const char **)argv, "inflight"));
+    }
+
+    if (!useCpu)
+    {
+        checkCudaErrors(cudaGetDeviceCount(&N_gpus));
+        printf("Found %d CUDA capable GPUs\n", N_gpus);
+    }
 
     if (N_gpus > 32)
     {
@@ -159,37 +175,100 @@ int main(int argc, char **argv)
         }
     }
 
-    printf("%d GPUs available to run Callback Functions\n", max_gpus);
+    if (useCpu)
+    {
+        printf("Using the CPU stand-in for the GPU step\n");
+    }
+    else
+    {
+        printf("%d GPUs available to run Callback Functions\n", max_gpus);
 
-    heterogeneous_workload *workloads;
-    workloads = (heterogeneous_workload *) malloc(N_workloads * sizeof(heterogeneous_workload));;
-    thread_barrier = cutCreateBarrier(N_workloads);
+        if (max_gpus == 0)
+        {
+            printf("No GPU can run the GPU step, use -cpu for its CPU stand-in\n");
+            exit(EXIT_WAIVED);
+        }
+    }
 
-    // Main thread spawns a CPU worker thread for each heterogeneous workload
-    printf("Starting %d heterogeneous computing workloads\n", N_workloads);
+    SdkDataflow<heterogeneous_workload> flow(N_inflight);
+    std::shared_ptr<SdkDeviceStage<heterogeneous_workload> > gpuStage;
+    success.assign(N_workloads, 0);
 
-    for (int i=0; i< N_workloads; ++i)
+    // Allocate Resources once per buffer in flight, GPUs round robin
+    for (int s=0; s < N_inflight; ++s)
     {
-        workloads[i].id = i;
-        workloads[i].cudaDeviceID = gpuInfo[i % max_gpus]; // i % N_gpus;
+        heterogeneous_workload &workload = flow.buffer(s);
 
-        cutStartThread(launch, &workloads[i]);
+        if (useCpu)
+        {
+            workload.cudaDeviceID = -1;
+            workload.h_data = (int *) malloc(N_elements_per_workload * sizeof(int));
+            workload.d_data = NULL;
+            workload.stream = 0;
+            continue;
+        }
+
+        workload.cudaDeviceID = gpuInfo[s % max_gpus];
+        checkCudaErrors(cudaSetDevice(workload.cudaDeviceID));
+        checkCudaErrors(cudaStreamCreate(&workload.stream));
+        checkCudaErrors(cudaMalloc(&workload.d_data, N_elements_per_workload * sizeof(int)));
+        checkCudaErrors(cudaHostAlloc(&workload.h_data, N_elements_per_workload * sizeof(int), cudaHostAllocPortable));
+    }
+
+    if (useCpu)
+    {
+        gpuStage.reset(new SdkCpuDeviceStage<heterogeneous_workload>(N_inflight,
+                       [](int64_t, heterogeneous_workload &workload)
+        {
+            for (int i=0; i < N_elements_per_workload; ++i)
+            {
+                workload.h_data[i]++;
+            }
+        }));
+    }
+    else
+    {
+        gpuStage.reset(new GpuStage);
     }
 
-    // Sleep until all workloads have finished
-    cutWaitForBarrier(&thread_barrier);
+    // CPU preprocess -> GPU process -> CPU postprocess
+    int pre  = flow.addCpuStage("preprocess", preprocess, N_inflight);
+    int gpu  = flow.addDeviceStage("GPU process", gpuStage);
+    int post = flow.addCpuStage("postprocess", postprocess, N_inflight);
+    flow.connect(pre, gpu);
+    flow.connect(gpu, post);
+
+    // Main thread streams the workloads through the graph and helps the pool until all have finished
+    printf("Starting %d heterogeneous computing workloads, %d in flight\n", N_workloads, N_inflight);
+    flow.run(N_workloads);
     printf("Total of %d workloads finished:\n", N_workloads);
+    flow.printStats();
 
-    bool success = true;
+    bool result = true;
 
     for (int i=0; i< N_workloads; ++i)
     {
-        success &= workloads[i].success;
+        result &= success[i] != 0;
     }
 
-    printf("%s\n", success ? "Success" : "Failure");
+    printf("%s\n", result ? "Success" : "Failure");
+
+    // Free Resources
+    for (int s=0; s < N_inflight; ++s)
+    {
+        heterogeneous_workload &workload = flow.buffer(s);
+
+        if (useCpu)
+        {
+            free(workload.h_data);
+            continue;
+        }
 
-    free(workloads);
+        checkCudaErrors(cudaSetDevice(workload.cudaDeviceID));
+        checkCudaErrors(cudaFree(workload.d_data));
+        checkCudaErrors(cudaFreeHost(workload.h_data));
+        checkCudaErrors(cudaStreamDestroy(workload.stream));
+    }
 
-    exit(success ? EXIT_SUCCESS : EXIT_FAILURE);
+    exit(result ? EXIT_SUCCESS : EXIT_FAILURE);
 }
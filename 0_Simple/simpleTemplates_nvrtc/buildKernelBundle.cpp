@@ -0,0 +1,148 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Build tool: compiles the variants of a kernel source concurrently into a
+// kernel bundle, see common/inc/helper_nvrtc_bundle.h.
+//
+//   buildKernelBundle <bundle> <source> <variants> [<option> ...]
+//
+// <variants> lists one variant per line as
+//
+//   <key> | <instantiation> | <options>
+//
+// The instantiation is appended to the source (explicit template
+// instantiations or extern "C" wrappers that pick the template arguments),
+// the options are separated by spaces and follow the ones given on the
+// command line, e.g. -I<dir> or --gpu-architecture=sm_80. Empty lines and
+// lines starting with # are skipped. The variants simpleTemplates_nvrtc
+// -bundle builds for an sm_80 device are
+//
+//   testKernel<float>/sm_80 | extern "C" __global__ void testVariant(float
+//       *p1, float *p2) { testKernel<float>(p1, p2); } | --gpu-architecture=sm_80
+//   testKernel<int>/sm_80 | extern "C" __global__ void testVariant(int *p1,
+//       int *p2) { testKernel<int>(p1, p2); } | --gpu-architecture=sm_80
+//
+// (one line each). Compilations go through the kernel cache, so a rebuild
+// only compiles the variants that changed. The tool is not part of the
+// sample build, it is built with
+//
+//   g++ -O2 -I../../common/inc -I<cuda>/include buildKernelBundle.cpp
+//       -o buildKernelBundle -lnvrtc -lcuda
+
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <helper_file.h>
+#include <nvrtc_helper.h>
+
+static std::string trim(const std::string &text) {
+  const size_t b = text.find_first_not_of(" \t\r");
+
+  if (b == std::string::npos) return std::string();
+
+  return text.substr(b, text.find_last_not_of(" \t\r") + 1 - b);
+}
+
+// Parses the variant list; false with a message on stderr if a line is
+// malformed.
+static bool parseVariants(const char *path, const std::string &list,
+                          std::vector<SdkKernelVariant> &variants) {
+  std::istringstream lines(list);
+  std::string line;
+
+  for (int number = 1; std::getline(lines, line); number++) {
+    line = trim(line);
+
+    if (line.empty() || line[0] == '#') continue;
+
+    const size_t first = line.find('|'), last = line.rfind('|');
+
+    if (first == std::string::npos || first == last) {
+      fprintf(stderr, "%s:%d: expected <key> | <instantiation> | <options>\n",
+              path, number);
+      return false;
+    }
+
+    SdkKernelVariant variant;
+    variant.key = trim(line.substr(0, first));
+    variant.instantiation = trim(line.substr(first + 1, last - first - 1));
+
+    if (variant.key.empty()) {
+      fprintf(stderr, "%s:%d: empty variant key\n", path, number);
+      return false;
+    }
+
+    std::istringstream options(line.substr(last + 1));
+    std::string option;
+
+    while (options >> option) variant.options.push_back(option);
+
+    variants.push_back(variant);
+  }
+
+  return true;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 4) {
+    fprintf(stderr,
+            "Usage: %s <bundle> <source> <variants> [<option> ...]\n"
+            "Compiles every variant listed in <variants> as\n"
+            "  <key> | <instantiation> | <options>\n"
+            "from <source> into the kernel bundle <bundle>\n",
+            argv[0]);
+    return 1;
+  }
+
+  std::string source, list;
+
+  if (!sdkReadFile(argv[2], source) || !sdkReadFile(argv[3], list)) {
+    fprintf(stderr, "error: unable to read %s or %s\n", argv[2], argv[3]);
+    return 1;
+  }
+
+  std::vector<SdkKernelVariant> variants;
+
+  if (!parseVariants(argv[3], list, variants)) return 1;
+
+  for (size_t i = 0; i < variants.size(); i++) {
+    std::vector<std::string> options(argv + 4, argv + argc);
+    options.insert(options.end(), variants[i].options.begin(),
+                   variants[i].options.end());
+    variants[i].options.swap(options);
+    variants[i].source = source;
+    variants[i].name = argv[2];
+  }
+
+  SdkNvrtcCompiler compiler;
+  SdkKernelCache &cache = SdkKernelCache::instance();
+  std::string log;
+  std::chrono::high_resolution_clock::time_point t0 =
+      std::chrono::high_resolution_clock::now();
+
+  if (!sdkBuildKernelBundle(compiler, cache, variants, argv[1], log)) {
+    fprintf(stderr, "error: unable to build %s\n%s\n", argv[1], log.c_str());
+    return 1;
+  }
+
+  printf("%s: %d variants, %d compiled, %d from the cache, %.1f ms\n", argv[1],
+         (int)variants.size(), (int)variants.size() - cache.hits(),
+         cache.hits(),
+         std::chrono::duration<double, std::milli>(
+             std::chrono::high_resolution_clock::now() - t0)
+             .count());
+  return 0;
+}
@@ -41,6 +41,76 @@ int g_TotalFailures = 0;
 template <class T>
 void runTest(int argc, char **argv, int len);
 
+static SdkKernelBundle bundle;
+static bool useBundle = false;
+static CUdevice bundleDevice;
+static std::string bundleArch;
+
+template<class T> const char *typeName();
+template<> const char *typeName<float>() { return "float"; }
+template<> const char *typeName<int>() { return "int"; }
+
+// Key of the testKernel<T> variant for the device, e.g. testKernel<int>/sm_80
+template<class T>
+std::string variantKey(const std::string &arch)
+{
+    return std::string("testKernel<") + typeName<T>() + ">/" + arch.substr(arch.rfind('=') + 1);
+}
+
+template<class T>
+SdkKernelVariant makeVariant(const std::string &arch)
+{
+    SdkKernelVariant variant;
+    variant.key = variantKey<T>(arch);
+    variant.instantiation = std::string("extern \"C\" __global__ void testVariant(") +
+                            typeName<T>() + " *p1, " + typeName<T>() + " *p2) { testKernel<" +
+                            typeName<T>() + ">(p1, p2); }";
+    return variant;
+}
+
+// Maps the bundle given by -bundle and builds all variants into it,
+// concurrently, if it lacks one for this device or was built from another
+// kernel source.
+void openVariantBundle(int argc, char **argv)
+{
+    char *bundleFile = 0;
+    getCmdLineArgumentString(argc, (const char **) argv, "bundle", &bundleFile);
+
+    // Picks the best CUDA device available, once for all variants
+    bundleDevice = findCudaDeviceDRV(argc, (const char **) argv);
+    bundleArch = deviceArchitectureOption(bundleDevice);
+
+    std::vector<SdkKernelVariant> variants;
+    variants.push_back(makeVariant<float>(bundleArch));
+    variants.push_back(makeVariant<int>(bundleArch));
+
+    char *kernelFile = sdkFindFilePath("simpleTemplates_kernel.cu", argv[0]);
+    prepareFileVariants(kernelFile, bundleArch, variants);
+
+    if (!bundle.open(bundleFile) || !kernelBundleIsCurrent(bundle, variants))
+    {
+        StopWatchInterface *timer = NULL;
+        sdkCreateTimer(&timer);
+        sdkStartTimer(&timer);
+
+        bundle.close();
+        compileVariantsToBundle(variants, bundleFile);
+
+        sdkStopTimer(&timer);
+        printf("Built %d kernel variants into %s: %f (ms)\n", (int) variants.size(), bundleFile,
+               sdkGetTimerValue(&timer));
+        sdkDeleteTimer(&timer);
+
+        if (!bundle.open(bundleFile))
+        {
+            fprintf(stderr, "Unable to open kernel bundle %s\n", bundleFile);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    useBundle = true;
+}
+
 template<class T>
 void computeGold(T *reference, T *idata, const unsigned int len)
 {
@@ -59,6 +129,13 @@ void computeGold(T *reference, T *idata, const unsigned int len)
 
 int main(int argc, char **argv)
 {
+    // -bundle=<file> loads the kernels from a bundle of template variants,
+    // built first if it lacks the current variants for this device
+    if (checkCmdLineFlag(argc, (const char **) argv, "bundle"))
+    {
+        openVariantBundle(argc, argv);
+    }
+
     printf("> runTest<float,32>\n");
 
     runTest<float>(argc, argv, 32);
@@ -180,7 +257,14 @@ size_t cubinSize;
 template<class T>
 void runTest(int argc, char **argv, int len)
 {
-    if (!moduleLoaded) {
+    // each bundled variant is a module of its own
+    static CUmodule variantModule = NULL;
+
+    if (useBundle && variantModule == NULL) {
+      variantModule = loadBundledCUBIN(bundle, variantKey<T>(bundleArch).c_str(), bundleDevice);
+    }
+
+    if (!useBundle && !moduleLoaded) {
       kernel_file = sdkFindFilePath("simpleTemplates_kernel.cu", argv[0]);
       compileFileToCUBIN(kernel_file, argc, argv, &cubin, &cubinSize, 0);
       module = loadCUBIN(cubin, argc, argv);
@@ -222,7 +306,16 @@ void runTest(int argc, char **argv, int len)
     dim3  threads(num_threads, 1, 1);
 
     // execute the kernel
-    CUfunction kernel_addr = getKernel<T>(module);
+    CUfunction kernel_addr;
+
+    if (useBundle)
+    {
+        checkCudaErrors(cuModuleGetFunction(&kernel_addr, variantModule, "testVariant"));
+    }
+    else
+    {
+        kernel_addr = getKernel<T>(module);
+    }
 
     void *arr[] = { (void *)&d_idata, (void *)&d_odata };
     checkCudaErrors(cuLaunchKernel(kernel_addr,
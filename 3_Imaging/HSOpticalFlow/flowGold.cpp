@@ -16,6 +16,8 @@
 #include "common.h"
 #include "flowGold.h"
 
+#include <helper_arena.h>
+
 ///////////////////////////////////////////////////////////////////////////////
 /// \brief host texture fetch
 ///
@@ -339,25 +341,29 @@ void ComputeFlowGold(const float *I0, const float *I1,
     float *u0 = u;
     float *v0 = v;
 
-    const float **pI0 = new const float *[nLevels];
-    const float **pI1 = new const float *[nLevels];
+    // all scratch memory comes from the arena of this thread and is released
+    // at the end of the call; repeated calls reuse the same memory
+    SdkArenaFrame frame;
+
+    const float **pI0 = frame.alloc<const float *>(nLevels);
+    const float **pI1 = frame.alloc<const float *>(nLevels);
 
-    int *pW = new int [nLevels];
-    int *pH = new int [nLevels];
-    int *pS = new int [nLevels];
+    int *pW = frame.alloc<int>(nLevels);
+    int *pH = frame.alloc<int>(nLevels);
+    int *pS = frame.alloc<int>(nLevels);
 
     const int pixelCountAligned = height * stride;
 
-    float *tmp = new float [pixelCountAligned];
-    float *du0 = new float [pixelCountAligned];
-    float *dv0 = new float [pixelCountAligned];
-    float *du1 = new float [pixelCountAligned];
-    float *dv1 = new float [pixelCountAligned];
-    float *Ix  = new float [pixelCountAligned];
-    float *Iy  = new float [pixelCountAligned];
-    float *Iz  = new float [pixelCountAligned];
-    float *nu  = new float [pixelCountAligned];
-    float *nv  = new float [pixelCountAligned];
+    float *tmp = frame.alloc<float>(pixelCountAligned);
+    float *du0 = frame.alloc<float>(pixelCountAligned);
+    float *dv0 = frame.alloc<float>(pixelCountAligned);
+    float *du1 = frame.alloc<float>(pixelCountAligned);
+    float *dv1 = frame.alloc<float>(pixelCountAligned);
+    float *Ix  = frame.alloc<float>(pixelCountAligned);
+    float *Iy  = frame.alloc<float>(pixelCountAligned);
+    float *Iz  = frame.alloc<float>(pixelCountAligned);
+    float *nu  = frame.alloc<float>(pixelCountAligned);
+    float *nv  = frame.alloc<float>(pixelCountAligned);
 
     // prepare pyramid
     int currentLevel = nLevels - 1;
@@ -373,8 +379,8 @@ void ComputeFlowGold(const float *I0, const float *I1,
         int nw = pW[currentLevel] / 2;
         int nh = pH[currentLevel] / 2;
         int ns = iAlignUp(nw);
-        pI0[currentLevel - 1] = new float [ns * nh];
-        pI1[currentLevel - 1] = new float [ns * nh];
+        pI0[currentLevel - 1] = frame.alloc<float>(ns * nh);
+        pI1[currentLevel - 1] = frame.alloc<float>(ns * nh);
 
         Downscale(pI0[currentLevel], pW[currentLevel], pH[currentLevel],
                   pS[currentLevel], nw, nh, ns, (float *)pI0[currentLevel - 1]);
@@ -453,29 +459,4 @@ void ComputeFlowGold(const float *I0, const float *I1,
         Swap(u, nu);
         Swap(v, nv);
     }
-
-    // cleanup
-    // last level is not being freed here
-    // because it refers to input images
-    for (int i = 0; i < nLevels - 1; ++i)
-    {
-        delete [] pI0[i];
-        delete [] pI1[i];
-    }
-
-    delete [] pI0;
-    delete [] pI1;
-    delete [] pW;
-    delete [] pH;
-    delete [] pS;
-    delete [] tmp;
-    delete [] du0;
-    delete [] dv0;
-    delete [] du1;
-    delete [] dv1;
-    delete [] Ix;
-    delete [] Iy;
-    delete [] Iz;
-    delete [] nu;
-    delete [] nv;
 }
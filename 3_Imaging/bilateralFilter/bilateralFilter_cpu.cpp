@@ -12,6 +12,8 @@
 #include <math.h>
 #include <string.h>
 
+#include <helper_arena.h>
+
 ////////////////////////////////////////////////////////////////////////////////
 // export C interface
 #define EPSILON 1e-3
@@ -104,7 +106,9 @@ void bilateralFilterGold(unsigned int *pSrc,
                          float e_d,
                          int w, int h, int r)
 {
-    float4 *hImage = new float4[w * h];
+    // scratch image from the arena of this thread, reused by later calls
+    SdkArenaFrame frame;
+    float4 *hImage = frame.alloc<float4>(w * h);
     float domainDist, colorDist, factor;
 
     for (int y = 0; y < h; y++)
@@ -162,6 +166,4 @@ void bilateralFilterGold(unsigned int *pSrc,
             pDest[y * w + x] = hrgbaFloatToInt(mul(1 / sum, t));
         }
     }
-
-    delete[] hImage;
 }
@@ -10,6 +10,7 @@
  */
 
 
+#include <helper_profiler.h>
 #include "convolutionSeparable_common.h"
 
 
@@ -26,6 +27,8 @@ extern "C" void convolutionRowCPU(
     int kernelR
 )
 {
+    SDK_PROFILE_ZONE("convolutionRowCPU");
+
     for (int y = 0; y < imageH; y++)
         for (int x = 0; x < imageW; x++)
         {
@@ -57,6 +60,8 @@ extern "C" void convolutionColumnCPU(
     int kernelR
 )
 {
+    SDK_PROFILE_ZONE("convolutionColumnCPU");
+
     for (int y = 0; y < imageH; y++)
         for (int x = 0; x < imageW; x++)
         {
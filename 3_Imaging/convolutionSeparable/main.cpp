@@ -20,6 +20,7 @@
 // Utilities and system includes
 #include <helper_functions.h>
 #include <helper_cuda.h>
+#include <helper_profiler.h>
 
 #include "convolutionSeparable_common.h"
 
@@ -187,6 +188,7 @@ int main(int argc, char **argv)
     free(h_Kernel);
 
     sdkDeleteTimer(&hTimer);
+    sdkProfilerReport();
 
     if (L2norm > 1e-6)
     {
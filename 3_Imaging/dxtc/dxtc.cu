@@ -16,9 +16,11 @@ namespace cg = cooperative_groups;
 
 #include <helper_functions.h>
 #include <helper_cuda.h>
+#include <helper_benchmark.h>
 
 #include <helper_math.h>
 #include <float.h> // for FLT_MAX
+#include <vector>
 
 #include "CudaMath.h"
 #include "dds.h"
@@ -572,6 +574,82 @@ static int compareBlock(const BlockDXT1 *b0, const BlockDXT1 *b1)
     }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// Convert a linear RGBA image of width W to 4x4 blocks of 16 pixels each
+////////////////////////////////////////////////////////////////////////////////
+static void convertToBlockLinear(const uint *image, uint *block_image, uint w, uint h, uint W)
+{
+    for (uint by = 0; by < h/4; by++)
+    {
+        for (uint bx = 0; bx < w/4; bx++)
+        {
+            for (int i = 0; i < 16; i++)
+            {
+                const int x = i & 3;
+                const int y = i / 4;
+                block_image[(by * w/4 + bx) * 16 + i] =
+                    image[(by * 4 + y) * 4 * (W/4) + bx * 4 + x];
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks of the CPU side, input conversion and result check, for
+// -benchmark_cpu on size x size images of random pixels
+////////////////////////////////////////////////////////////////////////////////
+static void benchmarkBlockLinearCPU(SdkBenchmarkState &state)
+{
+    const uint size = (uint)state.param("size");
+    std::vector<uint> image(size * size), block_image(size * size);
+
+    for (size_t i = 0; i < image.size(); i++)
+    {
+        image[i] = (uint)rand();
+    }
+
+    while (state.keepRunning())
+    {
+        convertToBlockLinear(image.data(), block_image.data(), size, size, size);
+        sdkDoNotOptimize(block_image.back());
+    }
+
+    state.setBytesProcessed(2 * image.size() * sizeof(uint));
+}
+
+static void benchmarkCompareBlocksCPU(SdkBenchmarkState &state)
+{
+    const uint size = (uint)state.param("size");
+    std::vector<BlockDXT1> result((size / 4) * (size / 4)), reference(result.size());
+
+    for (size_t i = 0; i < result.size(); i++)
+    {
+        uint words[2] = { (uint)rand(), (uint)rand() };
+        memcpy(&reference[i], words, sizeof(BlockDXT1));
+
+        // a quarter of the blocks differ from the reference
+        words[1] ^= (i % 4 == 0) ? 0x5u : 0u;
+        memcpy(&result[i], words, sizeof(BlockDXT1));
+    }
+
+    while (state.keepRunning())
+    {
+        int rms = 0;
+
+        for (size_t i = 0; i < result.size(); i++)
+        {
+            rms += compareBlock(&result[i], &reference[i]);
+        }
+
+        sdkDoNotOptimize(rms);
+    }
+
+    state.setItemsProcessed(size * size);
+}
+
+SDK_BENCHMARK(benchmarkBlockLinearCPU)->range("size", 256, 4096, 2);
+SDK_BENCHMARK(benchmarkCompareBlocksCPU)->range("size", 256, 4096, 2);
+
 ////////////////////////////////////////////////////////////////////////////////
 // Program main
 ////////////////////////////////////////////////////////////////////////////////
@@ -579,6 +657,11 @@ int main(int argc, char **argv)
 {
     printf("%s Starting...\n\n", argv[0]);
 
+    if (sdkBenchmarkRequested(argc, (const char **)argv))
+    {
+        return sdkRunBenchmarks(argc, (const char **)argv);
+    }
+
     // use command-line specified CUDA device, otherwise use device with highest Gflops/s
     findCudaDevice(argc, (const char **)argv);
 
@@ -611,19 +694,7 @@ int main(int argc, char **argv)
     uint *block_image = (uint *)malloc(memSize);
 
     // Convert linear image to block linear.
-    for (uint by = 0; by < h/4; by++)
-    {
-        for (uint bx = 0; bx < w/4; bx++)
-        {
-            for (int i = 0; i < 16; i++)
-            {
-                const int x = i & 3;
-                const int y = i / 4;
-                block_image[(by * w/4 + bx) * 16 + i] =
-                    ((uint *)data)[(by * 4 + y) * 4 * (W/4) + bx * 4 + x];
-            }
-        }
-    }
+    convertToBlockLinear((uint *)data, block_image, w, h, W);
 
     // copy into global mem
     uint *d_data = NULL;
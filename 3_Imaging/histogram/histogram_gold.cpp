@@ -12,6 +12,7 @@
 
 
 #include <assert.h>
+#include <helper_profiler.h>
 #include "histogram_common.h"
 
 
@@ -22,6 +23,8 @@ extern "C" void histogram64CPU(
     uint byteCount
 )
 {
+    SDK_PROFILE_ZONE("histogram64CPU");
+
     for (uint i = 0; i < HISTOGRAM64_BIN_COUNT; i++)
         h_Histogram[i] = 0;
 
@@ -45,6 +48,8 @@ extern "C" void histogram256CPU(
     uint byteCount
 )
 {
+    SDK_PROFILE_ZONE("histogram256CPU");
+
     for (uint i = 0; i < HISTOGRAM256_BIN_COUNT; i++)
         h_Histogram[i] = 0;
 
@@ -20,6 +20,7 @@
 // Utility and system includes
 #include <helper_cuda.h>
 #include <helper_functions.h>  // helper for shared that are common to CUDA Samples
+#include <helper_profiler.h>
 
 // project include
 #include "histogram_common.h"
@@ -194,6 +195,8 @@ int main(int argc, char **argv)
 
     printf("\nNOTE: The CUDA Samples are not meant for performance measurements. Results may vary when GPU Boost is enabled.\n\n");
 
+    sdkProfilerReport();
+
     printf("%s - Test Summary\n", sSDKsample);
 
     // pass or fail (for both 64 bit and 256 bit histograms)
@@ -26,7 +26,7 @@
 // includes, project
 #include <helper_functions.h> // Helper functions (utilities, parsing, timing)
 #include <helper_cuda.h>      // helper functions (cuda error checking and initialization)
-#include <multithreading.h>
+#include <helper_parallel.h>   // host thread pool
 
 #include "MonteCarlo_common.h"
 
@@ -94,12 +94,12 @@ extern "C" void BlackScholesCall(
 
 
 ////////////////////////////////////////////////////////////////////////////////
-// GPU-driving host thread
+// GPU-driving host task
 ////////////////////////////////////////////////////////////////////////////////
 //Timer
 StopWatchInterface **hTimer = NULL;
 
-static CUT_THREADPROC solverThread(TOptionPlan *plan)
+static void solverThread(TOptionPlan *plan)
 {
     //Init GPU
     checkCudaErrors(cudaSetDevice(plan->device));
@@ -128,8 +128,6 @@ static CUT_THREADPROC solverThread(TOptionPlan *plan)
     cudaStreamSynchronize(0);
 
     printf("solverThread() finished - GPU Device %d: %s\n", plan->device, deviceProp.name);
-
-    CUT_THREADEND;
 }
 
 static void multiSolver(TOptionPlan *plan, int nPlans)
@@ -216,7 +214,7 @@ static void multiSolver(TOptionPlan *plan, int nPlans)
 void usage()
 {
     printf("--method=[threaded,streamed] --scaling=[strong,weak] [--help]\n");
-    printf("Method=threaded: 1 CPU thread for each GPU     [default]\n");
+    printf("Method=threaded: 1 CPU task for each GPU       [default]\n");
     printf("       streamed: 1 CPU thread handles all GPUs (requires CUDA 4.0 or newer)\n");
     printf("Scaling=strong : constant problem size\n");
     printf("        weak   : problem size scales with number of available GPUs [default]\n");
@@ -318,8 +316,6 @@ int main(int argc, char **argv)
     float *callValueBS = new float[OPT_N];
     //Solver config
     TOptionPlan *optionSolver = new TOptionPlan[GPU_N];
-    //OS thread ID
-    CUTThread *threadID = new CUTThread[GPU_N];
 
     int gpuBase, gpuIndex;
     int i;
@@ -351,7 +347,7 @@ int main(int argc, char **argv)
         callValueGPU[i].Confidence = -1.0f;
     }
 
-    printf("main(): starting %i host threads...\n", GPU_N);
+    printf("main(): starting %i host tasks...\n", GPU_N);
 
 
     //Get option count for each GPU
@@ -382,14 +378,17 @@ int main(int argc, char **argv)
 
     if (use_threads || bqatest)
     {
-        //Start CPU thread for each GPU
+        //Queue a CPU task for each GPU on the persistent thread pool
+        SdkTaskGroup solvers(sdkThreadPool());
+
         for (gpuIndex = 0; gpuIndex < GPU_N; gpuIndex++)
         {
-            threadID[gpuIndex] = cutStartThread((CUT_THREADROUTINE)solverThread, &optionSolver[gpuIndex]);
+            TOptionPlan *plan = &optionSolver[gpuIndex];
+            solvers.run([plan]() { solverThread(plan); });
         }
 
         printf("main(): waiting for GPU results...\n");
-        cutWaitForThreads(threadID, GPU_N);
+        solvers.wait();
 
         printf("main(): GPU statistics, threaded\n");
 
@@ -480,26 +479,36 @@ int main(int argc, char **argv)
 
 #ifdef DO_CPU
     printf("main(): running CPU MonteCarlo...\n");
-    TOptionValue callValueCPU;
+    TOptionValue *callValueCPU = new TOptionValue[OPT_N];
     sumDelta = 0;
     sumRef   = 0;
 
+    //Options are independent, one task per option
+    sdkThreadPool().parallelFor(0, OPT_N, 1, [&](int64_t begin, int64_t end)
+    {
+        for (int64_t opt = begin; opt < end; opt++)
+        {
+            MonteCarloCPU(
+                callValueCPU[opt],
+                optionData[opt],
+                NULL,
+                PATH_N
+            );
+        }
+    });
+
     for (i = 0; i < OPT_N; i++)
     {
-        MonteCarloCPU(
-            callValueCPU,
-            optionData[i],
-            NULL,
-            PATH_N
-        );
-        delta     = fabs(callValueCPU.Expected - callValueGPU[i].Expected);
-        ref       = callValueCPU.Expected;
+        delta     = fabs(callValueCPU[i].Expected - callValueGPU[i].Expected);
+        ref       = callValueCPU[i].Expected;
         sumDelta += delta;
         sumRef   += fabs(ref);
-        printf("Exp : %f | %f\t", callValueCPU.Expected,   callValueGPU[i].Expected);
-        printf("Conf: %f | %f\n", callValueCPU.Confidence, callValueGPU[i].Confidence);
+        printf("Exp : %f | %f\t", callValueCPU[i].Expected,   callValueGPU[i].Expected);
+        printf("Conf: %f | %f\n", callValueCPU[i].Confidence, callValueGPU[i].Confidence);
     }
 
+    delete[] callValueCPU;
+
     printf("L1 norm: %E\n", sumDelta / sumRef);
 #endif
 
@@ -515,7 +524,6 @@ int main(int argc, char **argv)
     delete[] callValueBS;
     delete[] callValueGPU;
     delete[] optionData;
-    delete[] threadID;
     delete[] hTimer;
 
     printf("Test Summary...\n");
@@ -25,6 +25,7 @@
 
 #include <helper_functions.h>
 #include <helper_cuda.h>
+#include <helper_profiler.h>
 
 #include "binomialOptions_common.h"
 #include "realtype.h"
@@ -189,6 +190,7 @@ int main(int argc, char **argv)
     printf("Shutting down...\n");
 
     sdkDeleteTimer(&hTimer);
+    sdkProfilerReport();
 
     printf("\nNOTE: The CUDA Samples are not meant for performance measurements. Results may vary when GPU Boost is enabled.\n\n");
 
@@ -13,6 +13,7 @@
 
 #include <stdio.h>
 #include <math.h>
+#include <helper_profiler.h>
 #include "binomialOptions_common.h"
 #include "realtype.h"
 
@@ -48,6 +49,8 @@ extern "C" void BlackScholesCall(
     TOptionData optionData
 )
 {
+    SDK_PROFILE_ZONE("BlackScholesCall");
+
     real S = optionData.S;
     real X = optionData.X;
     real T = optionData.T;
@@ -82,6 +85,8 @@ extern "C" void binomialOptionsCPU(
     TOptionData optionData
 )
 {
+    SDK_PROFILE_ZONE("binomialOptionsCPU");
+
     static real Call[NUM_STEPS + 1];
 
     const real       S = optionData.S;
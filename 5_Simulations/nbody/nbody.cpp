@@ -26,6 +26,7 @@
 #include <cstdlib>
 #include <cstdio>
 #include <algorithm>
+#include <vector>
 #include <assert.h>
 #include <math.h>
 
@@ -33,6 +34,7 @@
 #include <cuda_gl_interop.h>
 #include <helper_cuda.h>
 #include <helper_functions.h>
+#include <helper_benchmark.h>
 
 #include "bodysystemcuda.h"
 #include "bodysystemcpu.h"
@@ -126,6 +128,38 @@ NBodyParams demoParams[] =
 };
 
 int numDemos = sizeof(demoParams) / sizeof(NBodyParams);
+
+////////////////////////////////////////
+// Benchmark of the CPU integrator for -benchmark_cpu
+////////////////////////////////////////
+template <typename T>
+void benchmarkBodySystemCPU(SdkBenchmarkState &state)
+{
+    const int n = (int)state.param("bodies");
+    const NBodyParams &params = demoParams[0];
+    std::vector<T> pos(n * 4), vel(n * 4);
+    std::vector<float> color(n * 4);
+
+    randomizeBodies(NBODY_CONFIG_SHELL, pos.data(), vel.data(), color.data(),
+                    params.m_clusterScale, params.m_velocityScale, n, true);
+
+    BodySystemCPU<T> system(n);
+    system.setSoftening(params.m_softening);
+    system.setDamping(params.m_damping);
+    system.setArray(BODYSYSTEM_POSITION, pos.data());
+    system.setArray(BODYSYSTEM_VELOCITY, vel.data());
+
+    while (state.keepRunning())
+    {
+        system.update(params.m_timestep);
+    }
+
+    // body-body interactions per step
+    state.setItemsProcessed((int64_t)n * n);
+}
+
+SDK_BENCHMARK(benchmarkBodySystemCPU<float>)->range("bodies", 1024, 8192, 2);
+SDK_BENCHMARK(benchmarkBodySystemCPU<double>)->range("bodies", 1024, 8192, 2);
 bool cycleDemo = true;
 int activeDemo = 0;
 float demoTime = 10000.0f; // ms
@@ -1029,6 +1063,7 @@ showHelp()
     printf("\t-fp64             (use double precision floating point values for simulation)\n");
     printf("\t-hostmem          (stores simulation data in host memory)\n");
     printf("\t-benchmark        (run benchmark to measure performance) \n");
+    printf("\t-benchmark_cpu    (benchmark the CPU integrator, no GPU needed, see helper_benchmark.h)\n");
     printf("\t-numbodies=<N>    (number of bodies (>= 1) to run in simulation) \n");
     printf("\t-device=<d>       (where d=0,1,2.... for the CUDA device to use)\n");
     printf("\t-numdevices=<i>   (where i=(number of CUDA devices > 0) to use for simulation)\n");
@@ -1056,6 +1091,11 @@ main(int argc, char **argv)
         return 0;
     }
 
+    if (sdkBenchmarkRequested(argc, (const char **)argv))
+    {
+        return sdkRunBenchmarks(argc, (const char **)argv);
+    }
+
     printf("Run \"nbody -benchmark [-numbodies=<numBodies>]\" to measure performance.\n");
     showHelp();
 
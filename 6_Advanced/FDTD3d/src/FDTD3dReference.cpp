@@ -17,6 +17,8 @@
 #include <iomanip>
 #include <stdio.h>
 
+#include <helper_arena.h>
+
 
 void generateRandomData(float *data, const int dimx, const int dimy, const int dimz, const float lowerBound, const float upperBound)
 {
@@ -63,9 +65,12 @@ bool fdtdReference(float *output, const float *input, const float *coeff, const
     float        *bufdst       = 0;
     float        *bufdstnext   = 0;
 
-    // Allocate temporary buffer
-    printf(" calloc intermediate\n");
-    intermediate = (float *)calloc(volumeSize, sizeof(float));
+    // Allocate temporary buffer from the scratch arena of this thread; the
+    // whole volume is written by the first timestep that reads it, so it
+    // needs no clearing, and repeated calls reuse the same memory
+    printf(" allocate intermediate\n");
+    SdkArenaFrame frame;
+    intermediate = frame.alloc<float>(volumeSize);
 
     // Decide which buffer to use first (result should end up in output)
     if ((timesteps % 2) == 0)
@@ -129,9 +134,6 @@ bool fdtdReference(float *output, const float *input, const float *coeff, const
 
     printf("\n");
 
-    if (intermediate)
-        free(intermediate);
-
     return true;
 }
 
@@ -27,6 +27,7 @@
 
 #include <cuda_runtime.h>
 #include <helper_cuda.h>
+#include <helper_jacobi.h>
 #include <helper_timer.h>
 #include <math.h>
 #include <stdio.h>
@@ -50,15 +51,18 @@ extern double JacobiMethodGpu(const float *A, const double *b,
                               const float conv_threshold, const int max_iter,
                               double *x, double *x_new, cudaStream_t stream);
 
-// creates N_ROWS x N_ROWS matrix A with N_ROWS+1 on the diagonal and 1
-// elsewhere. The elements of the right hand side b all equal 2*n, hence the
-// exact solution x to A*x = b is a vector of ones.
-void createLinearSystem(float *A, double *b);
+// creates n x n matrix A with n+1 on the diagonal and 1 elsewhere. The
+// elements of the right hand side b all equal 2*n, hence the exact solution x
+// to A*x = b is a vector of ones.
+void createLinearSystem(float *A, double *b, int n);
 
 // Run the Jacobi method for A*x = b on CPU.
 void JacobiMethodCPU(float *A, double *b, float conv_threshold, int max_iter,
                      int *numit, double *x);
 
+// Run the multithreaded CPU solvers on systems of runtime size, no GPU needed.
+int runCpuBenchmark(int argc, char **argv);
+
 int main(int argc, char **argv) {
   if (checkCmdLineFlag(argc, (const char **)argv, "help")) {
     printf("Command line: jacobiCudaGraphs [-option]\n");
@@ -69,10 +73,21 @@ int main(int argc, char **argv) {
     printf("                       : 1 - JacobiMethodGpuCudaGraphExecUpdate\n");
     printf("                       : 2 - JacobiMethodGpu - Non CUDA Graph\n");
     printf("-device=device_num     : cuda device id");
+    printf("-cpu                   : CPU solvers only (Jacobi, red-black\n");
+    printf("                         Gauss-Seidel and SOR), dense and CSR\n");
+    printf("  -n=<rows>            : dense system size (default 2048)\n");
+    printf("  -grid=<n>            : n x n grid for the CSR system "
+           "(default 1024)\n");
+    printf("  -omega=<w>           : SOR relaxation factor (default 1.5)\n");
+    printf("  -maxiter=<sweeps>    : sweep limit (default 1000)\n");
     printf("-help         : Output a help message\n");
     exit(EXIT_SUCCESS);
   }
 
+  if (checkCmdLineFlag(argc, (const char **)argv, "cpu")) {
+    exit(runCpuBenchmark(argc, argv));
+  }
+
   int gpumethod = 0;
   if (checkCmdLineFlag(argc, (const char **)argv, "gpumethod")) {
     gpumethod = getCmdLineArgumentInt(argc, (const char **)argv, "gpumethod");
@@ -93,7 +108,7 @@ int main(int argc, char **argv) {
   checkCudaErrors(cudaMallocHost(&A, N_ROWS * N_ROWS * sizeof(float)));
   memset(A, 0, N_ROWS * N_ROWS * sizeof(float));
 
-  createLinearSystem(A, b);
+  createLinearSystem(A, b, N_ROWS);
   double *x = NULL;
   // start with array of all zeroes
   x = (double *)calloc(N_ROWS, sizeof(double));
@@ -169,35 +184,180 @@ int main(int argc, char **argv) {
   return (fabs(sum - sumGPU) < conv_threshold) ? EXIT_SUCCESS : EXIT_FAILURE;
 }
 
-void createLinearSystem(float *A, double *b) {
-  int i, j;
-  for (i = 0; i < N_ROWS; i++) {
-    b[i] = 2.0 * N_ROWS;
-    for (j = 0; j < N_ROWS; j++) A[i * N_ROWS + j] = 1.0;
-    A[i * N_ROWS + i] = N_ROWS + 1.0;
+void createLinearSystem(float *A, double *b, int n) {
+  for (int i = 0; i < n; i++) {
+    b[i] = 2.0 * n;
+    for (int j = 0; j < n; j++) A[(size_t)i * n + j] = 1.0;
+    A[(size_t)i * n + i] = n + 1.0;
   }
 }
 
 void JacobiMethodCPU(float *A, double *b, float conv_threshold, int max_iter,
                      int *num_iter, double *x) {
-  double *x_new;
-  x_new = (double *)calloc(N_ROWS, sizeof(double));
-  int k;
-
-  for (k = 0; k < max_iter; k++) {
-    double sum = 0.0;
-    for (int i = 0; i < N_ROWS; i++) {
-      double temp_dx = b[i];
-      for (int j = 0; j < N_ROWS; j++) temp_dx -= A[i * N_ROWS + j] * x[j];
-      temp_dx /= A[i * N_ROWS + i];
-      x_new[i] += temp_dx;
-      sum += fabs(temp_dx);
+  StationarySolver<StationaryDenseMatrix> solver;
+  solver.setup(StationaryDenseMatrix(N_ROWS, A), STATIONARY_JACOBI);
+  StationaryStats stats = solver.solve(b, x, conv_threshold, max_iter);
+  *num_iter = stats.iterations;
+}
+
+// 5-point Laplacian on a grid x grid mesh with 5 on the diagonal, so that all
+// three methods converge in a reasonable number of sweeps. b = A * ones.
+static void createCsrSystem(int grid, std::vector<int> &rowPtr,
+                            std::vector<int> &colInd, std::vector<float> &val,
+                            std::vector<double> &b) {
+  const int n = grid * grid;
+  rowPtr.assign(1, 0);
+  colInd.clear();
+  val.clear();
+  b.assign(n, 0.0);
+
+  for (int i = 0; i < n; i++) {
+    const int ix = i % grid, iy = i / grid;
+    const int nbr[5] = {iy > 0 ? i - grid : -1, ix > 0 ? i - 1 : -1, i,
+                        ix < grid - 1 ? i + 1 : -1,
+                        iy < grid - 1 ? i + grid : -1};
+
+    for (int k = 0; k < 5; k++) {
+      if (nbr[k] < 0) continue;
+      colInd.push_back(nbr[k]);
+      val.push_back(nbr[k] == i ? 5.0f : -1.0f);
+      b[i] += val.back();
+    }
+
+    rowPtr.push_back((int)colInd.size());
+  }
+}
+
+template <typename Matrix>
+static int runCpuSolvers(const Matrix &A, const double *b, int n,
+                         float conv_threshold, int max_iter, double omega,
+                         double flops, double bytes) {
+  const StationaryMethod methods[] = {STATIONARY_JACOBI,
+                                      STATIONARY_GAUSS_SEIDEL, STATIONARY_SOR};
+  std::vector<double> x(n);
+  int nErrors = 0;
+
+  for (int m = 0; m < 3; m++) {
+    StationarySolver<Matrix> solver;
+
+    if (solver.setup(A, methods[m], omega) != 0) {
+      printf("  %-24s setup failed\n", stationaryMethodName(methods[m]));
+      nErrors++;
+      continue;
+    }
+
+    std::fill(x.begin(), x.end(), 0.0);
+    StationaryStats stats = solver.solve(b, x.data(), conv_threshold, max_iter);
+    double err = 0.0;
+
+    for (int i = 0; i < n; i++) err += fabs(x[i] - 1.0);
+
+    stationaryPrintStats(stationaryMethodName(methods[m]), n, stats, flops,
+                         bytes);
+    printf("  %-24s error = %.3e\n", "", err);
+    nErrors += isfinite(err) ? 0 : 1;
+  }
+
+  return nErrors;
+}
+
+// Runs sweeps sweeps of every method on one thread and on a team of at least
+// four, and checks that the iterates agree: the Gauss-Seidel/SOR sweeps over
+// a dense matrix must stay sequential however many threads share them.
+template <typename Matrix>
+static int checkThreadCounts(const Matrix &A, const double *b, int n,
+                             double omega, int sweeps) {
+  const StationaryMethod methods[] = {STATIONARY_JACOBI,
+                                      STATIONARY_GAUSS_SEIDEL, STATIONARY_SOR};
+  const int numThreads = std::max(sdkGetNumThreads(), 4);
+  std::vector<double> x1(n), xN(n);
+  int nErrors = 0;
+
+  for (int m = 0; m < 3; m++) {
+    StationarySolver<Matrix> solver;
+    std::fill(x1.begin(), x1.end(), 0.0);
+    std::fill(xN.begin(), xN.end(), 0.0);
+    sdkSetNumThreads(1);
+    solver.setup(A, methods[m], omega);
+    solver.solve(b, x1.data(), 0.0, sweeps);
+    sdkSetNumThreads(numThreads);
+    solver.setup(A, methods[m], omega);
+    solver.solve(b, xN.data(), 0.0, sweeps);
+    sdkSetNumThreads(0);
+    double diff = 0.0, norm = 0.0;
+
+    for (int i = 0; i < n; i++) {
+      diff = std::max(diff, fabs(x1[i] - xN[i]));
+      norm = std::max(norm, fabs(x1[i]));
     }
 
-    for (int i = 0; i < N_ROWS; i++) x[i] = x_new[i];
+    const bool ok = diff <= 1e-10 * std::max(norm, 1.0);
+    printf("  %-24s 1 vs %d threads, %d sweeps: max diff = %.3e %s\n",
+           stationaryMethodName(methods[m]), numThreads, sweeps, diff,
+           ok ? "" : "(MISMATCH)");
+    nErrors += ok ? 0 : 1;
+  }
+
+  return nErrors;
+}
+
+int runCpuBenchmark(int argc, char **argv) {
+  int n = 2048, grid = 1024, max_iter = 1000;
+  double omega = 1.5;
+  float conv_threshold = 1.0e-2f;
+
+  if (checkCmdLineFlag(argc, (const char **)argv, "n")) {
+    n = getCmdLineArgumentInt(argc, (const char **)argv, "n");
+  }
+
+  if (checkCmdLineFlag(argc, (const char **)argv, "grid")) {
+    grid = getCmdLineArgumentInt(argc, (const char **)argv, "grid");
+  }
+
+  if (checkCmdLineFlag(argc, (const char **)argv, "maxiter")) {
+    max_iter = getCmdLineArgumentInt(argc, (const char **)argv, "maxiter");
+  }
+
+  if (checkCmdLineFlag(argc, (const char **)argv, "omega")) {
+    omega = getCmdLineArgumentFloat(argc, (const char **)argv, "omega");
+  }
 
-    if (sum <= conv_threshold) break;
+  if (n < 2 || grid < 2 || max_iter < 1) {
+    printf("Error: invalid problem size or sweep limit\n");
+    return EXIT_FAILURE;
   }
-  *num_iter = k + 1;
-  free(x_new);
+
+  int nErrors = 0;
+  printf("CPU solvers on %d threads, tolerance %.1e, at most %d sweeps\n",
+         sdkGetNumThreads(), conv_threshold, max_iter);
+
+  // dense system of the GPU path at runtime size
+  float *A = (float *)malloc(sizeof(float) * n * n);
+  double *b = (double *)malloc(sizeof(double) * n);
+  createLinearSystem(A, b, n);
+  printf("Dense %d x %d:\n", n, n);
+  nErrors += runCpuSolvers(StationaryDenseMatrix(n, A), b, n, conv_threshold,
+                           max_iter, omega, 2.0 * n * n,
+                           sizeof(float) * (double)n * n);
+  nErrors += checkThreadCounts(StationaryDenseMatrix(n, A), b, n, omega, 10);
+  free(A);
+  free(b);
+
+  // sparse 5-point system
+  std::vector<int> rowPtr, colInd;
+  std::vector<float> val;
+  std::vector<double> bCsr;
+  createCsrSystem(grid, rowPtr, colInd, val, bCsr);
+  const int rows = grid * grid, nnz = (int)colInd.size();
+  printf("CSR %d x %d grid, nnz = %d:\n", grid, grid, nnz);
+  CsrMatrixView<float> csr(rows, rows, nnz, rowPtr.data(), colInd.data(),
+                           val.data());
+  nErrors += runCpuSolvers(StationaryCsrMatrix(csr), bCsr.data(), rows,
+                           1.0e-6f * rows,
+                           max_iter, omega, 2.0 * nnz,
+                           (sizeof(float) + sizeof(int)) * (double)nnz +
+                               3.0 * sizeof(double) * rows);
+
+  printf("&&&& jacobiCudaGraphs -cpu %s\n", nErrors ? "FAILED" : "PASSED");
+  return nErrors ? EXIT_FAILURE : EXIT_SUCCESS;
 }
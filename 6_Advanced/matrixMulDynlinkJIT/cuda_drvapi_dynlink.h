@@ -15,4 +15,355 @@
 
 #include "cuda_drvapi_dynlink_cuda.h"
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Driver entry points bound lazily.  cuInit only loads the driver library
+ * and calls its cuInit; every other entry point (cuDeviceGet, ...) starts out
+ * pointing at a stub that looks the symbol up on its first call, publishes
+ * it once with an atomic compare-and-swap, and rebinds the global pointer so
+ * later calls go straight to the driver.
+ *
+ * The lookups go through a CUdriverLoader, so a test can substitute a fake
+ * library, and each CUdriverTable is an independent set of bindings: the
+ * global entry points use a table of their own, other tables are queried
+ * with cuDriverTableGetProc.
+ *
+ * X(name, v2, v3, params, args) lists an entry point; name_v2 (name_v3) is
+ * bound instead of name when the requested CUDA version is at least v2 (v3),
+ * 0 meaning never.
+ */
+#define CU_DRIVER_PROCS(X)                                                                          \
+    X(cuDriverGetVersion, 0, 0, (int *driverVersion), (driverVersion))                              \
+    X(cuDeviceGet, 0, 0, (CUdevice *device, int ordinal), (device, ordinal))                        \
+    X(cuDeviceGetCount, 0, 0, (int *count), (count))                                                \
+    X(cuDeviceGetName, 0, 0, (char *name, int len, CUdevice dev), (name, len, dev))                 \
+    X(cuDeviceComputeCapability, 0, 0,                                                              \
+      (int *major, int *minor, CUdevice dev),                                                       \
+      (major, minor, dev))                                                                          \
+    X(cuDeviceTotalMem, 3020, 0, (size_t *bytes, CUdevice dev), (bytes, dev))                       \
+    X(cuDeviceGetProperties, 0, 0, (CUdevprop *prop, CUdevice dev), (prop, dev))                    \
+    X(cuDeviceGetAttribute, 0, 0,                                                                   \
+      (int *pi, CUdevice_attribute attrib, CUdevice dev),                                           \
+      (pi, attrib, dev))                                                                            \
+    X(cuGetErrorString, 0, 0, (CUresult error, const char **pStr), (error, pStr))                   \
+    X(cuCtxCreate, 3020, 0,                                                                         \
+      (CUcontext *pctx, unsigned int flags, CUdevice dev),                                          \
+      (pctx, flags, dev))                                                                           \
+    X(cuCtxDestroy, 4000, 0, (CUcontext ctx), (ctx))                                                \
+    X(cuCtxAttach, 0, 0, (CUcontext *pctx, unsigned int flags), (pctx, flags))                      \
+    X(cuCtxDetach, 0, 0, (CUcontext ctx), (ctx))                                                    \
+    X(cuCtxPushCurrent, 4000, 0, (CUcontext ctx), (ctx))                                            \
+    X(cuCtxPopCurrent, 4000, 0, (CUcontext *pctx), (pctx))                                          \
+    X(cuCtxGetCurrent, 0, 0, (CUcontext *pctx), (pctx))                                             \
+    X(cuCtxSetCurrent, 0, 0, (CUcontext ctx), (ctx))                                                \
+    X(cuCtxGetDevice, 0, 0, (CUdevice *device), (device))                                           \
+    X(cuCtxSynchronize, 0, 0, (void), ())                                                           \
+    X(cuModuleLoad, 0, 0, (CUmodule *module, const char *fname), (module, fname))                   \
+    X(cuModuleLoadData, 0, 0, (CUmodule *module, const void *image), (module, image))               \
+    X(cuModuleLoadDataEx, 0, 0,                                                                     \
+      (CUmodule *module, const void *image, unsigned int numOptions, CUjit_option *options,         \
+       void **optionValues),                                                                        \
+      (module, image, numOptions, options, optionValues))                                           \
+    X(cuModuleLoadFatBinary, 0, 0, (CUmodule *module, const void *fatCubin), (module, fatCubin))    \
+    X(cuModuleUnload, 0, 0, (CUmodule hmod), (hmod))                                                \
+    X(cuModuleGetFunction, 0, 0,                                                                    \
+      (CUfunction *hfunc, CUmodule hmod, const char *name),                                         \
+      (hfunc, hmod, name))                                                                          \
+    X(cuModuleGetGlobal, 3020, 0,                                                                   \
+      (CUdeviceptr *dptr, size_t *bytes, CUmodule hmod, const char *name),                          \
+      (dptr, bytes, hmod, name))                                                                    \
+    X(cuModuleGetTexRef, 0, 0,                                                                      \
+      (CUtexref *pTexRef, CUmodule hmod, const char *name),                                         \
+      (pTexRef, hmod, name))                                                                        \
+    X(cuModuleGetSurfRef, 0, 0,                                                                     \
+      (CUsurfref *pSurfRef, CUmodule hmod, const char *name),                                       \
+      (pSurfRef, hmod, name))                                                                       \
+    X(cuMemGetInfo, 3020, 0, (size_t *free, size_t *total), (free, total))                          \
+    X(cuMemAlloc, 3020, 0, (CUdeviceptr *dptr, size_t bytesize), (dptr, bytesize))                  \
+    X(cuMemAllocPitch, 3020, 0,                                                                     \
+      (CUdeviceptr *dptr, size_t *pPitch, size_t WidthInBytes, size_t Height,                       \
+       unsigned int ElementSizeBytes),                                                              \
+      (dptr, pPitch, WidthInBytes, Height, ElementSizeBytes))                                       \
+    X(cuMemFree, 3020, 0, (CUdeviceptr dptr), (dptr))                                               \
+    X(cuMemGetAddressRange, 3020, 0,                                                                \
+      (CUdeviceptr *pbase, size_t *psize, CUdeviceptr dptr),                                        \
+      (pbase, psize, dptr))                                                                         \
+    X(cuMemAllocHost, 3020, 0, (void **pp, size_t bytesize), (pp, bytesize))                        \
+    X(cuMemFreeHost, 0, 0, (void *p), (p))                                                          \
+    X(cuMemHostAlloc, 0, 0,                                                                         \
+      (void **pp, size_t bytesize, unsigned int Flags),                                             \
+      (pp, bytesize, Flags))                                                                        \
+    X(cuMemHostGetFlags, 0, 0, (unsigned int *pFlags, void *p), (pFlags, p))                        \
+    X(cuMemHostGetDevicePointer, 3020, 0,                                                           \
+      (CUdeviceptr *pdptr, void *p, unsigned int Flags),                                            \
+      (pdptr, p, Flags))                                                                            \
+    X(cuDeviceGetByPCIBusId, 0, 0, (CUdevice *dev, char *pciBusId), (dev, pciBusId))                \
+    X(cuDeviceGetPCIBusId, 0, 0, (char *pciBusId, int len, CUdevice dev), (pciBusId, len, dev))     \
+    X(cuIpcGetEventHandle, 0, 0, (CUipcEventHandle *pHandle, CUevent event), (pHandle, event))      \
+    X(cuIpcOpenEventHandle, 0, 0, (CUevent *phEvent, CUipcEventHandle handle), (phEvent, handle))   \
+    X(cuIpcGetMemHandle, 0, 0, (CUipcMemHandle *pHandle, CUdeviceptr dptr), (pHandle, dptr))        \
+    X(cuIpcOpenMemHandle, 0, 0,                                                                     \
+      (CUdeviceptr *pdptr, CUipcMemHandle handle, unsigned int Flags),                              \
+      (pdptr, handle, Flags))                                                                       \
+    X(cuIpcCloseMemHandle, 0, 0, (CUdeviceptr dptr), (dptr))                                        \
+    X(cuMemHostRegister, 0, 0,                                                                      \
+      (void *p, size_t bytesize, unsigned int Flags),                                               \
+      (p, bytesize, Flags))                                                                         \
+    X(cuMemHostUnregister, 0, 0, (void *p), (p))                                                    \
+    X(cuMemcpyHtoD, 3020, 0,                                                                        \
+      (CUdeviceptr dstDevice, const void *srcHost, size_t ByteCount),                               \
+      (dstDevice, srcHost, ByteCount))                                                              \
+    X(cuMemcpyDtoH, 3020, 0,                                                                        \
+      (void *dstHost, CUdeviceptr srcDevice, size_t ByteCount),                                     \
+      (dstHost, srcDevice, ByteCount))                                                              \
+    X(cuMemcpyDtoD, 3020, 0,                                                                        \
+      (CUdeviceptr dstDevice, CUdeviceptr srcDevice, size_t ByteCount),                             \
+      (dstDevice, srcDevice, ByteCount))                                                            \
+    X(cuMemcpyDtoA, 3020, 0,                                                                        \
+      (CUarray dstArray, size_t dstOffset, CUdeviceptr srcDevice, size_t ByteCount),                \
+      (dstArray, dstOffset, srcDevice, ByteCount))                                                  \
+    X(cuMemcpyAtoD, 3020, 0,                                                                        \
+      (CUdeviceptr dstDevice, CUarray srcArray, size_t srcOffset, size_t ByteCount),                \
+      (dstDevice, srcArray, srcOffset, ByteCount))                                                  \
+    X(cuMemcpyHtoA, 3020, 0,                                                                        \
+      (CUarray dstArray, size_t dstOffset, const void *srcHost, size_t ByteCount),                  \
+      (dstArray, dstOffset, srcHost, ByteCount))                                                    \
+    X(cuMemcpyAtoH, 3020, 0,                                                                        \
+      (void *dstHost, CUarray srcArray, size_t srcOffset, size_t ByteCount),                        \
+      (dstHost, srcArray, srcOffset, ByteCount))                                                    \
+    X(cuMemcpyAtoA, 3020, 0,                                                                        \
+      (CUarray dstArray, size_t dstOffset, CUarray srcArray, size_t srcOffset, size_t ByteCount),   \
+      (dstArray, dstOffset, srcArray, srcOffset, ByteCount))                                        \
+    X(cuMemcpy2D, 3020, 0, (const CUDA_MEMCPY2D *pCopy), (pCopy))                                   \
+    X(cuMemcpy2DUnaligned, 3020, 0, (const CUDA_MEMCPY2D *pCopy), (pCopy))                          \
+    X(cuMemcpy3D, 3020, 0, (const CUDA_MEMCPY3D *pCopy), (pCopy))                                   \
+    X(cuMemcpyHtoDAsync, 3020, 0,                                                                   \
+      (CUdeviceptr dstDevice, const void *srcHost, size_t ByteCount, CUstream hStream),             \
+      (dstDevice, srcHost, ByteCount, hStream))                                                     \
+    X(cuMemcpyDtoHAsync, 3020, 0,                                                                   \
+      (void *dstHost, CUdeviceptr srcDevice, size_t ByteCount, CUstream hStream),                   \
+      (dstHost, srcDevice, ByteCount, hStream))                                                     \
+    X(cuMemcpyDtoDAsync, 0, 0,                                                                      \
+      (CUdeviceptr dstDevice, CUdeviceptr srcDevice, size_t ByteCount, CUstream hStream),           \
+      (dstDevice, srcDevice, ByteCount, hStream))                                                   \
+    X(cuMemcpyHtoAAsync, 3020, 0,                                                                   \
+      (CUarray dstArray, size_t dstOffset, const void *srcHost, size_t ByteCount,                   \
+      CUstream hStream),                                                                            \
+      (dstArray, dstOffset, srcHost, ByteCount, hStream))                                           \
+    X(cuMemcpyAtoHAsync, 3020, 0,                                                                   \
+      (void *dstHost, CUarray srcArray, size_t srcOffset, size_t ByteCount, CUstream hStream),      \
+      (dstHost, srcArray, srcOffset, ByteCount, hStream))                                           \
+    X(cuMemcpy2DAsync, 3020, 0, (const CUDA_MEMCPY2D *pCopy, CUstream hStream), (pCopy, hStream))   \
+    X(cuMemcpy3DAsync, 3020, 0, (const CUDA_MEMCPY3D *pCopy, CUstream hStream), (pCopy, hStream))   \
+    X(cuMemcpy, 0, 0, (CUdeviceptr dst, CUdeviceptr src, size_t ByteCount), (dst, src, ByteCount))  \
+    X(cuMemcpyPeer, 0, 0,                                                                           \
+      (CUdeviceptr dstDevice, CUcontext dstContext, CUdeviceptr srcDevice, CUcontext srcContext,    \
+       size_t ByteCount),                                                                           \
+      (dstDevice, dstContext, srcDevice, srcContext, ByteCount))                                    \
+    X(cuMemsetD8, 3020, 0,                                                                          \
+      (CUdeviceptr dstDevice, unsigned char uc, unsigned int N),                                    \
+      (dstDevice, uc, N))                                                                           \
+    X(cuMemsetD16, 3020, 0,                                                                         \
+      (CUdeviceptr dstDevice, unsigned short us, unsigned int N),                                   \
+      (dstDevice, us, N))                                                                           \
+    X(cuMemsetD32, 3020, 0,                                                                         \
+      (CUdeviceptr dstDevice, unsigned int ui, unsigned int N),                                     \
+      (dstDevice, ui, N))                                                                           \
+    X(cuMemsetD2D8, 3020, 0,                                                                        \
+      (CUdeviceptr dstDevice, unsigned int dstPitch, unsigned char uc, size_t Width,                \
+       size_t Height),                                                                              \
+      (dstDevice, dstPitch, uc, Width, Height))                                                     \
+    X(cuMemsetD2D16, 3020, 0,                                                                       \
+      (CUdeviceptr dstDevice, unsigned int dstPitch, unsigned short us, size_t Width,               \
+       size_t Height),                                                                              \
+      (dstDevice, dstPitch, us, Width, Height))                                                     \
+    X(cuMemsetD2D32, 3020, 0,                                                                       \
+      (CUdeviceptr dstDevice, unsigned int dstPitch, unsigned int ui, size_t Width, size_t Height), \
+      (dstDevice, dstPitch, ui, Width, Height))                                                     \
+    X(cuFuncSetBlockShape, 0, 0, (CUfunction hfunc, int x, int y, int z), (hfunc, x, y, z))         \
+    X(cuFuncSetSharedSize, 0, 0, (CUfunction hfunc, unsigned int bytes), (hfunc, bytes))            \
+    X(cuFuncGetAttribute, 0, 0,                                                                     \
+      (int *pi, CUfunction_attribute attrib, CUfunction hfunc),                                     \
+      (pi, attrib, hfunc))                                                                          \
+    X(cuFuncSetCacheConfig, 0, 0, (CUfunction hfunc, CUfunc_cache config), (hfunc, config))         \
+    X(cuFuncSetSharedMemConfig, 0, 0, (CUfunction hfunc, CUsharedconfig config), (hfunc, config))   \
+    X(cuLaunchKernel, 0, 0,                                                                         \
+      (CUfunction f, unsigned int gridDimX, unsigned int gridDimY, unsigned int gridDimZ,           \
+       unsigned int blockDimX, unsigned int blockDimY, unsigned int blockDimZ,                      \
+       unsigned int sharedMemBytes, CUstream hStream, void **kernelParams, void **extra),           \
+      (f, gridDimX, gridDimY, gridDimZ, blockDimX, blockDimY, blockDimZ, sharedMemBytes, hStream,   \
+       kernelParams, extra))                                                                        \
+    X(cuArrayCreate, 3020, 0,                                                                       \
+      (CUarray *pHandle, const CUDA_ARRAY_DESCRIPTOR *pAllocateArray),                              \
+      (pHandle, pAllocateArray))                                                                    \
+    X(cuArrayGetDescriptor, 3020, 0,                                                                \
+      (CUDA_ARRAY_DESCRIPTOR *pArrayDescriptor, CUarray hArray),                                    \
+      (pArrayDescriptor, hArray))                                                                   \
+    X(cuArrayDestroy, 0, 0, (CUarray hArray), (hArray))                                             \
+    X(cuArray3DCreate, 3020, 0,                                                                     \
+      (CUarray *pHandle, const CUDA_ARRAY3D_DESCRIPTOR *pAllocateArray),                            \
+      (pHandle, pAllocateArray))                                                                    \
+    X(cuArray3DGetDescriptor, 3020, 0,                                                              \
+      (CUDA_ARRAY3D_DESCRIPTOR *pArrayDescriptor, CUarray hArray),                                  \
+      (pArrayDescriptor, hArray))                                                                   \
+    X(cuTexRefCreate, 0, 0, (CUtexref *pTexRef), (pTexRef))                                         \
+    X(cuTexRefDestroy, 0, 0, (CUtexref hTexRef), (hTexRef))                                         \
+    X(cuTexRefSetArray, 0, 0,                                                                       \
+      (CUtexref hTexRef, CUarray hArray, unsigned int Flags),                                       \
+      (hTexRef, hArray, Flags))                                                                     \
+    X(cuTexRefSetAddress, 3020, 0,                                                                  \
+      (size_t *ByteOffset, CUtexref hTexRef, CUdeviceptr dptr, size_t bytes),                       \
+      (ByteOffset, hTexRef, dptr, bytes))                                                           \
+    X(cuTexRefSetAddress2D, 3020, 4010,                                                             \
+      (CUtexref hTexRef, const CUDA_ARRAY_DESCRIPTOR *desc, CUdeviceptr dptr, size_t Pitch),        \
+      (hTexRef, desc, dptr, Pitch))                                                                 \
+    X(cuTexRefSetFormat, 0, 0,                                                                      \
+      (CUtexref hTexRef, CUarray_format fmt, int NumPackedComponents),                              \
+      (hTexRef, fmt, NumPackedComponents))                                                          \
+    X(cuTexRefSetAddressMode, 0, 0,                                                                 \
+      (CUtexref hTexRef, int dim, CUaddress_mode am),                                               \
+      (hTexRef, dim, am))                                                                           \
+    X(cuTexRefSetFilterMode, 0, 0, (CUtexref hTexRef, CUfilter_mode fm), (hTexRef, fm))             \
+    X(cuTexRefSetFlags, 0, 0, (CUtexref hTexRef, unsigned int Flags), (hTexRef, Flags))             \
+    X(cuTexRefGetAddress, 3020, 0, (CUdeviceptr *pdptr, CUtexref hTexRef), (pdptr, hTexRef))        \
+    X(cuTexRefGetArray, 0, 0, (CUarray *phArray, CUtexref hTexRef), (phArray, hTexRef))             \
+    X(cuTexRefGetAddressMode, 0, 0,                                                                 \
+      (CUaddress_mode *pam, CUtexref hTexRef, int dim),                                             \
+      (pam, hTexRef, dim))                                                                          \
+    X(cuTexRefGetFilterMode, 0, 0, (CUfilter_mode *pfm, CUtexref hTexRef), (pfm, hTexRef))          \
+    X(cuTexRefGetFormat, 0, 0,                                                                      \
+      (CUarray_format *pFormat, int *pNumChannels, CUtexref hTexRef),                               \
+      (pFormat, pNumChannels, hTexRef))                                                             \
+    X(cuTexRefGetFlags, 0, 0, (unsigned int *pFlags, CUtexref hTexRef), (pFlags, hTexRef))          \
+    X(cuSurfRefSetArray, 0, 0,                                                                      \
+      (CUsurfref hSurfRef, CUarray hArray, unsigned int Flags),                                     \
+      (hSurfRef, hArray, Flags))                                                                    \
+    X(cuSurfRefGetArray, 0, 0, (CUarray *phArray, CUsurfref hSurfRef), (phArray, hSurfRef))         \
+    X(cuParamSetSize, 0, 0, (CUfunction hfunc, unsigned int numbytes), (hfunc, numbytes))           \
+    X(cuParamSeti, 0, 0,                                                                            \
+      (CUfunction hfunc, int offset, unsigned int value),                                           \
+      (hfunc, offset, value))                                                                       \
+    X(cuParamSetf, 0, 0, (CUfunction hfunc, int offset, float value), (hfunc, offset, value))       \
+    X(cuParamSetv, 0, 0,                                                                            \
+      (CUfunction hfunc, int offset, void *ptr, unsigned int numbytes),                             \
+      (hfunc, offset, ptr, numbytes))                                                               \
+    X(cuParamSetTexRef, 0, 0,                                                                       \
+      (CUfunction hfunc, int texunit, CUtexref hTexRef),                                            \
+      (hfunc, texunit, hTexRef))                                                                    \
+    X(cuLaunch, 0, 0, (CUfunction f), (f))                                                          \
+    X(cuLaunchGrid, 0, 0,                                                                           \
+      (CUfunction f, int grid_width, int grid_height),                                              \
+      (f, grid_width, grid_height))                                                                 \
+    X(cuLaunchGridAsync, 0, 0,                                                                      \
+      (CUfunction f, int grid_width, int grid_height, CUstream hStream),                            \
+      (f, grid_width, grid_height, hStream))                                                        \
+    X(cuEventCreate, 0, 0, (CUevent *phEvent, unsigned int Flags), (phEvent, Flags))                \
+    X(cuEventRecord, 0, 0, (CUevent hEvent, CUstream hStream), (hEvent, hStream))                   \
+    X(cuEventQuery, 0, 0, (CUevent hEvent), (hEvent))                                               \
+    X(cuEventSynchronize, 0, 0, (CUevent hEvent), (hEvent))                                         \
+    X(cuEventDestroy, 4000, 0, (CUevent hEvent), (hEvent))                                          \
+    X(cuEventElapsedTime, 0, 0,                                                                     \
+      (float *pMilliseconds, CUevent hStart, CUevent hEnd),                                         \
+      (pMilliseconds, hStart, hEnd))                                                                \
+    X(cuStreamCreate, 0, 0, (CUstream *phStream, unsigned int Flags), (phStream, Flags))            \
+    X(cuStreamWaitEvent, 0, 0,                                                                      \
+      (CUstream hStream, CUevent hEvent, unsigned int Flags),                                       \
+      (hStream, hEvent, Flags))                                                                     \
+    X(cuStreamAddCallback, 0, 0,                                                                    \
+      (CUstream hStream, CUstreamCallback callback, void *userData, unsigned int flags),            \
+      (hStream, callback, userData, flags))                                                         \
+    X(cuStreamQuery, 0, 0, (CUstream hStream), (hStream))                                           \
+    X(cuStreamSynchronize, 0, 0, (CUstream hStream), (hStream))                                     \
+    X(cuStreamDestroy, 4000, 0, (CUstream hStream), (hStream))                                      \
+    X(cuGraphicsUnregisterResource, 0, 0, (CUgraphicsResource resource), (resource))                \
+    X(cuGraphicsSubResourceGetMappedArray, 0, 0,                                                    \
+      (CUarray *pArray, CUgraphicsResource resource, unsigned int arrayIndex,                       \
+       unsigned int mipLevel),                                                                      \
+      (pArray, resource, arrayIndex, mipLevel))                                                     \
+    X(cuGraphicsResourceGetMappedPointer, 3020, 0,                                                  \
+      (CUdeviceptr *pDevPtr, size_t *pSize, CUgraphicsResource resource),                           \
+      (pDevPtr, pSize, resource))                                                                   \
+    X(cuGraphicsResourceSetMapFlags, 0, 0,                                                          \
+      (CUgraphicsResource resource, unsigned int flags),                                            \
+      (resource, flags))                                                                            \
+    X(cuGraphicsMapResources, 0, 0,                                                                 \
+      (unsigned int count, CUgraphicsResource *resources, CUstream hStream),                        \
+      (count, resources, hStream))                                                                  \
+    X(cuGraphicsUnmapResources, 0, 0,                                                               \
+      (unsigned int count, CUgraphicsResource *resources, CUstream hStream),                        \
+      (count, resources, hStream))                                                                  \
+    X(cuGetExportTable, 0, 0,                                                                       \
+      (const void **ppExportTable, const CUuuid *pExportTableId),                                   \
+      (ppExportTable, pExportTableId))                                                              \
+    X(cuCtxSetLimit, 0, 0, (CUlimit limit, size_t value), (limit, value))                           \
+    X(cuCtxGetLimit, 0, 0, (size_t *pvalue, CUlimit limit), (pvalue, limit))                        \
+    X(cuCtxGetCacheConfig, 0, 0, (CUfunc_cache *pconfig), (pconfig))                                \
+    X(cuCtxSetCacheConfig, 0, 0, (CUfunc_cache config), (config))                                   \
+    X(cuCtxGetSharedMemConfig, 0, 0, (CUsharedconfig *pConfig), (pConfig))                          \
+    X(cuCtxSetSharedMemConfig, 0, 0, (CUsharedconfig config), (config))                             \
+    X(cuCtxGetApiVersion, 0, 0, (CUcontext ctx, unsigned int *version), (ctx, version))             \
+    X(cuMipmappedArrayCreate, 0, 0,                                                                 \
+      (CUmipmappedArray *pHandle, const CUDA_ARRAY3D_DESCRIPTOR *pMipmappedArrayDesc,               \
+       unsigned int numMipmapLevels),                                                               \
+      (pHandle, pMipmappedArrayDesc, numMipmapLevels))                                              \
+    X(cuMipmappedArrayGetLevel, 0, 0,                                                               \
+      (CUarray *pLevelArray, CUmipmappedArray hMipmappedArray, unsigned int level),                 \
+      (pLevelArray, hMipmappedArray, level))                                                        \
+    X(cuMipmappedArrayDestroy, 0, 0, (CUmipmappedArray hMipmappedArray), (hMipmappedArray))         \
+    X(cuProfilerStop, 0, 0, (void), ())
+
+typedef enum CUdriverProc_enum
+{
+#define CU_DRIVER_PROC_ENUM(name, v2, v3, params, args) CU_DRIVER_PROC_##name,
+    CU_DRIVER_PROCS(CU_DRIVER_PROC_ENUM)
+#undef CU_DRIVER_PROC_ENUM
+    CU_DRIVER_PROC_COUNT
+} CUdriverProc;
+
+// Where the driver comes from: load returns a library handle (NULL on
+// failure), getProc a symbol of it (NULL if missing), unload may be NULL.
+typedef struct CUdriverLoader_st
+{
+    const char *name;
+    void *(*load)(const char *name);
+    void *(*getProc)(void *library, const char *symbol);
+    void (*unload)(void *library);
+} CUdriverLoader;
+
+// One set of bindings; zero-initialize before cuDriverTableInit.
+typedef struct CUdriverTable_st
+{
+    const CUdriverLoader *loader;
+    void *library;
+    int cudaVersion;
+    tcuInit *init;
+    void *volatile procs[CU_DRIVER_PROC_COUNT];
+} CUdriverTable;
+
+// The platform loader: nvcuda.dll, libcuda.so.1 or libcuda.dylib.
+extern const CUdriverLoader cuDriverDefaultLoader;
+
+// Loads the library of loader into table and calls its cuInit.
+CUresult CUDAAPI cuDriverTableInit(CUdriverTable *table, const CUdriverLoader *loader,
+                                   unsigned int Flags, int cudaVersion);
+
+// Entry point proc of table, looked up on the first request; NULL if the
+// library does not have it. A missing entry point is reported on the first
+// request only.
+void *cuDriverTableGetProc(CUdriverTable *table, CUdriverProc proc);
+
+// Unloads the library of table and forgets its bindings.
+void cuDriverTableClose(CUdriverTable *table);
+
+// cuInit with the global entry points bound through loader.
+CUresult CUDAAPI cuInitWithLoader(const CUdriverLoader *loader, unsigned int Flags,
+                                  int cudaVersion);
+
+#ifdef __cplusplus
+}
+#endif
+
 #endif //__cuda_drvapi_dynlink_h__
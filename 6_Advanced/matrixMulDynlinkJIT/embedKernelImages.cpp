@@ -0,0 +1,189 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Build tool: embeds kernel images (PTX, CUBIN, fatbins) compressed into a
+// C source with a table of SdkKernelImage entries, see
+// common/inc/helper_kernel_images.h.
+//
+//   embedKernelImages <table> <name>=<file> [<name>=<file> ...]
+//
+// writes <table>.c and <table>.h; the header declares
+//
+//   extern const SdkKernelImage <table>[];
+//   extern const int <table>_count;
+//
+// An image that does not get smaller is stored as is. The tool is not part
+// of the sample build, matrixMul_kernel_images.c/.h were generated with
+//
+//   g++ -O2 -I../../common/inc embedKernelImages.cpp -o embedKernelImages
+//   ./embedKernelImages matrixMul_kernel_images
+//       matrixMul_kernel_32=matrixMul_kernel_32.ptx
+//       matrixMul_kernel_64=matrixMul_kernel_64.ptx
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+
+#include <helper_kernel_images.h>
+
+static const char *sCopyright =
+    "/**\n"
+    " * Copyright 2021 NVIDIA Corporation.  All rights reserved.\n"
+    " *\n"
+    " * Please refer to the NVIDIA end user license agreement (EULA) "
+    "associated\n"
+    " * with this source code for terms and conditions that govern your use "
+    "of\n"
+    " * this software. Any use, reproduction, disclosure, or distribution of\n"
+    " * this software and related documentation outside the terms of the "
+    "EULA\n"
+    " * is strictly prohibited.\n"
+    " *\n"
+    " */\n\n"
+    "///////////////////////////////////////////////////////////////////////"
+    "/////////\n"
+    "// This file is auto-generated by embedKernelImages, do not edit\n"
+    "///////////////////////////////////////////////////////////////////////"
+    "/////////\n";
+
+struct Image {
+  std::string name;
+  std::vector<unsigned char> data;
+  unsigned int size;
+};
+
+static bool readImage(const char *path, std::vector<unsigned char> &data) {
+  FILE *f = fopen(path, "rb");
+
+  if (f == NULL) return false;
+
+  unsigned char buffer[1 << 16];
+  size_t n;
+
+  while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+    data.insert(data.end(), buffer, buffer + n);
+  }
+
+  bool ok = !ferror(f);
+  fclose(f);
+  return ok;
+}
+
+static bool writeSource(const std::string &table,
+                        const std::vector<Image> &images) {
+  const std::string path = table + ".c";
+  FILE *f = fopen(path.c_str(), "w");
+
+  if (f == NULL) return false;
+
+  fprintf(f, "%s#include \"%s.h\"\n", sCopyright, table.c_str());
+
+  for (size_t i = 0; i < images.size(); i++) {
+    const std::vector<unsigned char> &data = images[i].data;
+    fprintf(f, "\nstatic const unsigned char %s_data[%u] = {",
+            images[i].name.c_str(), (unsigned int)data.size());
+
+    for (size_t j = 0; j < data.size(); j++) {
+      fprintf(f, "%s0x%02x%s", (j % 12) ? " " : "\n    ", data[j],
+              (j + 1 < data.size()) ? "," : "");
+    }
+
+    fprintf(f, "\n};\n");
+  }
+
+  fprintf(f, "\nconst SdkKernelImage %s[] = {\n", table.c_str());
+
+  for (size_t i = 0; i < images.size(); i++) {
+    fprintf(f, "    {\"%s\", %s_data, %u, %u},\n", images[i].name.c_str(),
+            images[i].name.c_str(), (unsigned int)images[i].data.size(),
+            images[i].size);
+  }
+
+  fprintf(f, "};\n\nconst int %s_count = %d;\n", table.c_str(),
+          (int)images.size());
+  return fclose(f) == 0;
+}
+
+static bool writeHeader(const std::string &table) {
+  const std::string path = table + ".h";
+  FILE *f = fopen(path.c_str(), "w");
+
+  if (f == NULL) return false;
+
+  const char *t = table.c_str();
+  fprintf(f,
+          "%s#ifndef __%s_h__\n#define __%s_h__\n\n"
+          "#include <helper_kernel_images.h>\n\n"
+          "#if defined __cplusplus\nextern \"C\" {\n#endif\n\n"
+          "extern const SdkKernelImage %s[];\nextern const int %s_count;\n\n"
+          "#if defined __cplusplus\n}\n#endif\n\n#endif  // __%s_h__\n",
+          sCopyright, t, t, t, t, t);
+  return fclose(f) == 0;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 3) {
+    fprintf(stderr,
+            "Usage: %s <table> <name>=<file> [<name>=<file> ...]\n"
+            "Writes the images compressed to <table>.c and <table>.h\n",
+            argv[0]);
+    return 1;
+  }
+
+  const std::string table = argv[1];
+  std::vector<Image> images;
+
+  for (int i = 2; i < argc; i++) {
+    const char *eq = strchr(argv[i], '=');
+
+    if (eq == NULL || eq == argv[i]) {
+      fprintf(stderr, "error: expected <name>=<file>, got %s\n", argv[i]);
+      return 1;
+    }
+
+    Image image;
+    image.name.assign(argv[i], eq - argv[i]);
+    std::vector<unsigned char> raw;
+
+    if (!readImage(eq + 1, raw) || raw.empty()) {
+      fprintf(stderr, "error: unable to read %s or it is empty\n", eq + 1);
+      return 1;
+    }
+
+    image.size = (unsigned int)raw.size();
+    image.data = sdkLzCompress(raw.data(), raw.size());
+
+    // check the round trip, and keep incompressible images as they are
+    std::vector<unsigned char> check(raw.size() + 1);
+
+    if (image.data.size() >= raw.size()) {
+      image.data = raw;
+    } else if (!sdkLzDecompress(image.data.data(), image.data.size(),
+                                check.data(), raw.size()) ||
+               memcmp(check.data(), raw.data(), raw.size()) != 0) {
+      fprintf(stderr, "error: %s does not round trip\n", eq + 1);
+      return 1;
+    }
+
+    printf("%s: %u -> %u bytes\n", image.name.c_str(), image.size,
+           (unsigned int)image.data.size());
+    images.push_back(image);
+  }
+
+  if (!writeSource(table, images) || !writeHeader(table)) {
+    fprintf(stderr, "error: unable to write %s.c/.h\n", table.c_str());
+    return 1;
+  }
+
+  return 0;
+}
@@ -19,6 +19,9 @@
  * how to perform JIT (just-in-time) compilation of CUDA kernel from PTX image,
  * stored in memory.
  *
+ * The PTX images are embedded compressed by embedKernelImages.cpp and are
+ * decoded on first use (see helper_kernel_images.h).
+ *
  * For more details on acquiring auto-generated sources refer README.TXT file
  * in "extras" directory.
  *
@@ -38,8 +41,7 @@
 
 // includes, project
 #include "matrixMul.h"
-#include "matrixMul_kernel_32_ptxdump.h"
-#include "matrixMul_kernel_64_ptxdump.h"
+#include "matrixMul_kernel_images.h"
 
 extern "C" void computeGold(float *, const float *, const float *, unsigned int, unsigned int, unsigned int);
 
@@ -174,12 +176,23 @@ CUresult initCUDA(int argc, char **argv, CUfunction *pMatrixMul, int *block_size
         // compile with set parameters
         printf("> Compiling CUDA module\n");
 
+        // the PTX is embedded compressed and decoded on first use
+        static SdkKernelImageTable kernelImages(matrixMul_kernel_images, matrixMul_kernel_images_count);
 #if defined(_WIN64) || defined(__LP64__)
-        status = cuModuleLoadDataEx(&cuModule, matrixMul_kernel_64_ptxdump, jitNumOptions, jitOptions, (void **)jitOptVals);
+        const void *ptx = kernelImages.get("matrixMul_kernel_64");
 #else
-        status = cuModuleLoadDataEx(&cuModule, matrixMul_kernel_32_ptxdump, jitNumOptions, jitOptions, (void **)jitOptVals);
+        const void *ptx = kernelImages.get("matrixMul_kernel_32");
 #endif
 
+        if (ptx == NULL)
+        {
+            printf("Error while decoding the embedded PTX\n");
+            cuCtxDestroy(g_cuContext);
+            exit(EXIT_FAILURE);
+        }
+
+        status = cuModuleLoadDataEx(&cuModule, ptx, jitNumOptions, jitOptions, (void **)jitOptVals);
+
         printf("> PTX JIT log:\n%s\n", jitLogBuffer);
 
         delete [] jitOptions;
@@ -1,1635 +0,0 @@
-/*
- * Copyright 1993-2013 NVIDIA Corporation.  All rights reserved.
- *
- * NVIDIA Corporation and its licensors retain all intellectual property and
- * proprietary rights in and to this software and related documentation.
- * Any use, reproduction, disclosure, or distribution of this software
- * and related documentation without an express license agreement from
- * NVIDIA Corporation is strictly prohibited.
- *
- * Please refer to the applicable NVIDIA end user license agreement (EULA)
- * associated with this source code for terms and conditions that govern
- * your use of this NVIDIA software.
- *
- */
-
-////////////////////////////////////////////////////////////////////////////////
-// This file is auto-generated, do not edit
-////////////////////////////////////////////////////////////////////////////////
-#include "matrixMul_kernel_32_ptxdump.h"
-
-unsigned char matrixMul_kernel_32_ptxdump[25784] =
-{
-    0x09, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x34, 0x0a, 0x09, 0x2e,
-    0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x73, 0x6d, 0x5f, 0x31, 0x30, 0x2c, 0x20, 0x6d, 0x61,
-    0x70, 0x5f, 0x66, 0x36, 0x34, 0x5f, 0x74, 0x6f, 0x5f, 0x66, 0x33, 0x32, 0x0a, 0x09, 0x2f, 0x2f,
-    0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x43,
-    0x3a, 0x5c, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x5c,
-    0x4e, 0x56, 0x49, 0x44, 0x49, 0x41, 0x20, 0x47, 0x50, 0x55, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x75,
-    0x74, 0x69, 0x6e, 0x67, 0x20, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x43, 0x55, 0x44,
-    0x41, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x5c, 0x62, 0x69, 0x6e, 0x2f, 0x2e, 0x2e, 0x2f, 0x6f,
-    0x70, 0x65, 0x6e, 0x36, 0x34, 0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x2f, 0x62, 0x65, 0x2e, 0x65, 0x78,
-    0x65, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x6e, 0x76, 0x6f, 0x70, 0x65, 0x6e, 0x63, 0x63, 0x20, 0x34,
-    0x2e, 0x30, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x20, 0x6f, 0x6e, 0x20, 0x32, 0x30, 0x31, 0x31,
-    0x2d, 0x30, 0x32, 0x2d, 0x32, 0x31, 0x0a, 0x0a, 0x09, 0x2f, 0x2f, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x69,
-    0x6c, 0x69, 0x6e, 0x67, 0x20, 0x43, 0x3a, 0x2f, 0x55, 0x73, 0x65, 0x72, 0x73, 0x2f, 0x45, 0x59,
-    0x4f, 0x55, 0x4e, 0x47, 0x7e, 0x31, 0x2e, 0x43, 0x4f, 0x4d, 0x2f, 0x41, 0x70, 0x70, 0x44, 0x61,
-    0x74, 0x61, 0x2f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x54, 0x65, 0x6d, 0x70, 0x2f, 0x74, 0x6d,
-    0x70, 0x78, 0x66, 0x74, 0x5f, 0x30, 0x30, 0x30, 0x30, 0x31, 0x34, 0x63, 0x30, 0x5f, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2d, 0x31, 0x31, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78,
-    0x4d, 0x75, 0x6c, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x2e, 0x63, 0x70, 0x70, 0x33, 0x2e,
-    0x69, 0x20, 0x28, 0x43, 0x3a, 0x2f, 0x55, 0x73, 0x65, 0x72, 0x73, 0x2f, 0x45, 0x59, 0x4f, 0x55,
-    0x4e, 0x47, 0x7e, 0x31, 0x2e, 0x43, 0x4f, 0x4d, 0x2f, 0x41, 0x70, 0x70, 0x44, 0x61, 0x74, 0x61,
-    0x2f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x54, 0x65, 0x6d, 0x70, 0x2f, 0x63, 0x63, 0x42, 0x49,
-    0x23, 0x2e, 0x61, 0x30, 0x34, 0x30, 0x30, 0x30, 0x29, 0x0a, 0x09, 0x2f, 0x2f, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x0a, 0x09, 0x2f, 0x2f, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x4f, 0x70, 0x74,
-    0x69, 0x6f, 0x6e, 0x73, 0x3a, 0x0a, 0x09, 0x2f, 0x2f, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x20, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74,
-    0x3a, 0x70, 0x74, 0x78, 0x2c, 0x20, 0x49, 0x53, 0x41, 0x3a, 0x73, 0x6d, 0x5f, 0x31, 0x30, 0x2c,
-    0x20, 0x45, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x3a, 0x6c, 0x69, 0x74, 0x74, 0x6c, 0x65, 0x2c, 0x20,
-    0x50, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72, 0x20, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x33, 0x32, 0x0a,
-    0x09, 0x2f, 0x2f, 0x20, 0x20, 0x2d, 0x4f, 0x33, 0x09, 0x28, 0x4f, 0x70, 0x74, 0x69, 0x6d, 0x69,
-    0x7a, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x29, 0x0a, 0x09, 0x2f,
-    0x2f, 0x20, 0x20, 0x2d, 0x67, 0x30, 0x09, 0x28, 0x44, 0x65, 0x62, 0x75, 0x67, 0x20, 0x6c, 0x65,
-    0x76, 0x65, 0x6c, 0x29, 0x0a, 0x09, 0x2f, 0x2f, 0x20, 0x20, 0x2d, 0x6d, 0x32, 0x09, 0x28, 0x52,
-    0x65, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x61, 0x64, 0x76, 0x69, 0x73, 0x6f, 0x72, 0x69, 0x65, 0x73,
-    0x29, 0x0a, 0x09, 0x2f, 0x2f, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d, 0x2d,
-    0x0a, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x31, 0x09, 0x22, 0x43, 0x3a, 0x2f, 0x55,
-    0x73, 0x65, 0x72, 0x73, 0x2f, 0x45, 0x59, 0x4f, 0x55, 0x4e, 0x47, 0x7e, 0x31, 0x2e, 0x43, 0x4f,
-    0x4d, 0x2f, 0x41, 0x70, 0x70, 0x44, 0x61, 0x74, 0x61, 0x2f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x2f,
-    0x54, 0x65, 0x6d, 0x70, 0x2f, 0x74, 0x6d, 0x70, 0x78, 0x66, 0x74, 0x5f, 0x30, 0x30, 0x30, 0x30,
-    0x31, 0x34, 0x63, 0x30, 0x5f, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2d, 0x31, 0x30,
-    0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65,
-    0x6c, 0x2e, 0x63, 0x75, 0x64, 0x61, 0x66, 0x65, 0x32, 0x2e, 0x67, 0x70, 0x75, 0x22, 0x0a, 0x09,
-    0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x32, 0x09, 0x22, 0x43, 0x3a, 0x5c, 0x76, 0x73, 0x32, 0x30,
-    0x30, 0x35, 0x5c, 0x56, 0x43, 0x5c, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x45, 0x5c, 0x63, 0x72,
-    0x74, 0x64, 0x65, 0x66, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09,
-    0x33, 0x09, 0x22, 0x43, 0x3a, 0x2f, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x46, 0x69,
-    0x6c, 0x65, 0x73, 0x2f, 0x4e, 0x56, 0x49, 0x44, 0x49, 0x41, 0x20, 0x47, 0x50, 0x55, 0x20, 0x43,
-    0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74,
-    0x2f, 0x43, 0x55, 0x44, 0x41, 0x2f, 0x76, 0x34, 0x2e, 0x30, 0x2f, 0x2f, 0x69, 0x6e, 0x63, 0x6c,
-    0x75, 0x64, 0x65, 0x5c, 0x63, 0x72, 0x74, 0x2f, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x5f, 0x72,
-    0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65,
-    0x09, 0x34, 0x09, 0x22, 0x43, 0x3a, 0x2f, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x46,
-    0x69, 0x6c, 0x65, 0x73, 0x2f, 0x4e, 0x56, 0x49, 0x44, 0x49, 0x41, 0x20, 0x47, 0x50, 0x55, 0x20,
-    0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69,
-    0x74, 0x2f, 0x43, 0x55, 0x44, 0x41, 0x2f, 0x76, 0x34, 0x2e, 0x30, 0x2f, 0x2f, 0x69, 0x6e, 0x63,
-    0x6c, 0x75, 0x64, 0x65, 0x5c, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65,
-    0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x35, 0x09, 0x22, 0x43,
-    0x3a, 0x2f, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x2f,
-    0x4e, 0x56, 0x49, 0x44, 0x49, 0x41, 0x20, 0x47, 0x50, 0x55, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x75,
-    0x74, 0x69, 0x6e, 0x67, 0x20, 0x54, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x2f, 0x43, 0x55, 0x44,
-    0x41, 0x2f, 0x76, 0x34, 0x2e, 0x30, 0x2f, 0x2f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c,
-    0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2e, 0x68, 0x22,
-    0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x36, 0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72,
-    0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64,
-    0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67,
-    0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34,
-    0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x64, 0x65, 0x76, 0x69, 0x63,
-    0x65, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c,
-    0x65, 0x09, 0x37, 0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20,
-    0x66, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75,
-    0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b,
-    0x69, 0x74, 0x5c, 0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63,
-    0x6c, 0x75, 0x64, 0x65, 0x5c, 0x64, 0x72, 0x69, 0x76, 0x65, 0x72, 0x5f, 0x74, 0x79, 0x70, 0x65,
-    0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x38, 0x09, 0x22, 0x63,
-    0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5c,
-    0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75,
-    0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75, 0x64,
-    0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x73,
-    0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2e, 0x68, 0x22, 0x0a,
-    0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x39, 0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f,
-    0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69,
-    0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20,
-    0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e,
-    0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72,
-    0x65, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c,
-    0x65, 0x09, 0x31, 0x30, 0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d,
-    0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70,
-    0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c,
-    0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e,
-    0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x5f, 0x74, 0x79, 0x70,
-    0x65, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x31, 0x31, 0x09,
-    0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c, 0x65,
-    0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f, 0x6d,
-    0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x63,
-    0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65,
-    0x5c, 0x62, 0x75, 0x69, 0x6c, 0x74, 0x69, 0x6e, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2e, 0x68,
-    0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x31, 0x32, 0x09, 0x22, 0x63, 0x3a, 0x5c,
-    0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x6e, 0x76,
-    0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69,
-    0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75, 0x64, 0x61, 0x5c,
-    0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x68, 0x6f, 0x73,
-    0x74, 0x5f, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66,
-    0x69, 0x6c, 0x65, 0x09, 0x31, 0x33, 0x09, 0x22, 0x43, 0x3a, 0x2f, 0x50, 0x72, 0x6f, 0x67, 0x72,
-    0x61, 0x6d, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x2f, 0x4e, 0x56, 0x49, 0x44, 0x49, 0x41, 0x20,
-    0x47, 0x50, 0x55, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x54, 0x6f,
-    0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x2f, 0x43, 0x55, 0x44, 0x41, 0x2f, 0x76, 0x34, 0x2e, 0x30, 0x2f,
-    0x2f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x5f,
-    0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x5f, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72,
-    0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x31, 0x34, 0x09, 0x22,
-    0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73,
-    0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70,
-    0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75,
-    0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c,
-    0x63, 0x72, 0x74, 0x5c, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x63, 0x6c, 0x61, 0x73,
-    0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x31, 0x35, 0x09, 0x22,
-    0x43, 0x3a, 0x5c, 0x76, 0x73, 0x32, 0x30, 0x30, 0x35, 0x5c, 0x56, 0x43, 0x5c, 0x49, 0x4e, 0x43,
-    0x4c, 0x55, 0x44, 0x45, 0x5c, 0x74, 0x69, 0x6d, 0x65, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66,
-    0x69, 0x6c, 0x65, 0x09, 0x31, 0x36, 0x09, 0x22, 0x68, 0x3a, 0x2f, 0x73, 0x77, 0x2f, 0x64, 0x65,
-    0x76, 0x72, 0x65, 0x6c, 0x2f, 0x53, 0x44, 0x4b, 0x31, 0x30, 0x2f, 0x43, 0x6f, 0x6d, 0x70, 0x75,
-    0x74, 0x65, 0x2f, 0x43, 0x2f, 0x73, 0x72, 0x63, 0x2f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d,
-    0x75, 0x6c, 0x44, 0x72, 0x76, 0x2f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f,
-    0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x2e, 0x63, 0x75, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c,
-    0x65, 0x09, 0x31, 0x37, 0x09, 0x22, 0x43, 0x3a, 0x2f, 0x50, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d,
-    0x20, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x2f, 0x4e, 0x56, 0x49, 0x44, 0x49, 0x41, 0x20, 0x47, 0x50,
-    0x55, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x54, 0x6f, 0x6f, 0x6c,
-    0x6b, 0x69, 0x74, 0x2f, 0x43, 0x55, 0x44, 0x41, 0x2f, 0x76, 0x34, 0x2e, 0x30, 0x2f, 0x2f, 0x69,
-    0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x5f, 0x66, 0x75,
-    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c,
-    0x65, 0x09, 0x31, 0x38, 0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d,
-    0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70,
-    0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c,
-    0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e,
-    0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x6d, 0x61, 0x74, 0x68, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x74,
-    0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x31,
-    0x39, 0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69,
-    0x6c, 0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63,
-    0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74,
-    0x5c, 0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75,
-    0x64, 0x65, 0x5c, 0x6d, 0x61, 0x74, 0x68, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74,
-    0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x32, 0x30, 0x09, 0x22,
-    0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73,
-    0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70,
-    0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75,
-    0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c,
-    0x64, 0x65, 0x76, 0x69, 0x63, 0x65, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73,
-    0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x32, 0x31, 0x09, 0x22, 0x63,
-    0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5c,
-    0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75,
-    0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75, 0x64,
-    0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x73,
-    0x6d, 0x5f, 0x31, 0x31, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x66, 0x75, 0x6e, 0x63,
-    0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09,
-    0x32, 0x32, 0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66,
-    0x69, 0x6c, 0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20,
-    0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69,
-    0x74, 0x5c, 0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c,
-    0x75, 0x64, 0x65, 0x5c, 0x73, 0x6d, 0x5f, 0x31, 0x32, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63,
-    0x5f, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e,
-    0x66, 0x69, 0x6c, 0x65, 0x09, 0x32, 0x33, 0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67,
-    0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61,
-    0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74,
-    0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30,
-    0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x73, 0x6d, 0x5f, 0x31, 0x33, 0x5f, 0x64,
-    0x6f, 0x75, 0x62, 0x6c, 0x65, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e,
-    0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x32, 0x34, 0x09, 0x22, 0x63, 0x3a,
-    0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x6e,
-    0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74,
-    0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75, 0x64, 0x61,
-    0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x73, 0x6d,
-    0x5f, 0x32, 0x30, 0x5f, 0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x74,
-    0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x32,
-    0x35, 0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69,
-    0x6c, 0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63,
-    0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74,
-    0x5c, 0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75,
-    0x64, 0x65, 0x5c, 0x73, 0x6d, 0x5f, 0x32, 0x30, 0x5f, 0x69, 0x6e, 0x74, 0x72, 0x69, 0x6e, 0x73,
-    0x69, 0x63, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x32, 0x36,
-    0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c,
-    0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f,
-    0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c,
-    0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64,
-    0x65, 0x5c, 0x73, 0x75, 0x72, 0x66, 0x61, 0x63, 0x65, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
-    0x6f, 0x6e, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x32, 0x37,
-    0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c,
-    0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75, 0x20, 0x63, 0x6f,
-    0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f, 0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c,
-    0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64,
-    0x65, 0x5c, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x5f, 0x66, 0x65, 0x74, 0x63, 0x68, 0x5f,
-    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x2e, 0x68, 0x22, 0x0a, 0x09, 0x2e, 0x66,
-    0x69, 0x6c, 0x65, 0x09, 0x32, 0x38, 0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x72, 0x6f, 0x67, 0x72,
-    0x61, 0x6d, 0x20, 0x66, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20,
-    0x67, 0x70, 0x75, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x6f,
-    0x6f, 0x6c, 0x6b, 0x69, 0x74, 0x5c, 0x63, 0x75, 0x64, 0x61, 0x5c, 0x76, 0x34, 0x2e, 0x30, 0x5c,
-    0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x5c, 0x6d, 0x61, 0x74, 0x68, 0x5f, 0x66, 0x75, 0x6e,
-    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5f, 0x64, 0x62, 0x6c, 0x5f, 0x70, 0x74, 0x78, 0x31, 0x2e,
-    0x68, 0x22, 0x0a, 0x0a, 0x09, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x2e, 0x61, 0x6c,
-    0x69, 0x67, 0x6e, 0x20, 0x34, 0x20, 0x2e, 0x62, 0x38, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61,
-    0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x37, 0x33, 0x38, 0x32,
-    0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x41, 0x73,
-    0x5f, 0x5f, 0x36, 0x5b, 0x31, 0x30, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x20, 0x2e, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x20, 0x34, 0x20, 0x2e, 0x62, 0x38,
-    0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61,
-    0x72, 0x5f, 0x38, 0x37, 0x33, 0x38, 0x36, 0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63,
-    0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x42, 0x73, 0x5f, 0x5f, 0x37, 0x5b, 0x31, 0x30, 0x32, 0x34, 0x5d,
-    0x3b, 0x0a, 0x0a, 0x09, 0x2e, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69,
-    0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x20,
-    0x28, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20,
-    0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69,
-    0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f,
-    0x43, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72,
-    0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74,
-    0x5f, 0x41, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33,
-    0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74,
-    0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69,
-    0x74, 0x5f, 0x42, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x73,
-    0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61,
-    0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62,
-    0x69, 0x74, 0x5f, 0x77, 0x41, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20,
-    0x2e, 0x73, 0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f,
-    0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33,
-    0x32, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x29, 0x0a, 0x09, 0x7b, 0x0a, 0x09, 0x2e, 0x72, 0x65,
-    0x67, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x25, 0x72, 0x3c, 0x35, 0x37, 0x3e, 0x3b, 0x0a, 0x09,
-    0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x25, 0x66, 0x3c, 0x35, 0x32, 0x3e,
-    0x3b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x70, 0x72, 0x65, 0x64, 0x20, 0x25, 0x70,
-    0x3c, 0x34, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x31, 0x30,
-    0x37, 0x09, 0x30, 0x0a, 0x24, 0x4c, 0x44, 0x57, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x5f, 0x6d, 0x61,
-    0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62,
-    0x69, 0x74, 0x3a, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x36, 0x36, 0x09,
-    0x30, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x73, 0x33, 0x32, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09,
-    0x25, 0x72, 0x31, 0x2c, 0x20, 0x25, 0x63, 0x74, 0x61, 0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09,
-    0x6d, 0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x32, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x2c, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74,
-    0x2e, 0x73, 0x33, 0x32, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09, 0x25, 0x72, 0x33, 0x2c, 0x20, 0x25,
-    0x63, 0x74, 0x61, 0x69, 0x64, 0x2e, 0x79, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72,
-    0x61, 0x6d, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x2c, 0x20, 0x5b, 0x5f, 0x5f,
-    0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d,
-    0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x41,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x3b, 0x0a, 0x09,
-    0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x36, 0x2c,
-    0x20, 0x25, 0x72, 0x35, 0x2c, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x36, 0x2c, 0x20, 0x25, 0x72,
-    0x34, 0x3b, 0x0a, 0x09, 0x73, 0x75, 0x62, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x38,
-    0x2c, 0x20, 0x25, 0x72, 0x37, 0x2c, 0x20, 0x31, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x73,
-    0x33, 0x32, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09, 0x25, 0x72, 0x39, 0x2c, 0x20, 0x25, 0x74, 0x69,
-    0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x73, 0x33, 0x32, 0x2e, 0x75, 0x31,
-    0x36, 0x20, 0x09, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x74, 0x69, 0x64, 0x2e, 0x79, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72,
-    0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36,
-    0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74,
-    0x70, 0x2e, 0x6c, 0x74, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x31, 0x2c, 0x20, 0x25,
-    0x72, 0x38, 0x2c, 0x20, 0x25, 0x72, 0x36, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x31, 0x20, 0x62,
-    0x72, 0x61, 0x20, 0x09, 0x24, 0x4c, 0x74, 0x5f, 0x30, 0x5f, 0x33, 0x33, 0x33, 0x30, 0x3b, 0x0a,
-    0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x32, 0x2c, 0x20,
-    0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72,
-    0x5f, 0x38, 0x37, 0x33, 0x38, 0x32, 0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f,
-    0x6e, 0x73, 0x74, 0x5f, 0x41, 0x73, 0x5f, 0x5f, 0x36, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e,
-    0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x33, 0x2c, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64,
-    0x61, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x37, 0x33, 0x38,
-    0x36, 0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x42,
-    0x73, 0x5f, 0x5f, 0x37, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e,
-    0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64,
-    0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f,
-    0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x41, 0x5d, 0x3b, 0x0a,
-    0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x34, 0x2c, 0x20,
-    0x25, 0x72, 0x34, 0x2c, 0x20, 0x31, 0x35, 0x3b, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x2e, 0x73, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x34, 0x2c, 0x20, 0x33,
-    0x31, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31,
-    0x36, 0x2c, 0x20, 0x31, 0x35, 0x3b, 0x0a, 0x09, 0x61, 0x6e, 0x64, 0x2e, 0x62, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x72, 0x31, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x31,
-    0x36, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31,
-    0x38, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x34, 0x3b, 0x0a, 0x09,
-    0x73, 0x68, 0x72, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x39, 0x2c, 0x20, 0x25,
-    0x72, 0x31, 0x38, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61,
-    0x6d, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x5b, 0x5f, 0x5f,
-    0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d,
-    0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x42,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x32, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x31,
-    0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x3b, 0x0a,
-    0x09, 0x6d, 0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x32, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09,
-    0x6d, 0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x32, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x36, 0x34, 0x3b, 0x0a, 0x09, 0x6d,
-    0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32,
-    0x34, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e,
-    0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x35, 0x2c, 0x20, 0x25, 0x72,
-    0x31, 0x31, 0x2c, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x32, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x30, 0x2c, 0x20, 0x25, 0x72,
-    0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32,
-    0x37, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x36, 0x3b, 0x0a, 0x09, 0x61,
-    0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x38, 0x2c, 0x20, 0x25, 0x72,
-    0x39, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x33, 0x2c, 0x20, 0x25,
-    0x72, 0x31, 0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x33, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x33, 0x3b,
-    0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x31, 0x2c,
-    0x20, 0x25, 0x72, 0x32, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64,
-    0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x37,
-    0x2c, 0x20, 0x25, 0x72, 0x39, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x38, 0x2c, 0x20,
-    0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x33, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x31, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09,
-    0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x35,
-    0x2c, 0x20, 0x25, 0x72, 0x32, 0x35, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e,
-    0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x36, 0x2c, 0x20, 0x25, 0x72,
-    0x33, 0x32, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x72, 0x33, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x31,
-    0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33,
-    0x38, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x33, 0x3b, 0x0a, 0x09,
-    0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x39, 0x2c, 0x20, 0x25,
-    0x72, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x38, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61,
-    0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x30, 0x2c, 0x20, 0x5b,
-    0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69,
-    0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f,
-    0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x34, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x34, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x34, 0x32, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d,
-    0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f,
-    0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x41, 0x5d, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x36, 0x2c, 0x20,
-    0x25, 0x72, 0x34, 0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x34, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x3b,
-    0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x34, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x34, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x61, 0x64,
-    0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x34,
-    0x35, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x32, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x2f, 0x2f, 0x20, 0x30, 0x0a, 0x09, 0x6d,
-    0x6f, 0x76, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x37, 0x2c, 0x20, 0x25, 0x72,
-    0x31, 0x39, 0x3b, 0x0a, 0x24, 0x4c, 0x74, 0x5f, 0x30, 0x5f, 0x32, 0x38, 0x31, 0x38, 0x3a, 0x0a,
-    0x20, 0x2f, 0x2f, 0x3c, 0x6c, 0x6f, 0x6f, 0x70, 0x3e, 0x20, 0x4c, 0x6f, 0x6f, 0x70, 0x20, 0x62,
-    0x6f, 0x64, 0x79, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x36, 0x2c, 0x20, 0x6e, 0x65, 0x73,
-    0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x2c, 0x20, 0x65,
-    0x73, 0x74, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69,
-    0x6f, 0x6e, 0x73, 0x3a, 0x20, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x0a, 0x09, 0x2e, 0x6c,
-    0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x38, 0x31, 0x09, 0x30, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x67,
-    0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x34, 0x33, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x73, 0x74, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x33, 0x37, 0x2b,
-    0x30, 0x5d, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31,
-    0x36, 0x09, 0x38, 0x32, 0x09, 0x30, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61,
-    0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x34,
-    0x31, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x73, 0x74, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x33, 0x38, 0x2b, 0x30, 0x5d, 0x2c, 0x20,
-    0x25, 0x66, 0x33, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x38, 0x35,
-    0x09, 0x30, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x2e, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x09, 0x30, 0x3b,
-    0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x39, 0x32, 0x09, 0x30, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x2c,
-    0x20, 0x25, 0x66, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x30, 0x2b, 0x36, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x2c, 0x20, 0x25, 0x66,
-    0x38, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72,
-    0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x30, 0x2c, 0x20, 0x5b, 0x25,
-    0x72, 0x32, 0x39, 0x2b, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72,
-    0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x31, 0x2c, 0x20, 0x5b, 0x25,
-    0x72, 0x33, 0x30, 0x2b, 0x31, 0x32, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x30, 0x2c, 0x20,
-    0x25, 0x66, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x33, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x34,
-    0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x39, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6d,
-    0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x35, 0x2c, 0x20, 0x25, 0x66,
-    0x31, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x32, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x31, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x31, 0x36, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x31, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x32, 0x35, 0x36,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31,
-    0x38, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x37, 0x2c, 0x20, 0x25,
-    0x66, 0x31, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39,
-    0x2b, 0x32, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x30, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33,
-    0x30, 0x2b, 0x33, 0x32, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x39, 0x2c, 0x20, 0x25, 0x66,
-    0x32, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x38, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x32, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x33, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x33, 0x38, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x32,
-    0x32, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x31, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x32, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x32, 0x38, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x32, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x34, 0x34, 0x38, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x37,
-    0x2c, 0x20, 0x25, 0x66, 0x32, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x36, 0x2c, 0x20, 0x25, 0x66,
-    0x32, 0x34, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b,
-    0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30,
-    0x2b, 0x35, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x33, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x32,
-    0x39, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x37, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x31, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x32, 0x39, 0x2b, 0x33, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x32, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x35, 0x37, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x31,
-    0x2c, 0x20, 0x25, 0x66, 0x33, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x30, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x33, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x34, 0x30, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x33, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x36, 0x34, 0x30, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x36, 0x2c,
-    0x20, 0x25, 0x66, 0x33, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x33,
-    0x33, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x34,
-    0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b,
-    0x37, 0x30, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x33, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x38,
-    0x2c, 0x20, 0x25, 0x66, 0x33, 0x36, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72,
-    0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20, 0x5b, 0x25,
-    0x72, 0x32, 0x39, 0x2b, 0x34, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x31, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x30, 0x2b, 0x37, 0x36, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x30, 0x2c,
-    0x20, 0x25, 0x66, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x39, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34,
-    0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x35, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x34, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x38, 0x33, 0x32, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x35, 0x2c, 0x20,
-    0x25, 0x66, 0x34, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x32,
-    0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x34, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x35, 0x36,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x38,
-    0x39, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x34, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x37, 0x2c,
-    0x20, 0x25, 0x66, 0x34, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72,
-    0x32, 0x39, 0x2b, 0x36, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72,
-    0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x30, 0x2c, 0x20, 0x5b, 0x25,
-    0x72, 0x33, 0x30, 0x2b, 0x39, 0x36, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x39, 0x2c, 0x20, 0x25,
-    0x66, 0x35, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x38, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63,
-    0x09, 0x31, 0x36, 0x09, 0x39, 0x37, 0x09, 0x30, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x2e, 0x73, 0x79,
-    0x6e, 0x63, 0x20, 0x09, 0x30, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09,
-    0x36, 0x36, 0x09, 0x30, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x31, 0x3b,
-    0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x33, 0x2c,
-    0x20, 0x25, 0x72, 0x34, 0x33, 0x2c, 0x20, 0x36, 0x34, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70,
-    0x2e, 0x6c, 0x65, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x32, 0x2c, 0x20, 0x25, 0x72,
-    0x34, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x36, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x32, 0x20,
-    0x62, 0x72, 0x61, 0x20, 0x09, 0x24, 0x4c, 0x74, 0x5f, 0x30, 0x5f, 0x32, 0x38, 0x31, 0x38, 0x3b,
-    0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x24, 0x4c, 0x74, 0x5f, 0x30,
-    0x5f, 0x32, 0x33, 0x30, 0x36, 0x3b, 0x0a, 0x24, 0x4c, 0x74, 0x5f, 0x30, 0x5f, 0x33, 0x33, 0x33,
-    0x30, 0x3a, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x73, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70,
-    0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73,
-    0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x6d,
-    0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x30, 0x2c,
-    0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x31, 0x3b, 0x0a, 0x09, 0x6d, 0x6f,
-    0x76, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x2f, 0x2f, 0x20,
-    0x30, 0x0a, 0x24, 0x4c, 0x74, 0x5f, 0x30, 0x5f, 0x32, 0x33, 0x30, 0x36, 0x3a, 0x0a, 0x09, 0x2e,
-    0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x31, 0x30, 0x33, 0x09, 0x30, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x38,
-    0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61,
-    0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62,
-    0x69, 0x74, 0x5f, 0x43, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20,
-    0x25, 0x72, 0x33, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x35, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x39, 0x3b, 0x0a,
-    0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35,
-    0x31, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x30, 0x2c, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x61, 0x64,
-    0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x32,
-    0x30, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x31, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x2c, 0x20, 0x25, 0x72,
-    0x35, 0x32, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x72, 0x35, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x33, 0x2c, 0x20, 0x34, 0x3b, 0x0a,
-    0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x35, 0x2c, 0x20,
-    0x25, 0x72, 0x34, 0x38, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x34, 0x3b, 0x0a, 0x09, 0x73, 0x74, 0x2e,
-    0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x35,
-    0x35, 0x2b, 0x30, 0x5d, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63,
-    0x09, 0x31, 0x36, 0x09, 0x31, 0x31, 0x30, 0x09, 0x30, 0x0a, 0x09, 0x65, 0x78, 0x69, 0x74, 0x3b,
-    0x0a, 0x24, 0x4c, 0x44, 0x57, 0x65, 0x6e, 0x64, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d,
-    0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x3a, 0x0a, 0x09,
-    0x7d, 0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62,
-    0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x0a, 0x09, 0x2e, 0x73, 0x68, 0x61, 0x72,
-    0x65, 0x64, 0x20, 0x2e, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x20, 0x34, 0x20, 0x2e, 0x62, 0x38, 0x20,
-    0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72,
-    0x5f, 0x38, 0x37, 0x33, 0x38, 0x32, 0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f,
-    0x6e, 0x73, 0x74, 0x5f, 0x41, 0x73, 0x5f, 0x5f, 0x34, 0x5b, 0x31, 0x30, 0x32, 0x34, 0x5d, 0x3b,
-    0x0a, 0x09, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x2e, 0x61, 0x6c, 0x69, 0x67, 0x6e,
-    0x20, 0x34, 0x20, 0x2e, 0x62, 0x38, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x5f, 0x6c, 0x6f,
-    0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x37, 0x33, 0x38, 0x36, 0x5f, 0x33, 0x38,
-    0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x42, 0x73, 0x5f, 0x5f, 0x35,
-    0x5b, 0x31, 0x30, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x2e, 0x65, 0x6e, 0x74, 0x72, 0x79,
-    0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f,
-    0x36, 0x34, 0x62, 0x69, 0x74, 0x20, 0x28, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d,
-    0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d,
-    0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f,
-    0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x43, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61,
-    0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72,
-    0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36,
-    0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x41, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72,
-    0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61,
-    0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31,
-    0x36, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x42, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61,
-    0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70,
-    0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73,
-    0x31, 0x36, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x41, 0x2c, 0x0a, 0x09, 0x09, 0x2e,
-    0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64,
-    0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f,
-    0x62, 0x73, 0x31, 0x36, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x29, 0x0a, 0x09,
-    0x7b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x25, 0x72, 0x3c,
-    0x35, 0x34, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x25, 0x66, 0x3c, 0x35, 0x32, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x70,
-    0x72, 0x65, 0x64, 0x20, 0x25, 0x70, 0x3c, 0x34, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63,
-    0x09, 0x31, 0x36, 0x09, 0x31, 0x31, 0x31, 0x09, 0x30, 0x0a, 0x24, 0x4c, 0x44, 0x57, 0x62, 0x65,
-    0x67, 0x69, 0x6e, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73,
-    0x31, 0x36, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x3a, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09,
-    0x31, 0x36, 0x09, 0x36, 0x36, 0x09, 0x30, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x33, 0x32,
-    0x2e, 0x75, 0x31, 0x36, 0x20, 0x09, 0x25, 0x72, 0x31, 0x2c, 0x20, 0x25, 0x63, 0x74, 0x61, 0x69,
-    0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x2c, 0x20, 0x31, 0x36,
-    0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x33, 0x32, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09,
-    0x25, 0x72, 0x33, 0x2c, 0x20, 0x25, 0x63, 0x74, 0x61, 0x69, 0x64, 0x2e, 0x79, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x34, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d,
-    0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x36, 0x34,
-    0x62, 0x69, 0x74, 0x5f, 0x77, 0x41, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f,
-    0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x2c, 0x20,
-    0x25, 0x72, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x2c, 0x20, 0x31, 0x36, 0x3b, 0x0a,
-    0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x37, 0x2c, 0x20, 0x25,
-    0x72, 0x36, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x38, 0x2c, 0x20, 0x25, 0x72, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x3b, 0x0a, 0x09, 0x73, 0x75,
-    0x62, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x38, 0x2c,
-    0x20, 0x31, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x33, 0x32, 0x2e, 0x75, 0x31, 0x36,
-    0x20, 0x09, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x74, 0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a,
-    0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x33, 0x32, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09, 0x25, 0x72,
-    0x31, 0x31, 0x2c, 0x20, 0x25, 0x74, 0x69, 0x64, 0x2e, 0x79, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x32, 0x2c,
-    0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74,
-    0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x36, 0x34, 0x62, 0x69,
-    0x74, 0x5f, 0x77, 0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x6c, 0x74, 0x2e,
-    0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x2c, 0x20, 0x25,
-    0x72, 0x36, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x31, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x24,
-    0x4c, 0x74, 0x5f, 0x31, 0x5f, 0x33, 0x33, 0x33, 0x30, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e,
-    0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x33, 0x2c, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64,
-    0x61, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x37, 0x33, 0x38,
-    0x32, 0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x41,
-    0x73, 0x5f, 0x5f, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x31, 0x34, 0x2c, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x5f, 0x6c, 0x6f, 0x63,
-    0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x37, 0x33, 0x38, 0x36, 0x5f, 0x33, 0x38, 0x5f,
-    0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x42, 0x73, 0x5f, 0x5f, 0x35, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x34, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d,
-    0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f,
-    0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x41, 0x5d, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e,
-    0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x2c, 0x20,
-    0x31, 0x35, 0x3b, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x31, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x35, 0x2c, 0x20, 0x33, 0x31, 0x3b, 0x0a, 0x09, 0x6d,
-    0x6f, 0x76, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x37, 0x2c, 0x20, 0x31, 0x35,
-    0x3b, 0x0a, 0x09, 0x61, 0x6e, 0x64, 0x2e, 0x62, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x38,
-    0x2c, 0x20, 0x25, 0x72, 0x31, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x37, 0x3b, 0x0a, 0x09, 0x61,
-    0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x39, 0x2c, 0x20, 0x25, 0x72,
-    0x31, 0x38, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x35, 0x3b, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x2e, 0x73,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x39, 0x2c, 0x20,
-    0x34, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x31, 0x32, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70,
-    0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73,
-    0x31, 0x36, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x6d,
-    0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x31, 0x2c,
-    0x20, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x32, 0x3b, 0x0a, 0x09, 0x6d, 0x75,
-    0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x32, 0x2c, 0x20,
-    0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x32,
-    0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x33, 0x2c, 0x20,
-    0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x32, 0x34,
-    0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x34, 0x2c, 0x20, 0x25,
-    0x72, 0x31, 0x31, 0x2c, 0x20, 0x36, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x32, 0x34, 0x2e,
-    0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x35, 0x2c, 0x20, 0x25, 0x72,
-    0x31, 0x30, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x32, 0x2c, 0x20,
-    0x31, 0x36, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x32, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x3b, 0x0a, 0x09,
-    0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x38, 0x2c, 0x20, 0x25,
-    0x72, 0x32, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x36, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x33, 0x2c, 0x20,
-    0x25, 0x72, 0x31, 0x30, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x33, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x33,
-    0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x31,
-    0x2c, 0x20, 0x25, 0x72, 0x32, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x34, 0x3b, 0x0a, 0x09, 0x61,
-    0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x32, 0x2c, 0x20, 0x25, 0x72,
-    0x32, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x38, 0x2c, 0x20,
-    0x25, 0x72, 0x31, 0x30, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x39, 0x2c, 0x20, 0x34,
-    0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x33, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x32, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x6d,
-    0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x36, 0x2c,
-    0x20, 0x25, 0x72, 0x32, 0x36, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c,
-    0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x33,
-    0x33, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x33, 0x38, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x33,
-    0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x39,
-    0x2c, 0x20, 0x25, 0x72, 0x33, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x34, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34,
-    0x30, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d,
-    0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x36, 0x34,
-    0x62, 0x69, 0x74, 0x5f, 0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x30, 0x2c, 0x20, 0x25, 0x72,
-    0x33, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x32, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61,
-    0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62,
-    0x73, 0x31, 0x36, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x41, 0x5d, 0x3b, 0x0a, 0x09, 0x61,
-    0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x33, 0x2c, 0x20, 0x25, 0x72,
-    0x34, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x37, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x2f, 0x2f, 0x20, 0x30, 0x0a, 0x09,
-    0x6d, 0x6f, 0x76, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x34, 0x2c, 0x20, 0x25,
-    0x72, 0x32, 0x30, 0x3b, 0x0a, 0x24, 0x4c, 0x74, 0x5f, 0x31, 0x5f, 0x32, 0x38, 0x31, 0x38, 0x3a,
-    0x0a, 0x20, 0x2f, 0x2f, 0x3c, 0x6c, 0x6f, 0x6f, 0x70, 0x3e, 0x20, 0x4c, 0x6f, 0x6f, 0x70, 0x20,
-    0x62, 0x6f, 0x64, 0x79, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x36, 0x2c, 0x20, 0x6e, 0x65,
-    0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x2c, 0x20,
-    0x65, 0x73, 0x74, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74,
-    0x69, 0x6f, 0x6e, 0x73, 0x3a, 0x20, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x0a, 0x09, 0x2e,
-    0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x38, 0x31, 0x09, 0x30, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x34, 0x33, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x73, 0x74, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x33, 0x38,
-    0x2b, 0x30, 0x5d, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09,
-    0x31, 0x36, 0x09, 0x38, 0x32, 0x09, 0x30, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x67, 0x6c, 0x6f, 0x62,
-    0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72,
-    0x34, 0x31, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x73, 0x74, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x33, 0x39, 0x2b, 0x30, 0x5d, 0x2c,
-    0x20, 0x25, 0x66, 0x33, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x38,
-    0x35, 0x09, 0x30, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x2e, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x09, 0x30,
-    0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x39, 0x32, 0x09, 0x30, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d,
-    0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x34,
-    0x2c, 0x20, 0x25, 0x66, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x36, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x2c, 0x20, 0x25,
-    0x66, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x30, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x30, 0x2b, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x31, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x31, 0x2b, 0x31, 0x32, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x30, 0x2c,
-    0x20, 0x25, 0x66, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x33,
-    0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31,
-    0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x31, 0x39, 0x32, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x35, 0x2c, 0x20, 0x25,
-    0x66, 0x31, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x32, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x31, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x36, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x31, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x32, 0x35,
-    0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x31, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x37, 0x2c, 0x20,
-    0x25, 0x66, 0x31, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33,
-    0x30, 0x2b, 0x32, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x30, 0x2c, 0x20, 0x5b, 0x25, 0x72,
-    0x33, 0x31, 0x2b, 0x33, 0x32, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x39, 0x2c, 0x20, 0x25,
-    0x66, 0x32, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x38, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x32, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x33,
-    0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x33, 0x38, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d,
-    0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x34, 0x2c, 0x20, 0x25, 0x66,
-    0x32, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x31, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x32, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x32, 0x38, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x32, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x34, 0x34, 0x38,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32,
-    0x37, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x36, 0x2c, 0x20, 0x25,
-    0x66, 0x32, 0x34, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30,
-    0x2b, 0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33,
-    0x31, 0x2b, 0x35, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x33, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x38, 0x2c, 0x20, 0x25, 0x66,
-    0x32, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x37, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x31, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x33, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x32, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x35, 0x37, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x33,
-    0x31, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x30, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x33, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x34, 0x30, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x33, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x36, 0x34, 0x30, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x36,
-    0x2c, 0x20, 0x25, 0x66, 0x33, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x35, 0x2c, 0x20, 0x25, 0x66,
-    0x33, 0x33, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b,
-    0x34, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31,
-    0x2b, 0x37, 0x30, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x33, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x33,
-    0x38, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x36, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x30, 0x2b, 0x34, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x31, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x37, 0x36, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x30,
-    0x2c, 0x20, 0x25, 0x66, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x39, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x34, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x35, 0x32, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x34, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x38, 0x33, 0x32, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x35, 0x2c,
-    0x20, 0x25, 0x66, 0x34, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x34,
-    0x32, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x35,
-    0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b,
-    0x38, 0x39, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x34, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x37,
-    0x2c, 0x20, 0x25, 0x66, 0x34, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72,
-    0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x39, 0x2c, 0x20, 0x5b, 0x25,
-    0x72, 0x33, 0x30, 0x2b, 0x36, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x30, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x31, 0x2b, 0x39, 0x36, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x39, 0x2c, 0x20,
-    0x25, 0x66, 0x35, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x38, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f,
-    0x63, 0x09, 0x31, 0x36, 0x09, 0x39, 0x37, 0x09, 0x30, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x2e, 0x73,
-    0x79, 0x6e, 0x63, 0x20, 0x09, 0x30, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36,
-    0x09, 0x36, 0x36, 0x09, 0x30, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x31,
-    0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x37, 0x2c,
-    0x20, 0x25, 0x72, 0x37, 0x2c, 0x20, 0x31, 0x36, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x33, 0x2c, 0x20,
-    0x36, 0x34, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x67, 0x65, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x70, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x37, 0x3b,
-    0x0a, 0x09, 0x40, 0x25, 0x70, 0x32, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x24, 0x4c, 0x74, 0x5f,
-    0x31, 0x5f, 0x32, 0x38, 0x31, 0x38, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69,
-    0x20, 0x09, 0x24, 0x4c, 0x74, 0x5f, 0x31, 0x5f, 0x32, 0x33, 0x30, 0x36, 0x3b, 0x0a, 0x24, 0x4c,
-    0x74, 0x5f, 0x31, 0x5f, 0x33, 0x33, 0x33, 0x30, 0x3a, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61,
-    0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x32, 0x2c, 0x20, 0x5b,
-    0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69,
-    0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f,
-    0x77, 0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x72,
-    0x31, 0x32, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x31, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x20, 0x20,
-    0x20, 0x20, 0x20, 0x09, 0x2f, 0x2f, 0x20, 0x30, 0x0a, 0x24, 0x4c, 0x74, 0x5f, 0x31, 0x5f, 0x32,
-    0x33, 0x30, 0x36, 0x3a, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x31, 0x30,
-    0x33, 0x09, 0x30, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x35, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61,
-    0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62,
-    0x73, 0x31, 0x36, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x43, 0x5d, 0x3b, 0x0a, 0x09, 0x6d,
-    0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x36, 0x2c,
-    0x20, 0x25, 0x72, 0x31, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64,
-    0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x2c,
-    0x20, 0x25, 0x72, 0x34, 0x36, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x38, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x37, 0x2c, 0x20,
-    0x31, 0x36, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x34, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x38, 0x3b, 0x0a,
-    0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x30, 0x2c, 0x20,
-    0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x39, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c,
-    0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x31, 0x2c, 0x20, 0x25,
-    0x72, 0x35, 0x30, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x35, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x35, 0x2c, 0x20, 0x25, 0x72,
-    0x35, 0x31, 0x3b, 0x0a, 0x09, 0x73, 0x74, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x35, 0x32, 0x2b, 0x30, 0x5d, 0x2c, 0x20, 0x25, 0x66,
-    0x31, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x31, 0x31, 0x34, 0x09,
-    0x30, 0x0a, 0x09, 0x65, 0x78, 0x69, 0x74, 0x3b, 0x0a, 0x24, 0x4c, 0x44, 0x57, 0x65, 0x6e, 0x64,
-    0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f,
-    0x36, 0x34, 0x62, 0x69, 0x74, 0x3a, 0x0a, 0x09, 0x7d, 0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x61, 0x74,
-    0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x36, 0x34, 0x62, 0x69,
-    0x74, 0x0a, 0x09, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x2e, 0x61, 0x6c, 0x69, 0x67,
-    0x6e, 0x20, 0x34, 0x20, 0x2e, 0x62, 0x38, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x5f, 0x6c,
-    0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x37, 0x33, 0x38, 0x32, 0x5f, 0x33,
-    0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x41, 0x73, 0x5f, 0x5f,
-    0x32, 0x5b, 0x34, 0x30, 0x39, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
-    0x64, 0x20, 0x2e, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x20, 0x34, 0x20, 0x2e, 0x62, 0x38, 0x20, 0x5f,
-    0x5f, 0x63, 0x75, 0x64, 0x61, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f,
-    0x38, 0x37, 0x33, 0x38, 0x36, 0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e,
-    0x73, 0x74, 0x5f, 0x42, 0x73, 0x5f, 0x5f, 0x33, 0x5b, 0x34, 0x30, 0x39, 0x36, 0x5d, 0x3b, 0x0a,
-    0x0a, 0x09, 0x2e, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d,
-    0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x20, 0x28, 0x0a,
-    0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f, 0x5f,
-    0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d,
-    0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x43, 0x2c,
-    0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f,
-    0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78,
-    0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x41,
-    0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20,
-    0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69,
-    0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f,
-    0x42, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x73, 0x33, 0x32,
-    0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72,
-    0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74,
-    0x5f, 0x77, 0x41, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x73,
-    0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61,
-    0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62,
-    0x69, 0x74, 0x5f, 0x77, 0x42, 0x29, 0x0a, 0x09, 0x7b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20,
-    0x2e, 0x75, 0x33, 0x32, 0x20, 0x25, 0x72, 0x3c, 0x35, 0x37, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x72,
-    0x65, 0x67, 0x20, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x25, 0x66, 0x3c, 0x31, 0x30, 0x30, 0x3e, 0x3b,
-    0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x70, 0x72, 0x65, 0x64, 0x20, 0x25, 0x70, 0x3c,
-    0x34, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x31, 0x31, 0x35,
-    0x09, 0x30, 0x0a, 0x24, 0x4c, 0x44, 0x57, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x5f, 0x6d, 0x61, 0x74,
-    0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69,
-    0x74, 0x3a, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x36, 0x36, 0x09, 0x30,
-    0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x73, 0x33, 0x32, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09, 0x25,
-    0x72, 0x31, 0x2c, 0x20, 0x25, 0x63, 0x74, 0x61, 0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x6d,
-    0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32,
-    0x2c, 0x20, 0x25, 0x72, 0x31, 0x2c, 0x20, 0x33, 0x32, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e,
-    0x73, 0x33, 0x32, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09, 0x25, 0x72, 0x33, 0x2c, 0x20, 0x25, 0x63,
-    0x74, 0x61, 0x69, 0x64, 0x2e, 0x79, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61,
-    0x6d, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63,
-    0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75,
-    0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x41, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x3b, 0x0a, 0x09, 0x6d,
-    0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x36, 0x2c, 0x20,
-    0x25, 0x72, 0x35, 0x2c, 0x20, 0x33, 0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x34,
-    0x3b, 0x0a, 0x09, 0x73, 0x75, 0x62, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x38, 0x2c,
-    0x20, 0x25, 0x72, 0x37, 0x2c, 0x20, 0x31, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x73, 0x33,
-    0x32, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09, 0x25, 0x72, 0x39, 0x2c, 0x20, 0x25, 0x74, 0x69, 0x64,
-    0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x73, 0x33, 0x32, 0x2e, 0x75, 0x31, 0x36,
-    0x20, 0x09, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x74, 0x69, 0x64, 0x2e, 0x79, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x31, 0x31, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d,
-    0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f,
-    0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70,
-    0x2e, 0x6c, 0x74, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x31, 0x2c, 0x20, 0x25, 0x72,
-    0x38, 0x2c, 0x20, 0x25, 0x72, 0x36, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x31, 0x20, 0x62, 0x72,
-    0x61, 0x20, 0x09, 0x24, 0x4c, 0x74, 0x5f, 0x32, 0x5f, 0x33, 0x33, 0x33, 0x30, 0x3b, 0x0a, 0x09,
-    0x6d, 0x6f, 0x76, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x32, 0x2c, 0x20, 0x5f,
-    0x5f, 0x63, 0x75, 0x64, 0x61, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f,
-    0x38, 0x37, 0x33, 0x38, 0x32, 0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e,
-    0x73, 0x74, 0x5f, 0x41, 0x73, 0x5f, 0x5f, 0x32, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x33, 0x2c, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61,
-    0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x37, 0x33, 0x38, 0x36,
-    0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x42, 0x73,
-    0x5f, 0x5f, 0x33, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x73,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61,
-    0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62,
-    0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x41, 0x5d, 0x3b, 0x0a, 0x09,
-    0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x34, 0x2c, 0x20, 0x25,
-    0x72, 0x34, 0x2c, 0x20, 0x33, 0x31, 0x3b, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x2e, 0x73, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x31, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x34, 0x2c, 0x20, 0x33, 0x31,
-    0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x36,
-    0x2c, 0x20, 0x33, 0x31, 0x3b, 0x0a, 0x09, 0x61, 0x6e, 0x64, 0x2e, 0x62, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x31, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x36,
-    0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x38,
-    0x2c, 0x20, 0x25, 0x72, 0x31, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x34, 0x3b, 0x0a, 0x09, 0x73,
-    0x68, 0x72, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x39, 0x2c, 0x20, 0x25, 0x72,
-    0x31, 0x38, 0x2c, 0x20, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d,
-    0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63,
-    0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75,
-    0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x32, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x31, 0x3b,
-    0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x32, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x3b, 0x0a, 0x09,
-    0x6d, 0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x32, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x33, 0x32, 0x3b, 0x0a, 0x09, 0x6d,
-    0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32,
-    0x33, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x31, 0x32, 0x38, 0x3b, 0x0a, 0x09, 0x6d,
-    0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32,
-    0x34, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e,
-    0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x35, 0x2c, 0x20, 0x25, 0x72,
-    0x31, 0x31, 0x2c, 0x20, 0x33, 0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x32, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x30, 0x2c, 0x20, 0x25, 0x72,
-    0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32,
-    0x37, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x36, 0x3b, 0x0a, 0x09, 0x61,
-    0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x38, 0x2c, 0x20, 0x25, 0x72,
-    0x39, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x33, 0x2c, 0x20, 0x25,
-    0x72, 0x31, 0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x33, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x33, 0x3b,
-    0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x31, 0x2c,
-    0x20, 0x25, 0x72, 0x32, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64,
-    0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x37,
-    0x2c, 0x20, 0x25, 0x72, 0x39, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x38, 0x2c, 0x20,
-    0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x33, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x31, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09,
-    0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x35,
-    0x2c, 0x20, 0x25, 0x72, 0x32, 0x35, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e,
-    0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x36, 0x2c, 0x20, 0x25, 0x72,
-    0x33, 0x32, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x72, 0x33, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x31,
-    0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33,
-    0x38, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x33, 0x3b, 0x0a, 0x09,
-    0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x39, 0x2c, 0x20, 0x25,
-    0x72, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x38, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61,
-    0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x30, 0x2c, 0x20, 0x5b,
-    0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69,
-    0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f,
-    0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x34, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x34, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x34, 0x32, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d,
-    0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f,
-    0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x41, 0x5d, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x36, 0x2c, 0x20,
-    0x25, 0x72, 0x34, 0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x34, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x3b,
-    0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x34, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x34, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x61, 0x64,
-    0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x34,
-    0x35, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x32, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x30, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x2f, 0x2f, 0x20, 0x30, 0x0a, 0x09, 0x6d,
-    0x6f, 0x76, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x37, 0x2c, 0x20, 0x25, 0x72,
-    0x31, 0x39, 0x3b, 0x0a, 0x24, 0x4c, 0x74, 0x5f, 0x32, 0x5f, 0x32, 0x38, 0x31, 0x38, 0x3a, 0x0a,
-    0x20, 0x2f, 0x2f, 0x3c, 0x6c, 0x6f, 0x6f, 0x70, 0x3e, 0x20, 0x4c, 0x6f, 0x6f, 0x70, 0x20, 0x62,
-    0x6f, 0x64, 0x79, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x36, 0x2c, 0x20, 0x6e, 0x65, 0x73,
-    0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x2c, 0x20, 0x65,
-    0x73, 0x74, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x69,
-    0x6f, 0x6e, 0x73, 0x3a, 0x20, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0x0a, 0x09, 0x2e, 0x6c,
-    0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x38, 0x31, 0x09, 0x30, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x67,
-    0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x34, 0x33, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x73, 0x74, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x33, 0x37, 0x2b,
-    0x30, 0x5d, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31,
-    0x36, 0x09, 0x38, 0x32, 0x09, 0x30, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61,
-    0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x34,
-    0x31, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x73, 0x74, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x33, 0x38, 0x2b, 0x30, 0x5d, 0x2c, 0x20,
-    0x25, 0x66, 0x33, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x38, 0x35,
-    0x09, 0x30, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x2e, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x09, 0x30, 0x3b,
-    0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x39, 0x32, 0x09, 0x30, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x2c,
-    0x20, 0x25, 0x66, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x32, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x2c, 0x20, 0x25,
-    0x66, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x30, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x32, 0x39, 0x2b, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x31, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x30, 0x2b, 0x32, 0x35, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x30, 0x2c,
-    0x20, 0x25, 0x66, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x33,
-    0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31,
-    0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x33, 0x38, 0x34, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x35, 0x2c, 0x20, 0x25,
-    0x66, 0x31, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x32, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x31, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x31, 0x36, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x31, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x35, 0x31,
-    0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x31, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x37, 0x2c, 0x20,
-    0x25, 0x66, 0x31, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32,
-    0x39, 0x2b, 0x32, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x30, 0x2c, 0x20, 0x5b, 0x25, 0x72,
-    0x33, 0x30, 0x2b, 0x36, 0x34, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x39, 0x2c, 0x20, 0x25,
-    0x66, 0x32, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x38, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x32, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x33,
-    0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x37, 0x36, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d,
-    0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x34, 0x2c, 0x20, 0x25, 0x66,
-    0x32, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x31, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x32, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x32, 0x38, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x32, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x38, 0x39, 0x36,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32,
-    0x37, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x36, 0x2c, 0x20, 0x25,
-    0x66, 0x32, 0x34, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39,
-    0x2b, 0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33,
-    0x30, 0x2b, 0x31, 0x30, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x38, 0x2c, 0x20, 0x25,
-    0x66, 0x32, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x37, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x31, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x33, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x32,
-    0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x31, 0x35, 0x32, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x33, 0x2c, 0x20, 0x25,
-    0x66, 0x33, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x30, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x33, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x34, 0x30, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x33, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x32,
-    0x38, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x33, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x35, 0x2c,
-    0x20, 0x25, 0x66, 0x33, 0x33, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72,
-    0x32, 0x39, 0x2b, 0x34, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72,
-    0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x38, 0x2c, 0x20, 0x5b, 0x25,
-    0x72, 0x33, 0x30, 0x2b, 0x31, 0x34, 0x30, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x37, 0x2c,
-    0x20, 0x25, 0x66, 0x33, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x36, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34,
-    0x30, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x34, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x34, 0x31, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x35, 0x33, 0x36, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x32, 0x2c,
-    0x20, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x33,
-    0x39, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x35,
-    0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b,
-    0x31, 0x36, 0x36, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x34, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x34,
-    0x34, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x32, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x36, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x32, 0x39, 0x2b, 0x35, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x37, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x37, 0x39, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x34,
-    0x36, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x35, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x34, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x36, 0x30, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x35, 0x30, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x39, 0x32, 0x30,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35,
-    0x31, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x30, 0x2c, 0x20, 0x25,
-    0x66, 0x34, 0x38, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x32, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39,
-    0x2b, 0x36, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33,
-    0x30, 0x2b, 0x32, 0x30, 0x34, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x32, 0x2c, 0x20, 0x25,
-    0x66, 0x35, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x31, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x35, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x36, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x36,
-    0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x32, 0x31, 0x37, 0x36, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x37, 0x2c, 0x20, 0x25,
-    0x66, 0x35, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x34, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x35, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x37, 0x32, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x35, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x32, 0x33,
-    0x30, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x36, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x39, 0x2c,
-    0x20, 0x25, 0x66, 0x35, 0x37, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x31, 0x2c, 0x20, 0x5b, 0x25, 0x72,
-    0x32, 0x39, 0x2b, 0x37, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72,
-    0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x32, 0x2c, 0x20, 0x5b, 0x25,
-    0x72, 0x33, 0x30, 0x2b, 0x32, 0x34, 0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x31, 0x2c,
-    0x20, 0x25, 0x66, 0x36, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x30, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36,
-    0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x38, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x36, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x32, 0x35, 0x36, 0x30, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x36, 0x2c,
-    0x20, 0x25, 0x66, 0x36, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x36,
-    0x33, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x38,
-    0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b,
-    0x32, 0x36, 0x38, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x36, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x36,
-    0x38, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x36, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x30, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x32, 0x39, 0x2b, 0x38, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x31, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x32, 0x38, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x37,
-    0x30, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x39, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x37, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x39, 0x32, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x37, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x32, 0x39, 0x34, 0x34,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37,
-    0x35, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x34, 0x2c, 0x20, 0x25,
-    0x66, 0x37, 0x32, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39,
-    0x2b, 0x39, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33,
-    0x30, 0x2b, 0x33, 0x30, 0x37, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x36, 0x2c, 0x20, 0x25,
-    0x66, 0x37, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x39, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x31, 0x30, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38,
-    0x30, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x33, 0x32, 0x30, 0x30, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x31, 0x2c, 0x20,
-    0x25, 0x66, 0x37, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x38,
-    0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x38, 0x32, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x31, 0x30,
-    0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b,
-    0x33, 0x33, 0x32, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x38, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x38,
-    0x33, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x31, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x35, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x32, 0x39, 0x2b, 0x31, 0x30, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x36, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x33, 0x34, 0x35, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6d,
-    0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x37, 0x2c, 0x20, 0x25, 0x66,
-    0x38, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x34, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x38, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x31, 0x31, 0x32, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x38, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x33, 0x35,
-    0x38, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x39, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x39, 0x2c,
-    0x20, 0x25, 0x66, 0x38, 0x37, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x31, 0x2c, 0x20, 0x5b, 0x25, 0x72,
-    0x32, 0x39, 0x2b, 0x31, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x32, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x30, 0x2b, 0x33, 0x37, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x31,
-    0x2c, 0x20, 0x25, 0x66, 0x39, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x30, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x39, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39, 0x2b, 0x31, 0x32, 0x30, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x39, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x33, 0x38, 0x34, 0x30,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39,
-    0x36, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x35, 0x2c, 0x20, 0x25,
-    0x66, 0x39, 0x33, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x32, 0x39,
-    0x2b, 0x31, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72,
-    0x33, 0x30, 0x2b, 0x33, 0x39, 0x36, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x37, 0x2c, 0x20, 0x25,
-    0x66, 0x39, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x36, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63,
-    0x09, 0x31, 0x36, 0x09, 0x39, 0x37, 0x09, 0x30, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x2e, 0x73, 0x79,
-    0x6e, 0x63, 0x20, 0x09, 0x30, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09,
-    0x36, 0x36, 0x09, 0x30, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x31, 0x3b,
-    0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x33, 0x2c,
-    0x20, 0x25, 0x72, 0x34, 0x33, 0x2c, 0x20, 0x31, 0x32, 0x38, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74,
-    0x70, 0x2e, 0x6c, 0x65, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x32, 0x2c, 0x20, 0x25,
-    0x72, 0x34, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x36, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x32,
-    0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x24, 0x4c, 0x74, 0x5f, 0x32, 0x5f, 0x32, 0x38, 0x31, 0x38,
-    0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x24, 0x4c, 0x74, 0x5f,
-    0x32, 0x5f, 0x32, 0x33, 0x30, 0x36, 0x3b, 0x0a, 0x24, 0x4c, 0x74, 0x5f, 0x32, 0x5f, 0x33, 0x33,
-    0x33, 0x30, 0x3a, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x73, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61,
-    0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62,
-    0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x30,
-    0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x31, 0x3b, 0x0a, 0x09, 0x6d,
-    0x6f, 0x76, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x2f, 0x2f,
-    0x20, 0x30, 0x0a, 0x24, 0x4c, 0x74, 0x5f, 0x32, 0x5f, 0x32, 0x33, 0x30, 0x36, 0x3a, 0x0a, 0x09,
-    0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x31, 0x30, 0x33, 0x09, 0x30, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34,
-    0x38, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d,
-    0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32,
-    0x62, 0x69, 0x74, 0x5f, 0x43, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e,
-    0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x31, 0x2c,
-    0x20, 0x25, 0x72, 0x33, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x35, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x39, 0x3b,
-    0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x35, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x30, 0x2c, 0x20, 0x33, 0x32, 0x3b, 0x0a, 0x09, 0x61,
-    0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x32, 0x2c, 0x20, 0x25, 0x72,
-    0x32, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x31, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x73,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x2c, 0x20, 0x25,
-    0x72, 0x35, 0x32, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x35, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x33, 0x2c, 0x20, 0x34, 0x3b,
-    0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x35, 0x2c,
-    0x20, 0x25, 0x72, 0x34, 0x38, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x34, 0x3b, 0x0a, 0x09, 0x73, 0x74,
-    0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72,
-    0x35, 0x35, 0x2b, 0x30, 0x5d, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f,
-    0x63, 0x09, 0x31, 0x36, 0x09, 0x31, 0x31, 0x38, 0x09, 0x30, 0x0a, 0x09, 0x65, 0x78, 0x69, 0x74,
-    0x3b, 0x0a, 0x24, 0x4c, 0x44, 0x57, 0x65, 0x6e, 0x64, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78,
-    0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x3a, 0x0a,
-    0x09, 0x7d, 0x20, 0x2f, 0x2f, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f,
-    0x62, 0x73, 0x33, 0x32, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x0a, 0x09, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x20, 0x2e, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x20, 0x34, 0x20, 0x2e, 0x62, 0x38,
-    0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61,
-    0x72, 0x5f, 0x38, 0x37, 0x33, 0x38, 0x32, 0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63,
-    0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x41, 0x73, 0x5f, 0x5f, 0x30, 0x5b, 0x34, 0x30, 0x39, 0x36, 0x5d,
-    0x3b, 0x0a, 0x09, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x2e, 0x61, 0x6c, 0x69, 0x67,
-    0x6e, 0x20, 0x34, 0x20, 0x2e, 0x62, 0x38, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x5f, 0x6c,
-    0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x37, 0x33, 0x38, 0x36, 0x5f, 0x33,
-    0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x42, 0x73, 0x5f, 0x5f,
-    0x31, 0x5b, 0x34, 0x30, 0x39, 0x36, 0x5d, 0x3b, 0x0a, 0x0a, 0x09, 0x2e, 0x65, 0x6e, 0x74, 0x72,
-    0x79, 0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32,
-    0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x20, 0x28, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72, 0x61,
-    0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72,
-    0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32,
-    0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x43, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61, 0x72,
-    0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61,
-    0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33,
-    0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x41, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70, 0x61,
-    0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70,
-    0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73,
-    0x33, 0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x42, 0x2c, 0x0a, 0x09, 0x09, 0x2e, 0x70,
-    0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61,
-    0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62,
-    0x73, 0x33, 0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x41, 0x2c, 0x0a, 0x09, 0x09,
-    0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x5f, 0x5f, 0x63, 0x75,
-    0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c,
-    0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x29, 0x0a,
-    0x09, 0x7b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x25, 0x72,
-    0x3c, 0x35, 0x34, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x25, 0x66, 0x3c, 0x31, 0x30, 0x30, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20,
-    0x2e, 0x70, 0x72, 0x65, 0x64, 0x20, 0x25, 0x70, 0x3c, 0x34, 0x3e, 0x3b, 0x0a, 0x09, 0x2e, 0x6c,
-    0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x31, 0x31, 0x39, 0x09, 0x30, 0x0a, 0x24, 0x4c, 0x44, 0x57,
-    0x62, 0x65, 0x67, 0x69, 0x6e, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f,
-    0x62, 0x73, 0x33, 0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x3a, 0x0a, 0x09, 0x2e, 0x6c, 0x6f,
-    0x63, 0x09, 0x31, 0x36, 0x09, 0x36, 0x36, 0x09, 0x30, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75,
-    0x33, 0x32, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09, 0x25, 0x72, 0x31, 0x2c, 0x20, 0x25, 0x63, 0x74,
-    0x61, 0x69, 0x64, 0x2e, 0x78, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f,
-    0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x2c, 0x20,
-    0x33, 0x32, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x33, 0x32, 0x2e, 0x75, 0x31, 0x36,
-    0x20, 0x09, 0x25, 0x72, 0x33, 0x2c, 0x20, 0x25, 0x63, 0x74, 0x61, 0x69, 0x64, 0x2e, 0x79, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x34, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d,
-    0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f,
-    0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x41, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e,
-    0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x33,
-    0x2c, 0x20, 0x25, 0x72, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x2c, 0x20, 0x33, 0x32,
-    0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x37, 0x2c,
-    0x20, 0x25, 0x72, 0x36, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x38, 0x2c, 0x20, 0x25, 0x72, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x3b, 0x0a, 0x09,
-    0x73, 0x75, 0x62, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x39, 0x2c, 0x20, 0x25, 0x72,
-    0x38, 0x2c, 0x20, 0x31, 0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x33, 0x32, 0x2e, 0x75,
-    0x31, 0x36, 0x20, 0x09, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x74, 0x69, 0x64, 0x2e, 0x78,
-    0x3b, 0x0a, 0x09, 0x63, 0x76, 0x74, 0x2e, 0x75, 0x33, 0x32, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09,
-    0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x74, 0x69, 0x64, 0x2e, 0x79, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31,
-    0x32, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d,
-    0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x36, 0x34,
-    0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x6c,
-    0x74, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x2c,
-    0x20, 0x25, 0x72, 0x36, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x31, 0x20, 0x62, 0x72, 0x61, 0x20,
-    0x09, 0x24, 0x4c, 0x74, 0x5f, 0x33, 0x5f, 0x33, 0x33, 0x33, 0x30, 0x3b, 0x0a, 0x09, 0x6d, 0x6f,
-    0x76, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x33, 0x2c, 0x20, 0x5f, 0x5f, 0x63,
-    0x75, 0x64, 0x61, 0x5f, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x37,
-    0x33, 0x38, 0x32, 0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74,
-    0x5f, 0x41, 0x73, 0x5f, 0x5f, 0x30, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x31, 0x34, 0x2c, 0x20, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x5f, 0x6c,
-    0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x37, 0x33, 0x38, 0x36, 0x5f, 0x33,
-    0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0x5f, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x5f, 0x42, 0x73, 0x5f, 0x5f,
-    0x31, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x34, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61,
-    0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33,
-    0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x41, 0x5d, 0x3b, 0x0a, 0x09, 0x61, 0x64,
-    0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x34,
-    0x2c, 0x20, 0x33, 0x31, 0x3b, 0x0a, 0x09, 0x73, 0x68, 0x72, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x31, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x35, 0x2c, 0x20, 0x33, 0x31, 0x3b, 0x0a,
-    0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x37, 0x2c, 0x20,
-    0x33, 0x31, 0x3b, 0x0a, 0x09, 0x61, 0x6e, 0x64, 0x2e, 0x62, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x31, 0x38, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x37, 0x3b, 0x0a,
-    0x09, 0x61, 0x64, 0x64, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x39, 0x2c, 0x20,
-    0x25, 0x72, 0x31, 0x38, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x35, 0x3b, 0x0a, 0x09, 0x73, 0x68, 0x72,
-    0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x39,
-    0x2c, 0x20, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31, 0x32, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64,
-    0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f,
-    0x62, 0x73, 0x33, 0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32,
-    0x31, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x32, 0x3b, 0x0a, 0x09,
-    0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x32,
-    0x2c, 0x20, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75,
-    0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x33,
-    0x2c, 0x20, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x33, 0x32, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c,
-    0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x34, 0x2c,
-    0x20, 0x25, 0x72, 0x31, 0x31, 0x2c, 0x20, 0x31, 0x32, 0x38, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c,
-    0x32, 0x34, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x35, 0x2c,
-    0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c,
-    0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x31,
-    0x32, 0x2c, 0x20, 0x33, 0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x72, 0x32, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x32,
-    0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x38,
-    0x2c, 0x20, 0x25, 0x72, 0x32, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x36, 0x3b, 0x0a, 0x09, 0x61, 0x64,
-    0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x32,
-    0x33, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x34, 0x2c, 0x20, 0x25,
-    0x72, 0x31, 0x33, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x33, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x34, 0x3b,
-    0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x32, 0x2c,
-    0x20, 0x25, 0x72, 0x32, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x3b, 0x0a, 0x09, 0x61, 0x64,
-    0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x32,
-    0x38, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f,
-    0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x39,
-    0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x33, 0x35, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x32, 0x2c, 0x20, 0x34, 0x3b,
-    0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x33, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x36, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x6d, 0x75,
-    0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x37, 0x2c, 0x20,
-    0x25, 0x72, 0x33, 0x33, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x33, 0x38, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x34, 0x2c, 0x20, 0x25,
-    0x72, 0x31, 0x33, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x33, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x34, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x34, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x72, 0x34, 0x30, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72,
-    0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32,
-    0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e,
-    0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x30, 0x2c,
-    0x20, 0x25, 0x72, 0x33, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d,
-    0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x32, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63,
-    0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75,
-    0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x41, 0x5d, 0x3b,
-    0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x33, 0x2c,
-    0x20, 0x25, 0x72, 0x34, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x37, 0x3b, 0x0a, 0x09, 0x6d, 0x6f,
-    0x76, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30,
-    0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x2f, 0x2f, 0x20,
-    0x30, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x73, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x34,
-    0x2c, 0x20, 0x25, 0x72, 0x32, 0x30, 0x3b, 0x0a, 0x24, 0x4c, 0x74, 0x5f, 0x33, 0x5f, 0x32, 0x38,
-    0x31, 0x38, 0x3a, 0x0a, 0x20, 0x2f, 0x2f, 0x3c, 0x6c, 0x6f, 0x6f, 0x70, 0x3e, 0x20, 0x4c, 0x6f,
-    0x6f, 0x70, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x36, 0x2c,
-    0x20, 0x6e, 0x65, 0x73, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3a, 0x20,
-    0x31, 0x2c, 0x20, 0x65, 0x73, 0x74, 0x69, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x74, 0x65,
-    0x72, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x3a, 0x20, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e,
-    0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x38, 0x31, 0x09, 0x30, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x32, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x34, 0x33, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x73,
-    0x74, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25,
-    0x72, 0x33, 0x38, 0x2b, 0x30, 0x5d, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x3b, 0x0a, 0x09, 0x2e, 0x6c,
-    0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x38, 0x32, 0x09, 0x30, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x67,
-    0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x34, 0x31, 0x2b, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x73, 0x74, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x33, 0x39, 0x2b,
-    0x30, 0x5d, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31,
-    0x36, 0x09, 0x38, 0x35, 0x09, 0x30, 0x0a, 0x09, 0x62, 0x61, 0x72, 0x2e, 0x73, 0x79, 0x6e, 0x63,
-    0x20, 0x09, 0x30, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x39, 0x32,
-    0x09, 0x30, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x30, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x30, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x2c, 0x20,
-    0x25, 0x66, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x31, 0x32, 0x38, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x2c, 0x20, 0x25, 0x66,
-    0x37, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31,
-    0x30, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31,
-    0x31, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x32, 0x35, 0x36, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x32, 0x2c, 0x20, 0x25,
-    0x66, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x31, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x32, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x31, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x33, 0x38, 0x34,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31,
-    0x35, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x34, 0x2c, 0x20, 0x25,
-    0x66, 0x31, 0x32, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30,
-    0x2b, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33,
-    0x31, 0x2b, 0x35, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x31, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x36, 0x2c, 0x20, 0x25, 0x66,
-    0x31, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x39, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x32, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x30, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x36, 0x34, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x31,
-    0x39, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x31, 0x38, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x32, 0x32, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x32, 0x34, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x32, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x37, 0x36, 0x38, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x34,
-    0x2c, 0x20, 0x25, 0x66, 0x32, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x33, 0x2c, 0x20, 0x25, 0x66,
-    0x32, 0x31, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b,
-    0x32, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31,
-    0x2b, 0x38, 0x39, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x32, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x32,
-    0x36, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x34, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x38, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x30, 0x2b, 0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x32, 0x39, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x31, 0x30, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x32,
-    0x38, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x32, 0x37, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x33, 0x31, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x33, 0x36, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x33, 0x32, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x31, 0x31, 0x35, 0x32,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33,
-    0x33, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x32, 0x2c, 0x20, 0x25,
-    0x66, 0x33, 0x30, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30,
-    0x2b, 0x34, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33,
-    0x31, 0x2b, 0x31, 0x32, 0x38, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x34, 0x2c, 0x20, 0x25,
-    0x66, 0x33, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x33, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x37, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x34, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x38,
-    0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x31, 0x34, 0x30, 0x38, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x33, 0x39, 0x2c, 0x20, 0x25,
-    0x66, 0x33, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x33, 0x36, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x34, 0x38, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x34, 0x31, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x31, 0x35,
-    0x33, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x34, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x31, 0x2c,
-    0x20, 0x25, 0x66, 0x33, 0x39, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72,
-    0x33, 0x30, 0x2b, 0x35, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72,
-    0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x34, 0x2c, 0x20, 0x5b, 0x25,
-    0x72, 0x33, 0x31, 0x2b, 0x31, 0x36, 0x36, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x33, 0x2c,
-    0x20, 0x25, 0x66, 0x34, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x32, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34,
-    0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x35, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x34, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x31, 0x37, 0x39, 0x32, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x38, 0x2c,
-    0x20, 0x25, 0x66, 0x34, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x34,
-    0x35, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x34, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x36,
-    0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x30, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b,
-    0x31, 0x39, 0x32, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x35, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x35,
-    0x30, 0x2c, 0x20, 0x25, 0x66, 0x34, 0x38, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x32, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x30, 0x2b, 0x36, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x33, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x32, 0x30, 0x34, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x35,
-    0x32, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x31, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x35, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x36, 0x38, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09,
-    0x25, 0x66, 0x35, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x32, 0x31, 0x37, 0x36,
-    0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35,
-    0x37, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x36, 0x2c, 0x20, 0x25,
-    0x66, 0x35, 0x34, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30,
-    0x2b, 0x37, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x35, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33,
-    0x31, 0x2b, 0x32, 0x33, 0x30, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x38, 0x2c, 0x20, 0x25,
-    0x66, 0x35, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x35, 0x37, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x31, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x37, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e,
-    0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x32,
-    0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x32, 0x34, 0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x33, 0x2c, 0x20, 0x25,
-    0x66, 0x36, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x30, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x36, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x38, 0x30, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x36, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x32, 0x35,
-    0x36, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x36, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x35, 0x2c,
-    0x20, 0x25, 0x66, 0x36, 0x33, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x37, 0x2c, 0x20, 0x5b, 0x25, 0x72,
-    0x33, 0x30, 0x2b, 0x38, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72,
-    0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x38, 0x2c, 0x20, 0x5b, 0x25,
-    0x72, 0x33, 0x31, 0x2b, 0x32, 0x36, 0x38, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x36, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x37, 0x2c,
-    0x20, 0x25, 0x66, 0x36, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x36, 0x36, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37,
-    0x30, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x38, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x37, 0x31, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x32, 0x38, 0x31, 0x36, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x32, 0x2c,
-    0x20, 0x25, 0x66, 0x37, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x36,
-    0x39, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x33, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x39,
-    0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b,
-    0x32, 0x39, 0x34, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x37, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x37,
-    0x34, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x32, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x36, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x30, 0x2b, 0x39, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68,
-    0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x37, 0x2c, 0x20,
-    0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x33, 0x30, 0x37, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61,
-    0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x37, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x37,
-    0x36, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x37, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x35, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x37, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x30, 0x30, 0x5d, 0x3b,
-    0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x38, 0x30, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x33, 0x32, 0x30,
-    0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66,
-    0x38, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x37, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x30, 0x2c, 0x20,
-    0x25, 0x66, 0x37, 0x38, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x32, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33,
-    0x30, 0x2b, 0x31, 0x30, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72,
-    0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x33, 0x2c, 0x20, 0x5b, 0x25,
-    0x72, 0x33, 0x31, 0x2b, 0x33, 0x33, 0x32, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e,
-    0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x32, 0x2c,
-    0x20, 0x25, 0x66, 0x38, 0x33, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x31, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38,
-    0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x30, 0x38, 0x5d, 0x3b, 0x0a, 0x09,
-    0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x66, 0x38, 0x36, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x33, 0x34, 0x35, 0x36, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x37,
-    0x2c, 0x20, 0x25, 0x66, 0x38, 0x35, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x36, 0x2c, 0x20, 0x25, 0x66,
-    0x38, 0x34, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x38, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b,
-    0x31, 0x31, 0x32, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64,
-    0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x38, 0x39, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33,
-    0x31, 0x2b, 0x33, 0x35, 0x38, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x30, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x38, 0x2c, 0x20, 0x25,
-    0x66, 0x38, 0x39, 0x2c, 0x20, 0x25, 0x66, 0x38, 0x37, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x31, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64,
-    0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39,
-    0x32, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x33, 0x37, 0x31, 0x32, 0x5d, 0x3b, 0x0a,
-    0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x33, 0x2c, 0x20,
-    0x25, 0x66, 0x39, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x32, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x30,
-    0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x39, 0x34, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x32,
-    0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66,
-    0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x35, 0x2c, 0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b,
-    0x33, 0x38, 0x34, 0x30, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20,
-    0x09, 0x25, 0x66, 0x39, 0x36, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x34, 0x2c, 0x20, 0x25, 0x66, 0x39,
-    0x35, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x33, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73, 0x68, 0x61,
-    0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x37, 0x2c, 0x20, 0x5b,
-    0x25, 0x72, 0x33, 0x30, 0x2b, 0x31, 0x32, 0x34, 0x5d, 0x3b, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x73,
-    0x68, 0x61, 0x72, 0x65, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x39, 0x38, 0x2c,
-    0x20, 0x5b, 0x25, 0x72, 0x33, 0x31, 0x2b, 0x33, 0x39, 0x36, 0x38, 0x5d, 0x3b, 0x0a, 0x09, 0x6d,
-    0x61, 0x64, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x25, 0x66, 0x39,
-    0x37, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x38, 0x2c, 0x20, 0x25, 0x66, 0x39, 0x36, 0x3b, 0x0a, 0x09,
-    0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09, 0x39, 0x37, 0x09, 0x30, 0x0a, 0x09, 0x62, 0x61,
-    0x72, 0x2e, 0x73, 0x79, 0x6e, 0x63, 0x20, 0x09, 0x30, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63,
-    0x09, 0x31, 0x36, 0x09, 0x36, 0x36, 0x09, 0x30, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33,
-    0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x36, 0x2c, 0x20, 0x25,
-    0x72, 0x34, 0x31, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x37, 0x2c, 0x20, 0x25, 0x72, 0x37, 0x2c, 0x20, 0x33, 0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64,
-    0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x33, 0x2c, 0x20, 0x25, 0x72, 0x34,
-    0x33, 0x2c, 0x20, 0x31, 0x32, 0x38, 0x3b, 0x0a, 0x09, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x67, 0x65,
-    0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x70, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x39, 0x2c, 0x20,
-    0x25, 0x72, 0x37, 0x3b, 0x0a, 0x09, 0x40, 0x25, 0x70, 0x32, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09,
-    0x24, 0x4c, 0x74, 0x5f, 0x33, 0x5f, 0x32, 0x38, 0x31, 0x38, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61,
-    0x2e, 0x75, 0x6e, 0x69, 0x20, 0x09, 0x24, 0x4c, 0x74, 0x5f, 0x33, 0x5f, 0x32, 0x33, 0x30, 0x36,
-    0x3b, 0x0a, 0x24, 0x4c, 0x74, 0x5f, 0x33, 0x5f, 0x33, 0x33, 0x33, 0x30, 0x3a, 0x0a, 0x09, 0x6c,
-    0x64, 0x2e, 0x70, 0x61, 0x72, 0x61, 0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x31,
-    0x32, 0x2c, 0x20, 0x5b, 0x5f, 0x5f, 0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d,
-    0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x36, 0x34,
-    0x62, 0x69, 0x74, 0x5f, 0x77, 0x42, 0x5d, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f,
-    0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x31,
-    0x2c, 0x20, 0x25, 0x72, 0x31, 0x32, 0x3b, 0x0a, 0x09, 0x6d, 0x6f, 0x76, 0x2e, 0x66, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x30, 0x66, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
-    0x30, 0x3b, 0x20, 0x20, 0x20, 0x20, 0x20, 0x09, 0x2f, 0x2f, 0x20, 0x30, 0x0a, 0x24, 0x4c, 0x74,
-    0x5f, 0x33, 0x5f, 0x32, 0x33, 0x30, 0x36, 0x3a, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31,
-    0x36, 0x09, 0x31, 0x30, 0x33, 0x09, 0x30, 0x0a, 0x09, 0x6c, 0x64, 0x2e, 0x70, 0x61, 0x72, 0x61,
-    0x6d, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x35, 0x2c, 0x20, 0x5b, 0x5f, 0x5f,
-    0x63, 0x75, 0x64, 0x61, 0x70, 0x61, 0x72, 0x6d, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d,
-    0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x5f, 0x43, 0x5d,
-    0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25,
-    0x72, 0x34, 0x36, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x33, 0x3b, 0x0a,
-    0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x37, 0x2c, 0x20,
-    0x25, 0x72, 0x31, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x36, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x2e,
-    0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x34, 0x38, 0x2c, 0x20, 0x25, 0x72,
-    0x34, 0x37, 0x2c, 0x20, 0x33, 0x32, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32,
-    0x20, 0x09, 0x25, 0x72, 0x34, 0x39, 0x2c, 0x20, 0x25, 0x72, 0x32, 0x31, 0x2c, 0x20, 0x25, 0x72,
-    0x34, 0x38, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72,
-    0x35, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x31, 0x30, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x39, 0x3b, 0x0a,
-    0x09, 0x6d, 0x75, 0x6c, 0x2e, 0x6c, 0x6f, 0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35,
-    0x31, 0x2c, 0x20, 0x25, 0x72, 0x35, 0x30, 0x2c, 0x20, 0x34, 0x3b, 0x0a, 0x09, 0x61, 0x64, 0x64,
-    0x2e, 0x75, 0x33, 0x32, 0x20, 0x09, 0x25, 0x72, 0x35, 0x32, 0x2c, 0x20, 0x25, 0x72, 0x34, 0x35,
-    0x2c, 0x20, 0x25, 0x72, 0x35, 0x31, 0x3b, 0x0a, 0x09, 0x73, 0x74, 0x2e, 0x67, 0x6c, 0x6f, 0x62,
-    0x61, 0x6c, 0x2e, 0x66, 0x33, 0x32, 0x20, 0x09, 0x5b, 0x25, 0x72, 0x35, 0x32, 0x2b, 0x30, 0x5d,
-    0x2c, 0x20, 0x25, 0x66, 0x31, 0x3b, 0x0a, 0x09, 0x2e, 0x6c, 0x6f, 0x63, 0x09, 0x31, 0x36, 0x09,
-    0x31, 0x32, 0x32, 0x09, 0x30, 0x0a, 0x09, 0x65, 0x78, 0x69, 0x74, 0x3b, 0x0a, 0x24, 0x4c, 0x44,
-    0x57, 0x65, 0x6e, 0x64, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62,
-    0x73, 0x33, 0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x3a, 0x0a, 0x09, 0x7d, 0x20, 0x2f, 0x2f,
-    0x20, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d, 0x75, 0x6c, 0x5f, 0x62, 0x73, 0x33, 0x32, 0x5f,
-    0x36, 0x34, 0x62, 0x69, 0x74, 0x0a, 0x0a, 0x00
-};
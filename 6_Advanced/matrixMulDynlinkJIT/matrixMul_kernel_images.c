@@ -0,0 +1,937 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// This file is auto-generated by embedKernelImages, do not edit
+////////////////////////////////////////////////////////////////////////////////
+#include "matrixMul_kernel_images.h"
+
+static const unsigned char matrixMul_kernel_32_data[5327] = {
+    0xf1, 0x82, 0x09, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+    0x31, 0x2e, 0x34, 0x0a, 0x09, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74,
+    0x20, 0x73, 0x6d, 0x5f, 0x31, 0x30, 0x2c, 0x20, 0x6d, 0x61, 0x70, 0x5f,
+    0x66, 0x36, 0x34, 0x5f, 0x74, 0x6f, 0x5f, 0x66, 0x33, 0x32, 0x0a, 0x09,
+    0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x64, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x43, 0x3a, 0x5c, 0x50, 0x72, 0x6f, 0x67,
+    0x72, 0x61, 0x6d, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x4e, 0x56,
+    0x49, 0x44, 0x49, 0x41, 0x20, 0x47, 0x50, 0x55, 0x20, 0x43, 0x6f, 0x6d,
+    0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x54, 0x6f, 0x6f, 0x6c, 0x6b,
+    0x69, 0x74, 0x5c, 0x43, 0x55, 0x44, 0x41, 0x5c, 0x76, 0x34, 0x2e, 0x30,
+    0x5c, 0x5c, 0x62, 0x69, 0x6e, 0x2f, 0x2e, 0x2e, 0x2f, 0x6f, 0x70, 0x65,
+    0x6e, 0x36, 0x34, 0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x2f, 0x62, 0x65, 0x2e,
+    0x65, 0x78, 0x65, 0x65, 0x00, 0x20, 0x6e, 0x76, 0x19, 0x00, 0xf0, 0x0c,
+    0x63, 0x63, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x74,
+    0x20, 0x6f, 0x6e, 0x20, 0x32, 0x30, 0x31, 0x31, 0x2d, 0x30, 0x32, 0x2d,
+    0x32, 0x31, 0x0a, 0x26, 0x00, 0x1f, 0x2d, 0x01, 0x00, 0x27, 0x01, 0x65,
+    0x00, 0x00, 0xa0, 0x00, 0x20, 0x69, 0x6c, 0xa0, 0x00, 0xf1, 0x29, 0x43,
+    0x3a, 0x2f, 0x55, 0x73, 0x65, 0x72, 0x73, 0x2f, 0x45, 0x59, 0x4f, 0x55,
+    0x4e, 0x47, 0x7e, 0x31, 0x2e, 0x43, 0x4f, 0x4d, 0x2f, 0x41, 0x70, 0x70,
+    0x44, 0x61, 0x74, 0x61, 0x2f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x54,
+    0x65, 0x6d, 0x70, 0x2f, 0x74, 0x6d, 0x70, 0x78, 0x66, 0x74, 0x5f, 0x30,
+    0x30, 0x30, 0x30, 0x31, 0x34, 0x63, 0x30, 0x09, 0x00, 0x00, 0x01, 0x00,
+    0xff, 0x0e, 0x2d, 0x31, 0x31, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78,
+    0x4d, 0x75, 0x6c, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x2e, 0x63,
+    0x70, 0x70, 0x33, 0x2e, 0x69, 0x20, 0x28, 0x5e, 0x00, 0x16, 0xdf, 0x63,
+    0x63, 0x42, 0x49, 0x23, 0x2e, 0x61, 0x30, 0x34, 0x30, 0x30, 0x30, 0x29,
+    0xe2, 0x00, 0x2d, 0x0f, 0x22, 0x01, 0x31, 0x8f, 0x4f, 0x70, 0x74, 0x69,
+    0x6f, 0x6e, 0x73, 0x3a, 0x4c, 0x00, 0x31, 0x21, 0x20, 0x54, 0x5a, 0x02,
+    0xa3, 0x3a, 0x70, 0x74, 0x78, 0x2c, 0x20, 0x49, 0x53, 0x41, 0x3a, 0x63,
+    0x02, 0xf3, 0x0d, 0x45, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x3a, 0x6c, 0x69,
+    0x74, 0x74, 0x6c, 0x65, 0x2c, 0x20, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x65,
+    0x72, 0x20, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x73, 0x02, 0x60, 0x20, 0x2d,
+    0x4f, 0x33, 0x09, 0x28, 0x8d, 0x00, 0x40, 0x6d, 0x69, 0x7a, 0x61, 0x93,
+    0x00, 0x61, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x24, 0x01, 0xca, 0x20,
+    0x20, 0x2d, 0x67, 0x30, 0x09, 0x28, 0x44, 0x65, 0x62, 0x75, 0x67, 0x17,
+    0x00, 0xff, 0x06, 0x6d, 0x32, 0x09, 0x28, 0x52, 0x65, 0x70, 0x6f, 0x72,
+    0x74, 0x20, 0x61, 0x64, 0x76, 0x69, 0x73, 0x6f, 0x72, 0x69, 0x65, 0x73,
+    0x58, 0x01, 0x30, 0x9f, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x31, 0x09,
+    0x22, 0x37, 0x02, 0x30, 0x1f, 0x30, 0x37, 0x02, 0x00, 0xb4, 0x75, 0x64,
+    0x61, 0x66, 0x65, 0x32, 0x2e, 0x67, 0x70, 0x75, 0x22, 0x6d, 0x00, 0x10,
+    0x32, 0x6d, 0x00, 0xf5, 0x0d, 0x5c, 0x76, 0x73, 0x32, 0x30, 0x30, 0x35,
+    0x5c, 0x56, 0x43, 0x5c, 0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x45, 0x5c,
+    0x63, 0x72, 0x74, 0x64, 0x65, 0x66, 0x73, 0x2e, 0x68, 0x2a, 0x00, 0x11,
+    0x33, 0x97, 0x00, 0x09, 0x94, 0x03, 0x1f, 0x2f, 0x94, 0x03, 0x09, 0x10,
+    0x2f, 0x94, 0x03, 0x10, 0x2f, 0x94, 0x03, 0x90, 0x2f, 0x2f, 0x69, 0x6e,
+    0x63, 0x6c, 0x75, 0x64, 0x65, 0x56, 0x00, 0xf7, 0x00, 0x2f, 0x64, 0x65,
+    0x76, 0x69, 0x63, 0x65, 0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65,
+    0x61, 0x00, 0x1f, 0x34, 0x61, 0x00, 0x30, 0xb8, 0x68, 0x6f, 0x73, 0x74,
+    0x5f, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0xbc, 0x00, 0x1f, 0x35, 0x5b,
+    0x00, 0x30, 0x01, 0x2d, 0x04, 0x69, 0x69, 0x6e, 0x5f, 0x74, 0x79, 0x70,
+    0x5c, 0x00, 0x73, 0x36, 0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x5c, 0x00,
+    0x00, 0x13, 0x00, 0xc1, 0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61,
+    0x20, 0x67, 0x70, 0x75, 0xd6, 0x04, 0x02, 0x5c, 0x00, 0x13, 0x74, 0xac,
+    0x04, 0x00, 0x87, 0x01, 0x02, 0xac, 0x04, 0x04, 0x5b, 0x00, 0x03, 0x13,
+    0x01, 0x0c, 0x5a, 0x00, 0x1f, 0x37, 0x5a, 0x00, 0x30, 0x5d, 0x72, 0x69,
+    0x76, 0x65, 0x72, 0x5a, 0x00, 0x1f, 0x38, 0x5a, 0x00, 0x2f, 0x5f, 0x73,
+    0x75, 0x72, 0x66, 0x61, 0xb5, 0x00, 0x00, 0x1f, 0x39, 0x5b, 0x00, 0x2f,
+    0x6e, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x5b, 0x00, 0x2f, 0x31, 0x30,
+    0x5c, 0x00, 0x2f, 0x5e, 0x76, 0x65, 0x63, 0x74, 0x6f, 0x11, 0x01, 0x2f,
+    0x31, 0x31, 0x5b, 0x00, 0x2f, 0x0f, 0x21, 0x02, 0x05, 0x2f, 0x31, 0x32,
+    0x5c, 0x00, 0x2f, 0x0f, 0xd8, 0x02, 0x04, 0x1f, 0x31, 0x95, 0x03, 0x31,
+    0x03, 0x7e, 0x02, 0xf9, 0x01, 0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x5f,
+    0x70, 0x61, 0x72, 0x61, 0x6d, 0x65, 0x74, 0x65, 0x72, 0x68, 0x00, 0x1f,
+    0x34, 0xc3, 0x00, 0x2f, 0xf9, 0x01, 0x63, 0x72, 0x74, 0x5c, 0x73, 0x74,
+    0x6f, 0x72, 0x61, 0x67, 0x65, 0x5f, 0x63, 0x6c, 0x61, 0x73, 0x60, 0x00,
+    0x01, 0xa1, 0x03, 0x0f, 0x87, 0x04, 0x00, 0x0b, 0x23, 0x04, 0x90, 0x31,
+    0x36, 0x09, 0x22, 0x68, 0x3a, 0x2f, 0x73, 0x77, 0x46, 0x04, 0xa2, 0x72,
+    0x65, 0x6c, 0x2f, 0x53, 0x44, 0x4b, 0x31, 0x30, 0x2f, 0xe7, 0x00, 0x85,
+    0x65, 0x2f, 0x43, 0x2f, 0x73, 0x72, 0x63, 0x2f, 0xf8, 0x04, 0x36, 0x44,
+    0x72, 0x76, 0x0d, 0x00, 0x06, 0x05, 0x05, 0x06, 0x4e, 0x00, 0x1f, 0x37,
+    0xd3, 0x04, 0x31, 0xa1, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x5f, 0x66, 0x75,
+    0x6e, 0x63, 0xd3, 0x06, 0x08, 0xae, 0x00, 0x0f, 0x67, 0x03, 0x30, 0x4f,
+    0x6d, 0x61, 0x74, 0x68, 0x5d, 0x00, 0x03, 0x0f, 0x69, 0x03, 0x30, 0x01,
+    0x5d, 0x00, 0x88, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x5d,
+    0x00, 0x1f, 0x32, 0x6a, 0x03, 0x30, 0x03, 0x57, 0x02, 0x0f, 0xbc, 0x00,
+    0x01, 0x1f, 0x32, 0x6e, 0x03, 0x30, 0x00, 0xe5, 0x07, 0x8f, 0x31, 0x5f,
+    0x61, 0x74, 0x6f, 0x6d, 0x69, 0x63, 0x65, 0x00, 0x03, 0x0f, 0x77, 0x03,
+    0x30, 0x00, 0x65, 0x00, 0x1f, 0x32, 0x65, 0x00, 0x0a, 0x1f, 0x33, 0x65,
+    0x00, 0x33, 0x7f, 0x33, 0x5f, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x2f, 0x01,
+    0x04, 0x0f, 0x7e, 0x03, 0x30, 0x5f, 0x73, 0x6d, 0x5f, 0x32, 0x30, 0xca,
+    0x00, 0x0a, 0x1f, 0x35, 0x65, 0x00, 0x35, 0x99, 0x69, 0x6e, 0x74, 0x72,
+    0x69, 0x6e, 0x73, 0x69, 0x63, 0x5f, 0x00, 0x0f, 0x27, 0x07, 0x30, 0x04,
+    0x73, 0x06, 0x0f, 0xbf, 0x00, 0x02, 0x0f, 0x2d, 0x07, 0x30, 0x04, 0x78,
+    0x06, 0x4f, 0x66, 0x65, 0x74, 0x63, 0x75, 0x03, 0x03, 0x1f, 0x32, 0xd2,
+    0x03, 0x3e, 0x90, 0x5f, 0x64, 0x62, 0x6c, 0x5f, 0x70, 0x74, 0x78, 0x31,
+    0x66, 0x00, 0xf0, 0x0a, 0x0a, 0x09, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65,
+    0x64, 0x20, 0x2e, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x20, 0x34, 0x20, 0x2e,
+    0x62, 0x38, 0x20, 0x5f, 0x5f, 0x46, 0x00, 0x20, 0x5f, 0x6c, 0xf7, 0x09,
+    0xf2, 0x02, 0x5f, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x37, 0x33, 0x38, 0x32,
+    0x5f, 0x33, 0x38, 0x5f, 0x6e, 0x6f, 0x6e, 0xc0, 0x03, 0xdf, 0x5f, 0x41,
+    0x73, 0x5f, 0x5f, 0x36, 0x5b, 0x31, 0x30, 0x32, 0x34, 0x5d, 0x3b, 0x47,
+    0x00, 0x19, 0x1a, 0x36, 0x47, 0x00, 0x54, 0x42, 0x73, 0x5f, 0x5f, 0x37,
+    0x47, 0x00, 0x96, 0x0a, 0x09, 0x2e, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20,
+    0x45, 0x05, 0xf1, 0x01, 0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62,
+    0x69, 0x74, 0x20, 0x28, 0x0a, 0x09, 0x09, 0x2e, 0x2e, 0x06, 0x53, 0x20,
+    0x2e, 0x75, 0x33, 0x32, 0x5f, 0x00, 0x47, 0x70, 0x61, 0x72, 0x6d, 0x7a,
+    0x0a, 0x06, 0x30, 0x00, 0x3f, 0x5f, 0x43, 0x2c, 0x31, 0x00, 0x1c, 0x1f,
+    0x41, 0x31, 0x00, 0x1d, 0x18, 0x42, 0x31, 0x00, 0x1f, 0x73, 0x31, 0x00,
+    0x10, 0x19, 0x77, 0x63, 0x00, 0x0f, 0x32, 0x00, 0x12, 0xb2, 0x42, 0x29,
+    0x0a, 0x09, 0x7b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x95, 0x00, 0x60,
+    0x25, 0x72, 0x3c, 0x35, 0x37, 0x3e, 0x74, 0x01, 0x01, 0x13, 0x00, 0x10,
+    0x66, 0x13, 0x00, 0x46, 0x66, 0x3c, 0x35, 0x32, 0x13, 0x00, 0x10, 0x70,
+    0x8a, 0x01, 0x41, 0x25, 0x70, 0x3c, 0x34, 0x13, 0x00, 0x30, 0x6c, 0x6f,
+    0x63, 0xc7, 0x06, 0xff, 0x00, 0x31, 0x30, 0x37, 0x09, 0x30, 0x0a, 0x24,
+    0x4c, 0x44, 0x57, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x6e, 0x00, 0x02, 0x16,
+    0x3a, 0x2f, 0x00, 0x90, 0x36, 0x36, 0x09, 0x30, 0x0a, 0x09, 0x63, 0x76,
+    0x74, 0xa6, 0x00, 0xf1, 0x0f, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09, 0x25,
+    0x72, 0x31, 0x2c, 0x20, 0x25, 0x63, 0x74, 0x61, 0x69, 0x64, 0x2e, 0x78,
+    0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f, 0xc8,
+    0x00, 0x61, 0x09, 0x25, 0x72, 0x32, 0x2c, 0x20, 0x23, 0x00, 0x3d, 0x31,
+    0x36, 0x3b, 0x3a, 0x00, 0x15, 0x33, 0x3a, 0x00, 0x62, 0x79, 0x3b, 0x0a,
+    0x09, 0x6c, 0x64, 0x03, 0x01, 0x04, 0x3a, 0x00, 0x4f, 0x34, 0x2c, 0x20,
+    0x5b, 0x3b, 0x01, 0x0f, 0x00, 0x68, 0x02, 0x37, 0x6d, 0x75, 0x6c, 0x72,
+    0x00, 0x10, 0x35, 0x72, 0x00, 0x00, 0x5b, 0x00, 0x2d, 0x72, 0x34, 0x1c,
+    0x00, 0x10, 0x36, 0x17, 0x00, 0x13, 0x35, 0x8e, 0x00, 0x34, 0x61, 0x64,
+    0x64, 0x18, 0x00, 0x10, 0x37, 0x18, 0x00, 0x01, 0x1d, 0x00, 0x00, 0x34,
+    0x00, 0x34, 0x73, 0x75, 0x62, 0x19, 0x00, 0x10, 0x38, 0x14, 0x00, 0x4e,
+    0x37, 0x2c, 0x20, 0x31, 0xbe, 0x00, 0x53, 0x39, 0x2c, 0x20, 0x25, 0x74,
+    0xf6, 0x00, 0x0c, 0x13, 0x01, 0x13, 0x30, 0x1c, 0x00, 0x0f, 0xd8, 0x00,
+    0x01, 0x2f, 0x31, 0x31, 0xd9, 0x00, 0x11, 0x10, 0x42, 0xd9, 0x00, 0x61,
+    0x73, 0x65, 0x74, 0x70, 0x2e, 0x6c, 0x5b, 0x00, 0x40, 0x20, 0x09, 0x25,
+    0x70, 0x6a, 0x01, 0x02, 0x92, 0x00, 0x00, 0xbf, 0x00, 0xf0, 0x05, 0x40,
+    0x25, 0x70, 0x31, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x24, 0x4c, 0x74,
+    0x5f, 0x30, 0x5f, 0x33, 0x33, 0x33, 0x30, 0xf1, 0x00, 0x21, 0x6f, 0x76,
+    0x12, 0x02, 0x00, 0x6a, 0x00, 0x2f, 0x32, 0x2c, 0xb6, 0x03, 0x17, 0x0b,
+    0x3b, 0x00, 0x1f, 0x33, 0x3b, 0x00, 0x04, 0x0f, 0xaa, 0x03, 0x01, 0x0f,
+    0xbd, 0x01, 0x2a, 0x07, 0x86, 0x01, 0x21, 0x31, 0x34, 0x82, 0x01, 0x40,
+    0x2c, 0x20, 0x31, 0x35, 0xfd, 0x00, 0x25, 0x68, 0x72, 0x19, 0x00, 0x01,
+    0xd4, 0x01, 0x00, 0x1f, 0x00, 0x10, 0x33, 0x89, 0x01, 0x00, 0xa8, 0x00,
+    0x04, 0x1a, 0x00, 0x13, 0x36, 0x2e, 0x00, 0x53, 0x61, 0x6e, 0x64, 0x2e,
+    0x62, 0x14, 0x00, 0x01, 0xce, 0x01, 0x03, 0x34, 0x00, 0x0b, 0xe9, 0x01,
+    0x11, 0x31, 0x3f, 0x01, 0x03, 0x22, 0x00, 0x01, 0xec, 0x01, 0x07, 0x66,
+    0x00, 0x00, 0xd2, 0x01, 0x01, 0x22, 0x00, 0x00, 0x19, 0x00, 0x0f, 0xb7,
+    0x01, 0x28, 0x0a, 0x74, 0x02, 0x10, 0x32, 0x0d, 0x02, 0x02, 0x13, 0x02,
+    0x21, 0x72, 0x31, 0xbf, 0x00, 0x0a, 0x1f, 0x00, 0x01, 0xd6, 0x01, 0x02,
+    0x1f, 0x00, 0x03, 0xb1, 0x02, 0x02, 0x41, 0x03, 0x03, 0x8a, 0x01, 0x12,
+    0x32, 0x42, 0x03, 0x13, 0x30, 0xb5, 0x02, 0x0d, 0x1f, 0x00, 0x01, 0xea,
+    0x02, 0x00, 0x1f, 0x00, 0x1f, 0x36, 0x3e, 0x00, 0x02, 0x01, 0x53, 0x01,
+    0x12, 0x39, 0xd3, 0x00, 0x0b, 0x79, 0x00, 0x02, 0x21, 0x01, 0x04, 0x9c,
+    0x03, 0x07, 0x25, 0x01, 0x11, 0x32, 0x0a, 0x03, 0x02, 0xb8, 0x00, 0x1b,
+    0x32, 0x1b, 0x00, 0x01, 0x3a, 0x01, 0x02, 0xb4, 0x00, 0x04, 0x36, 0x00,
+    0x04, 0x6b, 0x00, 0x01, 0x5b, 0x01, 0x01, 0x44, 0x01, 0x14, 0x32, 0x36,
+    0x00, 0x04, 0x1b, 0x00, 0x02, 0x16, 0x00, 0x02, 0xab, 0x00, 0x0b, 0x1c,
+    0x00, 0x12, 0x33, 0x67, 0x00, 0x01, 0xa8, 0x00, 0x2a, 0x31, 0x33, 0x6e,
+    0x00, 0x11, 0x33, 0x68, 0x00, 0x02, 0x8f, 0x00, 0x1b, 0x39, 0x1b, 0x00,
+    0x01, 0x17, 0x01, 0x02, 0x8f, 0x00, 0x00, 0x1b, 0x00, 0x03, 0xdc, 0x00,
+    0x04, 0x55, 0x00, 0x01, 0x6b, 0x00, 0x00, 0x92, 0x00, 0x07, 0xf8, 0x00,
+    0x04, 0x1c, 0x00, 0x01, 0x6b, 0x00, 0x00, 0x5b, 0x00, 0x0f, 0x1c, 0x00,
+    0x00, 0x01, 0x14, 0x01, 0x00, 0x1a, 0x01, 0x0f, 0x1c, 0x00, 0x00, 0x01,
+    0x87, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1c, 0x00, 0x08, 0xc2, 0x00, 0x01,
+    0x85, 0x00, 0x02, 0x73, 0x00, 0x0d, 0xde, 0x00, 0x01, 0x15, 0x01, 0x03,
+    0x1c, 0x00, 0x0c, 0xde, 0x00, 0x02, 0x16, 0x01, 0x02, 0xd6, 0x03, 0x08,
+    0x72, 0x02, 0x03, 0x3c, 0x00, 0x2f, 0x34, 0x30, 0x72, 0x02, 0x10, 0x01,
+    0x71, 0x02, 0x07, 0x71, 0x00, 0x11, 0x34, 0x4f, 0x00, 0x00, 0x3b, 0x00,
+    0x00, 0xea, 0x00, 0x0f, 0x56, 0x00, 0x01, 0x1f, 0x32, 0x56, 0x00, 0x10,
+    0x05, 0x9a, 0x03, 0x04, 0x35, 0x00, 0x01, 0xc1, 0x00, 0x02, 0x02, 0x01,
+    0x1b, 0x34, 0x13, 0x02, 0x12, 0x34, 0x50, 0x01, 0x01, 0xcd, 0x00, 0x0e,
+    0x8a, 0x01, 0x11, 0x34, 0x52, 0x01, 0x00, 0x24, 0x00, 0x0b, 0x36, 0x01,
+    0x12, 0x34, 0x4d, 0x00, 0x02, 0x1f, 0x00, 0x00, 0x53, 0x00, 0x00, 0xd6,
+    0x03, 0x00, 0xb8, 0x06, 0x84, 0x09, 0x25, 0x66, 0x31, 0x2c, 0x20, 0x30,
+    0x66, 0x45, 0x12, 0x20, 0x3b, 0x20, 0x01, 0x00, 0x00, 0xf3, 0x12, 0x19,
+    0x30, 0xfb, 0x03, 0x12, 0x34, 0xc5, 0x03, 0x32, 0x39, 0x3b, 0x0a, 0x00,
+    0x05, 0xf1, 0x17, 0x32, 0x38, 0x31, 0x38, 0x3a, 0x0a, 0x20, 0x2f, 0x2f,
+    0x3c, 0x6c, 0x6f, 0x6f, 0x70, 0x3e, 0x20, 0x4c, 0x6f, 0x6f, 0x70, 0x20,
+    0x62, 0x6f, 0x64, 0x79, 0x20, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x36, 0x36,
+    0x2c, 0x20, 0x6e, 0x65, 0x73, 0x17, 0x09, 0xa0, 0x64, 0x65, 0x70, 0x74,
+    0x68, 0x3a, 0x20, 0x31, 0x2c, 0x20, 0x11, 0x00, 0xa1, 0x6d, 0x61, 0x74,
+    0x65, 0x64, 0x20, 0x69, 0x74, 0x65, 0x72, 0x7c, 0x13, 0xa6, 0x73, 0x3a,
+    0x20, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77, 0x6e, 0xf9, 0x06, 0x20, 0x38,
+    0x31, 0xf9, 0x06, 0x94, 0x6c, 0x64, 0x2e, 0x67, 0x6c, 0x6f, 0x62, 0x61,
+    0x6c, 0xa8, 0x00, 0x00, 0x4b, 0x01, 0x00, 0x1d, 0x01, 0x21, 0x2b, 0x30,
+    0xae, 0x05, 0x13, 0x74, 0xf1, 0x08, 0x02, 0x1f, 0x00, 0x10, 0x5b, 0x1a,
+    0x02, 0x70, 0x2b, 0x30, 0x5d, 0x2c, 0x20, 0x25, 0x66, 0xe0, 0x00, 0x05,
+    0x4c, 0x00, 0x1f, 0x32, 0x4c, 0x00, 0x02, 0x12, 0x33, 0x4c, 0x00, 0x1f,
+    0x31, 0x4c, 0x00, 0x06, 0x13, 0x38, 0x4c, 0x00, 0x00, 0x46, 0x02, 0x05,
+    0x4c, 0x00, 0x10, 0x35, 0x4c, 0x00, 0xa0, 0x62, 0x61, 0x72, 0x2e, 0x73,
+    0x79, 0x6e, 0x63, 0x20, 0x09, 0x01, 0x06, 0x04, 0x1c, 0x00, 0x14, 0x39,
+    0x68, 0x00, 0x08, 0x49, 0x00, 0x20, 0x25, 0x66, 0x9a, 0x05, 0x00, 0x92,
+    0x03, 0x02, 0x68, 0x00, 0x0d, 0x1f, 0x00, 0x11, 0x35, 0x1f, 0x00, 0x22,
+    0x33, 0x30, 0x1f, 0x00, 0x25, 0x6d, 0x61, 0x19, 0x00, 0x00, 0xaf, 0x01,
+    0x00, 0x3d, 0x00, 0x01, 0x23, 0x00, 0x20, 0x25, 0x66, 0xc9, 0x04, 0x0d,
+    0x3d, 0x00, 0x14, 0x37, 0x5c, 0x00, 0x01, 0xff, 0x09, 0x0d, 0x1f, 0x00,
+    0x14, 0x38, 0x5c, 0x00, 0x11, 0x36, 0x20, 0x00, 0x07, 0x5d, 0x00, 0x00,
+    0x3d, 0x02, 0x00, 0x3e, 0x00, 0x01, 0x24, 0x00, 0x20, 0x25, 0x66, 0x5a,
+    0x04, 0x0d, 0x3e, 0x00, 0x00, 0xe4, 0x04, 0x02, 0x5e, 0x00, 0x1f, 0x38,
+    0x5e, 0x00, 0x02, 0x01, 0xa1, 0x05, 0x01, 0x5f, 0x00, 0x21, 0x31, 0x32,
+    0x22, 0x00, 0x07, 0x60, 0x00, 0x00, 0x0a, 0x07, 0x02, 0x42, 0x00, 0x02,
+    0x28, 0x00, 0x20, 0x25, 0x66, 0xaa, 0x02, 0x0e, 0x43, 0x00, 0x02, 0x85,
+    0x01, 0x5f, 0x32, 0x39, 0x2b, 0x31, 0x32, 0x64, 0x00, 0x03, 0x02, 0x3e,
+    0x01, 0x00, 0x64, 0x00, 0x11, 0x39, 0x22, 0x00, 0x08, 0x64, 0x00, 0x02,
+    0x18, 0x01, 0x00, 0x2a, 0x03, 0x01, 0x28, 0x00, 0x00, 0x76, 0x00, 0x0f,
+    0x44, 0x00, 0x02, 0x15, 0x36, 0x65, 0x00, 0x1f, 0x36, 0x65, 0x00, 0x03,
+    0x02, 0x47, 0x01, 0x51, 0x33, 0x30, 0x2b, 0x32, 0x35, 0x22, 0x00, 0x08,
+    0x65, 0x00, 0x01, 0x20, 0x01, 0x00, 0x43, 0x00, 0x02, 0x28, 0x00, 0x00,
+    0x77, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x14, 0x39, 0x65, 0x00, 0x1f, 0x32,
+    0xe8, 0x01, 0x03, 0x00, 0xde, 0x05, 0x02, 0x65, 0x00, 0x12, 0x33, 0x22,
+    0x00, 0x07, 0x65, 0x00, 0x01, 0x93, 0x04, 0x01, 0x43, 0x00, 0x02, 0x28,
+    0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x02, 0x00, 0x03, 0x00,
+    0x65, 0x00, 0x0f, 0xf1, 0x01, 0x03, 0x00, 0xf2, 0x05, 0x03, 0x65, 0x00,
+    0x1c, 0x38, 0xf3, 0x01, 0x01, 0xf2, 0x05, 0x01, 0x43, 0x00, 0x02, 0x28,
+    0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x02, 0x92, 0x02, 0x00,
+    0x65, 0x00, 0x0f, 0xf8, 0x01, 0x03, 0x00, 0x1f, 0x06, 0x02, 0x65, 0x00,
+    0x2c, 0x34, 0x34, 0xf8, 0x01, 0x01, 0x20, 0x06, 0x01, 0x43, 0x00, 0x02,
+    0x28, 0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x02, 0x9b, 0x02,
+    0x4f, 0x32, 0x39, 0x2b, 0x33, 0xf9, 0x01, 0x03, 0x00, 0xc2, 0x06, 0x02,
+    0x65, 0x00, 0x12, 0x35, 0x1b, 0x02, 0x07, 0x65, 0x00, 0x01, 0xc2, 0x06,
+    0x01, 0x43, 0x00, 0x02, 0x28, 0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00,
+    0x01, 0x00, 0x73, 0x06, 0x03, 0x65, 0x00, 0x0f, 0xf9, 0x01, 0x03, 0x00,
+    0x5c, 0x06, 0x03, 0x65, 0x00, 0x1c, 0x37, 0xf9, 0x01, 0x01, 0x43, 0x06,
+    0x01, 0x43, 0x00, 0x02, 0x28, 0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00,
+    0x02, 0x05, 0xe0, 0x03, 0x1f, 0x34, 0xf9, 0x01, 0x03, 0x00, 0xe3, 0x06,
+    0x04, 0x86, 0x03, 0x0c, 0xf9, 0x01, 0x01, 0xe1, 0x05, 0x01, 0x43, 0x00,
+    0x02, 0x28, 0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x06, 0xe9,
+    0x03, 0x0f, 0xf9, 0x01, 0x03, 0x00, 0xf7, 0x06, 0x02, 0x65, 0x00, 0x2c,
+    0x37, 0x30, 0xf9, 0x01, 0x01, 0x2a, 0x06, 0x01, 0x43, 0x00, 0x02, 0x28,
+    0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x01, 0x01, 0xff, 0x06, 0x02,
+    0x65, 0x00, 0x0f, 0xf9, 0x01, 0x03, 0x00, 0xeb, 0x06, 0x03, 0x65, 0x00,
+    0x1c, 0x36, 0xf9, 0x01, 0x00, 0xe6, 0x06, 0x02, 0x43, 0x00, 0x02, 0x28,
+    0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x05, 0xf2, 0x03, 0x1f,
+    0x35, 0xf9, 0x01, 0x03, 0x00, 0xba, 0x06, 0x02, 0x65, 0x00, 0x12, 0x38,
+    0x1b, 0x02, 0x08, 0x65, 0x00, 0x01, 0x23, 0x01, 0x01, 0x1c, 0x07, 0x01,
+    0x28, 0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x05, 0xf2, 0x03,
+    0x02, 0xd0, 0x03, 0x0e, 0x21, 0x00, 0x05, 0xf2, 0x03, 0x2c, 0x38, 0x39,
+    0xf9, 0x01, 0x11, 0x34, 0x23, 0x01, 0x01, 0x2e, 0x07, 0x01, 0x28, 0x00,
+    0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x05, 0xf2, 0x03, 0x1f, 0x36,
+    0xda, 0x05, 0x04, 0x05, 0xf2, 0x03, 0x12, 0x39, 0x22, 0x00, 0x08, 0x57,
+    0x04, 0x01, 0x58, 0x00, 0x01, 0x99, 0x01, 0x00, 0x27, 0x00, 0x00, 0x76,
+    0x00, 0x08, 0x4a, 0x06, 0x00, 0x25, 0x0e, 0x0f, 0x66, 0x06, 0x04, 0x02,
+    0x13, 0x0e, 0x0d, 0x81, 0x08, 0x02, 0x49, 0x09, 0x10, 0x34, 0xd2, 0x03,
+    0x0d, 0x47, 0x08, 0x00, 0x06, 0x00, 0x01, 0xad, 0x0a, 0x02, 0xdf, 0x0c,
+    0x13, 0x65, 0x1e, 0x00, 0x11, 0x70, 0xd2, 0x09, 0x03, 0x23, 0x00, 0x03,
+    0xe1, 0x0c, 0x18, 0x32, 0xe1, 0x0c, 0x00, 0xe1, 0x07, 0xa5, 0x3b, 0x0a,
+    0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69, 0x16, 0x00, 0x34, 0x33,
+    0x30, 0x36, 0x03, 0x08, 0x00, 0x03, 0x0d, 0x1f, 0x3a, 0xbb, 0x0b, 0x4a,
+    0x0f, 0xa4, 0x08, 0x10, 0x06, 0x97, 0x00, 0x07, 0x3a, 0x0f, 0x33, 0x31,
+    0x30, 0x33, 0x8e, 0x07, 0x0a, 0x8d, 0x09, 0x00, 0x28, 0x03, 0x0f, 0xb3,
+    0x10, 0x0e, 0x0e, 0x99, 0x00, 0x01, 0xab, 0x01, 0x01, 0xd8, 0x00, 0x2b,
+    0x25, 0x72, 0x56, 0x0a, 0x01, 0xc0, 0x01, 0x01, 0x95, 0x0f, 0x27, 0x72,
+    0x34, 0x8f, 0x09, 0x04, 0x1e, 0x00, 0x01, 0x19, 0x00, 0x00, 0x24, 0x00,
+    0x0c, 0xf5, 0x0b, 0x12, 0x35, 0x51, 0x0b, 0x01, 0x3e, 0x00, 0x14, 0x35,
+    0xb8, 0x01, 0x04, 0x1c, 0x00, 0x01, 0x95, 0x01, 0x01, 0x74, 0x00, 0x11,
+    0x35, 0xab, 0x09, 0x09, 0xe3, 0x09, 0x11, 0x35, 0x01, 0x0a, 0x00, 0x24,
+    0x00, 0x0b, 0xe3, 0x09, 0x12, 0x35, 0x05, 0x02, 0x01, 0x03, 0x0b, 0x11,
+    0x35, 0xf1, 0x01, 0x19, 0x74, 0xf5, 0x08, 0x10, 0x5b, 0x23, 0x00, 0x03,
+    0xd6, 0x08, 0x00, 0x72, 0x00, 0x05, 0x2d, 0x01, 0x20, 0x31, 0x30, 0x2d,
+    0x01, 0x40, 0x65, 0x78, 0x69, 0x74, 0xda, 0x01, 0x5f, 0x44, 0x57, 0x65,
+    0x6e, 0x64, 0x9b, 0x10, 0x05, 0x4f, 0x7d, 0x20, 0x2f, 0x2f, 0x1a, 0x12,
+    0x02, 0x0f, 0xc6, 0x12, 0x2c, 0x1f, 0x34, 0xc6, 0x12, 0x33, 0x1f, 0x35,
+    0xc6, 0x12, 0x0d, 0x2f, 0x36, 0x34, 0xc6, 0x12, 0x1b, 0x01, 0x30, 0x00,
+    0x0f, 0xc6, 0x12, 0x19, 0x02, 0x31, 0x00, 0x0f, 0xc6, 0x12, 0x18, 0x02,
+    0x31, 0x00, 0x09, 0xc6, 0x12, 0x0f, 0x31, 0x00, 0x11, 0x0a, 0xc6, 0x12,
+    0x0f, 0x32, 0x00, 0x12, 0x0f, 0xc6, 0x12, 0x02, 0x02, 0xa0, 0x12, 0x0f,
+    0xc6, 0x12, 0x1b, 0x10, 0x31, 0x9f, 0x0b, 0x0f, 0xc6, 0x12, 0x06, 0x01,
+    0x6e, 0x00, 0x0f, 0xc6, 0x12, 0x02, 0x1f, 0x75, 0xc6, 0x12, 0x0e, 0x04,
+    0xc1, 0x0e, 0x0c, 0xc6, 0x12, 0x07, 0x3a, 0x00, 0x0f, 0xc6, 0x12, 0x04,
+    0x04, 0xe2, 0x03, 0x0f, 0xe1, 0x03, 0x0a, 0x04, 0x3b, 0x01, 0x07, 0xe2,
+    0x03, 0x04, 0x3c, 0x03, 0x0f, 0xc6, 0x12, 0x01, 0x03, 0x1c, 0x00, 0x09,
+    0xc6, 0x12, 0x07, 0x12, 0x0d, 0x02, 0xc6, 0x12, 0x0a, 0x84, 0x03, 0x02,
+    0x2f, 0x12, 0x08, 0xda, 0x12, 0x03, 0x19, 0x00, 0x01, 0xce, 0x03, 0x16,
+    0x38, 0xda, 0x12, 0x08, 0x0c, 0x01, 0x04, 0xbf, 0x12, 0x04, 0xdb, 0x12,
+    0x08, 0x1c, 0x00, 0x00, 0x29, 0x01, 0x0d, 0xdb, 0x12, 0x07, 0x71, 0x12,
+    0x0f, 0xee, 0x00, 0x0f, 0x09, 0xdb, 0x12, 0x03, 0xfc, 0x05, 0x01, 0x97,
+    0x04, 0x01, 0x93, 0x00, 0x0e, 0xdb, 0x12, 0x1f, 0x31, 0xdb, 0x12, 0x01,
+    0x0f, 0xa0, 0x12, 0x05, 0x0f, 0xcb, 0x03, 0x01, 0x0b, 0x3b, 0x00, 0x1f,
+    0x34, 0xdb, 0x12, 0x17, 0x03, 0x6a, 0x07, 0x0f, 0xd2, 0x01, 0x24, 0x07,
+    0x87, 0x01, 0x02, 0x8e, 0x12, 0x0f, 0xdb, 0x12, 0x01, 0x01, 0x9c, 0x01,
+    0x00, 0x1f, 0x00, 0x0d, 0xdb, 0x12, 0x00, 0x77, 0x14, 0x0c, 0xdb, 0x12,
+    0x02, 0xbf, 0x12, 0x02, 0x34, 0x00, 0x00, 0x65, 0x0a, 0x08, 0xdb, 0x12,
+    0x05, 0xbf, 0x12, 0x00, 0x50, 0x00, 0x0a, 0x66, 0x00, 0x03, 0xc9, 0x06,
+    0x03, 0x08, 0x12, 0x0f, 0xb7, 0x01, 0x28, 0x0a, 0x89, 0x02, 0x03, 0xbc,
+    0x12, 0x02, 0x06, 0x00, 0x0e, 0x19, 0x06, 0x03, 0xbb, 0x12, 0x02, 0x8c,
+    0x06, 0x0f, 0xbc, 0x12, 0x07, 0x04, 0x58, 0x03, 0x0f, 0xbc, 0x12, 0x03,
+    0x00, 0x1f, 0x00, 0x0f, 0xdb, 0x12, 0x03, 0x02, 0xc0, 0x12, 0x1f, 0x30,
+    0xac, 0x11, 0x01, 0x02, 0x33, 0x12, 0x00, 0xd8, 0x00, 0x05, 0xe7, 0x06,
+    0x04, 0x1a, 0x00, 0x07, 0xc1, 0x12, 0x0c, 0xa6, 0x12, 0x01, 0x3b, 0x01,
+    0x02, 0xb5, 0x00, 0x0c, 0x36, 0x00, 0x08, 0xc1, 0x12, 0x00, 0x8b, 0x02,
+    0x0f, 0xc1, 0x12, 0x0d, 0x04, 0x1c, 0x00, 0x02, 0x68, 0x00, 0x03, 0xbf,
+    0x14, 0x0b, 0x1c, 0x00, 0x07, 0xc2, 0x12, 0x0d, 0x54, 0x00, 0x05, 0xc0,
+    0x12, 0x03, 0x1c, 0x00, 0x0f, 0xc3, 0x12, 0x01, 0x00, 0x95, 0x00, 0x0f,
+    0xc3, 0x12, 0x05, 0x04, 0xa7, 0x12, 0x0f, 0xc3, 0x12, 0x01, 0x00, 0x1d,
+    0x01, 0x0f, 0x1c, 0x00, 0x00, 0x05, 0xc6, 0x12, 0x0c, 0xa8, 0x00, 0x02,
+    0xc3, 0x12, 0x0f, 0xe0, 0x00, 0x03, 0x01, 0x18, 0x01, 0x03, 0x1c, 0x00,
+    0x0f, 0x6e, 0x12, 0x02, 0x0f, 0xc4, 0x12, 0x0b, 0x03, 0x6c, 0x06, 0x0f,
+    0xc4, 0x12, 0x09, 0x0f, 0x83, 0x03, 0x02, 0x0f, 0xb1, 0x02, 0x11, 0x0f,
+    0xc4, 0x12, 0x03, 0x01, 0x19, 0x0c, 0x20, 0x72, 0x33, 0x3c, 0x03, 0x0f,
+    0x71, 0x12, 0x1e, 0x02, 0x76, 0x01, 0x12, 0x30, 0x6e, 0x0a, 0x1f, 0x31,
+    0x71, 0x12, 0x82, 0x04, 0x25, 0x12, 0x0f, 0x71, 0x12, 0x31, 0x00, 0x23,
+    0x12, 0x0f, 0x71, 0x12, 0x36, 0x04, 0x52, 0x12, 0x0f, 0x71, 0x12, 0x05,
+    0x03, 0x87, 0x00, 0x0f, 0x71, 0x12, 0x22, 0x00, 0xfb, 0x0f, 0x0f, 0x71,
+    0x12, 0x09, 0x1f, 0x31, 0x71, 0x12, 0x2a, 0x00, 0x96, 0x0d, 0x0f, 0x71,
+    0x12, 0x0a, 0x1f, 0x31, 0x71, 0x12, 0x2e, 0x01, 0xb4, 0x12, 0x0f, 0x71,
+    0x12, 0x0a, 0x1f, 0x31, 0x71, 0x12, 0x2f, 0x00, 0x65, 0x00, 0x0f, 0x71,
+    0x12, 0x0b, 0x1f, 0x31, 0x71, 0x12, 0x2f, 0x00, 0xb5, 0x12, 0x0f, 0x71,
+    0x12, 0x0b, 0x1f, 0x31, 0x71, 0x12, 0x2f, 0x00, 0x65, 0x00, 0x0f, 0x71,
+    0x12, 0x0b, 0x1f, 0x31, 0x71, 0x12, 0x2f, 0x00, 0x65, 0x00, 0x0f, 0x71,
+    0x12, 0x0b, 0x1f, 0x31, 0x71, 0x12, 0x2f, 0x01, 0x7f, 0x13, 0x0f, 0x71,
+    0x12, 0x0a, 0x1f, 0x31, 0x71, 0x12, 0x2f, 0x00, 0x65, 0x00, 0x0f, 0x71,
+    0x12, 0x0b, 0x1f, 0x31, 0x71, 0x12, 0x2f, 0x00, 0x84, 0x03, 0x0f, 0x71,
+    0x12, 0x0b, 0x00, 0x86, 0x03, 0x0f, 0x71, 0x12, 0x2c, 0x01, 0xe4, 0x13,
+    0x0f, 0x71, 0x12, 0x0a, 0x1f, 0x31, 0x71, 0x12, 0x2f, 0x00, 0x65, 0x00,
+    0x0f, 0x71, 0x12, 0x0b, 0x1f, 0x31, 0x71, 0x12, 0x2f, 0x00, 0xe4, 0x13,
+    0x0f, 0x71, 0x12, 0x0b, 0x1f, 0x31, 0x71, 0x12, 0x2f, 0x00, 0x65, 0x00,
+    0x0f, 0x71, 0x12, 0x0b, 0x1f, 0x31, 0x71, 0x12, 0x2f, 0x00, 0x49, 0x14,
+    0x0f, 0x71, 0x12, 0x0b, 0x1f, 0x31, 0x71, 0x12, 0x52, 0x02, 0xe4, 0x0c,
+    0x0b, 0x71, 0x12, 0x01, 0xd4, 0x08, 0x00, 0x48, 0x0b, 0x0b, 0xd0, 0x09,
+    0x0f, 0x89, 0x12, 0x01, 0x1a, 0x67, 0x89, 0x12, 0x01, 0xda, 0x08, 0x00,
+    0x57, 0x03, 0x0a, 0x87, 0x12, 0x02, 0xf7, 0x07, 0x0c, 0x87, 0x12, 0x17,
+    0x31, 0x87, 0x12, 0x02, 0xaf, 0x0c, 0x08, 0x87, 0x12, 0x0f, 0x67, 0x0b,
+    0x3f, 0x0f, 0x87, 0x12, 0x14, 0x02, 0x97, 0x00, 0x0f, 0x87, 0x12, 0x10,
+    0x00, 0xa3, 0x03, 0x0f, 0x74, 0x10, 0x0e, 0x0e, 0x99, 0x00, 0x02, 0xc4,
+    0x1b, 0x01, 0xec, 0x06, 0x05, 0x87, 0x12, 0x04, 0x1b, 0x00, 0x02, 0xd8,
+    0x0a, 0x05, 0xcd, 0x13, 0x0b, 0x39, 0x00, 0x01, 0x54, 0x0a, 0x00, 0x24,
+    0x00, 0x0d, 0x9a, 0x01, 0x07, 0x15, 0x1d, 0x01, 0x14, 0x02, 0x08, 0x50,
+    0x12, 0x07, 0x8f, 0x13, 0x08, 0xdc, 0x12, 0x04, 0x1f, 0x00, 0x05, 0xdc,
+    0x12, 0x0c, 0x88, 0x12, 0x02, 0x5a, 0x14, 0x01, 0x19, 0x0b, 0x01, 0xdb,
+    0x12, 0x0f, 0x88, 0x12, 0x00, 0x1f, 0x32, 0x88, 0x12, 0x02, 0x1f, 0x34,
+    0x88, 0x12, 0x0e, 0x04, 0x5d, 0x10, 0x0f, 0x88, 0x12, 0x01, 0x01, 0x1c,
+    0x00, 0x0f, 0x88, 0x12, 0x2c, 0x42, 0x32, 0x5b, 0x34, 0x30, 0xa3, 0x03,
+    0x0f, 0x88, 0x12, 0x2a, 0x14, 0x33, 0x47, 0x00, 0x0f, 0x88, 0x12, 0x02,
+    0x2f, 0x33, 0x32, 0x4e, 0x25, 0x1b, 0x04, 0x30, 0x00, 0x0f, 0x88, 0x12,
+    0x16, 0x05, 0x31, 0x00, 0x0f, 0x25, 0x12, 0x15, 0x05, 0x31, 0x00, 0x0f,
+    0x4e, 0x25, 0x15, 0x05, 0x31, 0x00, 0x0f, 0x4e, 0x25, 0x16, 0x06, 0x32,
+    0x00, 0x0f, 0x4e, 0x25, 0x14, 0x3f, 0x31, 0x30, 0x30, 0x89, 0x12, 0x0e,
+    0x00, 0x1f, 0x0b, 0x0f, 0x89, 0x12, 0x03, 0x04, 0x6f, 0x00, 0x0f, 0x4f,
+    0x25, 0x33, 0x10, 0x33, 0x07, 0x04, 0x0f, 0x4f, 0x25, 0x35, 0x07, 0x3c,
+    0x01, 0x0f, 0x4f, 0x25, 0x23, 0x01, 0x8e, 0x00, 0x0f, 0x4f, 0x25, 0x80,
+    0x07, 0xe3, 0x01, 0x0f, 0x4f, 0x25, 0x1c, 0x1f, 0x32, 0x4f, 0x25, 0x2c,
+    0x04, 0xa6, 0x05, 0x0f, 0x4f, 0x25, 0x20, 0x03, 0x01, 0x09, 0x0f, 0xbd,
+    0x01, 0x24, 0x0f, 0x4f, 0x25, 0x01, 0x01, 0x5a, 0x12, 0x0f, 0x4f, 0x25,
+    0x16, 0x01, 0x14, 0x00, 0x0f, 0x4f, 0x25, 0x3a, 0x09, 0xc3, 0x0f, 0x0f,
+    0xb7, 0x01, 0x1f, 0x0f, 0x4f, 0x25, 0x44, 0x01, 0xb5, 0x02, 0x0f, 0x4f,
+    0x25, 0x07, 0x20, 0x31, 0x32, 0x7e, 0x06, 0x0f, 0x50, 0x25, 0x22, 0x0c,
+    0x0f, 0x03, 0x0f, 0x50, 0x25, 0xff, 0x91, 0x06, 0x70, 0x06, 0x0f, 0x50,
+    0x25, 0x39, 0x06, 0xf7, 0x06, 0x0f, 0x50, 0x25, 0x9e, 0x1f, 0x32, 0x50,
+    0x25, 0xff, 0x9a, 0x0e, 0x80, 0x12, 0x0f, 0x51, 0x25, 0x3b, 0x0f, 0x17,
+    0x12, 0x00, 0x0f, 0x51, 0x25, 0x3e, 0x0e, 0xb1, 0x11, 0x0f, 0x51, 0x25,
+    0x40, 0x0e, 0x4c, 0x11, 0x0f, 0x51, 0x25, 0x40, 0x0e, 0xe7, 0x10, 0x0f,
+    0x51, 0x25, 0x40, 0x0e, 0x82, 0x10, 0x0f, 0x51, 0x25, 0x40, 0x0e, 0x1d,
+    0x10, 0x0f, 0x51, 0x25, 0x40, 0x04, 0x68, 0x1f, 0x0f, 0x52, 0x25, 0x4b,
+    0x22, 0x31, 0x31, 0x70, 0x11, 0x0f, 0x53, 0x25, 0x4b, 0x3f, 0x31, 0x32,
+    0x38, 0x54, 0x25, 0x50, 0x3c, 0x31, 0x34, 0x30, 0xfd, 0x01, 0x0f, 0x55,
+    0x25, 0x40, 0x22, 0x31, 0x35, 0x55, 0x01, 0x0f, 0x56, 0x25, 0x4b, 0x2d,
+    0x31, 0x36, 0x9c, 0x17, 0x0f, 0x57, 0x25, 0x40, 0x2d, 0x31, 0x37, 0x3e,
+    0x17, 0x0f, 0x58, 0x25, 0x40, 0x2d, 0x31, 0x39, 0xda, 0x16, 0x01, 0x94,
+    0x10, 0x0e, 0xe9, 0x12, 0x0e, 0x45, 0x00, 0x05, 0xfa, 0x03, 0x02, 0x0f,
+    0x01, 0x0e, 0x21, 0x00, 0x05, 0xfa, 0x03, 0x2d, 0x32, 0x30, 0x76, 0x16,
+    0x01, 0x82, 0x23, 0x01, 0x44, 0x00, 0x02, 0x29, 0x00, 0x00, 0x78, 0x00,
+    0x0f, 0x45, 0x00, 0x02, 0x05, 0xfb, 0x03, 0x02, 0x3e, 0x04, 0x0e, 0x21,
+    0x00, 0x05, 0xfb, 0x03, 0x2d, 0x32, 0x31, 0x12, 0x16, 0x11, 0x35, 0x26,
+    0x01, 0x01, 0xd5, 0x23, 0x01, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x45,
+    0x00, 0x02, 0x05, 0xfc, 0x03, 0x1f, 0x37, 0xfe, 0x01, 0x03, 0x16, 0x35,
+    0x2c, 0x18, 0x1d, 0x33, 0xae, 0x15, 0x11, 0x36, 0x26, 0x01, 0x00, 0x44,
+    0x00, 0x02, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x45, 0x00, 0x01, 0x15,
+    0x36, 0xfc, 0x03, 0x02, 0xa9, 0x00, 0x0e, 0x21, 0x00, 0x07, 0x2d, 0x18,
+    0x0d, 0x4a, 0x15, 0x11, 0x36, 0x26, 0x01, 0x00, 0x44, 0x00, 0x02, 0x29,
+    0x00, 0x00, 0x78, 0x00, 0x0f, 0x45, 0x00, 0x02, 0x05, 0xfc, 0x03, 0x02,
+    0xd9, 0x03, 0x0e, 0x21, 0x00, 0x06, 0x2e, 0x18, 0x1d, 0x35, 0xe6, 0x14,
+    0x00, 0x24, 0x09, 0x02, 0x44, 0x00, 0x02, 0x29, 0x00, 0x00, 0x78, 0x00,
+    0x0f, 0x45, 0x00, 0x02, 0x05, 0xfc, 0x03, 0x02, 0x05, 0x07, 0x0e, 0x21,
+    0x00, 0x05, 0xfc, 0x03, 0x3c, 0x32, 0x36, 0x38, 0xfe, 0x01, 0x11, 0x36,
+    0x26, 0x01, 0x00, 0x44, 0x00, 0x02, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f,
+    0x4e, 0x08, 0x02, 0x06, 0xf0, 0x07, 0x0f, 0xfe, 0x01, 0x03, 0x16, 0x37,
+    0xf1, 0x07, 0x12, 0x38, 0x4b, 0x07, 0x07, 0x66, 0x00, 0x11, 0x37, 0x26,
+    0x01, 0x00, 0x44, 0x00, 0x02, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x45,
+    0x00, 0x02, 0x05, 0xfc, 0x03, 0x02, 0x73, 0x03, 0x0e, 0x21, 0x00, 0x05,
+    0xfc, 0x03, 0x22, 0x32, 0x39, 0xeb, 0x04, 0x08, 0x66, 0x00, 0x01, 0x26,
+    0x01, 0x00, 0x44, 0x00, 0x02, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x45,
+    0x00, 0x02, 0x05, 0xfc, 0x03, 0x02, 0xa3, 0x06, 0x0e, 0x21, 0x00, 0x05,
+    0xfc, 0x03, 0x22, 0x33, 0x30, 0x87, 0x02, 0x08, 0x66, 0x00, 0x01, 0x26,
+    0x01, 0x00, 0x44, 0x00, 0x02, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x45,
+    0x00, 0x02, 0x05, 0xfc, 0x03, 0x2f, 0x31, 0x30, 0xff, 0x01, 0x03, 0x18,
+    0x38, 0x47, 0x2d, 0x0c, 0xff, 0x01, 0x11, 0x38, 0x27, 0x01, 0x00, 0x45,
+    0x00, 0x02, 0x29, 0x00, 0x00, 0x79, 0x00, 0x0f, 0x45, 0x00, 0x02, 0x05,
+    0xfd, 0x03, 0x12, 0x31, 0x0f, 0x03, 0x0e, 0x22, 0x00, 0x06, 0x49, 0x2d,
+    0x1d, 0x33, 0xec, 0x09, 0x11, 0x38, 0x28, 0x01, 0x00, 0x45, 0x00, 0x02,
+    0x29, 0x00, 0x00, 0x79, 0x00, 0x0f, 0x45, 0x00, 0x02, 0x05, 0xfe, 0x03,
+    0x12, 0x31, 0x40, 0x06, 0x0e, 0x22, 0x00, 0x05, 0xff, 0x03, 0x2d, 0x33,
+    0x34, 0xf3, 0x09, 0x12, 0x38, 0x4f, 0x0a, 0x01, 0xa1, 0x01, 0x00, 0x29,
+    0x00, 0x00, 0x79, 0x00, 0x0f, 0x45, 0x00, 0x02, 0x05, 0xff, 0x03, 0x1f,
+    0x31, 0xf5, 0x09, 0x04, 0x15, 0x38, 0x00, 0x04, 0x2d, 0x33, 0x35, 0xf6,
+    0x09, 0x11, 0x39, 0x29, 0x01, 0x00, 0x45, 0x00, 0x02, 0x29, 0x00, 0x00,
+    0x79, 0x00, 0x0f, 0x45, 0x00, 0x01, 0x15, 0x39, 0x00, 0x04, 0x1f, 0x31,
+    0xf7, 0x09, 0x04, 0x15, 0x39, 0x01, 0x04, 0x2d, 0x33, 0x37, 0xf8, 0x09,
+    0x11, 0x39, 0x29, 0x01, 0x00, 0x45, 0x00, 0x02, 0x29, 0x00, 0x00, 0x79,
+    0x00, 0x0f, 0x45, 0x00, 0x02, 0x05, 0x01, 0x04, 0x1f, 0x31, 0xf9, 0x09,
+    0x04, 0x15, 0x39, 0x02, 0x04, 0x2d, 0x33, 0x38, 0xfa, 0x09, 0x11, 0x39,
+    0x29, 0x01, 0x00, 0x45, 0x00, 0x02, 0x29, 0x00, 0x00, 0x79, 0x00, 0x0f,
+    0x45, 0x00, 0x02, 0x05, 0x02, 0x04, 0x1f, 0x31, 0xfb, 0x09, 0x04, 0x16,
+    0x39, 0x32, 0x1c, 0x1d, 0x39, 0xfc, 0x09, 0x02, 0xc7, 0x00, 0x01, 0xa1,
+    0x01, 0x00, 0x28, 0x00, 0x00, 0x78, 0x00, 0x0f, 0xc0, 0x2b, 0x4b, 0x02,
+    0x1e, 0x11, 0x0f, 0xc1, 0x2b, 0x1a, 0x02, 0x52, 0x0e, 0x0c, 0x3a, 0x19,
+    0x17, 0x32, 0x3a, 0x19, 0x02, 0x75, 0x13, 0x0f, 0xc1, 0x2b, 0x1c, 0x0f,
+    0x2d, 0x12, 0x1c, 0x0f, 0x3a, 0x19, 0x14, 0x02, 0x97, 0x00, 0x0f, 0xc1,
+    0x2b, 0x2b, 0x06, 0x26, 0x17, 0x0f, 0xc1, 0x2b, 0x42, 0x0c, 0x66, 0x12,
+    0x0f, 0xc1, 0x2b, 0x7a, 0x1f, 0x38, 0x39, 0x19, 0x0b, 0x07, 0x0d, 0x17,
+    0x0d, 0x39, 0x19, 0x04, 0x1c, 0x00, 0x0f, 0x39, 0x19, 0x2c, 0x1f, 0x30,
+    0x39, 0x19, 0x33, 0x1f, 0x31, 0x39, 0x19, 0x0d, 0x0f, 0xc1, 0x2b, 0x1a,
+    0x04, 0x30, 0x00, 0x0f, 0x39, 0x19, 0x19, 0x0f, 0xc1, 0x2b, 0x1b, 0x05,
+    0x31, 0x00, 0x0f, 0xc1, 0x2b, 0x15, 0x05, 0x31, 0x00, 0x0f, 0xc1, 0x2b,
+    0x16, 0x06, 0x32, 0x00, 0x0f, 0xc1, 0x2b, 0x14, 0x0f, 0x39, 0x19, 0x11,
+    0x1f, 0x39, 0x39, 0x19, 0x09, 0x0f, 0xc2, 0x2b, 0x38, 0x05, 0x39, 0x19,
+    0x0f, 0xc2, 0x2b, 0x31, 0x07, 0x3c, 0x01, 0x0f, 0xc2, 0x2b, 0x23, 0x02,
+    0x84, 0x16, 0x0f, 0xc2, 0x2b, 0x94, 0x07, 0xf8, 0x01, 0x0f, 0xc2, 0x2b,
+    0x1c, 0x1f, 0x33, 0xc2, 0x2b, 0x2c, 0x0c, 0x3b, 0x00, 0x0f, 0xc2, 0x2b,
+    0x18, 0x03, 0x0a, 0x09, 0x0f, 0xd2, 0x01, 0x24, 0x0f, 0xc2, 0x2b, 0x01,
+    0x0d, 0x4e, 0x19, 0x0f, 0xc2, 0x2b, 0x0a, 0x0d, 0x4e, 0x19, 0x0f, 0xc2,
+    0x2b, 0x2e, 0x0f, 0x11, 0x29, 0x01, 0x0f, 0xb7, 0x01, 0x18, 0x0f, 0xc2,
+    0x2b, 0x44, 0x0f, 0x4e, 0x19, 0x03, 0x05, 0xc2, 0x2b, 0x0f, 0x4e, 0x19,
+    0x04, 0x0f, 0xc3, 0x2b, 0x12, 0x05, 0xe9, 0x06, 0x0f, 0xc3, 0x2b, 0xff,
+    0x80, 0x06, 0x6e, 0x06, 0x0f, 0xc3, 0x2b, 0x39, 0x06, 0xf5, 0x06, 0x0f,
+    0xc3, 0x2b, 0x4b, 0x1f, 0x33, 0xc3, 0x2b, 0xff, 0x9a, 0x0f, 0xe4, 0x18,
+    0x2a, 0x0f, 0xc4, 0x2b, 0x10, 0x0f, 0xe4, 0x18, 0x2d, 0x0f, 0xc4, 0x2b,
+    0x11, 0x0f, 0xe4, 0x18, 0x2e, 0x0f, 0xc4, 0x2b, 0x11, 0x0f, 0xe4, 0x18,
+    0x2e, 0x0f, 0xc4, 0x2b, 0x11, 0x0f, 0xe4, 0x18, 0x2e, 0x0f, 0xc4, 0x2b,
+    0x11, 0x0f, 0xe4, 0x18, 0x2e, 0x0f, 0xc4, 0x2b, 0x11, 0x0f, 0xe4, 0x18,
+    0x2e, 0x0f, 0xc4, 0x2b, 0x11, 0x0f, 0xe4, 0x18, 0x2f, 0x0f, 0xc5, 0x2b,
+    0x11, 0x0f, 0xe4, 0x18, 0x2f, 0x0f, 0xc6, 0x2b, 0x11, 0x0f, 0xe4, 0x18,
+    0x2f, 0x0f, 0xc7, 0x2b, 0x11, 0x0f, 0xe4, 0x18, 0x2f, 0x0f, 0xc8, 0x2b,
+    0x11, 0x0f, 0xe4, 0x18, 0x2f, 0x0f, 0xc9, 0x2b, 0x11, 0x0f, 0xe4, 0x18,
+    0x2f, 0x0f, 0xca, 0x2b, 0x11, 0x0f, 0xe4, 0x18, 0x2f, 0x0f, 0xcb, 0x2b,
+    0x11, 0x0f, 0xe4, 0x18, 0x2f, 0x05, 0x00, 0x44, 0x0f, 0xe4, 0x18, 0x06,
+    0x1f, 0x31, 0xe4, 0x18, 0x30, 0x00, 0x66, 0x00, 0x0f, 0xe4, 0x18, 0x0b,
+    0x1f, 0x31, 0xe4, 0x18, 0x30, 0x00, 0x89, 0x1d, 0x0f, 0xe4, 0x18, 0x0b,
+    0x1f, 0x31, 0xe4, 0x18, 0x30, 0x01, 0xef, 0x1d, 0x0f, 0xe4, 0x18, 0x0a,
+    0x1f, 0x31, 0xe4, 0x18, 0x30, 0x00, 0x24, 0x07, 0x0f, 0xe4, 0x18, 0x0b,
+    0x01, 0x25, 0x07, 0x0f, 0xe4, 0x18, 0x2c, 0x00, 0x66, 0x00, 0x0f, 0xe4,
+    0x18, 0x0b, 0x1f, 0x31, 0xe4, 0x18, 0x30, 0x00, 0x66, 0x00, 0x0f, 0xe4,
+    0x18, 0x0b, 0x1f, 0x31, 0xe4, 0x18, 0x30, 0x00, 0x4b, 0x41, 0x0f, 0xe4,
+    0x18, 0x0b, 0x1f, 0x31, 0xe4, 0x18, 0x30, 0x01, 0xb1, 0x41, 0x0f, 0xe4,
+    0x18, 0x0a, 0x1f, 0x31, 0xe4, 0x18, 0x30, 0x01, 0x89, 0x1f, 0x0f, 0xe4,
+    0x18, 0x0b, 0x01, 0xba, 0x33, 0x0f, 0xe4, 0x18, 0x2c, 0x01, 0x67, 0x00,
+    0x0f, 0xe4, 0x18, 0x0b, 0x1f, 0x31, 0xe4, 0x18, 0x30, 0x01, 0x67, 0x00,
+    0x0f, 0xe4, 0x18, 0x0b, 0x1f, 0x31, 0xe4, 0x18, 0x30, 0x01, 0x58, 0x20,
+    0x0f, 0xe4, 0x18, 0x0b, 0x1f, 0x31, 0xe4, 0x18, 0x30, 0x01, 0x67, 0x00,
+    0x0f, 0xe4, 0x18, 0x0b, 0x1f, 0x31, 0xe4, 0x18, 0x30, 0x01, 0xc2, 0x0a,
+    0x0f, 0xe4, 0x18, 0x0b, 0x01, 0xc3, 0x0a, 0x0f, 0xe4, 0x18, 0x2c, 0x01,
+    0x67, 0x00, 0x0f, 0xe4, 0x18, 0x0b, 0x1f, 0x31, 0xe4, 0x18, 0x53, 0x0f,
+    0x33, 0x32, 0x0a, 0x0c, 0x76, 0x10, 0x0f, 0xfc, 0x18, 0x02, 0x0f, 0x34,
+    0x32, 0x13, 0x02, 0x68, 0x0e, 0x0c, 0xfa, 0x18, 0x17, 0x33, 0xfa, 0x18,
+    0x02, 0x21, 0x13, 0x0f, 0x34, 0x32, 0x1c, 0x0f, 0xd9, 0x11, 0x1c, 0x0f,
+    0xfa, 0x18, 0x14, 0x02, 0x97, 0x00, 0x0f, 0x34, 0x32, 0x2b, 0x06, 0xe7,
+    0x16, 0x0f, 0x34, 0x32, 0x42, 0x0d, 0x9b, 0x01, 0x0f, 0x34, 0x32, 0x79,
+    0x11, 0x32, 0x43, 0x0f, 0x0f, 0xfb, 0x18, 0x0a, 0x0f, 0x34, 0x32, 0x06,
+    0xa0, 0x33, 0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74, 0x0a, 0x0a
+};
+
+static const unsigned char matrixMul_kernel_64_data[5570] = {
+    0xf1, 0x82, 0x09, 0x2e, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20,
+    0x31, 0x2e, 0x34, 0x0a, 0x09, 0x2e, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74,
+    0x20, 0x73, 0x6d, 0x5f, 0x31, 0x30, 0x2c, 0x20, 0x6d, 0x61, 0x70, 0x5f,
+    0x66, 0x36, 0x34, 0x5f, 0x74, 0x6f, 0x5f, 0x66, 0x33, 0x32, 0x0a, 0x09,
+    0x2f, 0x2f, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x64, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x43, 0x3a, 0x5c, 0x50, 0x72, 0x6f, 0x67,
+    0x72, 0x61, 0x6d, 0x20, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x5c, 0x4e, 0x56,
+    0x49, 0x44, 0x49, 0x41, 0x20, 0x47, 0x50, 0x55, 0x20, 0x43, 0x6f, 0x6d,
+    0x70, 0x75, 0x74, 0x69, 0x6e, 0x67, 0x20, 0x54, 0x6f, 0x6f, 0x6c, 0x6b,
+    0x69, 0x74, 0x5c, 0x43, 0x55, 0x44, 0x41, 0x5c, 0x76, 0x34, 0x2e, 0x30,
+    0x5c, 0x5c, 0x62, 0x69, 0x6e, 0x2f, 0x2e, 0x2e, 0x2f, 0x6f, 0x70, 0x65,
+    0x6e, 0x36, 0x34, 0x2f, 0x6c, 0x69, 0x62, 0x2f, 0x2f, 0x62, 0x65, 0x2e,
+    0x65, 0x78, 0x65, 0x65, 0x00, 0x20, 0x6e, 0x76, 0x19, 0x00, 0xf0, 0x0c,
+    0x63, 0x63, 0x20, 0x34, 0x2e, 0x30, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x74,
+    0x20, 0x6f, 0x6e, 0x20, 0x32, 0x30, 0x31, 0x31, 0x2d, 0x30, 0x32, 0x2d,
+    0x32, 0x31, 0x0a, 0x26, 0x00, 0x1f, 0x2d, 0x01, 0x00, 0x27, 0x01, 0x65,
+    0x00, 0x00, 0xa0, 0x00, 0x20, 0x69, 0x6c, 0xa0, 0x00, 0xf0, 0x22, 0x43,
+    0x3a, 0x2f, 0x55, 0x73, 0x65, 0x72, 0x73, 0x2f, 0x45, 0x59, 0x4f, 0x55,
+    0x4e, 0x47, 0x7e, 0x31, 0x2e, 0x43, 0x4f, 0x4d, 0x2f, 0x41, 0x70, 0x70,
+    0x44, 0x61, 0x74, 0x61, 0x2f, 0x4c, 0x6f, 0x63, 0x61, 0x6c, 0x2f, 0x54,
+    0x65, 0x6d, 0x70, 0x2f, 0x74, 0x6d, 0x70, 0x78, 0x66, 0x74, 0x5f, 0x30,
+    0x01, 0x00, 0x32, 0x63, 0x32, 0x63, 0x09, 0x00, 0xff, 0x11, 0x30, 0x30,
+    0x30, 0x2d, 0x31, 0x31, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x69, 0x78, 0x4d,
+    0x75, 0x6c, 0x5f, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, 0x2e, 0x63, 0x70,
+    0x70, 0x33, 0x2e, 0x69, 0x20, 0x28, 0x5e, 0x00, 0x16, 0xdf, 0x63, 0x63,
+    0x42, 0x49, 0x23, 0x2e, 0x61, 0x30, 0x34, 0x35, 0x32, 0x34, 0x29, 0xe2,
+    0x00, 0x2d, 0x0f, 0x22, 0x01, 0x31, 0x8f, 0x4f, 0x70, 0x74, 0x69, 0x6f,
+    0x6e, 0x73, 0x3a, 0x4c, 0x00, 0x31, 0x21, 0x20, 0x54, 0x5a, 0x02, 0xa3,
+    0x3a, 0x70, 0x74, 0x78, 0x2c, 0x20, 0x49, 0x53, 0x41, 0x3a, 0x63, 0x02,
+    0xf2, 0x0f, 0x45, 0x6e, 0x64, 0x69, 0x61, 0x6e, 0x3a, 0x6c, 0x69, 0x74,
+    0x74, 0x6c, 0x65, 0x2c, 0x20, 0x50, 0x6f, 0x69, 0x6e, 0x74, 0x65, 0x72,
+    0x20, 0x53, 0x69, 0x7a, 0x65, 0x3a, 0x36, 0x34, 0x3b, 0x00, 0x50, 0x2d,
+    0x4f, 0x33, 0x09, 0x28, 0x8d, 0x00, 0x40, 0x6d, 0x69, 0x7a, 0x61, 0x93,
+    0x00, 0x61, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x24, 0x01, 0xca, 0x20,
+    0x20, 0x2d, 0x67, 0x30, 0x09, 0x28, 0x44, 0x65, 0x62, 0x75, 0x67, 0x17,
+    0x00, 0xff, 0x06, 0x6d, 0x32, 0x09, 0x28, 0x52, 0x65, 0x70, 0x6f, 0x72,
+    0x74, 0x20, 0x61, 0x64, 0x76, 0x69, 0x73, 0x6f, 0x72, 0x69, 0x65, 0x73,
+    0x58, 0x01, 0x30, 0x9f, 0x2e, 0x66, 0x69, 0x6c, 0x65, 0x09, 0x31, 0x09,
+    0x22, 0x37, 0x02, 0x30, 0x1f, 0x30, 0x37, 0x02, 0x00, 0xb4, 0x75, 0x64,
+    0x61, 0x66, 0x65, 0x32, 0x2e, 0x67, 0x70, 0x75, 0x22, 0x6d, 0x00, 0x11,
+    0x32, 0x6d, 0x00, 0xa3, 0x76, 0x73, 0x32, 0x30, 0x30, 0x35, 0x2f, 0x56,
+    0x43, 0x2f, 0x3e, 0x03, 0x20, 0x2e, 0x2e, 0x0d, 0x00, 0xf5, 0x03, 0x5c,
+    0x49, 0x4e, 0x43, 0x4c, 0x55, 0x44, 0x45, 0x5c, 0x63, 0x72, 0x74, 0x64,
+    0x65, 0x66, 0x73, 0x2e, 0x68, 0x38, 0x00, 0x11, 0x33, 0x38, 0x00, 0x09,
+    0xa2, 0x03, 0x1f, 0x2f, 0xa2, 0x03, 0x09, 0x10, 0x2f, 0xa2, 0x03, 0x10,
+    0x2f, 0xa2, 0x03, 0x90, 0x2f, 0x2f, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64,
+    0x65, 0x56, 0x00, 0xf7, 0x00, 0x2f, 0x64, 0x65, 0x76, 0x69, 0x63, 0x65,
+    0x5f, 0x72, 0x75, 0x6e, 0x74, 0x69, 0x6d, 0x65, 0x61, 0x00, 0x1f, 0x34,
+    0x61, 0x00, 0x30, 0xb8, 0x68, 0x6f, 0x73, 0x74, 0x5f, 0x64, 0x65, 0x66,
+    0x69, 0x6e, 0x65, 0xbc, 0x00, 0x1f, 0x35, 0x5b, 0x00, 0x30, 0x01, 0x3b,
+    0x04, 0x69, 0x69, 0x6e, 0x5f, 0x74, 0x79, 0x70, 0x5c, 0x00, 0x73, 0x36,
+    0x09, 0x22, 0x63, 0x3a, 0x5c, 0x70, 0x5c, 0x00, 0x00, 0x13, 0x00, 0xc1,
+    0x73, 0x5c, 0x6e, 0x76, 0x69, 0x64, 0x69, 0x61, 0x20, 0x67, 0x70, 0x75,
+    0xe4, 0x04, 0x02, 0x5c, 0x00, 0x13, 0x74, 0xba, 0x04, 0x00, 0x95, 0x01,
+    0x02, 0xba, 0x04, 0x04, 0x5b, 0x00, 0x03, 0x13, 0x01, 0x0c, 0x5a, 0x00,
+    0x1f, 0x37, 0x5a, 0x00, 0x30, 0x5d, 0x72, 0x69, 0x76, 0x65, 0x72, 0x5a,
+    0x00, 0x1f, 0x38, 0x5a, 0x00, 0x2f, 0x5f, 0x73, 0x75, 0x72, 0x66, 0x61,
+    0xb5, 0x00, 0x00, 0x1f, 0x39, 0x5b, 0x00, 0x2f, 0x6e, 0x74, 0x65, 0x78,
+    0x74, 0x75, 0x72, 0x5b, 0x00, 0x2f, 0x31, 0x30, 0x5c, 0x00, 0x2f, 0x5e,
+    0x76, 0x65, 0x63, 0x74, 0x6f, 0x11, 0x01, 0x2f, 0x31, 0x31, 0x5b, 0x00,
+    0x2f, 0x0f, 0x21, 0x02, 0x05, 0x2f, 0x31, 0x32, 0x5c, 0x00, 0x2f, 0x0f,
+    0xd8, 0x02, 0x04, 0x1f, 0x31, 0x95, 0x03, 0x31, 0x03, 0x7e, 0x02, 0xf9,
+    0x01, 0x6c, 0x61, 0x75, 0x6e, 0x63, 0x68, 0x5f, 0x70, 0x61, 0x72, 0x61,
+    0x6d, 0x65, 0x74, 0x65, 0x72, 0x68, 0x00, 0x1f, 0x34, 0xc3, 0x00, 0x2f,
+    0xf9, 0x01, 0x63, 0x72, 0x74, 0x5c, 0x73, 0x74, 0x6f, 0x72, 0x61, 0x67,
+    0x65, 0x5f, 0x63, 0x6c, 0x61, 0x73, 0x60, 0x00, 0x02, 0xa1, 0x03, 0x0f,
+    0x95, 0x04, 0x0d, 0x0b, 0x31, 0x04, 0x90, 0x31, 0x36, 0x09, 0x22, 0x68,
+    0x3a, 0x2f, 0x73, 0x77, 0x54, 0x04, 0xa2, 0x72, 0x65, 0x6c, 0x2f, 0x53,
+    0x44, 0x4b, 0x31, 0x30, 0x2f, 0xf5, 0x00, 0x85, 0x65, 0x2f, 0x43, 0x2f,
+    0x73, 0x72, 0x63, 0x2f, 0x14, 0x05, 0x36, 0x44, 0x72, 0x76, 0x0d, 0x00,
+    0x06, 0x21, 0x05, 0x06, 0x4e, 0x00, 0x1f, 0x37, 0xe1, 0x04, 0x31, 0xa1,
+    0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x5f, 0x66, 0x75, 0x6e, 0x63, 0xef, 0x06,
+    0x08, 0xae, 0x00, 0x0f, 0x75, 0x03, 0x30, 0x4f, 0x6d, 0x61, 0x74, 0x68,
+    0x5d, 0x00, 0x03, 0x0f, 0x77, 0x03, 0x30, 0x01, 0x5d, 0x00, 0x88, 0x63,
+    0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x5d, 0x00, 0x1f, 0x32, 0x78,
+    0x03, 0x30, 0x03, 0x65, 0x02, 0x0f, 0xbc, 0x00, 0x01, 0x1f, 0x32, 0x7c,
+    0x03, 0x30, 0x00, 0x01, 0x08, 0x8f, 0x31, 0x5f, 0x61, 0x74, 0x6f, 0x6d,
+    0x69, 0x63, 0x65, 0x00, 0x03, 0x0f, 0x85, 0x03, 0x30, 0x00, 0x65, 0x00,
+    0x1f, 0x32, 0x65, 0x00, 0x0a, 0x1f, 0x33, 0x65, 0x00, 0x33, 0x7f, 0x33,
+    0x5f, 0x64, 0x6f, 0x75, 0x62, 0x6c, 0x2f, 0x01, 0x04, 0x0f, 0x8c, 0x03,
+    0x30, 0x5f, 0x73, 0x6d, 0x5f, 0x32, 0x30, 0xca, 0x00, 0x0a, 0x1f, 0x35,
+    0x65, 0x00, 0x35, 0x99, 0x69, 0x6e, 0x74, 0x72, 0x69, 0x6e, 0x73, 0x69,
+    0x63, 0x5f, 0x00, 0x0f, 0x35, 0x07, 0x30, 0x04, 0x81, 0x06, 0x0f, 0xbf,
+    0x00, 0x02, 0x0f, 0x3b, 0x07, 0x30, 0x04, 0x86, 0x06, 0x4f, 0x66, 0x65,
+    0x74, 0x63, 0x75, 0x03, 0x03, 0x1f, 0x32, 0xd2, 0x03, 0x3e, 0x90, 0x5f,
+    0x64, 0x62, 0x6c, 0x5f, 0x70, 0x74, 0x78, 0x31, 0x66, 0x00, 0xf0, 0x0a,
+    0x0a, 0x09, 0x2e, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x2e, 0x61,
+    0x6c, 0x69, 0x67, 0x6e, 0x20, 0x34, 0x20, 0x2e, 0x62, 0x38, 0x20, 0x5f,
+    0x5f, 0x46, 0x00, 0x20, 0x5f, 0x6c, 0x13, 0x0a, 0xf2, 0x02, 0x5f, 0x76,
+    0x61, 0x72, 0x5f, 0x38, 0x37, 0x33, 0x38, 0x32, 0x5f, 0x33, 0x38, 0x5f,
+    0x6e, 0x6f, 0x6e, 0xc0, 0x03, 0xdf, 0x5f, 0x41, 0x73, 0x5f, 0x5f, 0x36,
+    0x5b, 0x31, 0x30, 0x32, 0x34, 0x5d, 0x3b, 0x47, 0x00, 0x19, 0x1a, 0x36,
+    0x47, 0x00, 0x54, 0x42, 0x73, 0x5f, 0x5f, 0x37, 0x47, 0x00, 0x96, 0x0a,
+    0x09, 0x2e, 0x65, 0x6e, 0x74, 0x72, 0x79, 0x20, 0x45, 0x05, 0xf1, 0x01,
+    0x62, 0x73, 0x31, 0x36, 0x5f, 0x33, 0x32, 0x62, 0x69, 0x74, 0x20, 0x28,
+    0x0a, 0x09, 0x09, 0x2e, 0x3c, 0x06, 0x53, 0x20, 0x2e, 0x75, 0x36, 0x34,
+    0x5f, 0x00, 0x47, 0x70, 0x61, 0x72, 0x6d, 0x96, 0x0a, 0x06, 0x30, 0x00,
+    0x3f, 0x5f, 0x43, 0x2c, 0x31, 0x00, 0x1c, 0x1f, 0x41, 0x31, 0x00, 0x1d,
+    0x18, 0x42, 0x31, 0x00, 0x3f, 0x73, 0x33, 0x32, 0x31, 0x00, 0x0e, 0x19,
+    0x77, 0x63, 0x00, 0x0f, 0x32, 0x00, 0x12, 0xf0, 0x08, 0x42, 0x29, 0x0a,
+    0x09, 0x7b, 0x0a, 0x09, 0x2e, 0x72, 0x65, 0x67, 0x20, 0x2e, 0x75, 0x33,
+    0x32, 0x20, 0x25, 0x72, 0x3c, 0x33, 0x34, 0x3e, 0x74, 0x01, 0x02, 0x13,
+    0x00, 0x96, 0x36, 0x34, 0x20, 0x25, 0x72, 0x64, 0x3c, 0x32, 0x39, 0x14,
+    0x00, 0x10, 0x66, 0x27, 0x00, 0x46, 0x66, 0x3c, 0x35, 0x32, 0x13, 0x00,
+    0x10, 0x70, 0x9e, 0x01, 0x32, 0x25, 0x70, 0x3c, 0x3a, 0x00, 0x30, 0x6c,
+    0x6f, 0x63, 0xdb, 0x06, 0xff, 0x00, 0x31, 0x30, 0x37, 0x09, 0x30, 0x0a,
+    0x24, 0x4c, 0x44, 0x57, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x82, 0x00, 0x02,
+    0x16, 0x3a, 0x2f, 0x00, 0x90, 0x36, 0x36, 0x09, 0x30, 0x0a, 0x09, 0x63,
+    0x76, 0x74, 0xba, 0x00, 0xf1, 0x0f, 0x2e, 0x75, 0x31, 0x36, 0x20, 0x09,
+    0x25, 0x72, 0x31, 0x2c, 0x20, 0x25, 0x63, 0x74, 0x61, 0x69, 0x64, 0x2e,
+    0x78, 0x3b, 0x0a, 0x09, 0x6d, 0x75, 0x6c, 0x32, 0x34, 0x2e, 0x6c, 0x6f,
+    0xdc, 0x00, 0x61, 0x09, 0x25, 0x72, 0x32, 0x2c, 0x20, 0x23, 0x00, 0x3d,
+    0x31, 0x36, 0x3b, 0x3a, 0x00, 0x15, 0x33, 0x3a, 0x00, 0x62, 0x79, 0x3b,
+    0x0a, 0x09, 0x6c, 0x64, 0x17, 0x01, 0x04, 0x3a, 0x00, 0x4f, 0x34, 0x2c,
+    0x20, 0x5b, 0x4f, 0x01, 0x0f, 0x00, 0x7c, 0x02, 0x37, 0x6d, 0x75, 0x6c,
+    0x72, 0x00, 0x10, 0x35, 0x72, 0x00, 0x00, 0x5b, 0x00, 0x2d, 0x72, 0x34,
+    0x1c, 0x00, 0x10, 0x36, 0x17, 0x00, 0x13, 0x35, 0x8e, 0x00, 0x34, 0x61,
+    0x64, 0x64, 0x18, 0x00, 0x10, 0x37, 0x18, 0x00, 0x01, 0x1d, 0x00, 0x00,
+    0x34, 0x00, 0x34, 0x73, 0x75, 0x62, 0x19, 0x00, 0x10, 0x38, 0x14, 0x00,
+    0x4e, 0x37, 0x2c, 0x20, 0x31, 0xbe, 0x00, 0x53, 0x39, 0x2c, 0x20, 0x25,
+    0x74, 0xf6, 0x00, 0x0c, 0x13, 0x01, 0x13, 0x30, 0x1c, 0x00, 0x0f, 0xd8,
+    0x00, 0x01, 0x2f, 0x31, 0x31, 0xd9, 0x00, 0x11, 0x10, 0x42, 0xd9, 0x00,
+    0x61, 0x73, 0x65, 0x74, 0x70, 0x2e, 0x6c, 0x5b, 0x00, 0x40, 0x20, 0x09,
+    0x25, 0x70, 0x6a, 0x01, 0x02, 0x92, 0x00, 0x00, 0xbf, 0x00, 0xf0, 0x05,
+    0x40, 0x25, 0x70, 0x31, 0x20, 0x62, 0x72, 0x61, 0x20, 0x09, 0x24, 0x4c,
+    0x74, 0x5f, 0x30, 0x5f, 0x33, 0x33, 0x33, 0x30, 0xf1, 0x00, 0x21, 0x6f,
+    0x76, 0x13, 0x02, 0x6f, 0x09, 0x25, 0x72, 0x64, 0x31, 0x2c, 0x83, 0x03,
+    0x17, 0x0b, 0x3b, 0x00, 0x1f, 0x32, 0x3b, 0x00, 0x04, 0x0f, 0x05, 0x04,
+    0x01, 0x0f, 0xbd, 0x01, 0x2a, 0x07, 0x86, 0x01, 0x11, 0x31, 0x2d, 0x02,
+    0x50, 0x34, 0x2c, 0x20, 0x31, 0x35, 0xfd, 0x00, 0x25, 0x68, 0x72, 0x19,
+    0x00, 0x01, 0xcf, 0x01, 0x00, 0x1f, 0x00, 0x10, 0x33, 0x89, 0x01, 0x00,
+    0xa8, 0x00, 0x04, 0x1a, 0x00, 0x04, 0x2e, 0x00, 0x53, 0x61, 0x6e, 0x64,
+    0x2e, 0x62, 0x14, 0x00, 0x01, 0x02, 0x02, 0x03, 0x34, 0x00, 0x00, 0xd0,
+    0x01, 0x08, 0x63, 0x00, 0x01, 0xe5, 0x01, 0x03, 0x22, 0x00, 0x1b, 0x32,
+    0x66, 0x00, 0x01, 0x06, 0x02, 0x00, 0x22, 0x00, 0x00, 0x35, 0x00, 0x0f,
+    0xb7, 0x01, 0x28, 0x0a, 0x74, 0x02, 0x11, 0x31, 0xb2, 0x01, 0x01, 0x13,
+    0x02, 0x21, 0x72, 0x31, 0xbf, 0x00, 0x0a, 0x1f, 0x00, 0x00, 0x48, 0x02,
+    0x03, 0x1f, 0x00, 0x00, 0x78, 0x00, 0x01, 0x4b, 0x02, 0x24, 0x36, 0x34,
+    0x1f, 0x00, 0x11, 0x64, 0xc7, 0x00, 0x1f, 0x39, 0x19, 0x00, 0x00, 0x12,
+    0x34, 0x38, 0x00, 0x0a, 0xe0, 0x00, 0x12, 0x32, 0x67, 0x00, 0x01, 0x54,
+    0x00, 0x0b, 0xe4, 0x02, 0x11, 0x32, 0x3f, 0x02, 0x01, 0x1a, 0x00, 0x11,
+    0x32, 0x29, 0x02, 0x75, 0x75, 0x6c, 0x2e, 0x77, 0x69, 0x64, 0x65, 0x51,
+    0x00, 0x01, 0x15, 0x01, 0x12, 0x39, 0xfe, 0x00, 0x00, 0x38, 0x00, 0x04,
+    0x0b, 0x02, 0x01, 0x33, 0x01, 0x00, 0x4c, 0x02, 0x00, 0x24, 0x00, 0x0f,
+    0x39, 0x00, 0x01, 0x02, 0x38, 0x01, 0x4c, 0x30, 0x2c, 0x20, 0x36, 0x3b,
+    0x00, 0x01, 0xfb, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x26, 0x00, 0x0f, 0x3b,
+    0x00, 0x01, 0x05, 0xfd, 0x00, 0x05, 0x92, 0x03, 0x05, 0xbc, 0x02, 0x01,
+    0xca, 0x00, 0x02, 0xff, 0x00, 0x10, 0x64, 0x00, 0x01, 0x03, 0x37, 0x01,
+    0x05, 0x20, 0x00, 0x02, 0x91, 0x00, 0x00, 0x27, 0x00, 0x0b, 0xe4, 0x01,
+    0x12, 0x32, 0x74, 0x04, 0x01, 0x5b, 0x00, 0x1d, 0x38, 0x70, 0x01, 0x12,
+    0x32, 0x18, 0x02, 0x09, 0x93, 0x04, 0x07, 0x56, 0x01, 0x02, 0x84, 0x02,
+    0x2f, 0x32, 0x33, 0xad, 0x00, 0x01, 0x02, 0x53, 0x02, 0x00, 0x41, 0x00,
+    0x0c, 0xe8, 0x00, 0x00, 0x87, 0x02, 0x06, 0x94, 0x00, 0x00, 0x58, 0x02,
+    0x09, 0x1e, 0x00, 0x01, 0x5a, 0x01, 0x05, 0xb2, 0x00, 0x0b, 0xae, 0x00,
+    0x01, 0x3b, 0x00, 0x02, 0xb4, 0x00, 0x00, 0xe7, 0x00, 0x05, 0x78, 0x02,
+    0x05, 0x3e, 0x00, 0x1f, 0x36, 0x79, 0x02, 0x10, 0x01, 0x78, 0x02, 0x08,
+    0x56, 0x00, 0x02, 0xe2, 0x02, 0x01, 0x80, 0x01, 0x04, 0x8f, 0x00, 0x04,
+    0x1b, 0x00, 0x01, 0xd0, 0x01, 0x02, 0x08, 0x02, 0x00, 0xcf, 0x01, 0x0d,
+    0x02, 0x01, 0x01, 0xcf, 0x01, 0x10, 0x32, 0x1d, 0x01, 0x0e, 0x02, 0x01,
+    0x02, 0x51, 0x00, 0x03, 0x23, 0x03, 0x09, 0xe4, 0x00, 0x01, 0x51, 0x00,
+    0x01, 0xad, 0x00, 0x01, 0x28, 0x00, 0x0f, 0xca, 0x00, 0x01, 0x00, 0x9d,
+    0x02, 0x0f, 0xca, 0x00, 0x0e, 0x01, 0x15, 0x04, 0x0c, 0x94, 0x00, 0x02,
+    0xbc, 0x02, 0x14, 0x32, 0x3e, 0x03, 0x09, 0x94, 0x00, 0x02, 0x3b, 0x01,
+    0x00, 0x22, 0x00, 0x0c, 0x94, 0x00, 0x02, 0xeb, 0x01, 0x01, 0x77, 0x00,
+    0x01, 0x28, 0x00, 0x03, 0x3b, 0x04, 0x00, 0x1d, 0x07, 0x84, 0x09, 0x25,
+    0x66, 0x31, 0x2c, 0x20, 0x30, 0x66, 0xda, 0x12, 0x20, 0x3b, 0x20, 0x01,
+    0x00, 0x00, 0x88, 0x13, 0x19, 0x30, 0x60, 0x04, 0x12, 0x32, 0xdc, 0x02,
+    0x32, 0x37, 0x3b, 0x0a, 0x65, 0x05, 0xf1, 0x17, 0x32, 0x38, 0x31, 0x38,
+    0x3a, 0x0a, 0x20, 0x2f, 0x2f, 0x3c, 0x6c, 0x6f, 0x6f, 0x70, 0x3e, 0x20,
+    0x4c, 0x6f, 0x6f, 0x70, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6c, 0x69,
+    0x6e, 0x65, 0x20, 0x36, 0x36, 0x2c, 0x20, 0x6e, 0x65, 0x73, 0x90, 0x09,
+    0xa0, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x2c, 0x20, 0x11,
+    0x00, 0xa1, 0x6d, 0x61, 0x74, 0x65, 0x64, 0x20, 0x69, 0x74, 0x65, 0x72,
+    0x11, 0x14, 0xa6, 0x73, 0x3a, 0x20, 0x75, 0x6e, 0x6b, 0x6e, 0x6f, 0x77,
+    0x6e, 0x5e, 0x07, 0x20, 0x38, 0x31, 0x5e, 0x07, 0x94, 0x6c, 0x64, 0x2e,
+    0x67, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0xa8, 0x00, 0x41, 0x32, 0x2c, 0x20,
+    0x5b, 0xcd, 0x00, 0x21, 0x2b, 0x30, 0x14, 0x06, 0x13, 0x74, 0x6b, 0x09,
+    0x02, 0x20, 0x00, 0x00, 0x1b, 0x00, 0x90, 0x31, 0x34, 0x2b, 0x30, 0x5d,
+    0x2c, 0x20, 0x25, 0x66, 0xe2, 0x00, 0x05, 0x4e, 0x00, 0x1f, 0x32, 0x4e,
+    0x00, 0x02, 0x12, 0x33, 0x4e, 0x00, 0x2f, 0x31, 0x39, 0x4e, 0x00, 0x07,
+    0x13, 0x35, 0x4e, 0x00, 0x00, 0x04, 0x03, 0x05, 0x4e, 0x00, 0x10, 0x35,
+    0x4e, 0x00, 0xa0, 0x62, 0x61, 0x72, 0x2e, 0x73, 0x79, 0x6e, 0x63, 0x20,
+    0x09, 0x41, 0x04, 0x04, 0x1c, 0x00, 0x14, 0x39, 0x6a, 0x00, 0x08, 0x4a,
+    0x00, 0x20, 0x25, 0x66, 0x03, 0x06, 0x00, 0x03, 0x04, 0x02, 0x69, 0x00,
+    0x0d, 0x1f, 0x00, 0x12, 0x35, 0x1f, 0x00, 0x12, 0x36, 0x1f, 0x00, 0x25,
+    0x6d, 0x61, 0x19, 0x00, 0x00, 0x42, 0x02, 0x00, 0x3d, 0x00, 0x01, 0x23,
+    0x00, 0x20, 0x25, 0x66, 0xf4, 0x01, 0x0d, 0x3d, 0x00, 0x14, 0x37, 0x5c,
+    0x00, 0x01, 0x7c, 0x0a, 0x0d, 0x1f, 0x00, 0x14, 0x38, 0x5c, 0x00, 0x11,
+    0x36, 0x20, 0x00, 0x07, 0x5d, 0x00, 0x00, 0xa6, 0x02, 0x00, 0x3e, 0x00,
+    0x01, 0x24, 0x00, 0x23, 0x25, 0x66, 0xbb, 0x06, 0x0a, 0x3e, 0x00, 0x00,
+    0x53, 0x04, 0x02, 0x5e, 0x00, 0x1f, 0x38, 0x5e, 0x00, 0x02, 0x01, 0x0a,
+    0x06, 0x01, 0x5f, 0x00, 0x21, 0x31, 0x32, 0x22, 0x00, 0x07, 0x60, 0x00,
+    0x01, 0x3f, 0x04, 0x01, 0x42, 0x00, 0x02, 0x28, 0x00, 0x23, 0x25, 0x66,
+    0xd4, 0x03, 0x0b, 0x43, 0x00, 0x03, 0x87, 0x01, 0x4f, 0x38, 0x2b, 0x31,
+    0x32, 0x64, 0x00, 0x03, 0x03, 0x3e, 0x01, 0x41, 0x36, 0x2b, 0x31, 0x39,
+    0x22, 0x00, 0x08, 0x64, 0x00, 0x02, 0x18, 0x01, 0x00, 0xdd, 0x02, 0x01,
+    0x28, 0x00, 0x00, 0x76, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x00, 0x39, 0x04,
+    0x02, 0x65, 0x00, 0x1f, 0x36, 0x65, 0x00, 0x03, 0x03, 0x47, 0x01, 0x41,
+    0x36, 0x2b, 0x32, 0x35, 0x22, 0x00, 0x08, 0x65, 0x00, 0x01, 0x20, 0x01,
+    0x01, 0xcf, 0x03, 0x01, 0x28, 0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00,
+    0x02, 0x14, 0x39, 0x65, 0x00, 0x1f, 0x32, 0xe8, 0x01, 0x03, 0x01, 0xf5,
+    0x03, 0x01, 0x65, 0x00, 0x12, 0x33, 0x22, 0x00, 0x07, 0x65, 0x00, 0x01,
+    0xd7, 0x03, 0x01, 0x43, 0x00, 0x02, 0x28, 0x00, 0x00, 0x77, 0x00, 0x0f,
+    0x44, 0x00, 0x02, 0x03, 0x04, 0x03, 0x22, 0x38, 0x2b, 0x6d, 0x0c, 0x0e,
+    0x21, 0x00, 0x03, 0x50, 0x01, 0x4c, 0x36, 0x2b, 0x33, 0x38, 0xf3, 0x01,
+    0x01, 0x61, 0x05, 0x01, 0x43, 0x00, 0x02, 0x28, 0x00, 0x00, 0x77, 0x00,
+    0x0f, 0x44, 0x00, 0x02, 0x03, 0x92, 0x02, 0x22, 0x38, 0x2b, 0xd6, 0x01,
+    0x0e, 0x21, 0x00, 0x03, 0x50, 0x01, 0x4c, 0x36, 0x2b, 0x34, 0x34, 0xf8,
+    0x01, 0x01, 0x28, 0x04, 0x01, 0x43, 0x00, 0x02, 0x28, 0x00, 0x00, 0x77,
+    0x00, 0x0f, 0x44, 0x00, 0x02, 0x03, 0x9b, 0x02, 0x3f, 0x38, 0x2b, 0x33,
+    0xf9, 0x01, 0x03, 0x13, 0x32, 0x50, 0x01, 0x32, 0x36, 0x2b, 0x35, 0x1b,
+    0x02, 0x07, 0x65, 0x00, 0x11, 0x33, 0x23, 0x01, 0x00, 0x43, 0x00, 0x02,
+    0x28, 0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x01, 0x13, 0x33, 0xa1,
+    0x02, 0x3f, 0x38, 0x2b, 0x33, 0xf9, 0x01, 0x03, 0x13, 0x33, 0x50, 0x01,
+    0x4c, 0x36, 0x2b, 0x35, 0x37, 0xf9, 0x01, 0x11, 0x33, 0x23, 0x01, 0x00,
+    0x43, 0x00, 0x02, 0x28, 0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x02,
+    0x05, 0xe0, 0x03, 0x1f, 0x34, 0xf9, 0x01, 0x03, 0x15, 0x33, 0xe2, 0x03,
+    0x12, 0x36, 0x22, 0x00, 0x08, 0x65, 0x00, 0x01, 0x23, 0x01, 0x00, 0x43,
+    0x00, 0x02, 0x28, 0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x06,
+    0xe9, 0x03, 0x0f, 0xf9, 0x01, 0x03, 0x15, 0x33, 0xeb, 0x03, 0x2c, 0x37,
+    0x30, 0xf9, 0x01, 0x11, 0x33, 0x23, 0x01, 0x00, 0x43, 0x00, 0x02, 0x28,
+    0x00, 0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x01, 0x15, 0x34, 0xf0, 0x03,
+    0x02, 0xd7, 0x01, 0x0e, 0x21, 0x00, 0x05, 0xf1, 0x03, 0x2c, 0x37, 0x36,
+    0xf9, 0x01, 0x11, 0x34, 0x23, 0x01, 0x00, 0x43, 0x00, 0x02, 0x28, 0x00,
+    0x00, 0x77, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x05, 0xf2, 0x03, 0x1f, 0x35,
+    0xf9, 0x01, 0x03, 0x15, 0x34, 0xf2, 0x03, 0x12, 0x38, 0x1b, 0x02, 0x08,
+    0x65, 0x00, 0x01, 0x23, 0x01, 0x00, 0x43, 0x00, 0x02, 0x28, 0x00, 0x00,
+    0x77, 0x00, 0x0f, 0x44, 0x00, 0x02, 0x05, 0xf2, 0x03, 0x02, 0xd0, 0x03,
+    0x0e, 0x21, 0x00, 0x05, 0xf2, 0x03, 0x2c, 0x38, 0x39, 0xf9, 0x01, 0x11,
+    0x34, 0x23, 0x01, 0x00, 0x43, 0x00, 0x02, 0x28, 0x00, 0x00, 0x77, 0x00,
+    0x0f, 0x44, 0x00, 0x02, 0x05, 0xf2, 0x03, 0x1f, 0x36, 0xda, 0x05, 0x04,
+    0x05, 0xf2, 0x03, 0x12, 0x39, 0x22, 0x00, 0x08, 0x57, 0x04, 0x01, 0x58,
+    0x00, 0x01, 0x99, 0x01, 0x00, 0x27, 0x00, 0x00, 0x76, 0x00, 0x08, 0x4a,
+    0x06, 0x00, 0x8e, 0x0e, 0x0f, 0x66, 0x06, 0x04, 0x02, 0x7c, 0x0e, 0x0f,
+    0x73, 0x08, 0x01, 0x02, 0xe6, 0x07, 0x10, 0x31, 0x77, 0x01, 0x0d, 0xef,
+    0x0a, 0x00, 0x06, 0x00, 0x0d, 0x5b, 0x0a, 0x04, 0x18, 0x08, 0x13, 0x33,
+    0xb2, 0x0a, 0x02, 0x67, 0x0d, 0x04, 0x52, 0x08, 0x15, 0x70, 0x50, 0x08,
+    0x00, 0x9d, 0x09, 0x02, 0x69, 0x0d, 0x18, 0x32, 0x69, 0x0d, 0x00, 0x04,
+    0x08, 0xa5, 0x3b, 0x0a, 0x09, 0x62, 0x72, 0x61, 0x2e, 0x75, 0x6e, 0x69,
+    0x16, 0x00, 0x34, 0x33, 0x30, 0x36, 0x26, 0x08, 0x00, 0x8b, 0x0d, 0x1f,
+    0x3a, 0x43, 0x0c, 0x4a, 0x0f, 0xc7, 0x08, 0x10, 0x06, 0x97, 0x00, 0x07,
+    0xc2, 0x0f, 0x33, 0x31, 0x30, 0x33, 0xad, 0x07, 0x0b, 0x9b, 0x09, 0x0f,
+    0xb1, 0x0d, 0x11, 0x1e, 0x43, 0x9a, 0x00, 0x01, 0x8d, 0x04, 0x01, 0xd9,
+    0x00, 0x20, 0x25, 0x72, 0xc2, 0x03, 0x08, 0x81, 0x01, 0x02, 0xdc, 0x0b,
+    0x01, 0x47, 0x01, 0x0e, 0x87, 0x0b, 0x01, 0xcc, 0x04, 0x01, 0x24, 0x00,
+    0x0c, 0x8c, 0x0f, 0x01, 0x7b, 0x04, 0x03, 0xf3, 0x00, 0x01, 0x7b, 0x04,
+    0x08, 0x1c, 0x00, 0x02, 0x27, 0x0b, 0x01, 0x1b, 0x00, 0x05, 0x93, 0x0f,
+    0x08, 0x28, 0x0a, 0x02, 0xfd, 0x0f, 0x01, 0xea, 0x09, 0x0d, 0x28, 0x0a,
+    0x01, 0x9b, 0x0a, 0x00, 0x42, 0x00, 0x0d, 0x28, 0x0a, 0x01, 0xe5, 0x09,
+    0x01, 0x04, 0x01, 0x01, 0x28, 0x00, 0x02, 0x18, 0x09, 0x08, 0x38, 0x09,
+    0x01, 0x81, 0x09, 0x13, 0x37, 0x18, 0x09, 0x00, 0x79, 0x00, 0x05, 0x50,
+    0x01, 0x20, 0x31, 0x30, 0x50, 0x01, 0x40, 0x65, 0x78, 0x69, 0x74, 0xfd,
+    0x01, 0x5f, 0x44, 0x57, 0x65, 0x6e, 0x64, 0x46, 0x11, 0x05, 0x4f, 0x7d,
+    0x20, 0x2f, 0x2f, 0xd9, 0x12, 0x02, 0x0f, 0x85, 0x13, 0x2c, 0x1f, 0x34,
+    0x85, 0x13, 0x33, 0x1f, 0x35, 0x85, 0x13, 0x0d, 0x2f, 0x36, 0x34, 0x85,
+    0x13, 0x1b, 0x01, 0x30, 0x00, 0x0f, 0x85, 0x13, 0x19, 0x02, 0x31, 0x00,
+    0x0f, 0x85, 0x13, 0x18, 0x02, 0x31, 0x00, 0x09, 0x85, 0x13, 0x0f, 0x31,
+    0x00, 0x11, 0x0a, 0x85, 0x13, 0x0f, 0x32, 0x00, 0x12, 0x0a, 0x85, 0x13,
+    0x03, 0x72, 0x13, 0x2f, 0x35, 0x33, 0x72, 0x13, 0x20, 0x10, 0x31, 0xe6,
+    0x0b, 0x0f, 0x72, 0x13, 0x06, 0x01, 0x6f, 0x00, 0x0f, 0x72, 0x13, 0x02,
+    0x34, 0x75, 0x36, 0x34, 0x5f, 0x12, 0x01, 0x8c, 0x0f, 0x09, 0x73, 0x13,
+    0x08, 0x19, 0x0f, 0x02, 0x6e, 0x0f, 0x08, 0xe0, 0x0e, 0x08, 0x3b, 0x00,
+    0x0f, 0x74, 0x13, 0x04, 0x04, 0x3d, 0x00, 0x0f, 0x07, 0x04, 0x0b, 0x04,
+    0x3f, 0x01, 0x07, 0x08, 0x04, 0x04, 0x39, 0x00, 0x02, 0xe3, 0x0e, 0x02,
+    0x59, 0x05, 0x07, 0x78, 0x13, 0x0a, 0x44, 0x10, 0x04, 0x7a, 0x13, 0x01,
+    0x61, 0x0d, 0x03, 0x1a, 0x00, 0x02, 0x7c, 0x03, 0x0c, 0xa3, 0x05, 0x02,
+    0x39, 0x10, 0x02, 0x36, 0x00, 0x04, 0x93, 0x13, 0x04, 0x1c, 0x00, 0x02,
+    0xf7, 0x05, 0x16, 0x38, 0x95, 0x13, 0x09, 0x1b, 0x01, 0x04, 0x7b, 0x13,
+    0x04, 0x97, 0x13, 0x09, 0x1d, 0x00, 0x00, 0x39, 0x01, 0x0d, 0x98, 0x13,
+    0x05, 0x50, 0x06, 0x00, 0x16, 0x09, 0x0f, 0x0a, 0x02, 0x0f, 0x08, 0x99,
+    0x13, 0x02, 0x3b, 0x00, 0x02, 0x99, 0x13, 0x03, 0x98, 0x00, 0x0e, 0x9b,
+    0x13, 0x1f, 0x31, 0x9b, 0x13, 0x02, 0x1f, 0x33, 0x9c, 0x13, 0x17, 0x01,
+    0x75, 0x11, 0x08, 0x3c, 0x00, 0x1f, 0x34, 0x9d, 0x13, 0x17, 0x09, 0xcb,
+    0x12, 0x0f, 0xe6, 0x01, 0x1f, 0x0f, 0xc7, 0x10, 0x00, 0x09, 0xa0, 0x13,
+    0x07, 0xa4, 0x10, 0x03, 0x22, 0x00, 0x11, 0x36, 0x3b, 0x11, 0x07, 0xe1,
+    0x01, 0x00, 0x3e, 0x0c, 0x06, 0xa3, 0x13, 0x04, 0x15, 0x00, 0x02, 0xe1,
+    0x01, 0x04, 0x38, 0x00, 0x00, 0xc7, 0x0a, 0x01, 0xe7, 0x05, 0x0b, 0xdb,
+    0x07, 0x03, 0x26, 0x00, 0x0c, 0x6f, 0x00, 0x03, 0xd2, 0x0f, 0x00, 0x26,
+    0x00, 0x0f, 0xe0, 0x00, 0x02, 0x0f, 0xca, 0x01, 0x18, 0x0c, 0x3d, 0x03,
+    0x03, 0xa4, 0x11, 0x03, 0x07, 0x00, 0x04, 0x49, 0x06, 0x08, 0x22, 0x00,
+    0x03, 0x60, 0x03, 0x1f, 0x31, 0xef, 0x12, 0x00, 0x03, 0x59, 0x08, 0x03,
+    0x0e, 0x12, 0x02, 0x71, 0x10, 0x0b, 0x3e, 0x00, 0x03, 0x29, 0x12, 0x07,
+    0xb6, 0x12, 0x05, 0x1b, 0x00, 0x03, 0x26, 0x12, 0x03, 0x9d, 0x08, 0x0f,
+    0x45, 0x03, 0x00, 0x02, 0xc2, 0x06, 0x01, 0x7b, 0x00, 0x0e, 0xd4, 0x08,
+    0x02, 0x48, 0x03, 0x03, 0x36, 0x13, 0x05, 0xbe, 0x11, 0x08, 0x3e, 0x00,
+    0x03, 0x8d, 0x13, 0x12, 0x37, 0x7b, 0x00, 0x0c, 0x1e, 0x00, 0x03, 0x72,
+    0x01, 0x1f, 0x32, 0xd7, 0x00, 0x00, 0x02, 0xac, 0x07, 0x04, 0x41, 0x00,
+    0x05, 0x53, 0x15, 0x05, 0x1f, 0x00, 0x03, 0xf6, 0x12, 0x03, 0x1f, 0x00,
+    0x03, 0xc9, 0x0b, 0x0a, 0x92, 0x01, 0x01, 0x72, 0x0c, 0x0f, 0xc9, 0x05,
+    0x0e, 0x0c, 0x72, 0x02, 0x01, 0x8c, 0x0c, 0x05, 0x95, 0x01, 0x0c, 0x57,
+    0x13, 0x01, 0x3f, 0x0c, 0x06, 0x29, 0x14, 0x04, 0xb3, 0x13, 0x07, 0xd5,
+    0x00, 0x01, 0x5b, 0x0c, 0x02, 0x29, 0x00, 0x0d, 0xb5, 0x00, 0x02, 0x4c,
+    0x01, 0x02, 0x51, 0x08, 0x23, 0x64, 0x33, 0xea, 0x0a, 0x0b, 0xb5, 0x00,
+    0x00, 0x2e, 0x0b, 0x0f, 0xaf, 0x06, 0x0e, 0x0f, 0x46, 0x02, 0x00, 0x01,
+    0x6e, 0x0c, 0x05, 0x46, 0x02, 0x0d, 0x7b, 0x00, 0x03, 0x29, 0x04, 0x02,
+    0x7a, 0x00, 0x00, 0x1b, 0x09, 0x08, 0x1e, 0x00, 0x01, 0x4b, 0x0c, 0x06,
+    0xd6, 0x00, 0x0f, 0xfa, 0x14, 0x00, 0x01, 0x67, 0x0c, 0x02, 0x29, 0x00,
+    0x0c, 0x5b, 0x00, 0x01, 0x8e, 0x0c, 0x02, 0xb9, 0x00, 0x01, 0x29, 0x00,
+    0x0f, 0xf2, 0x12, 0x1a, 0x04, 0x44, 0x00, 0x04, 0x36, 0x13, 0x02, 0xce,
+    0x0a, 0x1f, 0x31, 0xf4, 0x12, 0x68, 0x2f, 0x34, 0x32, 0xa6, 0x12, 0x06,
+    0x2f, 0x33, 0x30, 0xf4, 0x12, 0x1e, 0x13, 0x33, 0x6c, 0x12, 0x0f, 0x4e,
+    0x00, 0x01, 0x1f, 0x31, 0xf4, 0x12, 0x3a, 0x04, 0xac, 0x13, 0x0f, 0xf5,
+    0x12, 0x05, 0x10, 0x32, 0x63, 0x13, 0x0f, 0xf6, 0x12, 0x26, 0x2f, 0x32,
+    0x33, 0xf7, 0x12, 0x0b, 0x2f, 0x32, 0x35, 0xf8, 0x12, 0x2b, 0x2f, 0x32,
+    0x33, 0xf9, 0x12, 0x0c, 0x2f, 0x32, 0x35, 0xfa, 0x12, 0x2f, 0x2f, 0x32,
+    0x33, 0xfb, 0x12, 0x0d, 0x00, 0x66, 0x00, 0x0f, 0xfc, 0x12, 0x2e, 0x00,
+    0x67, 0x00, 0x0f, 0xfd, 0x12, 0x0b, 0x2f, 0x32, 0x35, 0xfe, 0x12, 0x30,
+    0x2f, 0x32, 0x33, 0xff, 0x12, 0x0d, 0x2f, 0x32, 0x35, 0x00, 0x13, 0x30,
+    0x00, 0x67, 0x00, 0x0f, 0x01, 0x13, 0x0b, 0x00, 0x67, 0x00, 0x0f, 0x02,
+    0x13, 0x2e, 0x00, 0x67, 0x00, 0x0f, 0x03, 0x13, 0x0b, 0x2f, 0x32, 0x35,
+    0x04, 0x13, 0x30, 0x2f, 0x32, 0x33, 0x05, 0x13, 0x0d, 0x2f, 0x32, 0x35,
+    0x06, 0x13, 0x30, 0x00, 0x67, 0x00, 0x0f, 0x07, 0x13, 0x0b, 0x00, 0x67,
+    0x00, 0x0f, 0x08, 0x13, 0x2e, 0x00, 0x96, 0x03, 0x0f, 0x09, 0x13, 0x0b,
+    0x01, 0x98, 0x03, 0x0f, 0x0a, 0x13, 0x2d, 0x00, 0x67, 0x00, 0x0f, 0x0b,
+    0x13, 0x0b, 0x2f, 0x32, 0x35, 0x0c, 0x13, 0x30, 0x00, 0x67, 0x00, 0x0f,
+    0x0d, 0x13, 0x0b, 0x00, 0x67, 0x00, 0x0f, 0x0e, 0x13, 0x2e, 0x2f, 0x32,
+    0x33, 0x0f, 0x13, 0x0d, 0x2f, 0x32, 0x35, 0x10, 0x13, 0x30, 0x00, 0x67,
+    0x00, 0x0f, 0x11, 0x13, 0x0b, 0x00, 0x67, 0x00, 0x0f, 0x12, 0x13, 0x2e,
+    0x2f, 0x32, 0x33, 0x13, 0x13, 0x0d, 0x2f, 0x32, 0x35, 0x14, 0x13, 0x4c,
+    0x03, 0xd7, 0x08, 0x03, 0xce, 0x09, 0x01, 0xe4, 0x01, 0x08, 0x1f, 0x00,
+    0x02, 0x18, 0x08, 0x00, 0x91, 0x0b, 0x0c, 0x1a, 0x00, 0x03, 0x3a, 0x08,
+    0x00, 0x07, 0x00, 0x06, 0x14, 0x13, 0x24, 0x67, 0x65, 0xe2, 0x0c, 0x02,
+    0x1e, 0x00, 0x02, 0x56, 0x00, 0x00, 0x6e, 0x03, 0x0a, 0x14, 0x13, 0x02,
+    0x24, 0x08, 0x0c, 0x14, 0x13, 0x17, 0x31, 0x14, 0x13, 0x02, 0x04, 0x0d,
+    0x08, 0x14, 0x13, 0x0f, 0xac, 0x0b, 0x43, 0x0f, 0x18, 0x13, 0x14, 0x02,
+    0x9b, 0x00, 0x0f, 0x18, 0x13, 0x10, 0x01, 0x87, 0x02, 0x0f, 0xe3, 0x10,
+    0x0e, 0x0f, 0x9d, 0x00, 0x00, 0x01, 0xa3, 0x02, 0x04, 0x4f, 0x1e, 0x14,
+    0x64, 0x1b, 0x13, 0x05, 0x1e, 0x00, 0x08, 0x54, 0x1f, 0x01, 0x55, 0x02,
+    0x0c, 0x3f, 0x00, 0x03, 0xc2, 0x09, 0x1f, 0x36, 0xab, 0x01, 0x01, 0x03,
+    0xc9, 0x0b, 0x03, 0x3e, 0x00, 0x04, 0x3c, 0x0d, 0x05, 0x1f, 0x00, 0x03,
+    0xca, 0x0b, 0x02, 0x41, 0x0a, 0x01, 0x4c, 0x02, 0x0c, 0xac, 0x0f, 0x03,
+    0x1b, 0x00, 0x0f, 0xec, 0x1f, 0x00, 0x13, 0x35, 0x55, 0x00, 0x02, 0x5b,
+    0x0b, 0x10, 0x35, 0x6d, 0x02, 0x0f, 0x0b, 0x13, 0x00, 0x14, 0x35, 0x2f,
+    0x09, 0x0a, 0x0b, 0x13, 0x1f, 0x34, 0x0b, 0x13, 0x0e, 0x04, 0xdf, 0x10,
+    0x0f, 0x0b, 0x13, 0x01, 0x01, 0x1c, 0x00, 0x0f, 0x0b, 0x13, 0x2c, 0x42,
+    0x32, 0x5b, 0x34, 0x30, 0xc7, 0x03, 0x0f, 0x0b, 0x13, 0x2a, 0x14, 0x33,
+    0x47, 0x00, 0x0f, 0x0b, 0x13, 0x02, 0x2f, 0x33, 0x32, 0x90, 0x26, 0x1b,
+    0x04, 0x30, 0x00, 0x0f, 0x0b, 0x13, 0x16, 0x05, 0x31, 0x00, 0x0f, 0xa8,
+    0x12, 0x15, 0x05, 0x31, 0x00, 0x0f, 0x90, 0x26, 0x15, 0x05, 0x31, 0x00,
+    0x0f, 0x90, 0x26, 0x16, 0x06, 0x32, 0x00, 0x0f, 0x90, 0x26, 0x28, 0x3f,
+    0x31, 0x30, 0x30, 0x1f, 0x13, 0x0e, 0x00, 0x75, 0x0b, 0x0f, 0x1f, 0x13,
+    0x03, 0x04, 0x83, 0x00, 0x0f, 0x91, 0x26, 0x33, 0x01, 0x25, 0x16, 0x0f,
+    0x91, 0x26, 0x35, 0x07, 0x50, 0x01, 0x0f, 0x91, 0x26, 0x23, 0x01, 0x8e,
+    0x00, 0x0f, 0x91, 0x26, 0x80, 0x07, 0xf7, 0x01, 0x0f, 0x91, 0x26, 0x1c,
+    0x1f, 0x32, 0x91, 0x26, 0x2c, 0x04, 0x47, 0x12, 0x0f, 0x91, 0x26, 0x20,
+    0x03, 0x0c, 0x08, 0x0f, 0xbd, 0x01, 0x24, 0x0f, 0x91, 0x26, 0x01, 0x01,
+    0x6d, 0x18, 0x0f, 0x91, 0x26, 0x16, 0x01, 0x14, 0x00, 0x0f, 0x91, 0x26,
+    0x3a, 0x09, 0x9f, 0x10, 0x0f, 0xb7, 0x01, 0x1f, 0x0f, 0x91, 0x26, 0xe6,
+    0x11, 0x31, 0x7a, 0x1a, 0x0f, 0x92, 0x26, 0x23, 0x05, 0x93, 0x03, 0x0f,
+    0x92, 0x26, 0x57, 0x06, 0x94, 0x04, 0x0f, 0x92, 0x26, 0xa6, 0x06, 0x8b,
+    0x06, 0x0f, 0x92, 0x26, 0xad, 0x06, 0x86, 0x07, 0x0f, 0x92, 0x26, 0x88,
+    0x1f, 0x32, 0x92, 0x26, 0xff, 0x9e, 0x0e, 0x39, 0x13, 0x0f, 0x93, 0x26,
+    0x3b, 0x0f, 0xcc, 0x12, 0x00, 0x0f, 0x93, 0x26, 0x3e, 0x0e, 0x62, 0x12,
+    0x0f, 0x93, 0x26, 0x40, 0x0e, 0xf9, 0x11, 0x0f, 0x93, 0x26, 0x40, 0x0e,
+    0x90, 0x11, 0x0f, 0x93, 0x26, 0x40, 0x0e, 0x27, 0x11, 0x0f, 0x93, 0x26,
+    0x40, 0x0e, 0xbe, 0x10, 0x0f, 0x93, 0x26, 0x40, 0x04, 0x68, 0x20, 0x0f,
+    0x94, 0x26, 0x4b, 0x22, 0x31, 0x31, 0x14, 0x12, 0x0f, 0x95, 0x26, 0x4b,
+    0x3f, 0x31, 0x32, 0x38, 0x96, 0x26, 0x50, 0x3c, 0x31, 0x34, 0x30, 0xfd,
+    0x01, 0x0f, 0x97, 0x26, 0x40, 0x22, 0x31, 0x35, 0x55, 0x01, 0x0f, 0x98,
+    0x26, 0x4b, 0x2d, 0x31, 0x36, 0x57, 0x18, 0x0f, 0x99, 0x26, 0x40, 0x2d,
+    0x31, 0x37, 0xf5, 0x17, 0x0f, 0x9a, 0x26, 0x40, 0x2d, 0x31, 0x39, 0x8d,
+    0x17, 0x01, 0xfb, 0x10, 0x0e, 0x88, 0x13, 0x0e, 0x45, 0x00, 0x05, 0xfa,
+    0x03, 0x02, 0x0f, 0x01, 0x0e, 0x21, 0x00, 0x05, 0xfa, 0x03, 0x2d, 0x32,
+    0x30, 0x25, 0x17, 0x12, 0x35, 0x48, 0x06, 0x01, 0x9e, 0x01, 0x00, 0x29,
+    0x00, 0x00, 0x78, 0x00, 0x0f, 0x45, 0x00, 0x02, 0x05, 0xfb, 0x03, 0x02,
+    0x3e, 0x04, 0x0e, 0x21, 0x00, 0x05, 0xfb, 0x03, 0x2d, 0x32, 0x31, 0xbd,
+    0x16, 0x11, 0x35, 0x26, 0x01, 0x00, 0x44, 0x00, 0x02, 0x29, 0x00, 0x00,
+    0x78, 0x00, 0x0f, 0x45, 0x00, 0x02, 0x05, 0xfc, 0x03, 0x1f, 0x37, 0xfe,
+    0x01, 0x03, 0x15, 0x35, 0xfc, 0x03, 0x2d, 0x32, 0x33, 0x55, 0x16, 0x11,
+    0x36, 0x26, 0x01, 0x00, 0x44, 0x00, 0x02, 0x29, 0x00, 0x00, 0x78, 0x00,
+    0x0f, 0x45, 0x00, 0x01, 0x15, 0x36, 0xfc, 0x03, 0x02, 0xa9, 0x00, 0x0e,
+    0x21, 0x00, 0x05, 0xfc, 0x03, 0x2d, 0x32, 0x34, 0xed, 0x15, 0x11, 0x36,
+    0x26, 0x01, 0x00, 0x44, 0x00, 0x02, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f,
+    0x45, 0x00, 0x02, 0x05, 0xfc, 0x03, 0x02, 0xd9, 0x03, 0x0e, 0x21, 0x00,
+    0x05, 0xfc, 0x03, 0x2d, 0x32, 0x35, 0x85, 0x15, 0x00, 0x28, 0x09, 0x02,
+    0x44, 0x00, 0x02, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x45, 0x00, 0x02,
+    0x05, 0xfc, 0x03, 0x02, 0x05, 0x07, 0x0e, 0x21, 0x00, 0x05, 0xfc, 0x03,
+    0x3c, 0x32, 0x36, 0x38, 0xfe, 0x01, 0x11, 0x36, 0x26, 0x01, 0x00, 0x44,
+    0x00, 0x02, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x4e, 0x08, 0x02, 0x06,
+    0xf0, 0x07, 0x0f, 0xfe, 0x01, 0x03, 0x16, 0x37, 0xf1, 0x07, 0x12, 0x38,
+    0x4b, 0x07, 0x07, 0x66, 0x00, 0x11, 0x37, 0x26, 0x01, 0x00, 0x44, 0x00,
+    0x02, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x45, 0x00, 0x02, 0x05, 0xfc,
+    0x03, 0x02, 0x73, 0x03, 0x0e, 0x21, 0x00, 0x05, 0xfc, 0x03, 0x22, 0x32,
+    0x39, 0xeb, 0x04, 0x08, 0x66, 0x00, 0x01, 0x26, 0x01, 0x00, 0x44, 0x00,
+    0x02, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x45, 0x00, 0x02, 0x05, 0xfc,
+    0x03, 0x02, 0xa3, 0x06, 0x0e, 0x21, 0x00, 0x05, 0xfc, 0x03, 0x22, 0x33,
+    0x30, 0x87, 0x02, 0x08, 0x66, 0x00, 0x01, 0x26, 0x01, 0x00, 0x44, 0x00,
+    0x02, 0x29, 0x00, 0x00, 0x78, 0x00, 0x0f, 0x45, 0x00, 0x02, 0x05, 0xfc,
+    0x03, 0x2f, 0x31, 0x30, 0xff, 0x01, 0x03, 0x18, 0x38, 0x89, 0x2e, 0x0c,
+    0xff, 0x01, 0x11, 0x38, 0x27, 0x01, 0x00, 0x45, 0x00, 0x02, 0x29, 0x00,
+    0x00, 0x79, 0x00, 0x0f, 0x45, 0x00, 0x02, 0x05, 0xfd, 0x03, 0x12, 0x31,
+    0x0f, 0x03, 0x0e, 0x22, 0x00, 0x06, 0x8b, 0x2e, 0x1d, 0x33, 0xec, 0x09,
+    0x11, 0x38, 0x28, 0x01, 0x00, 0x45, 0x00, 0x02, 0x29, 0x00, 0x00, 0x79,
+    0x00, 0x0f, 0x45, 0x00, 0x02, 0x05, 0xfe, 0x03, 0x12, 0x31, 0x40, 0x06,
+    0x0e, 0x22, 0x00, 0x05, 0xff, 0x03, 0x2d, 0x33, 0x34, 0xf3, 0x09, 0x12,
+    0x38, 0x4f, 0x0a, 0x01, 0xa1, 0x01, 0x00, 0x29, 0x00, 0x00, 0x79, 0x00,
+    0x0f, 0x45, 0x00, 0x02, 0x05, 0xff, 0x03, 0x1f, 0x31, 0xf5, 0x09, 0x04,
+    0x15, 0x38, 0x00, 0x04, 0x2d, 0x33, 0x35, 0xf6, 0x09, 0x11, 0x39, 0x29,
+    0x01, 0x00, 0x45, 0x00, 0x02, 0x29, 0x00, 0x00, 0x79, 0x00, 0x0f, 0x45,
+    0x00, 0x01, 0x15, 0x39, 0x00, 0x04, 0x1f, 0x31, 0xf7, 0x09, 0x04, 0x15,
+    0x39, 0x01, 0x04, 0x2d, 0x33, 0x37, 0xf8, 0x09, 0x11, 0x39, 0x29, 0x01,
+    0x00, 0x45, 0x00, 0x02, 0x29, 0x00, 0x00, 0x79, 0x00, 0x0f, 0x45, 0x00,
+    0x02, 0x05, 0x01, 0x04, 0x1f, 0x31, 0xf9, 0x09, 0x04, 0x15, 0x39, 0x02,
+    0x04, 0x2d, 0x33, 0x38, 0xfa, 0x09, 0x11, 0x39, 0x29, 0x01, 0x00, 0x45,
+    0x00, 0x02, 0x29, 0x00, 0x00, 0x79, 0x00, 0x0f, 0x45, 0x00, 0x02, 0x05,
+    0x02, 0x04, 0x1f, 0x31, 0xfb, 0x09, 0x04, 0x15, 0x39, 0x03, 0x04, 0x2d,
+    0x33, 0x39, 0xfc, 0x09, 0x02, 0xc7, 0x00, 0x01, 0xa1, 0x01, 0x00, 0x28,
+    0x00, 0x00, 0x78, 0x00, 0x0f, 0x02, 0x2d, 0x4e, 0x0d, 0xcb, 0x10, 0x07,
+    0x02, 0x2d, 0x02, 0x23, 0x11, 0x0f, 0x03, 0x2d, 0x1a, 0x02, 0x75, 0x0e,
+    0x0c, 0xef, 0x19, 0x17, 0x32, 0xef, 0x19, 0x02, 0xfd, 0x13, 0x0f, 0x03,
+    0x2d, 0x1c, 0x0f, 0xb5, 0x12, 0x1c, 0x0f, 0xeb, 0x19, 0x14, 0x02, 0x97,
+    0x00, 0x0f, 0x03, 0x2d, 0x2c, 0x06, 0xc3, 0x17, 0x0f, 0x03, 0x2d, 0x42,
+    0x0c, 0xfe, 0x15, 0x0f, 0x03, 0x2d, 0x9c, 0x1f, 0x38, 0xf8, 0x19, 0x0b,
+    0x07, 0xb8, 0x17, 0x0d, 0xf8, 0x19, 0x04, 0x1c, 0x00, 0x0f, 0xf8, 0x19,
+    0x2c, 0x1f, 0x30, 0xf8, 0x19, 0x33, 0x1f, 0x31, 0xf8, 0x19, 0x0d, 0x0f,
+    0x03, 0x2d, 0x1a, 0x04, 0x30, 0x00, 0x0f, 0xf8, 0x19, 0x19, 0x0f, 0x03,
+    0x2d, 0x1b, 0x05, 0x31, 0x00, 0x0f, 0x03, 0x2d, 0x15, 0x05, 0x31, 0x00,
+    0x0f, 0x03, 0x2d, 0x16, 0x06, 0x32, 0x00, 0x0f, 0x03, 0x2d, 0x15, 0x0f,
+    0xe5, 0x19, 0x11, 0x1f, 0x39, 0xe5, 0x19, 0x09, 0x0f, 0x04, 0x2d, 0x39,
+    0x05, 0x52, 0x15, 0x0f, 0x04, 0x2d, 0x33, 0x07, 0x40, 0x01, 0x0f, 0x04,
+    0x2d, 0x28, 0x02, 0x9d, 0x03, 0x0f, 0x04, 0x2d, 0x9e, 0x07, 0x0b, 0x02,
+    0x0f, 0x04, 0x2d, 0x1e, 0x1f, 0x33, 0x04, 0x2d, 0x2d, 0x04, 0xf3, 0x05,
+    0x0f, 0x04, 0x2d, 0x21, 0x03, 0x2e, 0x08, 0x0f, 0xe6, 0x01, 0x25, 0x0f,
+    0x04, 0x2d, 0x03, 0x06, 0x13, 0x1a, 0x0f, 0x04, 0x2d, 0x14, 0x06, 0x16,
+    0x1a, 0x0f, 0x04, 0x2d, 0x3d, 0x0f, 0xbd, 0x2a, 0x02, 0x0f, 0xca, 0x01,
+    0x18, 0x0f, 0x04, 0x2d, 0x29, 0x0e, 0x62, 0x19, 0x0f, 0x05, 0x2d, 0x57,
+    0x0e, 0xd7, 0x08, 0x0f, 0x05, 0x2d, 0x37, 0x0e, 0xd8, 0x00, 0x0f, 0x06,
+    0x2d, 0x4c, 0x06, 0xcc, 0x05, 0x0f, 0x06, 0x2d, 0x98, 0x06, 0xb2, 0x06,
+    0x0f, 0x06, 0x2d, 0xcc, 0x1f, 0x33, 0x06, 0x2d, 0xff, 0xa2, 0x0f, 0x6c,
+    0x19, 0x2b, 0x0f, 0x07, 0x2d, 0x11, 0x0f, 0x6e, 0x19, 0x2e, 0x0f, 0x07,
+    0x2d, 0x12, 0x0f, 0x70, 0x19, 0x2f, 0x0f, 0x07, 0x2d, 0x12, 0x0f, 0x72,
+    0x19, 0x2f, 0x0f, 0x07, 0x2d, 0x12, 0x0f, 0x74, 0x19, 0x2f, 0x0f, 0x07,
+    0x2d, 0x12, 0x0f, 0x76, 0x19, 0x2f, 0x0f, 0x07, 0x2d, 0x12, 0x0f, 0x78,
+    0x19, 0x2f, 0x0f, 0x07, 0x2d, 0x12, 0x0f, 0x7a, 0x19, 0x30, 0x0f, 0x08,
+    0x2d, 0x12, 0x0f, 0x7c, 0x19, 0x30, 0x0f, 0x09, 0x2d, 0x12, 0x0f, 0x7e,
+    0x19, 0x30, 0x0f, 0x0a, 0x2d, 0x12, 0x0f, 0x80, 0x19, 0x30, 0x0f, 0x0b,
+    0x2d, 0x12, 0x0f, 0x82, 0x19, 0x30, 0x0f, 0x0c, 0x2d, 0x12, 0x0f, 0x84,
+    0x19, 0x30, 0x0f, 0x0d, 0x2d, 0x12, 0x0f, 0x86, 0x19, 0x30, 0x0f, 0x0e,
+    0x2d, 0x12, 0x0f, 0x88, 0x19, 0x30, 0x00, 0x68, 0x00, 0x0f, 0x89, 0x19,
+    0x0b, 0x00, 0xa9, 0x05, 0x0f, 0x8a, 0x19, 0x2f, 0x00, 0x68, 0x00, 0x0f,
+    0x8b, 0x19, 0x0b, 0x00, 0x68, 0x00, 0x0f, 0x8c, 0x19, 0x2f, 0x2f, 0x32,
+    0x33, 0x8d, 0x19, 0x0d, 0x00, 0x68, 0x00, 0x0f, 0x8e, 0x19, 0x2f, 0x00,
+    0x68, 0x00, 0x0f, 0x8f, 0x19, 0x0b, 0x00, 0x68, 0x00, 0x0f, 0x90, 0x19,
+    0x2f, 0x00, 0x48, 0x07, 0x0f, 0x91, 0x19, 0x0b, 0x02, 0x49, 0x07, 0x0f,
+    0x92, 0x19, 0x2d, 0x00, 0x68, 0x00, 0x0f, 0x93, 0x19, 0x0b, 0x00, 0x68,
+    0x00, 0x0f, 0x94, 0x19, 0x2f, 0x00, 0x68, 0x00, 0x0f, 0x95, 0x19, 0x0b,
+    0x00, 0x68, 0x00, 0x0f, 0x96, 0x19, 0x2f, 0x2f, 0x32, 0x33, 0x97, 0x19,
+    0x0d, 0x00, 0x68, 0x00, 0x0f, 0x98, 0x19, 0x2f, 0x00, 0x68, 0x00, 0x0f,
+    0x99, 0x19, 0x0b, 0x00, 0x83, 0x08, 0x0f, 0x9a, 0x19, 0x2f, 0x00, 0x84,
+    0x08, 0x0f, 0x9b, 0x19, 0x0c, 0x02, 0x25, 0x35, 0x0f, 0x9c, 0x19, 0x2d,
+    0x01, 0x69, 0x00, 0x0f, 0x9d, 0x19, 0x0b, 0x00, 0x69, 0x00, 0x0f, 0x9e,
+    0x19, 0x2f, 0x01, 0x69, 0x00, 0x0f, 0x9f, 0x19, 0x0b, 0x00, 0x69, 0x00,
+    0x0f, 0xa0, 0x19, 0x2f, 0x00, 0x69, 0x00, 0x0f, 0xa1, 0x19, 0x0c, 0x00,
+    0x69, 0x00, 0x0f, 0xa2, 0x19, 0x2f, 0x01, 0x69, 0x00, 0x0f, 0xa3, 0x19,
+    0x0b, 0x00, 0x69, 0x00, 0x0f, 0xa4, 0x19, 0x2f, 0x01, 0xf8, 0x0a, 0x0f,
+    0xa5, 0x19, 0x0b, 0x02, 0xf9, 0x0a, 0x0f, 0xa6, 0x19, 0x2d, 0x01, 0x69,
+    0x00, 0x0f, 0xa7, 0x19, 0x0b, 0x00, 0x69, 0x00, 0x0f, 0xa8, 0x19, 0x4b,
+    0x0f, 0x96, 0x33, 0x15, 0x0d, 0xd1, 0x10, 0x07, 0x96, 0x33, 0x07, 0xa8,
+    0x19, 0x0f, 0x97, 0x33, 0x15, 0x02, 0xb5, 0x0e, 0x0c, 0xa8, 0x19, 0x17,
+    0x33, 0xa8, 0x19, 0x02, 0x97, 0x13, 0x0f, 0x97, 0x33, 0x1d, 0x0f, 0x3f,
+    0x12, 0x1f, 0x0f, 0xac, 0x19, 0x14, 0x02, 0x9b, 0x00, 0x0f, 0x97, 0x33,
+    0x2c, 0x06, 0x77, 0x17, 0x0f, 0x97, 0x33, 0x4a, 0x0e, 0xac, 0x01, 0x0f,
+    0x97, 0x33, 0x84, 0x11, 0x32, 0xa5, 0x0f, 0x0f, 0x9f, 0x19, 0x0a, 0x0f,
+    0x97, 0x33, 0x06, 0xa0, 0x33, 0x32, 0x5f, 0x36, 0x34, 0x62, 0x69, 0x74,
+    0x0a, 0x0a
+};
+
+const SdkKernelImage matrixMul_kernel_images[] = {
+    {"matrixMul_kernel_32", matrixMul_kernel_32_data, 5327, 25783},
+    {"matrixMul_kernel_64", matrixMul_kernel_64_data, 5570, 26488},
+};
+
+const int matrixMul_kernel_images_count = 2;
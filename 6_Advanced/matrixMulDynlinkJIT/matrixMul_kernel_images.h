@@ -0,0 +1,31 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+////////////////////////////////////////////////////////////////////////////////
+// This file is auto-generated by embedKernelImages, do not edit
+////////////////////////////////////////////////////////////////////////////////
+#ifndef __matrixMul_kernel_images_h__
+#define __matrixMul_kernel_images_h__
+
+#include <helper_kernel_images.h>
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+extern const SdkKernelImage matrixMul_kernel_images[];
+extern const int matrixMul_kernel_images_count;
+
+#if defined __cplusplus
+}
+#endif
+
+#endif  // __matrixMul_kernel_images_h__
@@ -43,6 +43,9 @@
    perform a CPU final reduction (default 1)
     "-type=<T>":       The datatype for the reduction, where T is "int",
    "float", or "double" (default int)
+    "-benchmark_cpu":  Benchmark the CPU reference reduction for 1K to 16M
+   elements of each type, no GPU needed; see helper_benchmark.h for the
+   output and baseline options
 */
 
 // CUDA Runtime
@@ -51,7 +54,9 @@
 // Utilities and system includes
 #include <helper_cuda.h>
 #include <helper_functions.h>
+#include <helper_benchmark.h>
 #include <algorithm>
+#include <vector>
 
 // includes, project
 #include "reduction.h"
@@ -106,6 +111,10 @@ int main(int argc, char **argv) {
     }
   }
 
+  if (sdkBenchmarkRequested(argc, (const char **)argv)) {
+    return sdkRunBenchmarks(argc, (const char **)argv);
+  }
+
   cudaDeviceProp deviceProp;
   int dev;
 
@@ -161,6 +170,28 @@ T reduceCPU(T *data, int size) {
   return sum;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+//! Benchmark of reduceCPU for -benchmark_cpu, over the sizes of the shmoo
+////////////////////////////////////////////////////////////////////////////////
+template <class T>
+void benchmarkReduceCPU(SdkBenchmarkState &state) {
+  std::vector<T> data(state.param("n"));
+
+  for (size_t i = 0; i < data.size(); i++) {
+    data[i] = (T)(rand() & 0xFF);
+  }
+
+  while (state.keepRunning()) {
+    sdkDoNotOptimize(reduceCPU<T>(data.data(), (int)data.size()));
+  }
+
+  state.setBytesProcessed(data.size() * sizeof(T));
+}
+
+SDK_BENCHMARK(benchmarkReduceCPU<int>)->range("n", 1 << 10, 1 << 24, 4);
+SDK_BENCHMARK(benchmarkReduceCPU<float>)->range("n", 1 << 10, 1 << 24, 4);
+SDK_BENCHMARK(benchmarkReduceCPU<double>)->range("n", 1 << 10, 1 << 24, 4);
+
 unsigned int nextPow2(unsigned int x) {
   --x;
   x |= x >> 1;
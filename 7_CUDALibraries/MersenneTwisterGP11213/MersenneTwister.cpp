@@ -12,6 +12,9 @@
 /*
  * This sample demonstrates the use of CURAND to generate
  * random numbers on GPU and CPU.
+ *
+ * -benchmark_cpu benchmarks the CPU generator for 64K to 4M numbers, no GPU
+ * needed; see helper_benchmark.h for the output and baseline options.
  */
 
 // Utilities and system includes
@@ -25,6 +28,7 @@
 // Utilities and system includes
 #include <helper_functions.h>
 #include <helper_cuda.h>
+#include <helper_benchmark.h>
 
 #include <cuda_runtime.h>
 #include <curand.h>
@@ -34,6 +38,31 @@ float compareResults(int rand_n, float *h_RandGPU, float *h_RandCPU);
 const int    DEFAULT_RAND_N = 2400000;
 const unsigned int DEFAULT_SEED = 777;
 
+///////////////////////////////////////////////////////////////////////////////
+// Benchmark of the CPU generator for -benchmark_cpu
+///////////////////////////////////////////////////////////////////////////////
+static void benchmarkGenerateUniformCPU(SdkBenchmarkState &state)
+{
+    const size_t rand_n = (size_t)state.param("count");
+    float *h_RandCPU = (float *)malloc(rand_n * sizeof(float));
+
+    curandGenerator_t prngCPU;
+    checkCudaErrors(curandCreateGeneratorHost(&prngCPU, CURAND_RNG_PSEUDO_MTGP32));
+    checkCudaErrors(curandSetPseudoRandomGeneratorSeed(prngCPU, DEFAULT_SEED));
+
+    while (state.keepRunning())
+    {
+        checkCudaErrors(curandGenerateUniform(prngCPU, h_RandCPU, rand_n));
+        sdkDoNotOptimize(h_RandCPU[rand_n - 1]);
+    }
+
+    state.setItemsProcessed(rand_n);
+    checkCudaErrors(curandDestroyGenerator(prngCPU));
+    free(h_RandCPU);
+}
+
+SDK_BENCHMARK(benchmarkGenerateUniformCPU)->range("count", 1 << 16, 1 << 22, 4);
+
 ///////////////////////////////////////////////////////////////////////////////
 // Main program
 ///////////////////////////////////////////////////////////////////////////////
@@ -42,6 +71,11 @@ int main(int argc, char **argv)
     // Start logs
     printf("%s Starting...\n\n", argv[0]);
 
+    if (sdkBenchmarkRequested(argc, (const char **)argv))
+    {
+        return sdkRunBenchmarks(argc, (const char **)argv);
+    }
+
     // initialize the GPU, either identified by --device
     // or by picking the device with highest flop rate.
     int devID = findCudaDevice(argc, (const char **)argv);
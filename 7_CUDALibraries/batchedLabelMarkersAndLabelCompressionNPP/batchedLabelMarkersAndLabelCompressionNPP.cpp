@@ -61,8 +61,12 @@
 #include <cuda_runtime.h>
 #include <helper_cuda.h>
 #include <helper_string.h>
+#include <helper_timer.h>
+#include <helper_labeling.h>
 #include <npp.h>
 
+#include <vector>
+
 // Note:  If you want to view these images we HIGHLY recommend using imagej
 // which is free on the internet and works on most platforms
 //        because it is one of the few image viewing apps that can display 32
@@ -94,6 +98,12 @@
 //
 //        Performance of ALL NPP image batch functions is limited by the maximum
 //        ROI height in the list of images.
+//
+//        With -cpu both stages run on the host instead (helper_labeling.h)
+//        and write the same files, no GPU is needed.  Host labels are the
+//        index of the first pixel of each region in raster order, so they do
+//        not vary from run to run and the compressed labels number the
+//        regions in the order they first appear.
 
 // Batched label compression support is only available on NPP versions > 11.0,
 // comment out if using NPP 11.0
@@ -260,6 +270,124 @@ int loadRaw8BitImage(Npp8u *pImage, int nWidth, int nHeight, int nImage) {
   return 0;
 }
 
+void writeRaw32uImage(FILE *bmpFile, const Npp32u *pImage, NppiSize oSize) {
+  for (int j = 0; j < oSize.height; j++) {
+    fwrite(&pImage[j * oSize.width], sizeof(Npp32u), oSize.width, bmpFile);
+  }
+}
+
+// Both stages of the sample on the host
+int runHost() {
+  const std::string *aLabelMarkersOutputFile[NUMBER_OF_IMAGES] = {
+      &LabelMarkersOutputFile0, &LabelMarkersOutputFile1,
+      &LabelMarkersOutputFile2, &LabelMarkersOutputFile3,
+      &LabelMarkersOutputFile4};
+  const std::string *aCompressedMarkerLabelsOutputFile[NUMBER_OF_IMAGES] = {
+      &CompressedMarkerLabelsOutputFile0, &CompressedMarkerLabelsOutputFile1,
+      &CompressedMarkerLabelsOutputFile2, &CompressedMarkerLabelsOutputFile3,
+      &CompressedMarkerLabelsOutputFile4};
+  const std::string *aLabelMarkersBatchOutputFile[NUMBER_OF_IMAGES] = {
+      &LabelMarkersBatchOutputFile0, &LabelMarkersBatchOutputFile1,
+      &LabelMarkersBatchOutputFile2, &LabelMarkersBatchOutputFile3,
+      &LabelMarkersBatchOutputFile4};
+  const std::string
+      *aCompressedMarkerLabelsBatchOutputFile[NUMBER_OF_IMAGES] = {
+          &CompressedMarkerLabelsBatchOutputFile0,
+          &CompressedMarkerLabelsBatchOutputFile1,
+          &CompressedMarkerLabelsBatchOutputFile2,
+          &CompressedMarkerLabelsBatchOutputFile3,
+          &CompressedMarkerLabelsBatchOutputFile4};
+  const NppiSize oSizeROI[NUMBER_OF_IMAGES] = {
+      {512, 512}, {512, 512}, {509, 335}, {1024, 683}, {1280, 720}};
+
+  std::vector<Npp8u> aInputImage[NUMBER_OF_IMAGES];
+  std::vector<Npp32u> aLabelImage[NUMBER_OF_IMAGES];
+  SdkLabelImage<Npp8u> aBatch[NUMBER_OF_IMAGES];
+  FILE *bmpFile;
+
+  printf("Labelling on the host with %d threads\n", sdkGetNumThreads());
+
+  for (int nImage = 0; nImage < NUMBER_OF_IMAGES; nImage++) {
+    const NppiSize &oSize = oSizeROI[nImage];
+    aInputImage[nImage].resize(oSize.width * oSize.height);
+    aLabelImage[nImage].resize(oSize.width * oSize.height);
+
+    if (loadRaw8BitImage(&aInputImage[nImage][0], oSize.width, oSize.height,
+                         nImage) != 0) {
+      return -1;
+    }
+
+    SdkLabelImage<Npp8u> oImage = {
+        &aInputImage[nImage][0], oSize.width * sizeof(Npp8u),
+        &aLabelImage[nImage][0], oSize.width * sizeof(Npp32u), oSize.width,
+        oSize.height};
+    aBatch[nImage] = oImage;
+
+    // One at a time image processing, 8-way as on the GPU
+    unsigned long long nStart = sdkGetTimeNs();
+    sdkLabelMarkersUF(oImage.src, oImage.srcPitch, oImage.labels,
+                      oImage.labelPitch, oSize.width, oSize.height, 8);
+    double fLabelMs = (sdkGetTimeNs() - nStart) * 1.0e-6;
+
+    FOPEN(bmpFile, aLabelMarkersOutputFile[nImage]->c_str(), "wb");
+    if (bmpFile == NULL) return -1;
+    writeRaw32uImage(bmpFile, oImage.labels, oSize);
+    fclose(bmpFile);
+
+    nStart = sdkGetTimeNs();
+    int nCompressedLabelCount = sdkCompressMarkerLabels(
+        oImage.labels, oImage.labelPitch, oSize.width, oSize.height,
+        oSize.width * oSize.height);
+    double fCompressMs = (sdkGetTimeNs() - nStart) * 1.0e-6;
+
+    printf(
+        "%s succeeded, compressed label count is %d (%.3f ms labelling, "
+        "%.3f ms compression).\n",
+        aCompressedMarkerLabelsOutputFile[nImage]->c_str(),
+        nCompressedLabelCount, fLabelMs, fCompressMs);
+
+    FOPEN(bmpFile, aCompressedMarkerLabelsOutputFile[nImage]->c_str(), "wb");
+    if (bmpFile == NULL) return -1;
+    writeRaw32uImage(bmpFile, oImage.labels, oSize);
+    fclose(bmpFile);
+  }
+
+  // Batch image processing, the bands of all images are labelled together
+  int aCompressedLabelCount[NUMBER_OF_IMAGES];
+
+  unsigned long long nStart = sdkGetTimeNs();
+  sdkLabelMarkersUFBatch(aBatch, NUMBER_OF_IMAGES, 8);
+  double fLabelMs = (sdkGetTimeNs() - nStart) * 1.0e-6;
+
+  for (int nImage = 0; nImage < NUMBER_OF_IMAGES; nImage++) {
+    FOPEN(bmpFile, aLabelMarkersBatchOutputFile[nImage]->c_str(), "wb");
+    if (bmpFile == NULL) return -1;
+    writeRaw32uImage(bmpFile, aBatch[nImage].labels, oSizeROI[nImage]);
+    fclose(bmpFile);
+  }
+
+  nStart = sdkGetTimeNs();
+  sdkCompressMarkerLabelsBatch(aBatch, NUMBER_OF_IMAGES, aCompressedLabelCount);
+  double fCompressMs = (sdkGetTimeNs() - nStart) * 1.0e-6;
+
+  printf("\n\nLabelMarkersUFBatch_8Way %.3f ms, CompressMarkerLabelsUFBatch %.3f ms\n",
+         fLabelMs, fCompressMs);
+
+  for (int nImage = 0; nImage < NUMBER_OF_IMAGES; nImage++) {
+    FOPEN(bmpFile, aCompressedMarkerLabelsBatchOutputFile[nImage]->c_str(),
+          "wb");
+    if (bmpFile == NULL) return -1;
+    writeRaw32uImage(bmpFile, aBatch[nImage].labels, oSizeROI[nImage]);
+    fclose(bmpFile);
+
+    printf("%s succeeded, compressed label count is %d.\n",
+           aCompressedMarkerLabelsBatchOutputFile[nImage]->c_str(),
+           aCompressedLabelCount[nImage]);
+  }
+
+  return 0;
+}
+
 int main(int argc, char **argv) {
   int aGenerateLabelsScratchBufferSize[NUMBER_OF_IMAGES];
   int aCompressLabelsScratchBufferSize[NUMBER_OF_IMAGES];
@@ -270,6 +398,10 @@ int main(int argc, char **argv) {
   NppStreamContext nppStreamCtx;
   FILE *bmpFile;
 
+  if (checkCmdLineFlag(argc, (const char **)argv, "cpu")) {
+    return runHost();
+  }
+
   for (int j = 0; j < NUMBER_OF_IMAGES; j++) {
     pInputImageDev[j] = 0;
     pInputImageHost[j] = 0;
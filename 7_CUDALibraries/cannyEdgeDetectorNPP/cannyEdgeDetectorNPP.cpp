@@ -28,8 +28,10 @@
 #include <cuda_runtime.h>
 #include <npp.h>
 
+#include <helper_canny.h>
 #include <helper_cuda.h>
 #include <helper_string.h>
+#include <helper_timer.h>
 
 inline int cudaDeviceInit(int argc, const char **argv) {
   int deviceCount;
@@ -79,10 +81,15 @@ int main(int argc, char *argv[]) {
     std::string sFilename;
     char *filePath;
 
-    cudaDeviceInit(argc, (const char **)argv);
+    // with -cpu the edges are detected on the host and no device is needed
+    bool bHost = checkCmdLineFlag(argc, (const char **)argv, "cpu");
 
-    if (printfNPPinfo(argc, argv) == false) {
-      exit(EXIT_SUCCESS);
+    if (!bHost) {
+      cudaDeviceInit(argc, (const char **)argv);
+
+      if (printfNPPinfo(argc, argv) == false) {
+        exit(EXIT_SUCCESS);
+      }
     }
 
     if (checkCmdLineFlag(argc, (const char **)argv, "input")) {
@@ -139,6 +146,29 @@ int main(int argc, char *argv[]) {
     npp::ImageCPU_8u_C1 oHostSrc;
     // load gray-scale image from disk
     npp::loadImage(sFilename, oHostSrc);
+
+    if (bHost) {
+      // same thresholds, norm and border as the NPP call below
+      npp::ImageCPU_8u_C1 oHostDst(oHostSrc.size());
+      SdkCannyParams oParams = {72, 256, true, kSdkBorderReplicate, 0, 0.0f};
+
+      unsigned long long nStart = sdkGetTimeNs();
+      sdkFilterCannyBorder(oHostSrc.data(), oHostSrc.pitch(),
+                           (int)oHostSrc.width(), (int)oHostSrc.height(), 0, 0,
+                           oHostDst.data(), oHostDst.pitch(),
+                           (int)oHostDst.width(), (int)oHostDst.height(),
+                           oParams);
+      unsigned long long nStop = sdkGetTimeNs();
+
+      printf("Host Canny on %d threads: %.3f ms\n", sdkGetNumThreads(),
+             (nStop - nStart) * 1e-6);
+
+      saveImage(sResultFilename, oHostDst);
+      std::cout << "Saved image: " << sResultFilename << std::endl;
+
+      exit(EXIT_SUCCESS);
+    }
+
     // declare a device image and copy construct from the host image,
     // i.e. upload host to device
     npp::ImageNPP_8u_C1 oDeviceSrc(oHostSrc);
@@ -14,21 +14,41 @@
 
 #include "Exceptions.h"
 
+#include <helper_arena.h>
+
+#include <string.h>
+
 namespace npp
 {
 
+    /// Host image allocator.
+    ///     Rows start on 64 byte boundaries: the pitch is padded to a multiple of
+    /// 64 bytes unless a tight pitch is requested, and the first row is 64 byte
+    /// aligned, so every row can be processed with aligned vector loads.
     template <typename D, size_t N>
     class ImageAllocatorCPU
     {
         public:
+            static const unsigned int gnAlignment = 64;
+
+            static
+            unsigned int
+            Pitch(unsigned int nWidth, bool bTight = false)
+            {
+                unsigned int nPitch = nWidth * sizeof(D) * N;
+
+                return bTight ? nPitch : (nPitch + gnAlignment - 1) / gnAlignment * gnAlignment;
+            };
+
             static
             D *
-            Malloc2D(unsigned int nWidth, unsigned int nHeight, unsigned int *pPitch)
+            Malloc2D(unsigned int nWidth, unsigned int nHeight, unsigned int *pPitch, bool bTight = false)
             {
                 NPP_ASSERT(nWidth * nHeight > 0);
 
-                D *pResult = new D[nWidth * N * nHeight];
-                *pPitch = nWidth * sizeof(D) * N;
+                *pPitch = Pitch(nWidth, bTight);
+                D *pResult = static_cast<D *>(sdkAlignedAlloc(static_cast<size_t>(*pPitch) * nHeight, gnAlignment));
+                NPP_ASSERT_NOT_NULL(pResult);
 
                 return pResult;
             };
@@ -37,24 +57,73 @@ namespace npp
             void
             Free2D(D *pPixels)
             {
-                delete[] pPixels;
+                sdkAlignedFree(pPixels);
             };
 
             static
             void
             Copy2D(D *pDst, size_t nDstPitch, const D *pSrc, size_t nSrcPitch, size_t nWidth, size_t nHeight)
             {
-                const void *pSrcLine = pSrc;
-                void        *pDstLine = pDst;
+                const unsigned char *pSrcLine = reinterpret_cast<const unsigned char *>(pSrc);
+                unsigned char       *pDstLine = reinterpret_cast<unsigned char *>(pDst);
 
                 for (size_t iLine = 0; iLine < nHeight; ++iLine)
                 {
                     // copy one line worth of data
-                    memcpy(pDst, pSrc, nWidth * N * sizeof(D));
-                    // move data pointers to next line
-                    pDst += nDstPitch;
-                    pSrc += nSrcPitch;
+                    memcpy(pDstLine, pSrcLine, nWidth * N * sizeof(D));
+                    // move data pointers to next line, pitches are in bytes
+                    pDstLine += nDstPitch;
+                    pSrcLine += nSrcPitch;
+                }
+            };
+
+    };
+
+    /// Host image allocator on the process-wide block pool (helper_arena.h).
+    ///     Same layout as ImageAllocatorCPU, but freed frames go back to a size
+    /// class free list, so a pipeline that creates and drops images of the same
+    /// size every frame stops allocating after the first one.
+    template <typename D, size_t N>
+    class ImageAllocatorCPUPooled
+    {
+        public:
+            static const unsigned int gnAlignment = ImageAllocatorCPU<D, N>::gnAlignment;
+
+            static
+            D *
+            Malloc2D(unsigned int nWidth, unsigned int nHeight, unsigned int *pPitch, bool bTight = false)
+            {
+                NPP_ASSERT(nWidth * nHeight > 0);
+
+                *pPitch = ImageAllocatorCPU<D, N>::Pitch(nWidth, bTight);
+
+                // the pool needs the block size back, it is kept in front of the
+                // pixels, one alignment unit ahead so the first row stays aligned
+                size_t nBytes = static_cast<size_t>(*pPitch) * nHeight + gnAlignment;
+                unsigned char *pBlock = static_cast<unsigned char *>(sdkHostPool().allocate(nBytes));
+                *reinterpret_cast<size_t *>(pBlock) = nBytes;
+
+                return reinterpret_cast<D *>(pBlock + gnAlignment);
+            };
+
+            static
+            void
+            Free2D(D *pPixels)
+            {
+                if (pPixels == 0)
+                {
+                    return;
                 }
+
+                unsigned char *pBlock = reinterpret_cast<unsigned char *>(pPixels) - gnAlignment;
+                sdkHostPool().deallocate(pBlock, *reinterpret_cast<size_t *>(pBlock));
+            };
+
+            static
+            void
+            Copy2D(D *pDst, size_t nDstPitch, const D *pSrc, size_t nSrcPitch, size_t nWidth, size_t nHeight)
+            {
+                ImageAllocatorCPU<D, N>::Copy2D(pDst, nDstPitch, pSrc, nSrcPitch, nWidth, nHeight);
             };
 
     };
@@ -19,6 +19,7 @@
 #include "Exceptions.h"
 
 #include <string>
+#include <utility>
 #include "string.h"
 
 
@@ -33,8 +34,10 @@ FreeImageErrorHandler(FREE_IMAGE_FORMAT oFif, const char *zMessage)
 namespace npp
 {
     // Load a gray-scale image from disk.
+    //  Works for any host allocator, e.g. ImageCPU_8u_C1 or ImagePooledCPU_8u_C1.
+    template<class A>
     void
-    loadImage(const std::string &rFileName, ImageCPU_8u_C1 &rImage)
+    loadImage(const std::string &rFileName, ImageCPU<Npp8u, 1, A> &rImage)
     {
         // set your own FreeImage error handler
         FreeImage_SetOutputMessage(FreeImageErrorHandler);
@@ -62,7 +65,7 @@ namespace npp
         NPP_ASSERT(FreeImage_GetBPP(pBitmap) == 8);
 
         // create an ImageCPU to receive the loaded image data
-        ImageCPU_8u_C1 oImage(FreeImage_GetWidth(pBitmap), FreeImage_GetHeight(pBitmap));
+        ImageCPU<Npp8u, 1, A> oImage(FreeImage_GetWidth(pBitmap), FreeImage_GetHeight(pBitmap));
 
         // Copy the FreeImage data into the new ImageCPU
         unsigned int nSrcPitch = FreeImage_GetPitch(pBitmap);
@@ -77,14 +80,17 @@ namespace npp
             pDstLine += nDstPitch;
         }
 
-        // swap the user given image with our result image, effecively
-        // moving our newly loaded image data into the user provided shell
-        oImage.swap(rImage);
+        FreeImage_Unload(pBitmap);
+
+        // move our newly loaded image data into the user provided image,
+        // its previous pixels are released
+        rImage = std::move(oImage);
     }
 
     // Save an gray-scale image to disk.
+    template<class A>
     void
-    saveImage(const std::string &rFileName, const ImageCPU_8u_C1 &rImage)
+    saveImage(const std::string &rFileName, const ImageCPU<Npp8u, 1, A> &rImage)
     {
         // create the result image storage using FreeImage so we can easily
         // save
@@ -105,6 +111,7 @@ namespace npp
         // now save the result image
         bool bSuccess;
         bSuccess = FreeImage_Save(FIF_PGM, pResultBitmap, rFileName.c_str(), 0) == TRUE;
+        FreeImage_Unload(pResultBitmap);
         NPP_ASSERT_MSG(bSuccess, "Failed to save result image.");
     }
 
@@ -114,8 +121,7 @@ namespace npp
     {
         ImageCPU_8u_C1 oImage;
         loadImage(rFileName, oImage);
-        ImageNPP_8u_C1 oResult(oImage);
-        rImage.swap(oResult);
+        rImage = ImageNPP_8u_C1(oImage);
     }
 
     // Save an gray-scale image to disk.
@@ -31,6 +31,7 @@
 #define NV_UTIL_NPP_IMAGE_PACKED_H
 
 #include "Image.h"
+#include "ImageView.h"
 #include "Pixel.h"
 
 namespace npp
@@ -76,7 +77,14 @@ namespace npp
                 , nPitch_(rImage.pitch())
             {
                 aPixels_ = A::Malloc2D(width(), height(), &nPitch_);
-                A::Copy2D(aPixels_, nPitch_, rImage.pixels(), rImage.pitch(), width(), height());
+                A::Copy2D(aPixels_, nPitch_, rImage.data(), rImage.pitch(), width(), height());
+            }
+
+            /// Takes over the pixels of rImage, which is left empty.
+            ImagePacked(ImagePacked<D, N, A> &&rImage): aPixels_(0)
+                , nPitch_(0)
+            {
+                swap(rImage);
             }
 
             virtual
@@ -107,6 +115,24 @@ namespace npp
                 return *this;
             }
 
+            ImagePacked &
+            operator= (ImagePacked<D, N, A> &&rImage)
+            {
+                if (&rImage == this)
+                {
+                    return *this;
+                }
+
+                A::Free2D(aPixels_);
+                aPixels_ = 0;
+                nPitch_ = 0;
+                Image::operator =(Image());
+
+                swap(rImage);
+
+                return *this;
+            }
+
             unsigned int
             pitch()
             const
@@ -148,6 +174,37 @@ namespace npp
                 return reinterpret_cast<const D *>(pixels(nX, nY));
             }
 
+            /// Non-owning view of the rectangle at (nX, nY) of size nWidth x nHeight.
+            ///     Processing a view touches the pixels in place, no frame is copied.
+            ImageView<D, N>
+            roi(unsigned int nX, unsigned int nY, unsigned int nWidth, unsigned int nHeight)
+            {
+                NPP_ASSERT(nX + nWidth <= width() && nY + nHeight <= height());
+                return ImageView<D, N>(data(nX, nY), pitch(), nWidth, nHeight);
+            }
+
+            ImageView<const D, N>
+            roi(unsigned int nX, unsigned int nY, unsigned int nWidth, unsigned int nHeight)
+            const
+            {
+                NPP_ASSERT(nX + nWidth <= width() && nY + nHeight <= height());
+                return ImageView<const D, N>(data(nX, nY), pitch(), nWidth, nHeight);
+            }
+
+            /// Non-owning view of the whole image.
+            ImageView<D, N>
+            view()
+            {
+                return roi(0, 0, width(), height());
+            }
+
+            ImageView<const D, N>
+            view()
+            const
+            {
+                return roi(0, 0, width(), height());
+            }
+
             void
             swap(ImagePacked<D, N, A> &rImage)
             {
@@ -170,4 +227,4 @@ namespace npp
 } // npp namespace
 
 
-#endif // NV_IMAGE_IPP_H
+#endif // NV_UTIL_NPP_IMAGE_PACKED_H
@@ -0,0 +1,100 @@
+/**
+ * Copyright 1993-2015 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+#ifndef NV_UTIL_NPP_IMAGE_VIEW_H
+#define NV_UTIL_NPP_IMAGE_VIEW_H
+
+#include "Image.h"
+#include "Pixel.h"
+#include "Exceptions.h"
+
+#include <type_traits>
+
+namespace npp
+{
+    /// Non-owning view of a rectangle of an image.
+    ///     A view is a pointer to its first pixel, the pitch of the image it
+    /// was taken from and its own size. It is cheap to copy and never frees
+    /// the pixels, so it must not outlive the image. Views of device images
+    /// hold device pointers and are meant to be passed on to NPP calls.
+    /// D may be const qualified for read-only views.
+    template<typename D, size_t N>
+    class ImageView: public npp::Image
+    {
+        public:
+            typedef typename std::remove_const<D>::type                  tValue;
+            typedef typename std::conditional<std::is_const<D>::value,
+                                              const npp::Pixel<tValue, N>,
+                                              npp::Pixel<tValue, N> >::type tPixel;
+            typedef D                                                    tData;
+            static const size_t                                          gnChannels = N;
+
+            ImageView(): pData_(0)
+                , nPitch_(0)
+            {
+                ;
+            }
+
+            ImageView(D *pData, unsigned int nPitch, unsigned int nWidth, unsigned int nHeight): Image(nWidth, nHeight)
+                , pData_(pData)
+                , nPitch_(nPitch)
+            {
+                ;
+            }
+
+            /// A mutable view converts to a read-only one.
+            template<typename X>
+            ImageView(const ImageView<X, N> &rView): Image(rView)
+                , pData_(rView.data())
+                , nPitch_(rView.pitch())
+            {
+                ;
+            }
+
+            unsigned int
+            pitch()
+            const
+            {
+                return nPitch_;
+            }
+
+            tPixel *
+            pixels(int nX = 0, int nY = 0)
+            const
+            {
+                typedef typename std::conditional<std::is_const<D>::value, const unsigned char, unsigned char>::type tByte;
+                return reinterpret_cast<tPixel *>(reinterpret_cast<tByte *>(pData_) + nY * pitch() + nX * gnChannels * sizeof(D));
+            }
+
+            D *
+            data(int nX = 0, int nY = 0)
+            const
+            {
+                return reinterpret_cast<D *>(pixels(nX, nY));
+            }
+
+            /// Sub-rectangle of this view, in its coordinates.
+            ImageView<D, N>
+            roi(unsigned int nX, unsigned int nY, unsigned int nWidth, unsigned int nHeight)
+            const
+            {
+                NPP_ASSERT(nX + nWidth <= width() && nY + nHeight <= height());
+                return ImageView<D, N>(data(nX, nY), pitch(), nWidth, nHeight);
+            }
+
+        private:
+            D *pData_;
+            unsigned int nPitch_;
+    };
+
+} // npp namespace
+
+#endif // NV_UTIL_NPP_IMAGE_VIEW_H
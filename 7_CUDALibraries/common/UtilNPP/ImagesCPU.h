@@ -19,6 +19,8 @@
 
 #include <npp.h>
 
+#include <utility>
+
 
 namespace npp
 {
@@ -38,13 +40,23 @@ namespace npp
                 ;
             }
 
+            ImageCPU(unsigned int nWidth, unsigned int nHeight, bool bTight): ImagePacked<D, N, A>(nWidth, nHeight, bTight)
+            {
+                ;
+            }
+
             explicit
             ImageCPU(const npp::Image::Size &rSize): ImagePacked<D, N, A>(rSize)
             {
                 ;
             }
 
-            ImageCPU(const ImageCPU<D, N, A> &rImage): Image(rImage)
+            ImageCPU(const ImageCPU<D, N, A> &rImage): ImagePacked<D, N, A>(rImage)
+            {
+                ;
+            }
+
+            ImageCPU(ImageCPU<D, N, A> &&rImage): ImagePacked<D, N, A>(std::move(rImage))
             {
                 ;
             }
@@ -63,6 +75,14 @@ namespace npp
                 return *this;
             }
 
+            ImageCPU &
+            operator= (ImageCPU<D, N, A> &&rImage)
+            {
+                ImagePacked<D, N, A>::operator= (std::move(rImage));
+
+                return *this;
+            }
+
             npp::Pixel<D, N> &
             operator()(unsigned int iX, unsigned int iY)
             {
@@ -100,6 +120,15 @@ namespace npp
     typedef ImageCPU<Npp32f, 3, npp::ImageAllocatorCPU<Npp32f,     3>  >   ImageCPU_32f_C3;
     typedef ImageCPU<Npp32f, 4, npp::ImageAllocatorCPU<Npp32f,     4>  >   ImageCPU_32f_C4;
 
+    // images whose frames are recycled through the host block pool
+    typedef ImageCPU<Npp8u,  1, npp::ImageAllocatorCPUPooled<Npp8u,  1>  >   ImagePooledCPU_8u_C1;
+    typedef ImageCPU<Npp8u,  3, npp::ImageAllocatorCPUPooled<Npp8u,  3>  >   ImagePooledCPU_8u_C3;
+    typedef ImageCPU<Npp8u,  4, npp::ImageAllocatorCPUPooled<Npp8u,  4>  >   ImagePooledCPU_8u_C4;
+
+    typedef ImageCPU<Npp16s, 1, npp::ImageAllocatorCPUPooled<Npp16s, 1>  >   ImagePooledCPU_16s_C1;
+    typedef ImageCPU<Npp32s, 1, npp::ImageAllocatorCPUPooled<Npp32s, 1>  >   ImagePooledCPU_32s_C1;
+    typedef ImageCPU<Npp32f, 1, npp::ImageAllocatorCPUPooled<Npp32f, 1>  >   ImagePooledCPU_32f_C1;
+
 } // npp namespace
 
-#endif // NV_IMAGE_IPP_H
+#endif // NV_UTIL_NPP_IMAGES_CPU_H
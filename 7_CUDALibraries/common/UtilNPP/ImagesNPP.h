@@ -18,6 +18,8 @@
 #include "ImageAllocatorsNPP.h"
 #include <cuda_runtime.h>
 
+#include <utility>
+
 namespace npp
 {
     // forward declaration
@@ -42,7 +44,12 @@ namespace npp
                 ;
             }
 
-            ImageNPP(const ImageNPP<D, N> &rImage): Image(rImage)
+            ImageNPP(const ImageNPP<D, N> &rImage): ImagePacked<D, N, npp::ImageAllocator<D, N> >(rImage)
+            {
+                ;
+            }
+
+            ImageNPP(ImageNPP<D, N> &&rImage): ImagePacked<D, N, npp::ImageAllocator<D, N> >(std::move(rImage))
             {
                 ;
             }
@@ -73,6 +80,14 @@ namespace npp
                 return *this;
             }
 
+            ImageNPP &
+            operator= (ImageNPP<D, N> &&rImage)
+            {
+                ImagePacked<D, N, npp::ImageAllocator<D, N> >::operator= (std::move(rImage));
+
+                return *this;
+            }
+
             void
             copyTo(D *pData, unsigned int nPitch)
             const
@@ -28,6 +28,8 @@
 // Utilities and system includes
 #include <helper_functions.h>  // helper for shared functions common to CUDA Samples
 #include <helper_cuda.h>       // helper function CUDA error checking and initialization
+#include <helper_spmv.h>       // multithreaded host SpMV (CSR, SELL-C-sigma, symmetric)
+#include <helper_pcg.h>        // host PCG solvers for the -cpu mode
 
 const char *sSDKname     = "conjugateGradient";
 
@@ -71,6 +73,163 @@ void genTridiag(int *I, int *J, float *val, int N, int nz)
     I[N] = nz;
 }
 
+/* time one host SpMV engine, returns msec per product */
+template <class Engine>
+float timeSpMV(Engine &engine, const float *x, float *y, int iterations)
+{
+    StopWatchInterface *timer = NULL;
+    sdkCreateTimer(&timer);
+
+    engine.multiply(x, y);  // warmup
+
+    sdkStartTimer(&timer);
+
+    for (int i = 0; i < iterations; i++)
+    {
+        engine.multiply(x, y);
+    }
+
+    sdkStopTimer(&timer);
+    float ms = sdkGetTimerValue(&timer) / iterations;
+    sdkDeleteTimer(&timer);
+    return ms;
+}
+
+float maxAbsDiff(const float *a, const float *b, int N)
+{
+    float err = 0.0f;
+
+    for (int i = 0; i < N; i++)
+    {
+        err = fmaxf(err, fabsf(a[i] - b[i]));
+    }
+
+    return err;
+}
+
+/*
+ * -spmv: benchmark the host SpMV engines on the CG matrix (no GPU needed).
+ * CSR with nnz-balanced rows, SELL-C-sigma and upper-triangle symmetric
+ * storage are compared against the measured memory bandwidth roofline.
+ */
+int runSpMVBenchmark(int N)
+{
+    const int iterations = 50;
+    int nz = (N-2)*3 + 4;
+    int *I = (int *)malloc(sizeof(int)*(N+1));
+    int *J = (int *)malloc(sizeof(int)*nz);
+    float *val = (float *)malloc(sizeof(float)*nz);
+    genTridiag(I, J, val, N, nz);
+
+    float *x = (float *)malloc(sizeof(float)*N);
+    float *yRef = (float *)malloc(sizeof(float)*N);
+    float *y = (float *)malloc(sizeof(float)*N);
+
+    for (int i = 0; i < N; i++)
+    {
+        x[i] = (float)rand()/RAND_MAX;
+    }
+
+    /* serial reference */
+    for (int i = 0; i < N; i++)
+    {
+        float sum = 0.0f;
+
+        for (int j = I[i]; j < I[i+1]; j++)
+        {
+            sum += val[j]*x[J[j]];
+        }
+
+        yRef[i] = sum;
+    }
+
+    CsrMatrixView<float> A(N, N, nz, I, J, val);
+    double peakBW = spmvStreamBandwidth();
+    printf("Host SpMV, N = %d, nnz = %d, %d threads, stream triad %.2f GB/s\n",
+           N, nz, sdkGetNumThreads(), peakBW);
+
+    int nErrors = 0;
+    float ms, err;
+
+    CsrSpMV<float> csr(A);
+    ms = timeSpMV(csr, x, y, iterations);
+    err = maxAbsDiff(y, yRef, N);
+    nErrors += (err > 1e-4f);
+    spmvPrintPerf("CSR", ms, csr.flops(), csr.bytes(), peakBW);
+
+    SellCSigmaSpMV<float, 8> sell(A, 256);
+    ms = timeSpMV(sell, x, y, iterations);
+    err = maxAbsDiff(y, yRef, N);
+    nErrors += (err > 1e-4f);
+    spmvPrintPerf("SELL-8-256", ms, sell.flops(), sell.bytes(), peakBW);
+    printf("  SELL fill ratio = %.3f\n", sell.fillRatio());
+
+    SymCsrSpMV<float> sym(A);
+    ms = timeSpMV(sym, x, y, iterations);
+    err = maxAbsDiff(y, yRef, N);
+    nErrors += (err > 1e-4f);
+    spmvPrintPerf("CSR symmetric (upper)", ms, sym.flops(), sym.bytes(), peakBW);
+
+    free(I);
+    free(J);
+    free(val);
+    free(x);
+    free(y);
+    free(yRef);
+
+    printf("Test Summary:  %d errors\n", nErrors);
+    return nErrors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/*
+ * -cpu: solve the tridiagonal system on the host with the multithreaded PCG
+ * solvers from helper_pcg.h, no GPU required.
+ */
+int runCpuPCG(int N)
+{
+    const int max_iter = 10000;
+    const double tol = 1e-8;
+    int nz = (N-2)*3 + 4;
+    int *I = (int *)malloc(sizeof(int)*(N+1));
+    int *J = (int *)malloc(sizeof(int)*nz);
+    float *val = (float *)malloc(sizeof(float)*nz);
+    genTridiag(I, J, val, N, nz);
+
+    std::vector<double> valD(val, val + nz), rhs(N, 1.0), x(N);
+    CsrMatrixView<double> A(N, N, nz, I, J, valD.data());
+    const PcgPreconditionerType types[] = {PCG_PRECOND_NONE, PCG_PRECOND_JACOBI,
+                                           PCG_PRECOND_SGS, PCG_PRECOND_IC0,
+                                           PCG_PRECOND_ILU0};
+    int nErrors = 0;
+
+    printf("Host PCG on %d threads, N = %d, nnz = %d, tol = %.1e\n",
+           sdkGetNumThreads(), N, nz, tol);
+
+    for (size_t t = 0; t < sizeof(types)/sizeof(types[0]); t++)
+    {
+        PcgSolver<double> solver;
+
+        if (solver.setup(A, types[t]) != 0)
+        {
+            printf("  %-24s setup failed\n", solver.preconditionerName());
+            nErrors++;
+            continue;
+        }
+
+        std::fill(x.begin(), x.end(), 0.0);
+        PcgStats stats = solver.solve(rhs.data(), x.data(), tol, max_iter);
+        pcgPrintStats(solver.preconditionerName(), stats);
+        nErrors += stats.converged ? 0 : 1;
+    }
+
+    free(I);
+    free(J);
+    free(val);
+
+    printf("Test Summary:  %d errors\n", nErrors);
+    return nErrors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
 int main(int argc, char **argv)
 {
     int M = 0, N = 0, nz = 0, *I = NULL, *J = NULL;
@@ -86,6 +245,16 @@ int main(int argc, char **argv)
     int k;
     float alpha, beta, alpham1;
 
+    if (checkCmdLineFlag(argc, (const char **)argv, "spmv"))
+    {
+        exit(runSpMVBenchmark(1048576));
+    }
+
+    if (checkCmdLineFlag(argc, (const char **)argv, "cpu"))
+    {
+        exit(runCpuPCG(1048576));
+    }
+
     // This will pick the best possible CUDA capable device
     cudaDeviceProp deviceProp;
     int devID = findCudaDevice(argc, (const char **)argv);
@@ -42,6 +42,9 @@
 // Utilities and system includes
 #include <helper_functions.h>  // shared functions common to CUDA Samples
 #include <helper_cuda.h>       // CUDA error checking
+#include <helper_pcg.h>        // host PCG solvers for the -cpu mode
+#include <helper_pipecg.h>     // pipelined and s-step CG for the -cpu mode
+#include <helper_amg.h>        // smoothed aggregation AMG for the -cpu mode
 
 const char *sSDKname     = "conjugateGradientPrecond";
 
@@ -125,6 +128,130 @@ void genLaplace(int *row_ptr, int *col_ind, float *val, int M, int N, int nz,
 
 }
 
+/*
+ * -cpu: solve the Laplace system on the host with the multithreaded PCG
+ * solvers from helper_pcg.h, no GPU required. genLaplace produces a negative
+ * definite operator, so the equivalent SPD system -A x = -b is solved, which
+ * IC(0) needs. The grid size is set with -grid=n (N = n*n unknowns).
+ */
+int runCpuPCG(int argc, char **argv)
+{
+    const int max_iter = 10000;
+    const double tol = 1e-8;
+    int n = 128;
+
+    if (checkCmdLineFlag(argc, (const char **)argv, "grid"))
+    {
+        n = getCmdLineArgumentInt(argc, (const char **)argv, "grid");
+    }
+
+    int N = n*n;
+    int nz = 5*N - 4*n;
+    int *I = (int *)malloc(sizeof(int)*(N+1));
+    int *J = (int *)malloc(sizeof(int)*nz);
+    float *val = (float *)malloc(sizeof(float)*nz);
+    float *rhs = (float *)malloc(sizeof(float)*N);
+
+    for (int i = 0; i < N; i++)
+    {
+        rhs[i] = 0.0;
+    }
+
+    genLaplace(I, J, val, N, N, nz, rhs);
+
+    std::vector<double> negA(nz), negB(N), x(N);
+
+    for (int k = 0; k < nz; k++)
+    {
+        negA[k] = -val[k];
+    }
+
+    for (int i = 0; i < N; i++)
+    {
+        negB[i] = -rhs[i];
+    }
+
+    CsrMatrixView<double> A(N, N, nz, I, J, negA.data());
+    const PcgPreconditionerType types[] = {PCG_PRECOND_NONE, PCG_PRECOND_JACOBI,
+                                           PCG_PRECOND_SGS, PCG_PRECOND_IC0,
+                                           PCG_PRECOND_ILU0};
+    int nErrors = 0;
+
+    printf("Host PCG on %d threads, N = %d, nnz = %d, tol = %.1e\n",
+           sdkGetNumThreads(), N, nz, tol);
+
+    for (size_t t = 0; t < sizeof(types)/sizeof(types[0]); t++)
+    {
+        PcgSolver<double> solver;
+
+        if (solver.setup(A, types[t]) != 0)
+        {
+            printf("  %-24s setup failed\n", solver.preconditionerName());
+            nErrors++;
+            continue;
+        }
+
+        std::fill(x.begin(), x.end(), 0.0);
+        PcgStats stats = solver.solve(negB.data(), x.data(), tol, max_iter);
+        pcgPrintStats(solver.preconditionerName(), stats);
+        nErrors += stats.converged ? 0 : 1;
+    }
+
+    // AMG: the hierarchy is built once and reused for a second right-hand side
+    AmgPreconditioner<double> amg;
+    PcgSolver<double> amgSolver;
+
+    if (amgSolver.setup(A, &amg, false) != 0)
+    {
+        printf("  %-24s setup failed\n", amg.name());
+        nErrors++;
+    }
+    else
+    {
+        std::vector<double> ones(N, 1.0);
+        const double *amgRhs[] = {negB.data(), ones.data()};
+
+        for (int k = 0; k < 2; k++)
+        {
+            std::fill(x.begin(), x.end(), 0.0);
+            PcgStats amgStats = amgSolver.solve(amgRhs[k], x.data(), tol, max_iter);
+            pcgPrintStats(k == 0 ? "AMG (SA)" : "AMG (SA), 2nd rhs", amgStats);
+            nErrors += amgStats.converged ? 0 : 1;
+        }
+
+        amg.printHierarchy();
+    }
+
+    // communication reducing CG variants on the same system
+    PipelinedCgSolver<double> pipelined;
+    SStepCgSolver<double> sstep;
+    PcgStats stats;
+
+    for (int jacobi = 0; jacobi < 2; jacobi++)
+    {
+        pipelined.setup(A, jacobi != 0);
+        std::fill(x.begin(), x.end(), 0.0);
+        stats = pipelined.solve(negB.data(), x.data(), tol, max_iter);
+        pcgPrintStats(pipelined.name(), stats);
+        nErrors += stats.converged ? 0 : 1;
+    }
+
+    sstep.setup(A, 4);
+    std::fill(x.begin(), x.end(), 0.0);
+    stats = sstep.solve(negB.data(), x.data(), tol, max_iter);
+    pcgPrintStats(sstep.name(), stats);
+    nErrors += stats.converged ? 0 : 1;
+
+    free(I);
+    free(J);
+    free(val);
+    free(rhs);
+
+    printf("Test Summary:\n");
+    printf("   Counted total of %d errors\n", nErrors);
+    return (nErrors == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 /*
  * Solve Ax=b using the conjugate gradient method
  * a) without any preconditioning,
@@ -162,6 +289,12 @@ int main(int argc, char **argv)
         qatest = 1;
     }
 
+    /* Host-only PCG mode */
+    if (checkCmdLineFlag(argc, (const char **)argv, "cpu"))
+    {
+        exit(runCpuPCG(argc, argv));
+    }
+
     /* This will pick the best possible CUDA capable device */
     cudaDeviceProp deviceProp;
     int devID = findCudaDevice(argc, (const char **)argv);
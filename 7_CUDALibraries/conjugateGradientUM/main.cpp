@@ -28,6 +28,7 @@
 // Utilities and system includes
 #include <helper_functions.h>  // helper for shared functions common to CUDA Samples
 #include <helper_cuda.h>       // helper function CUDA error checking and initialization
+#include <helper_pipecg.h>     // pipelined and s-step CG for the -cpu mode
 
 const char *sSDKname     = "conjugateGradientUM";
 
@@ -71,6 +72,92 @@ void genTridiag(int *I, int *J, float *val, int N, int nz)
     I[N] = nz;
 }
 
+/* solve A x = b on the host with solver and print one line of results */
+template <typename Solver>
+int runCpuSolver(Solver &solver, const char *label, const double *rhs,
+                 std::vector<double> &x, double tol, int max_iter)
+{
+    std::fill(x.begin(), x.end(), 0.0);
+    PcgStats stats = solver.solve(rhs, x.data(), tol, max_iter);
+    printf("    %-12s %4d it, %9.3f ms, %7.3f ms/it, rel. residual = %e %s\n",
+           label, stats.iterations, stats.solveMs,
+           stats.solveMs / std::max(stats.iterations, 1), stats.relResidual,
+           stats.converged ? "" : (stats.diverged ? "DIVERGED" : "FAIL"));
+    return stats.converged ? 0 : 1;
+}
+
+/*
+ * -cpu: strong scaling of classic CG against the communication reducing
+ * pipelined and s-step variants on the host, no GPU required. Classic CG
+ * synchronizes all threads twice per iteration for its dot products, the
+ * pipelined variant once and s-step CG once every s iterations, which is
+ * what decides scaling once the per-thread share of the matrix gets small.
+ * Options: -n=<rows> (default 1048576), -s=<steps> (default and maximum 4).
+ */
+int runCpuCGScaling(int argc, char **argv)
+{
+    const int max_iter = 10000;
+    const double tol = 1e-8;
+    int N = 1048576, s = 4;
+
+    if (checkCmdLineFlag(argc, (const char **)argv, "n"))
+    {
+        N = std::max(getCmdLineArgumentInt(argc, (const char **)argv, "n"), 3);
+    }
+
+    if (checkCmdLineFlag(argc, (const char **)argv, "s"))
+    {
+        s = getCmdLineArgumentInt(argc, (const char **)argv, "s");
+    }
+
+    int nz = (N-2)*3 + 4;
+    int *I = (int *)malloc(sizeof(int)*(N+1));
+    int *J = (int *)malloc(sizeof(int)*nz);
+    float *val = (float *)malloc(sizeof(float)*nz);
+    genTridiag(I, J, val, N, nz);
+
+    std::vector<double> valD(val, val + nz), rhs(N, 1.0), x(N);
+    CsrMatrixView<double> A(N, N, nz, I, J, valD.data());
+    const int maxThreads = sdkGetNumThreads();
+    int nErrors = 0;
+
+    printf("Host CG scaling, N = %d, nnz = %d, tol = %.1e, up to %d threads\n",
+           N, nz, tol, maxThreads);
+
+    for (int threads = 1; ; threads = std::min(threads * 2, maxThreads))
+    {
+        sdkSetNumThreads(threads);
+        printf("  %d thread(s)\n", threads);
+
+        PcgSolver<double> classic;
+        classic.setup(A, PCG_PRECOND_NONE);
+        nErrors += runCpuSolver(classic, "classic", rhs.data(), x, tol, max_iter);
+
+        PipelinedCgSolver<double> pipelined;
+        pipelined.setup(A, false);
+        nErrors += runCpuSolver(pipelined, "pipelined", rhs.data(), x, tol, max_iter);
+
+        SStepCgSolver<double> sstep;
+        sstep.setup(A, s);
+        char label[32];
+        sprintf(label, "s-step (s=%d)", sstep.s());
+        nErrors += runCpuSolver(sstep, label, rhs.data(), x, tol, max_iter);
+
+        if (threads == maxThreads)
+        {
+            break;
+        }
+    }
+
+    sdkSetNumThreads(0);
+    free(I);
+    free(J);
+    free(val);
+
+    printf("Test Summary:  %d errors\n", nErrors);
+    return nErrors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
 int main(int argc, char **argv)
 {
     int N = 0, nz = 0, *I = NULL, *J = NULL;
@@ -87,6 +174,11 @@ int main(int argc, char **argv)
 
     printf("Starting [%s]...\n", sSDKname);
 
+    if (checkCmdLineFlag(argc, (const char **)argv, "cpu"))
+    {
+        exit(runCpuCGScaling(argc, argv));
+    }
+
     // This will pick the best possible CUDA capable device
     cudaDeviceProp deviceProp;
     int devID = findCudaDevice(argc, (const char **)argv);
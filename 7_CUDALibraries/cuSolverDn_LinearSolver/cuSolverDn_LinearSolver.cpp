@@ -32,6 +32,11 @@
  *     ./cuSolverDn_LinearSolver -R=lu -file<file>     // LU with partial
  * pivoting
  *     ./cuSolverDn_LinearSolver -R=qr -file<file>     // QR factorization
+ *     ./cuSolverDn_LinearSolver -R=lu -cpu            // multithreaded host
+ * solver of helper_dense.h, no GPU; add -tile for the task-DAG (tile
+ * algorithm) version and -nb=<int> to change the block size
+ *     SDK_PROFILE=1 ./cuSolverDn_LinearSolver -cpu   // time the panels and
+ * updates of the host solver, SDK_PROFILE_TRACE=<file.json> for a Chrome trace
  *
  *  Remark: the absolute error on solution x is meaningless without knowing
  * condition number of A. The relative error on residual should be close to
@@ -51,6 +56,7 @@
 #include "helper_cuda.h"
 
 #include "helper_cusolver.h"
+#include "helper_dense.h"
 
 template <typename T_ELEM>
 int loadMMSparseMatrix(char *filename, char elem_type, bool csrFormat, int *m,
@@ -67,6 +73,9 @@ void UsageDN(void) {
   printf("-lda=<int> : leading dimension of A , m by default\n");
   printf("-file=<filename>: filename containing a matrix in MM format\n");
   printf("-device=<device_id> : <device_id> if want to run on specific GPU\n");
+  printf("-cpu       : solve with the multithreaded host solver, no GPU\n");
+  printf("-tile      : with -cpu, run the tile algorithm as a task DAG\n");
+  printf("-nb=<int>  : with -cpu, block (tile) size, 128 by default\n");
 
   exit(0);
 }
@@ -295,6 +304,64 @@ int linearSolverQR(cusolverDnHandle_t handle, int n, const double *Acopy,
   return 0;
 }
 
+/*
+ *  solve A*x = b on the host with the blocked or tiled factorizations of
+ *  helper_dense.h
+ *
+ */
+int linearSolverHost(const char *testFunc, DenseMode mode, int nb, int n,
+                     const double *Acopy, int lda, const double *b,
+                     double *x) {
+  double *A = (double *)malloc(sizeof(double) * lda * n);
+  double *tau = (double *)malloc(sizeof(double) * n);
+  int *ipiv = (int *)malloc(sizeof(int) * n);
+  int h_info = 0;
+  double start, stop;
+  double time_solve;
+  const char *name = "cholesky";
+
+  assert(NULL != A);
+  assert(NULL != tau);
+  assert(NULL != ipiv);
+
+  printf("host %s solver: %d threads, nb = %d\n", denseModeName(mode),
+         sdkGetNumThreads(), nb);
+
+  memcpy(A, Acopy, sizeof(double) * lda * n);
+  memcpy(x, b, sizeof(double) * n);
+
+  start = second();
+
+  if (0 == strcmp(testFunc, "chol")) {
+    h_info = densePotrf(n, A, lda, mode, nb);
+    if (0 == h_info) densePotrs(n, A, lda, x);
+  } else if (0 == strcmp(testFunc, "lu")) {
+    name = "LU";
+    h_info = denseGetrf(n, A, lda, ipiv, mode, nb);
+    if (0 == h_info) denseGetrs(n, A, lda, ipiv, x);
+  } else {
+    name = "QR";
+    denseGeqrf(n, A, lda, tau, mode, nb);
+    denseGeqrs(n, A, lda, tau, x);
+  }
+
+  stop = second();
+
+  if (0 != h_info) {
+    fprintf(stderr, "Error: %s factorization failed, info = %d\n", name,
+            h_info);
+  }
+
+  time_solve = stop - start;
+  fprintf(stdout, "timing: %s = %10.6f sec\n", name, time_solve);
+
+  free(A);
+  free(tau);
+  free(ipiv);
+
+  return h_info;
+}
+
 void parseCommandLineArguments(int argc, char *argv[], struct testOpts &opts) {
   memset(&opts, 0, sizeof(opts));
 
@@ -378,8 +445,6 @@ int main(int argc, char *argv[]) {
                              // selected with -R option.
   }
 
-  findCudaDevice(argc, (const char **)argv);
-
   printf("step 1: read matrix market format\n");
 
   if (opts.sparse_mat_filename == NULL) {
@@ -465,6 +530,52 @@ int main(int argc, char *argv[]) {
     }
   }
 
+  if (checkCmdLineFlag(argc, (const char **)argv, "cpu")) {
+    const DenseMode mode = checkCmdLineFlag(argc, (const char **)argv, "tile")
+                               ? DENSE_TILED
+                               : DENSE_BLOCKED;
+    int nb = 128;
+
+    if (checkCmdLineFlag(argc, (const char **)argv, "nb")) {
+      nb = std::max(1, getCmdLineArgumentInt(argc, (const char **)argv, "nb"));
+    }
+
+    printf("step 4: solve A*x = b on the host\n");
+    errors = linearSolverHost(opts.testFunc, mode, nb, rowsA, h_A, lda, h_b,
+                              h_x);
+
+    printf("step 5: evaluate residual\n");
+    for (int row = 0; row < rowsA; row++) {
+      double r = h_b[row];
+      for (int col = 0; col < colsA; col++) {
+        r -= h_A[row + col * lda] * h_x[col];
+      }
+      h_r[row] = r;
+    }
+
+    x_inf = vec_norminf(colsA, h_x);
+    r_inf = vec_norminf(rowsA, h_r);
+    A_inf = mat_norminf(rowsA, colsA, h_A, lda);
+
+    printf("|b - A*x| = %E \n", r_inf);
+    printf("|A| = %E \n", A_inf);
+    printf("|x| = %E \n", x_inf);
+    printf("|b - A*x|/(|A|*|x|) = %E \n", r_inf / (A_inf * x_inf));
+
+    sdkProfilerReport();
+
+    free(h_csrValA);
+    free(h_csrRowPtrA);
+    free(h_csrColIndA);
+    free(h_A);
+    free(h_x);
+    free(h_b);
+    free(h_r);
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+
+  findCudaDevice(argc, (const char **)argv);
+
   checkCudaErrors(cusolverDnCreate(&handle));
   checkCudaErrors(cublasCreate(&cublasHandle));
   checkCudaErrors(cudaStreamCreate(&stream));
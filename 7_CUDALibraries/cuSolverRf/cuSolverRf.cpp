@@ -20,9 +20,14 @@
  *
  *  step 3: analyze and refactor A
  *
+ *  step 4: repeat step 3 on the host with helper_refactor.h, for one
+ *          matrix and for a batch of matrices with the same pattern
+ *
  *  How to use
  *     ./cuSolverRf -P=symrcm -file <file>
  *     ./cuSolverRf -P=symamd -file <file>
+ *     ./cuSolverRf -P=auto -permfile=<perm> -file <file>
+ *     ./cuSolverRf -batch=<k> -file <file>
  *
  */
 
@@ -37,6 +42,8 @@
 
 #include "helper_string.h"
 #include "helper_cusolver.h"
+#include "helper_reorder.h"
+#include "helper_refactor.h"
 
 #include "cusolverSp_LOWLEVEL_PREVIEW.h"
 
@@ -64,8 +71,12 @@ void UsageRF(void)
     printf( "-P=<name>    : choose a reordering\n");
     printf( "              symrcm (Reverse Cuthill-McKee)\n");
     printf( "              symamd (Approximate Minimum Degree)\n");
+    printf( "              rcm, amd, nd (host orderings from helper_reorder.h)\n");
+    printf( "              auto   (the host ordering with the smallest nnz(L))\n");
+    printf( "-permfile=<file> : reuse/save the host ordering for this pattern and -P\n");
     printf( "-file=<filename> : filename containing a matrix in MM format\n");
     printf( "-device=<device_id> : <device_id> if want to run on specific GPU\n");
+    printf( "-batch=<k>  : number of matrices refactored at once on the host (default 32)\n");
 
     exit( 0 );
 }
@@ -86,7 +97,8 @@ void parseCommandLineArguments(int argc, char *argv[], struct testOpts &opts)
 
         if (reorderType)
         {
-            if ((STRCASECMP(reorderType, "symrcm") != 0) && (STRCASECMP(reorderType, "symamd") != 0))
+            if ((STRCASECMP(reorderType, "symrcm") != 0) && (STRCASECMP(reorderType, "symamd") != 0) &&
+                !reorderIsHostMethod(reorderType))
             {
                 printf("\nIncorrect argument passed to -P option\n");
                 UsageRF();
@@ -103,6 +115,11 @@ void parseCommandLineArguments(int argc, char *argv[], struct testOpts &opts)
         opts.reorder = "symrcm"; // Setting default reordering to be symrcm.
     }
 
+    if (checkCmdLineFlag(argc, (const char **)argv, "permfile"))
+    {
+        getCmdLineArgumentString(argc, (const char **)argv, "permfile", &opts.permFile);
+    }
+
     if (checkCmdLineFlag(argc, (const char **)argv, "file"))
     {
         char *fileName = 0;
@@ -239,9 +256,23 @@ int main (int argc, char *argv[])
     double time_rf_reset;
     double time_rf_refactor;
     double time_rf_solve;
+    double time_host_setup;
+    double time_host_reset;
+    double time_host_refactor;
+    double time_host_solve;
+    double time_host_batch_refactor;
+    double time_host_batch_solve;
+
+    HostRefactorLU hostRf; // refactorization on the host
+    int batchSize = 32;
 
     parseCommandLineArguments(argc, argv, opts);
 
+    if (checkCmdLineFlag(argc, (const char **)argv, "batch"))
+    {
+        batchSize = std::max(1, getCmdLineArgumentInt(argc, (const char **)argv, "batch"));
+    }
+
     printf("step 1.1: preparation\n");
     printf("step 1.1: read matrix market format\n");
 
@@ -350,7 +381,7 @@ int main (int argc, char *argv[])
     }
 
     printf("step 2: reorder the matrix to reduce zero fill-in\n");
-    printf("        Q = symrcm(A) or Q = symamd(A) \n");
+    printf("        Q = symrcm(A), Q = symamd(A) or a host ordering\n");
     start = second();
     start = second();
 
@@ -368,6 +399,11 @@ int main (int argc, char *argv[])
             descrA, h_csrRowPtrA, h_csrColIndA, 
             h_Qreorder));
     }
+    else if ( reorderIsHostMethod(opts.reorder) )
+    {
+        reorderHostPattern(opts.reorder, opts.permFile, rowsA,
+            h_csrRowPtrA, h_csrColIndA, h_Qreorder);
+    }
     else 
     {
         fprintf(stderr, "Error: %s is unknow reordering\n", opts.reorder);
@@ -725,6 +761,133 @@ int main (int argc, char *argv[])
     printf("(GPU) |x| = %E \n", x_inf);
     printf("(GPU) |b - A*x|/(|A|*|x|) = %E \n", r_inf/(A_inf * x_inf));
 
+/*
+ *  The same refactorization on the host. Setup takes (P, Q, L, U) like
+ *  cusolverRfSetupHost and precomputes the update schedule and level sets,
+ *  refactor and solve then run without allocation or pivoting.
+ */
+    printf("step 15: set up host refactorization by (P, Q, L, U) \n");
+    start = second();
+
+    if (hostRf.setup(rowsA, h_csrRowPtrA, h_csrColIndA, h_csrRowPtrL, h_csrColIndL,
+            h_csrRowPtrU, h_csrColIndU, h_P, h_Q))
+    {
+        fprintf(stderr, "Error: A is not covered by the pattern of L+U\n");
+        return 1;
+    }
+    hostRf.setNumericProperties(nzero, nboost);
+
+    stop = second();
+    time_host_setup = stop - start;
+    hostRf.printStats();
+
+    printf("step 16: host refactorization \n");
+    start = second();
+    hostRf.resetValues(h_csrValA);
+    stop = second();
+    time_host_reset = stop - start;
+
+    start = second();
+    singularity = hostRf.refactor();
+    stop = second();
+    time_host_refactor = stop - start;
+
+    if ( 0 <= singularity )
+    {
+        printf("WARNING: pivot of row %d was boosted\n", singularity);
+    }
+
+    printf("step 17: solve A*x = b on the host \n");
+    start = second();
+    hostRf.solve(h_b, h_x);
+    stop = second();
+    time_host_solve = stop - start;
+
+    // r = b - A*x on the host
+    for(int row = 0 ; row < rowsA ; row++)
+    {
+        double sum = h_b[row];
+        for(int k = h_csrRowPtrA[row] - baseA ; k < h_csrRowPtrA[row+1] - baseA ; k++)
+        {
+            sum -= h_csrValA[k] * h_x[h_csrColIndA[k] - baseA];
+        }
+        h_r[row] = sum;
+    }
+
+    x_inf = vec_norminf(colsA, h_x);
+    r_inf = vec_norminf(rowsA, h_r);
+    printf("(CPU) |b - A*x| = %E \n", r_inf);
+    printf("(CPU) |b - A*x|/(|A|*|x|) = %E \n", r_inf/(A_inf * x_inf));
+
+/*
+ *  A batch of matrices with the pattern of A, as in the Newton loop of a
+ *  circuit or power flow simulation: A_k has the diagonal of A scaled by
+ *  1 + k/batchSize.
+ */
+    printf("step 18: refactor and solve a batch of %d matrices on the host \n", batchSize);
+    {
+        std::vector<double> valBatch((size_t)batchSize * nnzA);
+        std::vector<double> xBatch((size_t)batchSize * colsA);
+        std::vector<const double *> valPtrs(batchSize), bPtrs(batchSize, h_b);
+        std::vector<double *> xPtrs(batchSize);
+        double worst = 0.0;
+
+        for(int k = 0 ; k < batchSize ; k++)
+        {
+            double *val = &valBatch[(size_t)k * nnzA];
+            for(int row = 0 ; row < rowsA ; row++)
+            {
+                for(int j = h_csrRowPtrA[row] - baseA ; j < h_csrRowPtrA[row+1] - baseA ; j++)
+                {
+                    const bool diag = (h_csrColIndA[j] - baseA == row);
+                    val[j] = h_csrValA[j] * (diag ? 1.0 + (double)k / batchSize : 1.0);
+                }
+            }
+            valPtrs[k] = val;
+            xPtrs[k] = &xBatch[(size_t)k * colsA];
+        }
+
+        hostRf.setupBatch(batchSize);
+
+        start = second();
+        singularity = hostRf.refactorBatch(batchSize, valPtrs.data());
+        stop = second();
+        time_host_batch_refactor = stop - start;
+
+        if ( 0 <= singularity )
+        {
+            printf("WARNING: matrix %d of the batch needed a pivot boost\n", singularity);
+        }
+
+        start = second();
+        hostRf.solveBatch(batchSize, bPtrs.data(), xPtrs.data());
+        stop = second();
+        time_host_batch_solve = stop - start;
+
+        for(int k = 0 ; k < batchSize ; k++)
+        {
+            const double *val = valPtrs[k];
+            const double *x = xPtrs[k];
+            double rk = 0.0;
+            double Ak = 0.0;
+            for(int row = 0 ; row < rowsA ; row++)
+            {
+                double sum = h_b[row];
+                double rowSum = 0.0;
+                for(int j = h_csrRowPtrA[row] - baseA ; j < h_csrRowPtrA[row+1] - baseA ; j++)
+                {
+                    sum -= val[j] * x[h_csrColIndA[j] - baseA];
+                    rowSum += fabs(val[j]);
+                }
+                rk = std::max(rk, fabs(sum));
+                Ak = std::max(Ak, rowSum);
+            }
+            worst = std::max(worst, rk / (Ak * vec_norminf(colsA, x)));
+        }
+
+        printf("(CPU) max over the batch |b - A_k*x_k|/(|A_k|*|x_k|) = %E \n", worst);
+    }
+
     printf("===== statistics \n");
     printf(" nnz(A) = %d, nnz(L+U) = %d, zero fill-in ratio = %f\n", 
         nnzA, nnzL + nnzU, ((double)(nnzL+nnzU))/(double)nnzA);
@@ -742,6 +905,14 @@ int main (int argc, char *argv[])
     printf(" cusolverRf reset    : %f sec\n", time_rf_reset);
     printf(" cusolverRf refactor : %f sec\n", time_rf_refactor);
     printf(" cusolverRf solve    : %f sec\n", time_rf_solve);
+    printf("\n");
+    printf(" host refactorization setup   : %f sec\n", time_host_setup);
+    printf(" host refactorization reset   : %f sec\n", time_host_reset);
+    printf(" host refactorization refactor: %f sec\n", time_host_refactor);
+    printf(" host refactorization solve   : %f sec\n", time_host_solve);
+    printf(" host batch of %4d refactor  : %f sec (%f sec per matrix)\n",
+        batchSize, time_host_batch_refactor, time_host_batch_refactor / batchSize);
+    printf(" host batch of %4d solve     : %f sec\n", batchSize, time_host_batch_solve);
 
     if (cusolverRfH) { checkCudaErrors(cusolverRfDestroy(cusolverRfH)); }
     if (cusolverSpH) { checkCudaErrors(cusolverSpDestroy(cusolverSpH)); }
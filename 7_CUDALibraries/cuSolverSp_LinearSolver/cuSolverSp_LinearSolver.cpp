@@ -28,7 +28,8 @@
  *     The example solves A*x = b by the following steps
  *  step 1: B = A(Q,Q)
  *     Q is the ordering to minimize zero fill-in.
- *     The user can choose symrcm or symamd.
+ *     The user can choose symrcm, symamd or metis from cuSOLVER, or the
+ *     host orderings rcm, amd, nd and auto from helper_reorder.h.
  *  step 2: solve B*z = Q*b
  *  step 3: x = inv(Q)*z
  *
@@ -47,6 +48,8 @@
  with partial pivoting
  *     ./cuSolverSp_LinearSolver -R=qr -P=symamd -file=<file>     // symamd + QR
  factorization
+ *     ./cuSolverSp_LinearSolver -R=chol -P=auto -file=<file>     // best host
+ ordering + Cholesky
  *
  *
  *  Remark: the absolute error on solution x is meaningless without knowing
@@ -68,6 +71,7 @@
 
 #include "helper_cuda.h"
 #include "helper_cusolver.h"
+#include "helper_reorder.h"
 
 template <typename T_ELEM>
 int loadMMSparseMatrix(char *filename, char elem_type, bool csrFormat, int *m,
@@ -85,6 +89,9 @@ void UsageSP(void) {
   printf("              symrcm (Reverse Cuthill-McKee)\n");
   printf("              symamd (Approximate Minimum Degree)\n");
   printf("              metis  (nested dissection)\n");
+  printf("              rcm, amd, nd (host orderings from helper_reorder.h)\n");
+  printf("              auto   (the host ordering with the smallest nnz(L))\n");
+  printf("-permfile=<file> : reuse/save the host ordering for this pattern and -P\n");
   printf("-file=<filename> : filename containing a matrix in MM format\n");
   printf("-device=<device_id> : <device_id> if want to run on specific GPU\n");
 
@@ -121,7 +128,8 @@ void parseCommandLineArguments(int argc, char *argv[], struct testOpts &opts) {
     if (reorderType) {
       if ((STRCASECMP(reorderType, "symrcm") != 0) &&
           (STRCASECMP(reorderType, "symamd") != 0) &&
-          (STRCASECMP(reorderType, "metis") != 0)) {
+          (STRCASECMP(reorderType, "metis") != 0) &&
+          !reorderIsHostMethod(reorderType)) {
         printf("\nIncorrect argument passed to -P option\n");
         UsageSP();
       } else {
@@ -130,6 +138,11 @@ void parseCommandLineArguments(int argc, char *argv[], struct testOpts &opts) {
     }
   }
 
+  if (checkCmdLineFlag(argc, (const char **)argv, "permfile")) {
+    getCmdLineArgumentString(argc, (const char **)argv, "permfile",
+                             &opts.permFile);
+  }
+
   if (checkCmdLineFlag(argc, (const char **)argv, "file")) {
     char *fileName = 0;
     getCmdLineArgumentString(argc, (const char **)argv, "file", &fileName);
@@ -324,8 +337,8 @@ int main(int argc, char *argv[]) {
 
   printf("step 2: reorder the matrix A to minimize zero fill-in\n");
   printf(
-      "        if the user choose a reordering by -P=symrcm, -P=symamd or "
-      "-P=metis\n");
+      "        if the user choose a reordering by -P=symrcm, -P=symamd, "
+      "-P=metis,\n        -P=rcm, -P=amd, -P=nd or -P=auto\n");
 
   if (NULL != opts.reorder) {
     if (0 == strcmp(opts.reorder, "symrcm")) {
@@ -342,6 +355,10 @@ int main(int argc, char *argv[]) {
                                                 h_csrRowPtrA, h_csrColIndA,
                                                 NULL, /* default setting. */
                                                 h_Q));
+    } else if (reorderIsHostMethod(opts.reorder)) {
+      printf("step 2.1: Q = %s(A) on the host\n", opts.reorder);
+      reorderHostPattern(opts.reorder, opts.permFile, rowsA, h_csrRowPtrA,
+                         h_csrColIndA, h_Q);
     } else {
       fprintf(stderr, "Error: %s is unknown reordering\n", opts.reorder);
       return 1;
@@ -23,6 +23,7 @@
 
 #include "helper_cuda.h"
 #include "helper_cusolver.h"
+#include "helper_cholesky.h"
 
 template <typename T_ELEM>
 int loadMMSparseMatrix(
@@ -43,6 +44,8 @@ void UsageSP(void)
     printf( "-h          : display this help\n");
     printf( "-file=<filename> : filename containing a matrix in MM format\n");
     printf( "-device=<device_id> : <device_id> if want to run on specific GPU\n");
+    printf( "-cpu        : factorize with the host supernodal Cholesky only, no GPU\n");
+    printf( "-P=<name>   : host ordering for -cpu, rcm, amd (default), nd or auto\n");
 
     exit( 0 );
 }
@@ -71,6 +74,116 @@ void parseCommandLineArguments(int argc, char *argv[], struct testOpts &opts)
             UsageSP();
         }
     }
+
+    if (checkCmdLineFlag(argc, (const char **)argv, "P"))
+    {
+        char *reorderType = NULL;
+        getCmdLineArgumentString(argc, (const char **)argv, "P", &reorderType);
+
+        if (reorderIsHostMethod(reorderType))
+        {
+            opts.reorder = reorderType;
+        }
+        else
+        {
+            printf("\nIncorrect ordering passed to -P \n ");
+            UsageSP();
+        }
+    }
+}
+
+// |b - A*x| and |A| in the infinity norm, on the host
+static double residualHost(int rowsA, const int *csrRowPtrA, const int *csrColIndA,
+    const double *csrValA, const double *x, const double *b, double *A_inf)
+{
+    const int baseA = csrRowPtrA[0];
+    double r_inf = 0.0;
+    *A_inf = 0.0;
+
+    for(int row = 0 ; row < rowsA ; row++)
+    {
+        double r = b[row];
+        double sum = 0.0;
+        for(int k = csrRowPtrA[row] - baseA ; k < csrRowPtrA[row+1] - baseA ; k++)
+        {
+            r -= csrValA[k] * x[csrColIndA[k] - baseA];
+            sum += fabs(csrValA[k]);
+        }
+        r_inf = std::max(r_inf, fabs(r));
+        *A_inf = std::max(*A_inf, sum);
+    }
+
+    return r_inf;
+}
+
+/*
+ * -cpu: factorize A with the multithreaded supernodal Cholesky of
+ * helper_cholesky.h. The symbolic analysis is done once and reused to
+ * factorize a second matrix with the same pattern and different values.
+ */
+int runCpuCholesky(const struct testOpts &opts, int rowsA, int nnzA,
+    const int *h_csrRowPtrA, const int *h_csrColIndA, const double *h_csrValA)
+{
+    const char *ordering = opts.reorder ? opts.reorder : "amd";
+    const int baseA = h_csrRowPtrA[0];
+    std::vector<int> Q(rowsA);
+    std::vector<double> b(rowsA, 1.0), x(rowsA), valB(h_csrValA, h_csrValA + nnzA);
+    SupernodalSymbolic symbolic;
+    SupernodalCholesky chol;
+    double A_inf = 0.0;
+    double r_inf = 0.0;
+    double start, stop;
+
+    printf("step 2: host ordering of A, -P=%s\n", ordering);
+    reorderHostPattern(ordering, NULL, rowsA, h_csrRowPtrA, h_csrColIndA, Q.data());
+
+    printf("step 3: supernodal analysis of chol(A)\n");
+    symbolic.analyze(rowsA, h_csrRowPtrA, h_csrColIndA, Q.data());
+    symbolic.printStats();
+
+    // the second matrix has the same pattern and twice the diagonal of A
+    for(int row = 0 ; row < rowsA ; row++)
+    {
+        for(int k = h_csrRowPtrA[row] - baseA ; k < h_csrRowPtrA[row+1] - baseA ; k++)
+        {
+            if (h_csrColIndA[k] - baseA == row) { valB[k] *= 2.0; }
+        }
+    }
+
+    for(int pass = 0 ; pass < 2 ; pass++)
+    {
+        const double *val = (0 == pass)? h_csrValA : valB.data();
+
+        printf("step %d: compute %s = L*L^T with %d threads%s\n", 4 + 2*pass,
+            (0 == pass)? "A" : "B = A + diag(A)", sdkGetNumThreads(),
+            (0 == pass)? "" : ", reusing step 3");
+        start = second();
+        const int singularity = chol.factor(symbolic, val);
+        stop = second();
+
+        if ( 0 <= singularity)
+        {
+            fprintf(stderr, "Error: matrix is not positive definite, singularity=%d\n", singularity);
+            return 1;
+        }
+
+        printf("(CPU) factorization: %.3f ms, %.2f GFLOP/s, %d of %d supernodes with parallel kernels\n",
+            (stop - start)*1000.0, symbolic.flops()/(stop - start)*1e-9,
+            chol.numTopSupernodes(), symbolic.numSupernodes());
+
+        printf("step %d: solve and evaluate residual r = b - A*x\n", 5 + 2*pass);
+        start = second();
+        chol.solve(b.data(), x.data());
+        stop = second();
+
+        r_inf = residualHost(rowsA, h_csrRowPtrA, h_csrColIndA, val, x.data(), b.data(), &A_inf);
+
+        printf("(CPU) solve: %.3f ms\n", (stop - start)*1000.0);
+        printf("(CPU) |b - A*x| = %E \n", r_inf);
+        printf("(CPU) |b - A*x|/(|A|*|x|) = %E \n", r_inf/(A_inf * vec_norminf(rowsA, x.data())));
+    }
+
+    return 0;
 }
 
 
@@ -127,8 +240,6 @@ int main (int argc, char *argv[])
 
     parseCommandLineArguments(argc, argv, opts);
 
-    findCudaDevice(argc, (const char **)argv);
-
     if (opts.sparse_mat_filename == NULL)
     {
         opts.sparse_mat_filename =  sdkFindFilePath("lap2D_5pt_n100.mtx", argv[0]);
@@ -167,6 +278,18 @@ int main (int argc, char *argv[])
 
     printf("sparse matrix A is %d x %d with %d nonzeros, base=%d\n", rowsA, colsA, nnzA, baseA);
 
+    if (checkCmdLineFlag(argc, (const char **)argv, "cpu"))
+    {
+        errors = runCpuCholesky(opts, rowsA, nnzA, h_csrRowPtrA, h_csrColIndA, h_csrValA);
+
+        free(h_csrValA);
+        free(h_csrRowPtrA);
+        free(h_csrColIndA);
+        return errors;
+    }
+
+    findCudaDevice(argc, (const char **)argv);
+
     checkCudaErrors(cusolverSpCreate(&cusolverSpH));
 
     checkCudaErrors(cusparseCreate(&cusparseH));
@@ -26,10 +26,18 @@
 #include <string>
 #include <fstream>
 #include <iostream>
+#include <algorithm>
+#include <vector>
+
+#if !defined(WIN32) && !defined(_WIN32) && !defined(WIN64) && !defined(_WIN64)
+#  include <dirent.h>
+#endif
 
 #include <npp.h>
 
 #include <helper_cuda.h>
+#include <helper_histogram.h>
+#include <helper_timer.h>
 
 #if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
 #define STRCASECMP  _stricmp
@@ -79,6 +87,145 @@ bool printfNPPinfo(int argc, char *argv[])
 	return bVal;
 }
 
+// Host equalization of one image, global as on the device or CLAHE.
+void equalizeHost(const npp::ImageCPU_8u_C1 &oSrc, npp::ImageCPU_8u_C1 &oDst,
+                  bool bClahe, const SdkClaheParams &oParams)
+{
+    if (bClahe)
+    {
+        sdkClahe8u(oSrc.data(), oSrc.pitch(), oDst.data(), oDst.pitch(),
+                   (int)oSrc.width(), (int)oSrc.height(), oParams);
+        return;
+    }
+
+    uint32_t aHist[256];
+    uint8_t aLut[256];
+
+    sdkHistogram8u(oSrc.data(), oSrc.pitch(), (int)oSrc.width(), (int)oSrc.height(), aHist);
+    // the device histogram has 255 bins, level 255 is not counted
+    aHist[255] = 0;
+    sdkEqualizationLut8u(aHist, aLut);
+    sdkApplyLut8u(oSrc.data(), oSrc.pitch(), oDst.data(), oDst.pitch(),
+                  (int)oSrc.width(), (int)oSrc.height(), aLut);
+}
+
+// Sorted names of the .pgm files in a folder.
+std::vector<std::string> listImages(const std::string &sDir)
+{
+    std::vector<std::string> aNames;
+
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+    WIN32_FIND_DATAA oFound;
+    HANDLE hFind = FindFirstFileA((sDir + "\\*.pgm").c_str(), &oFound);
+
+    if (hFind != INVALID_HANDLE_VALUE)
+    {
+        do
+        {
+            aNames.push_back(oFound.cFileName);
+        }
+        while (FindNextFileA(hFind, &oFound));
+
+        FindClose(hFind);
+    }
+#else
+    DIR *pDir = opendir(sDir.c_str());
+
+    if (pDir != NULL)
+    {
+        for (struct dirent *pEntry = readdir(pDir); pEntry != NULL; pEntry = readdir(pDir))
+        {
+            std::string sName = pEntry->d_name;
+
+            if (sName.size() > 4 && STRCASECMP(sName.c_str() + sName.size() - 4, ".pgm") == 0)
+            {
+                aNames.push_back(sName);
+            }
+        }
+
+        closedir(pDir);
+    }
+#endif
+
+    std::sort(aNames.begin(), aNames.end());
+    return aNames;
+}
+
+// Equalizes every .pgm file of -input_dir into -output_dir (default the
+// input folder) on the host. Images are loaded and saved in groups, the
+// images of a group are equalized concurrently.
+int runHostBatch(int argc, char *argv[], bool bClahe, const SdkClaheParams &oParams)
+{
+    char *inputDir = 0;
+    char *outputDir = 0;
+    getCmdLineArgumentString(argc, (const char **)argv, "input_dir", &inputDir);
+
+    std::string sInputDir = inputDir;
+    std::string sOutputDir = sInputDir;
+
+    if (getCmdLineArgumentString(argc, (const char **)argv, "output_dir", &outputDir))
+    {
+        sOutputDir = outputDir;
+    }
+
+    std::vector<std::string> aNames = listImages(sInputDir);
+
+    // skip the results of earlier runs
+    aNames.erase(std::remove_if(aNames.begin(), aNames.end(), [](const std::string &sName)
+                 {
+                     return sName.find("_histEqualization.") != std::string::npos ||
+                            sName.find("_clahe.") != std::string::npos;
+                 }), aNames.end());
+
+    if (aNames.empty())
+    {
+        std::cout << "histEqualizationNPP found no .pgm images in <" << sInputDir << ">" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const size_t nGroup = 4 * sdkGetNumThreads();
+    const char *pSuffix = bClahe ? "_clahe.pgm" : "_histEqualization.pgm";
+    double fSeconds = 0.0;
+    double fPixels = 0.0;
+
+    for (size_t nFirst = 0; nFirst < aNames.size(); nFirst += nGroup)
+    {
+        const size_t nCount = std::min(nGroup, aNames.size() - nFirst);
+        std::vector<npp::ImageCPU_8u_C1> aSrc(nCount);
+        std::vector<npp::ImageCPU_8u_C1> aDst(nCount);
+
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            npp::loadImage(sInputDir + "/" + aNames[nFirst + i], aSrc[i]);
+            aDst[i] = npp::ImageCPU_8u_C1(aSrc[i].size());
+            fPixels += (double)aSrc[i].width() * aSrc[i].height();
+        }
+
+        unsigned long long nStart = sdkGetTimeNs();
+
+        sdkParallelFor(0, (int64_t)nCount, 1, [&](int64_t b, int64_t e, int)
+        {
+            for (int64_t i = b; i < e; ++i)
+            {
+                equalizeHost(aSrc[i], aDst[i], bClahe, oParams);
+            }
+        });
+
+        fSeconds += (sdkGetTimeNs() - nStart) * 1.0e-9;
+
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            std::string sName = aNames[nFirst + i];
+            npp::saveImage(sOutputDir + "/" + sName.substr(0, sName.size() - 4) + pSuffix, aDst[i]);
+        }
+    }
+
+    printf("Equalized %d images on %d threads: %.3f ms, %.1f MPix/s\n", (int)aNames.size(),
+           sdkGetNumThreads(), fSeconds * 1.0e3, fPixels / fSeconds * 1.0e-6);
+
+    return EXIT_SUCCESS;
+}
+
 int main(int argc, char *argv[])
 {
     printf("%s Starting...\n\n", argv[0]);
@@ -88,11 +235,39 @@ int main(int argc, char *argv[])
         std::string sFilename;
         char *filePath;
 
-        cudaDeviceInit(argc, (const char **)argv);
+        // -cpu equalizes on the host, -clahe adaptively on the host with
+        // -tiles=<n> (8) and -clip=<limit> (2.0), and -input_dir=<folder>
+        // equalizes all .pgm files of a folder on the host
+        bool bClahe = checkCmdLineFlag(argc, (const char **)argv, "clahe");
+        bool bBatch = checkCmdLineFlag(argc, (const char **)argv, "input_dir");
+        bool bHost = bClahe || bBatch || checkCmdLineFlag(argc, (const char **)argv, "cpu");
+
+        SdkClaheParams oClaheParams = {8, 8, 2.0f};
 
-        if (printfNPPinfo(argc, argv) == false)
+        if (checkCmdLineFlag(argc, (const char **)argv, "tiles"))
         {
-            exit(EXIT_SUCCESS);
+            oClaheParams.tilesX = getCmdLineArgumentInt(argc, (const char **)argv, "tiles");
+            oClaheParams.tilesY = oClaheParams.tilesX;
+        }
+
+        if (checkCmdLineFlag(argc, (const char **)argv, "clip"))
+        {
+            oClaheParams.clipLimit = getCmdLineArgumentFloat(argc, (const char **)argv, "clip");
+        }
+
+        if (bBatch)
+        {
+            exit(runHostBatch(argc, argv, bClahe, oClaheParams));
+        }
+
+        if (!bHost)
+        {
+            cudaDeviceInit(argc, (const char **)argv);
+
+            if (printfNPPinfo(argc, argv) == false)
+            {
+                exit(EXIT_SUCCESS);
+            }
         }
 
         if (checkCmdLineFlag(argc, (const char **)argv, "input"))
@@ -144,7 +319,7 @@ int main(int argc, char *argv[])
             dstFileName = dstFileName.substr(0, dot);
         }
 
-        dstFileName += "_histEqualization.pgm";
+        dstFileName += bClahe ? "_clahe.pgm" : "_histEqualization.pgm";
 
         if (checkCmdLineFlag(argc, (const char **)argv, "output"))
         {
@@ -155,6 +330,23 @@ int main(int argc, char *argv[])
 
         npp::ImageCPU_8u_C1 oHostSrc;
         npp::loadImage(sFilename, oHostSrc);
+
+        if (bHost)
+        {
+            npp::ImageCPU_8u_C1 oHostDst(oHostSrc.size());
+
+            unsigned long long nStart = sdkGetTimeNs();
+            equalizeHost(oHostSrc, oHostDst, bClahe, oClaheParams);
+            double fSeconds = (sdkGetTimeNs() - nStart) * 1.0e-9;
+
+            printf("Host %s on %d threads: %.3f ms\n", bClahe ? "CLAHE" : "equalization",
+                   sdkGetNumThreads(), fSeconds * 1.0e3);
+
+            npp::saveImage(dstFileName.c_str(), oHostDst);
+            std::cout << "Saved image file " << dstFileName << std::endl;
+            exit(EXIT_SUCCESS);
+        }
+
         npp::ImageNPP_8u_C1 oDeviceSrc(oHostSrc);
 
         //
@@ -58,8 +58,12 @@
 #include <string.h>
 #include <fstream>
 
+#include <vector>
+
 #include <npp.h>
 #include <helper_cuda.h>
+#include <helper_timer.h>
+#include <helper_watershed.h>
 
 // Note:  If you want to view these images we HIGHLY recommend using imagej which is free on the internet and works on most platforms 
 //        because it is one of the few image viewing apps that can display 32 bit integer image data.  While it normalizes the data
@@ -69,6 +73,9 @@
 //        with no image format information.   When viewing RAW files with imagej just enter the image size and bit depth values that
 //        are part of the file name when requested by imagej.
 //
+//        With -cpu the segmentation runs on the host instead (helper_watershed.h), all images of a mode in one batch, and the
+//        same files are written. No GPU is needed.
+//
 
 #define NUMBER_OF_IMAGES 3
 
@@ -190,6 +197,108 @@ loadRaw8BitImage(Npp8u * pImage, int nWidth, int nHeight, int nImage)
     return 0;
 }
 
+int
+writeRawImage(const std::string & rFileName, const void * pImage, size_t nBytes)
+{
+    FILE * bmpFile;
+
+    FOPEN(bmpFile, rFileName.c_str(), "wb");
+    if (bmpFile == NULL)
+    {
+        printf("%s could not be opened for writing.\n", rFileName.c_str());
+        return -1;
+    }
+
+    size_t nSize = fwrite(pImage, 1, nBytes, bmpFile);
+    if (fclose(bmpFile) != 0 || nSize < nBytes)
+    {
+        printf("%s write failed.\n", rFileName.c_str());
+        return -1;
+    }
+
+    return 0;
+}
+
+// Host segmentation of all images for each of the three output modes
+int
+runHost()
+{
+    const std::string * aSegmentsOutputFile[NUMBER_OF_IMAGES] = 
+        { &SegmentsOutputFile0, &SegmentsOutputFile1, &SegmentsOutputFile2 };
+    const std::string * aSegmentBoundariesOutputFile[NUMBER_OF_IMAGES] = 
+        { &SegmentBoundariesOutputFile0, &SegmentBoundariesOutputFile1, &SegmentBoundariesOutputFile2 };
+    const std::string * aSegmentsWithContrastingBoundariesOutputFile[NUMBER_OF_IMAGES] = 
+        { &SegmentsWithContrastingBoundariesOutputFile0, &SegmentsWithContrastingBoundariesOutputFile1, &SegmentsWithContrastingBoundariesOutputFile2 };
+    const std::string * aCompressedSegmentLabelsOutputFile[NUMBER_OF_IMAGES] = 
+        { &CompressedSegmentLabelsOutputFile0, &CompressedSegmentLabelsOutputFile1, &CompressedSegmentLabelsOutputFile2 };
+
+    const std::string ** aModeOutputFile[3] = 
+        { aSegmentsOutputFile, aSegmentBoundariesOutputFile, aSegmentsWithContrastingBoundariesOutputFile };
+    const int aMode[3] = 
+        { kSdkWatershedBoundariesNone, kSdkWatershedBoundariesOnly, kSdkWatershedBoundariesContrast };
+    const char * aModeName[3] = 
+        { "segments", "segment boundaries", "segments with contrasting boundaries" };
+
+    const int nWidth = 512;
+    const int nHeight = 512;
+    const size_t nPixels = (size_t)nWidth * nHeight;
+
+    std::vector<Npp8u> aInputImage[NUMBER_OF_IMAGES];
+    std::vector<Npp8u> aSegments[NUMBER_OF_IMAGES];
+    std::vector<Npp32u> aSegmentLabels[NUMBER_OF_IMAGES];
+    SdkWatershedImage<Npp8u> aBatch[NUMBER_OF_IMAGES];
+
+    printf("Segmenting on the host with %d threads\n", sdkGetNumThreads());
+
+    for (int nImage = 0; nImage < NUMBER_OF_IMAGES; nImage++)
+    {
+        aInputImage[nImage].resize(nPixels);
+        aSegmentLabels[nImage].resize(nPixels);
+
+        if (loadRaw8BitImage(&aInputImage[nImage][0], nWidth, nHeight, nImage) != 0)
+            return -1;
+    }
+
+    for (int nMode = 0; nMode < 3; nMode++)
+    {
+        // the segmentation works in place, start from the unaltered input images
+        for (int nImage = 0; nImage < NUMBER_OF_IMAGES; nImage++)
+        {
+            aSegments[nImage] = aInputImage[nImage];
+
+            SdkWatershedImage<Npp8u> oImage = { &aSegments[nImage][0], nWidth * sizeof(Npp8u), 
+                                                nMode == 0 ? &aSegmentLabels[nImage][0] : 0, nWidth, nHeight };
+            aBatch[nImage] = oImage;
+        }
+
+        unsigned long long nStart = sdkGetTimeNs();
+        sdkSegmentWatershedBatch(aBatch, NUMBER_OF_IMAGES, 8, aMode[nMode]);
+        double fSeconds = (sdkGetTimeNs() - nStart) * 1.0e-9;
+
+        printf("Host %s 8Way: %.3f ms, %.1f MPix/s\n", aModeName[nMode], fSeconds * 1.0e3, 
+               NUMBER_OF_IMAGES * nPixels * 1.0e-6 / fSeconds);
+
+        for (int nImage = 0; nImage < NUMBER_OF_IMAGES; nImage++)
+        {
+            if (writeRawImage(*aModeOutputFile[nMode][nImage], &aSegments[nImage][0], nPixels * sizeof(Npp8u)) != 0)
+                return -1;
+            printf("%s succeeded.\n", aModeOutputFile[nMode][nImage]->c_str());
+
+            if (nMode == 0)
+            {
+                int nCompressedLabelCount = sdkCompressMarkerLabels(&aSegmentLabels[nImage][0], nWidth * sizeof(Npp32u), 
+                                                                    nWidth, nHeight, (Npp32u)nPixels);
+
+                if (writeRawImage(*aCompressedSegmentLabelsOutputFile[nImage], &aSegmentLabels[nImage][0], nPixels * sizeof(Npp32u)) != 0)
+                    return -1;
+                printf("%s succeeded, %d segments.\n", aCompressedSegmentLabelsOutputFile[nImage]->c_str(), nCompressedLabelCount);
+            }
+        }
+    }
+
+    return 0;
+}
+
 int 
 main( int argc, char** argv )
 {
@@ -203,6 +312,11 @@ main( int argc, char** argv )
     FILE * bmpFile;
     NppiNorm eNorm = nppiNormInf; // default to 8 way neighbor search
 
+    if (checkCmdLineFlag(argc, (const char **)argv, "cpu"))
+    {
+        return runHost();
+    }
+
     for (int j = 0; j < NUMBER_OF_IMAGES; j++)
     {
         pInputImageDev[j] = 0;
@@ -0,0 +1,600 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Smoothed aggregation algebraic multigrid preconditioner for PcgSolver.
+//
+// Setup (once per matrix, reused for every right-hand side):
+//  1. strength graph: j is a strong neighbour of i if
+//     |a_ij| >= theta * sqrt(|a_ii a_jj|),
+//  2. greedy aggregation of the strength graph (Vanek, Mandel, Brezina),
+//  3. tentative prolongator T with one normalized constant per aggregate,
+//     smoothed by one damped Jacobi step: P = (I - w D^-1 A) T,
+//  4. Galerkin coarse operator A_c = P^T A P via two row-parallel sparse
+//     matrix products,
+// repeated until the coarse level has at most coarseSize rows, maxLevels is
+// reached or aggregation stops reducing the size. A coarsest level of up to
+// 4 * coarseSize rows is solved with a dense Cholesky factorization, a larger
+// one (after a stall or at maxLevels) with damped Jacobi sweeps. The solve
+// phase is one V-cycle with damped Jacobi pre- and post-smoothing, which
+// keeps the preconditioner symmetric positive definite as required by CG.
+// The matrix must be symmetric positive definite.
+#ifndef COMMON_HELPER_AMG_H_
+#define COMMON_HELPER_AMG_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include <helper_parallel.h>
+#include <helper_pcg.h>
+#include <helper_spmv.h>
+
+//! Zero-based CSR matrix that owns its arrays.
+template <typename T>
+struct AmgCsrMatrix {
+  int rows;
+  int cols;
+  std::vector<int> rowPtr;
+  std::vector<int> colInd;
+  std::vector<T> val;
+
+  AmgCsrMatrix() : rows(0), cols(0) {}
+
+  CsrMatrixView<T> view() const {
+    return CsrMatrixView<T>(rows, cols, (int)colInd.size(), rowPtr.data(),
+                            colInd.data(), val.data());
+  }
+};
+
+//! C = A*B (Gustavson). Rows are processed in parallel chunks, each with its
+//! own column marker: the first pass counts, the second fills.
+template <typename T>
+inline void amgSpGemm(const CsrMatrixView<T> &A, const CsrMatrixView<T> &B,
+                      AmgCsrMatrix<T> &C) {
+  const int64_t grain = 1024;
+  C.rows = A.rows;
+  C.cols = B.cols;
+  C.rowPtr.assign(A.rows + 1, 0);
+
+  sdkParallelFor(0, A.rows, grain, [&](int64_t rb, int64_t re, int) {
+    std::vector<int> marker(B.cols, -1);
+
+    for (int i = (int)rb; i < (int)re; i++) {
+      int count = 0;
+
+      for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+        const int j = A.colInd[k];
+
+        for (int kk = B.rowPtr[j]; kk < B.rowPtr[j + 1]; kk++) {
+          const int c = B.colInd[kk];
+
+          if (marker[c] != i) {
+            marker[c] = i;
+            count++;
+          }
+        }
+      }
+
+      C.rowPtr[i + 1] = count;
+    }
+  });
+
+  for (int i = 0; i < A.rows; i++) C.rowPtr[i + 1] += C.rowPtr[i];
+
+  C.colInd.resize(C.rowPtr[A.rows]);
+  C.val.resize(C.rowPtr[A.rows]);
+
+  sdkParallelFor(0, A.rows, grain, [&](int64_t rb, int64_t re, int) {
+    // marker holds the output position of a column; positions written by
+    // earlier rows of the chunk are all below the current row start
+    std::vector<int> marker(B.cols, -1);
+
+    for (int i = (int)rb; i < (int)re; i++) {
+      const int start = C.rowPtr[i];
+      int end = start;
+
+      for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+        const int j = A.colInd[k];
+        const T a = A.val[k];
+
+        for (int kk = B.rowPtr[j]; kk < B.rowPtr[j + 1]; kk++) {
+          const int c = B.colInd[kk];
+
+          if (marker[c] < start) {
+            marker[c] = end;
+            C.colInd[end] = c;
+            C.val[end] = a * B.val[kk];
+            end++;
+          } else {
+            C.val[marker[c]] += a * B.val[kk];
+          }
+        }
+      }
+    }
+  });
+}
+
+//! B = A^T
+template <typename T>
+inline void amgTranspose(const CsrMatrixView<T> &A, AmgCsrMatrix<T> &B) {
+  B.rows = A.cols;
+  B.cols = A.rows;
+  B.rowPtr.assign(A.cols + 1, 0);
+  B.colInd.resize(A.nnz);
+  B.val.resize(A.nnz);
+
+  for (int k = 0; k < A.nnz; k++) B.rowPtr[A.colInd[k] + 1]++;
+  for (int j = 0; j < A.cols; j++) B.rowPtr[j + 1] += B.rowPtr[j];
+
+  std::vector<int> pos(B.rowPtr.begin(), B.rowPtr.end() - 1);
+
+  for (int i = 0; i < A.rows; i++) {
+    for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+      const int p = pos[A.colInd[k]]++;
+      B.colInd[p] = i;
+      B.val[p] = A.val[k];
+    }
+  }
+}
+
+//! Greedy aggregation of the strength graph of A. Fills agg[i] with the
+//! aggregate of row i and returns the number of aggregates.
+template <typename T>
+inline int amgAggregate(const CsrMatrixView<T> &A, const std::vector<T> &diag,
+                        double theta, std::vector<int> &agg) {
+  const int n = A.rows;
+  std::vector<int> sPtr(n + 1, 0), sInd;
+  std::vector<double> sVal;
+  sInd.reserve(A.nnz);
+  sVal.reserve(A.nnz);
+
+  for (int i = 0; i < n; i++) {
+    for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+      const int j = A.colInd[k];
+      const double a = fabs((double)A.val[k]);
+
+      if (j != i && a >= theta * sqrt(fabs((double)diag[i] * diag[j]))) {
+        sInd.push_back(j);
+        sVal.push_back(a);
+      }
+    }
+
+    sPtr[i + 1] = (int)sInd.size();
+  }
+
+  int numAgg = 0;
+  agg.assign(n, -1);
+
+  // phase 1: roots whose whole strong neighbourhood is still free
+  for (int i = 0; i < n; i++) {
+    if (agg[i] >= 0) continue;
+
+    bool free = true;
+
+    for (int k = sPtr[i]; k < sPtr[i + 1] && free; k++) {
+      free = agg[sInd[k]] < 0;
+    }
+
+    if (!free) continue;
+
+    agg[i] = numAgg;
+    for (int k = sPtr[i]; k < sPtr[i + 1]; k++) agg[sInd[k]] = numAgg;
+    numAgg++;
+  }
+
+  // phase 2: attach leftovers to the most strongly connected aggregate
+  std::vector<int> phase1(agg);
+
+  for (int i = 0; i < n; i++) {
+    if (agg[i] >= 0) continue;
+
+    double best = -1.0;
+
+    for (int k = sPtr[i]; k < sPtr[i + 1]; k++) {
+      if (phase1[sInd[k]] >= 0 && sVal[k] > best) {
+        best = sVal[k];
+        agg[i] = phase1[sInd[k]];
+      }
+    }
+  }
+
+  // phase 3: whatever is left forms new aggregates with its free neighbours
+  for (int i = 0; i < n; i++) {
+    if (agg[i] >= 0) continue;
+
+    agg[i] = numAgg;
+
+    for (int k = sPtr[i]; k < sPtr[i + 1]; k++) {
+      if (agg[sInd[k]] < 0) agg[sInd[k]] = numAgg;
+    }
+
+    numAgg++;
+  }
+
+  return numAgg;
+}
+
+//! Estimate of the spectral radius of D^-1 A: a few power iterations, padded
+//! by 10% and capped by the Gershgorin bound. Gershgorin alone is sharp for
+//! the fine Laplacian but badly overestimates on the wide coarse stencils,
+//! which would make the Jacobi damping far too weak there.
+template <typename T>
+inline double amgSpectralRadius(const CsrMatrixView<T> &A,
+                                const std::vector<T> &dinv, int iterations) {
+  const int n = A.rows;
+  double gershgorin = 0.0;
+
+  for (int i = 0; i < n; i++) {
+    double rowSum = 0.0;
+    for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) rowSum += fabs((double)A.val[k]);
+    gershgorin = std::max(gershgorin, rowSum * fabs((double)dinv[i]));
+  }
+
+  std::vector<double> x(n), y(n);
+  double rho = 0.0;
+
+  for (int i = 0; i < n; i++) x[i] = 1.0 + (double)(i % 13) / 13.0;
+
+  for (int it = 0; it < iterations; it++) {
+    double xx = 0.0, yy = 0.0;
+
+    sdkParallelFor(0, n, 4096, [&](int64_t rb, int64_t re, int) {
+      for (int i = (int)rb; i < (int)re; i++) {
+        double sum = 0.0;
+        for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) sum += A.val[k] * x[A.colInd[k]];
+        y[i] = dinv[i] * sum;
+      }
+    });
+
+    for (int i = 0; i < n; i++) {
+      xx += x[i] * x[i];
+      yy += y[i] * y[i];
+    }
+
+    if (yy == 0.0) break;
+
+    rho = sqrt(yy / xx);
+    const double scale = 1.0 / sqrt(yy);
+    for (int i = 0; i < n; i++) x[i] = y[i] * scale;
+  }
+
+  return std::min(1.1 * rho, gershgorin);
+}
+
+//! Tuning parameters of AmgPreconditioner.
+struct AmgOptions {
+  double strengthThreshold;  // theta of the strength graph
+  int coarseSize;            // stop coarsening below this many rows
+  int maxLevels;
+  int smootherSweeps;        // Jacobi sweeps before and after correction
+  int coarseSweeps;          // Jacobi sweeps on a coarsest level too large
+                             // for the dense solver
+
+  AmgOptions()
+      : strengthThreshold(0.08), coarseSize(256), maxLevels(16),
+        smootherSweeps(2), coarseSweeps(16) {}
+};
+
+//! Why AmgPreconditioner::setup stopped adding levels.
+enum AmgStopReason {
+  AMG_STOP_COARSE_SIZE,  // the coarsest level has at most coarseSize rows
+  AMG_STOP_MAX_LEVELS,   // maxLevels was reached
+  AMG_STOP_STALLED       // aggregation removed less than 10% of the rows
+};
+
+template <typename T>
+class AmgPreconditioner : public HostPreconditioner<T> {
+ public:
+  explicit AmgPreconditioner(const AmgOptions &options = AmgOptions())
+      : options_(options), stop_(AMG_STOP_COARSE_SIZE), direct_(false) {}
+
+  int setup(const CsrMatrixView<T> &A) {
+    levels_.clear();
+    levels_.reserve(options_.maxLevels);
+    levels_.push_back(Level());
+    levels_[0].A = A;
+
+    for (;;) {
+      Level &fine = levels_.back();
+      const int n = fine.A.rows;
+
+      if (!pcgExtractDiagonal(fine.A, fine.dinv)) return -1;
+
+      std::vector<T> diag(fine.dinv);
+      for (int i = 0; i < n; i++) fine.dinv[i] = T(1) / fine.dinv[i];
+      const double rho = amgSpectralRadius(fine.A, fine.dinv, 15);
+      fine.omega = (T)(4.0 / (3.0 * std::max(rho, 1e-30)));
+      fine.x.assign(n, T(0));
+      fine.b.assign(n, T(0));
+      fine.tmp.assign(n, T(0));
+
+      if (n <= options_.coarseSize) {
+        stop_ = AMG_STOP_COARSE_SIZE;
+        break;
+      }
+
+      if ((int)levels_.size() == options_.maxLevels) {
+        stop_ = AMG_STOP_MAX_LEVELS;
+        break;
+      }
+
+      std::vector<int> agg;
+      const int nc = amgAggregate(fine.A, diag, options_.strengthThreshold,
+                                  agg);
+
+      if (nc >= n * 9 / 10 || nc == 0) {
+        stop_ = AMG_STOP_STALLED;
+        break;
+      }
+
+      // tentative prolongator, then P = T - w D^-1 A T
+      AmgCsrMatrix<T> Tp, AT;
+      std::vector<int> aggSize(nc, 0);
+      for (int i = 0; i < n; i++) aggSize[agg[i]]++;
+      Tp.rows = n;
+      Tp.cols = nc;
+      Tp.rowPtr.resize(n + 1);
+      Tp.colInd = agg;
+      Tp.val.resize(n);
+
+      for (int i = 0; i <= n; i++) Tp.rowPtr[i] = i;
+      for (int i = 0; i < n; i++) Tp.val[i] = T(1 / sqrt((double)aggSize[agg[i]]));
+
+      amgSpGemm(fine.A, Tp.view(), AT);
+      fine.P = AT;
+
+      for (int i = 0; i < n; i++) {
+        const T scale = -fine.omega * fine.dinv[i];
+
+        for (int k = AT.rowPtr[i]; k < AT.rowPtr[i + 1]; k++) {
+          fine.P.val[k] = scale * AT.val[k] + (AT.colInd[k] == agg[i] ? Tp.val[i] : T(0));
+        }
+      }
+
+      amgTranspose(fine.P.view(), fine.R);
+
+      // Galerkin product A_c = R (A P)
+      AmgCsrMatrix<T> AP;
+      amgSpGemm(fine.A, fine.P.view(), AP);
+      Level coarse;
+      amgSpGemm(fine.R.view(), AP.view(), coarse.Aown);
+      levels_.push_back(std::move(coarse));
+      levels_.back().A = levels_.back().Aown.view();
+    }
+
+    return factorCoarse();
+  }
+
+  void apply(const T *r, T *z) {
+    Level &top = levels_[0];
+    std::copy(r, r + top.A.rows, top.b.begin());
+    vcycle(0);
+    std::copy(top.x.begin(), top.x.end(), z);
+  }
+
+  const char *name() const { return "AMG (SA)"; }
+
+  int numLevels() const { return (int)levels_.size(); }
+
+  AmgStopReason stopReason() const { return stop_; }
+
+  //! true if the coarsest level is solved exactly by dense Cholesky, false
+  //! if it is only smoothed
+  bool directCoarseSolve() const { return direct_; }
+
+  //! sum of nnz over all levels / nnz of the fine matrix
+  double operatorComplexity() const {
+    double nnz = 0.0;
+    for (size_t l = 0; l < levels_.size(); l++) nnz += levels_[l].A.nnz;
+    return levels_.empty() ? 0.0 : nnz / levels_[0].A.nnz;
+  }
+
+  void printHierarchy() const {
+    printf("  AMG hierarchy: %d levels, operator complexity %.3f\n",
+           numLevels(), operatorComplexity());
+
+    for (size_t l = 0; l < levels_.size(); l++) {
+      printf("    level %2d: rows = %9d, nnz = %10d, nnz/row = %6.2f\n",
+             (int)l, levels_[l].A.rows, levels_[l].A.nnz,
+             (double)levels_[l].A.nnz / std::max(levels_[l].A.rows, 1));
+    }
+
+    if (levels_.empty()) return;
+
+    const char *reason = (stop_ == AMG_STOP_STALLED)
+                             ? "coarsening stalled"
+                             : (stop_ == AMG_STOP_MAX_LEVELS)
+                                   ? "maxLevels reached"
+                                   : "coarse size reached";
+
+    if (direct_) {
+      printf("    coarsest level: %s, dense Cholesky\n", reason);
+    } else {
+      printf("    coarsest level: %s, %d rows too large to factor, %d Jacobi "
+             "sweeps\n",
+             reason, levels_.back().A.rows, options_.coarseSweeps);
+    }
+  }
+
+ private:
+  struct Level {
+    CsrMatrixView<T> A;
+    AmgCsrMatrix<T> Aown;  // coarse levels own their operator
+    AmgCsrMatrix<T> P, R;  // prolongation to this level, restriction from it
+    std::vector<T> dinv, x, b, tmp;
+    T omega;
+  };
+
+  static const int64_t kGrain = 4096;
+  // largest coarsest level, in multiples of coarseSize, that is factored
+  static const int kDirectSizeFactor = 4;
+
+  //! x += w D^-1 (b - A x), out of place through tmp
+  void jacobiSweep(Level &L) {
+    const CsrMatrixView<T> &A = L.A;
+    const T *x = L.x.data(), *b = L.b.data(), *dinv = L.dinv.data();
+    T *y = L.tmp.data();
+    const T omega = L.omega;
+
+    sdkParallelFor(0, A.rows, kGrain, [&](int64_t rb, int64_t re, int) {
+      for (int i = (int)rb; i < (int)re; i++) {
+        T sum = b[i];
+
+        for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+          sum -= A.val[k] * x[A.colInd[k]];
+        }
+
+        y[i] = x[i] + omega * dinv[i] * sum;
+      }
+    });
+    L.x.swap(L.tmp);
+  }
+
+  void vcycle(size_t l) {
+    Level &L = levels_[l];
+    const int n = L.A.rows;
+
+    if (l + 1 == levels_.size()) {
+      coarseSolve(L);
+      return;
+    }
+
+    // pre-smoothing from a zero initial guess, the first sweep is x = w D^-1 b
+    sdkParallelFor(0, n, kGrain, [&](int64_t rb, int64_t re, int) {
+      for (int i = (int)rb; i < (int)re; i++) L.x[i] = L.omega * L.dinv[i] * L.b[i];
+    });
+
+    for (int s = 1; s < options_.smootherSweeps; s++) jacobiSweep(L);
+
+    // restrict the residual: b_c = R (b - A x)
+    const CsrMatrixView<T> A = L.A;
+    const T *x = L.x.data(), *b = L.b.data();
+    T *r = L.tmp.data();
+
+    sdkParallelFor(0, n, kGrain, [&](int64_t rb, int64_t re, int) {
+      for (int i = (int)rb; i < (int)re; i++) {
+        T sum = b[i];
+        for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) sum -= A.val[k] * x[A.colInd[k]];
+        r[i] = sum;
+      }
+    });
+
+    Level &C = levels_[l + 1];
+    const CsrMatrixView<T> R = L.R.view();
+    T *bc = C.b.data();
+
+    sdkParallelFor(0, R.rows, kGrain, [&](int64_t rb, int64_t re, int) {
+      for (int i = (int)rb; i < (int)re; i++) {
+        T sum = 0;
+        for (int k = R.rowPtr[i]; k < R.rowPtr[i + 1]; k++) sum += R.val[k] * r[R.colInd[k]];
+        bc[i] = sum;
+      }
+    });
+
+    vcycle(l + 1);
+
+    // prolongate the correction, x += P x_c
+    const CsrMatrixView<T> P = L.P.view();
+    const T *xc = C.x.data();
+    T *xf = L.x.data();
+
+    sdkParallelFor(0, n, kGrain, [&](int64_t rb, int64_t re, int) {
+      for (int i = (int)rb; i < (int)re; i++) {
+        T sum = 0;
+        for (int k = P.rowPtr[i]; k < P.rowPtr[i + 1]; k++) sum += P.val[k] * xc[P.colInd[k]];
+        xf[i] += sum;
+      }
+    });
+
+    for (int s = 0; s < options_.smootherSweeps; s++) jacobiSweep(L);
+  }
+
+  //! dense Cholesky of the coarsest operator, if it is small enough
+  int factorCoarse() {
+    const Level &L = levels_.back();
+    const int n = L.A.rows;
+    direct_ = n <= kDirectSizeFactor * std::max(options_.coarseSize, 1);
+
+    if (!direct_) {
+      chol_.clear();
+      coarseWork_.clear();
+      return 0;
+    }
+
+    chol_.assign((size_t)n * n, 0.0);
+
+    for (int i = 0; i < n; i++) {
+      for (int k = L.A.rowPtr[i]; k < L.A.rowPtr[i + 1]; k++) {
+        chol_[(size_t)i * n + L.A.colInd[k]] += L.A.val[k];
+      }
+    }
+
+    for (int j = 0; j < n; j++) {
+      double d = chol_[(size_t)j * n + j];
+      for (int k = 0; k < j; k++) d -= chol_[(size_t)j * n + k] * chol_[(size_t)j * n + k];
+      if (d <= 0.0) return -1;
+      d = sqrt(d);
+      chol_[(size_t)j * n + j] = d;
+
+      for (int i = j + 1; i < n; i++) {
+        double s = chol_[(size_t)i * n + j];
+        for (int k = 0; k < j; k++) s -= chol_[(size_t)i * n + k] * chol_[(size_t)j * n + k];
+        chol_[(size_t)i * n + j] = s / d;
+      }
+    }
+
+    coarseWork_.assign(n, 0.0);
+    return 0;
+  }
+
+  void coarseSolve(Level &L) {
+    const int n = L.A.rows;
+
+    if (!direct_) {
+      // a fixed number of sweeps from zero keeps the V-cycle SPD
+      sdkParallelFor(0, n, kGrain, [&](int64_t rb, int64_t re, int) {
+        for (int i = (int)rb; i < (int)re; i++) L.x[i] = L.omega * L.dinv[i] * L.b[i];
+      });
+
+      for (int s = 1; s < options_.coarseSweeps; s++) jacobiSweep(L);
+
+      return;
+    }
+
+    double *y = coarseWork_.data();
+
+    for (int i = 0; i < n; i++) {
+      double s = L.b[i];
+      for (int k = 0; k < i; k++) s -= chol_[(size_t)i * n + k] * y[k];
+      y[i] = s / chol_[(size_t)i * n + i];
+    }
+
+    for (int i = n - 1; i >= 0; i--) {
+      double s = y[i];
+      for (int k = i + 1; k < n; k++) s -= chol_[(size_t)k * n + i] * y[k];
+      y[i] = s / chol_[(size_t)i * n + i];
+    }
+
+    for (int i = 0; i < n; i++) L.x[i] = (T)y[i];
+  }
+
+  AmgOptions options_;
+  AmgStopReason stop_;
+  bool direct_;
+  std::vector<Level> levels_;
+  std::vector<double> chol_, coarseWork_;
+};
+
+#endif  // COMMON_HELPER_AMG_H_
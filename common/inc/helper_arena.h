@@ -0,0 +1,380 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Host memory that is reused instead of being returned to the system, for
+// scratch buffers of functions that are called over and over.
+//
+//  - sdkAlignedAlloc(): cache line (64 byte) aligned memory. Allocations of
+//    2 MB or more are aligned to 2 MB and, on Linux, advised to be backed
+//    by transparent huge pages, which saves TLB misses when streaming over
+//    large volumes.
+//  - sdkFirstTouch(): touches fresh pages from the threads of
+//    sdkParallelFor(). On a NUMA system the first touch decides which node
+//    a page lives on, so a buffer that is later processed by the same
+//    parallel loops is spread over the nodes instead of being placed on
+//    the node of the allocating thread.
+//  - SdkArena: a bump allocator over large blocks. SdkArenaFrame marks the
+//    arena and releases everything allocated after the mark when it goes
+//    out of scope, in LIFO order. The blocks are kept, so once a function
+//    has run, calling it again with the same sizes makes no allocation at
+//    all. sdkHostArena() is a per-thread arena, so frames need no lock.
+//  - SdkPool: free lists of blocks in size classes (four per power of
+//    two), for buffers that do not follow a stack discipline.
+//    SdkPoolAllocator adapts it to standard containers; SdkPoolVector<T>
+//    is a std::vector on the process-wide pool sdkHostPool().
+//
+//   void gold(int n) {
+//     SdkArenaFrame frame;
+//     float *tmp = frame.alloc<float>(n);  // uninitialized, 64 byte aligned
+//     ...
+//   }                                      // tmp is released here
+//
+// Memory is not returned to the system until trim() is called on the arena
+// or pool, or the owning thread (arena) or process (pool) exits.
+#ifndef COMMON_HELPER_ARENA_H_
+#define COMMON_HELPER_ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#endif
+
+#include <helper_parallel.h>
+
+static const size_t kSdkCacheLine = 64;
+static const size_t kSdkHugePage = 2 << 20;
+static const size_t kSdkPageSize = 4096;
+
+////////////////////////////////////////////////////////////////////////////////
+//! Aligned allocation; alignment is a power of two. Returns NULL on failure.
+////////////////////////////////////////////////////////////////////////////////
+inline void *sdkAlignedAlloc(size_t bytes, size_t alignment = kSdkCacheLine) {
+  if (bytes >= kSdkHugePage) alignment = std::max(alignment, kSdkHugePage);
+
+  alignment = std::max(alignment, sizeof(void *));
+  void *p = NULL;
+
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+  p = _aligned_malloc(bytes, alignment);
+#else
+  if (posix_memalign(&p, alignment, bytes) != 0) return NULL;
+
+#if defined(MADV_HUGEPAGE)
+  if (bytes >= kSdkHugePage) madvise(p, bytes & ~(kSdkHugePage - 1), MADV_HUGEPAGE);
+#endif
+#endif
+
+  return p;
+}
+
+inline void sdkAlignedFree(void *p) {
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+  _aligned_free(p);
+#else
+  free(p);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Writes one byte per page of p[0, bytes) from the threads of
+//! sdkParallelFor(), in chunks of 1 MB. Only for memory whose contents do not
+//! matter yet.
+////////////////////////////////////////////////////////////////////////////////
+inline void sdkFirstTouch(void *p, size_t bytes) {
+  char *base = (char *)p;
+  const int64_t pages = (int64_t)((bytes + kSdkPageSize - 1) / kSdkPageSize);
+
+  sdkParallelFor(0, pages, (1 << 20) / kSdkPageSize,
+                 [=](int64_t b, int64_t e, int) {
+    for (int64_t page = b; page < e; page++) base[page * kSdkPageSize] = 0;
+  });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Arena
+////////////////////////////////////////////////////////////////////////////////
+class SdkArena {
+ public:
+  struct Mark {
+    size_t block, offset;
+  };
+
+  //! Blocks hold at least blockBytes. Larger requests get a block of their
+  //! own, which is first touched in parallel if it spans huge pages.
+  explicit SdkArena(size_t blockBytes = 4 << 20)
+      : blockBytes_(blockBytes), current_(0), offset_(0), systemAllocs_(0) {}
+
+  ~SdkArena() {
+    for (size_t b = 0; b < blocks_.size(); b++) sdkAlignedFree(blocks_[b].base);
+  }
+
+  //! Uninitialized memory; throws std::bad_alloc if the system has none.
+  void *allocate(size_t bytes, size_t alignment = kSdkCacheLine) {
+    bytes = std::max<size_t>(bytes, 1);
+
+    // first fit from the current block on; the blocks after the current one
+    // are free and were left by a released frame
+    for (size_t b = current_; b < blocks_.size(); b++) {
+      const size_t offset = (b == current_) ? offset_ : 0;
+      const size_t start = (offset + alignment - 1) & ~(alignment - 1);
+
+      if (start + bytes <= blocks_[b].size) {
+        current_ = b;
+        offset_ = start + bytes;
+        return blocks_[b].base + start;
+      }
+    }
+
+    Block block;
+    block.size = std::max(blockBytes_, bytes + alignment);
+    block.base = (char *)sdkAlignedAlloc(block.size,
+                                         std::max(alignment, kSdkCacheLine));
+
+    if (block.base == NULL) throw std::bad_alloc();
+
+    if (block.size > blockBytes_ && block.size >= kSdkHugePage) {
+      sdkFirstTouch(block.base, block.size);
+    }
+
+    systemAllocs_++;
+    blocks_.push_back(block);
+    current_ = blocks_.size() - 1;
+    offset_ = bytes;
+    return block.base;
+  }
+
+  template <typename T>
+  T *alloc(size_t count, size_t alignment = kSdkCacheLine) {
+    return (T *)allocate(count * sizeof(T), std::max(alignment, alignof(T)));
+  }
+
+  Mark mark() const {
+    Mark m = {current_, offset_};
+    return m;
+  }
+
+  //! Frees everything allocated since m was taken.
+  void release(const Mark &m) {
+    current_ = m.block;
+    offset_ = m.offset;
+  }
+
+  //! Returns the blocks that are not in use to the system.
+  void trim() {
+    const size_t keep = (offset_ > 0 || current_ > 0) ? current_ + 1 : 0;
+
+    for (size_t b = keep; b < blocks_.size(); b++) sdkAlignedFree(blocks_[b].base);
+
+    blocks_.resize(keep);
+  }
+
+  //! Bytes reserved from the system.
+  size_t capacity() const {
+    size_t bytes = 0;
+    for (size_t b = 0; b < blocks_.size(); b++) bytes += blocks_[b].size;
+    return bytes;
+  }
+
+  //! Number of blocks ever requested from the system.
+  size_t systemAllocations() const { return systemAllocs_; }
+
+ private:
+  struct Block {
+    char *base;
+    size_t size;
+  };
+
+  SdkArena(const SdkArena &);
+  SdkArena &operator=(const SdkArena &);
+
+  size_t blockBytes_;
+  std::vector<Block> blocks_;
+  size_t current_, offset_;
+  size_t systemAllocs_;
+};
+
+//! Scratch arena of the calling thread.
+inline SdkArena &sdkHostArena() {
+  static thread_local SdkArena arena;
+  return arena;
+}
+
+//! Allocations from an arena that are released together at end of scope.
+class SdkArenaFrame {
+ public:
+  explicit SdkArenaFrame(SdkArena &arena = sdkHostArena())
+      : arena_(arena), mark_(arena.mark()) {}
+
+  ~SdkArenaFrame() { arena_.release(mark_); }
+
+  template <typename T>
+  T *alloc(size_t count, size_t alignment = kSdkCacheLine) {
+    return arena_.alloc<T>(count, alignment);
+  }
+
+ private:
+  SdkArenaFrame(const SdkArenaFrame &);
+  SdkArenaFrame &operator=(const SdkArenaFrame &);
+
+  SdkArena &arena_;
+  SdkArena::Mark mark_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Size-class pool
+////////////////////////////////////////////////////////////////////////////////
+class SdkPool {
+ public:
+  // classes of 64 bytes up to 1 GB; larger blocks are not pooled
+  static const int kMinShift = 6;
+  static const int kMaxShift = 30;
+  static const int kNumClasses = 4 * (kMaxShift - kMinShift) + 1;
+
+  SdkPool() : systemAllocs_(0) {}
+
+  ~SdkPool() { trim(); }
+
+  //! Size class of a request of bytes, -1 if it is not pooled.
+  static int sizeClass(size_t bytes) {
+    if (bytes <= ((size_t)1 << kMinShift)) return 0;
+    if (bytes > ((size_t)1 << kMaxShift)) return -1;
+
+    int shift = kMinShift;
+    while (((size_t)1 << (shift + 1)) < bytes) shift++;
+
+    // bytes is in (2^shift, 2^(shift+1)], in steps of a quarter
+    const size_t quarter = (size_t)1 << (shift - 2);
+    const int step = (int)((bytes - ((size_t)1 << shift) + quarter - 1) / quarter);
+    return 4 * (shift - kMinShift) + step;
+  }
+
+  static size_t classBytes(int c) {
+    if (c == 0) return (size_t)1 << kMinShift;
+
+    const int shift = kMinShift + (c - 1) / 4;
+    const int step = (c - 1) % 4 + 1;
+    return ((size_t)1 << shift) + step * ((size_t)1 << (shift - 2));
+  }
+
+  //! Uninitialized memory of at least bytes, 64 byte aligned; throws
+  //! std::bad_alloc if the system has none.
+  void *allocate(size_t bytes) {
+    const int c = sizeClass(bytes);
+    void *p = NULL;
+
+    if (c >= 0) {
+      std::lock_guard<std::mutex> lock(classes_[c].mutex);
+
+      if (!classes_[c].free.empty()) {
+        p = classes_[c].free.back();
+        classes_[c].free.pop_back();
+        return p;
+      }
+    }
+
+    p = sdkAlignedAlloc(c >= 0 ? classBytes(c) : bytes);
+
+    if (p == NULL) throw std::bad_alloc();
+
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    systemAllocs_++;
+    return p;
+  }
+
+  //! bytes must be the size p was allocated with.
+  void deallocate(void *p, size_t bytes) {
+    if (p == NULL) return;
+
+    const int c = sizeClass(bytes);
+
+    if (c < 0) {
+      sdkAlignedFree(p);
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(classes_[c].mutex);
+    classes_[c].free.push_back(p);
+  }
+
+  //! Returns the cached blocks to the system.
+  void trim() {
+    for (int c = 0; c < kNumClasses; c++) {
+      std::lock_guard<std::mutex> lock(classes_[c].mutex);
+
+      for (size_t i = 0; i < classes_[c].free.size(); i++) {
+        sdkAlignedFree(classes_[c].free[i]);
+      }
+
+      classes_[c].free.clear();
+    }
+  }
+
+  //! Number of blocks ever requested from the system.
+  size_t systemAllocations() {
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    return systemAllocs_;
+  }
+
+ private:
+  struct SizeClass {
+    std::mutex mutex;
+    std::vector<void *> free;
+  };
+
+  SizeClass classes_[kNumClasses];
+  std::mutex statsMutex_;
+  size_t systemAllocs_;
+};
+
+//! Process-wide pool.
+inline SdkPool &sdkHostPool() {
+  static SdkPool pool;
+  return pool;
+}
+
+//! Standard allocator on sdkHostPool().
+template <typename T>
+class SdkPoolAllocator {
+ public:
+  typedef T value_type;
+
+  SdkPoolAllocator() {}
+  template <typename U>
+  SdkPoolAllocator(const SdkPoolAllocator<U> &) {}
+
+  T *allocate(size_t n) { return (T *)sdkHostPool().allocate(n * sizeof(T)); }
+  void deallocate(T *p, size_t n) { sdkHostPool().deallocate(p, n * sizeof(T)); }
+};
+
+template <typename T, typename U>
+bool operator==(const SdkPoolAllocator<T> &, const SdkPoolAllocator<U> &) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const SdkPoolAllocator<T> &, const SdkPoolAllocator<U> &) {
+  return false;
+}
+
+template <typename T>
+using SdkPoolVector = std::vector<T, SdkPoolAllocator<T> >;
+
+#endif  // COMMON_HELPER_ARENA_H_
@@ -0,0 +1,595 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Benchmark harness for host code: registration, parameter sweeps,
+// calibrated iteration counts, robust statistics and machine readable
+// results that can be compared against a baseline.
+//
+//   static void reduceCpu(SdkBenchmarkState &state) {
+//     std::vector<int> data(state.param("n"), 1);
+//     while (state.keepRunning()) sdkDoNotOptimize(reduceCPU(...));
+//     state.setBytesProcessed(data.size() * sizeof(int));
+//   }
+//   SDK_BENCHMARK(reduceCpu)->range("n", 1 << 10, 1 << 24, 4);
+//
+//   int main(int argc, char **argv) {
+//     if (sdkBenchmarkRequested(argc, (const char **)argv))
+//       return sdkRunBenchmarks(argc, (const char **)argv);
+//     ...
+//
+// Every parameter combination of a benchmark is one case, named like
+// "reduceCpu/n=1024". A case is run once to warm up, then the number of
+// iterations per sample is grown until a sample takes at least
+// -benchmark_min_time seconds, so short functions are not dominated by
+// the timer. The case is then sampled -benchmark_repetitions times.
+// Samples outside the Tukey fences (1.5 interquartile ranges beyond the
+// quartiles) are dropped as outliers, e.g. a sample hit by a context
+// switch. The rest give the mean time per iteration and its 95%
+// confidence interval (Student's t).
+//
+// Command line, all optional besides -benchmark_cpu:
+//   -benchmark_cpu                run the registered benchmarks and exit
+//   -benchmark_filter=<text>      only the cases whose name contains text
+//   -benchmark_min_time=<s>       minimum time per sample (0.01)
+//   -benchmark_repetitions=<n>    samples per case (15)
+//   -benchmark_format=<fmt>       text, json or csv on stdout (text)
+//   -benchmark_out=<file>         also write the results, .json or .csv
+//   -benchmark_baseline=<file>    compare with results written earlier
+//   -benchmark_tolerance=<pct>    slowdown that counts as regression (5)
+// With a baseline, a case regresses if it is slower by more than the
+// tolerance and the confidence intervals do not overlap; the exit code is
+// then EXIT_FAILURE, which lets a CI job catch performance regressions.
+#ifndef COMMON_HELPER_BENCHMARK_H_
+#define COMMON_HELPER_BENCHMARK_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <helper_string.h>
+#include <helper_timer.h>
+
+//! Keeps the compiler from optimizing away the computation of value.
+template <typename T>
+inline void sdkDoNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  static const void *volatile sink;
+  sink = &value;
+#endif
+}
+
+class SdkBenchmarkState {
+ public:
+  SdkBenchmarkState(int64_t iterations,
+                    const std::vector<std::pair<std::string, int64_t> > &params)
+      : iterations_(iterations),
+        done_(0),
+        start_(0),
+        pausedNs_(0),
+        pauseStart_(0),
+        elapsedNs_(0),
+        items_(0),
+        bytes_(0),
+        params_(params) {}
+
+  //! Value of the sweep parameter called name; 0 if there is none.
+  int64_t param(const char *name) const {
+    for (size_t p = 0; p < params_.size(); p++) {
+      if (params_[p].first == name) return params_[p].second;
+    }
+
+    return 0;
+  }
+
+  int64_t iterations() const { return iterations_; }
+
+  //! Loop condition of the timed loop; the first call starts the clock and
+  //! the call after the last iteration stops it.
+  bool keepRunning() {
+    if (done_ == 0) start_ = sdkGetTimeNs();
+
+    if (done_ < iterations_) {
+      done_++;
+      return true;
+    }
+
+    elapsedNs_ = sdkGetTimeNs() - start_ - pausedNs_;
+    return false;
+  }
+
+  //! Excludes the time until resumeTiming(), e.g. to restore the input of an
+  //! in-place algorithm.
+  void pauseTiming() { pauseStart_ = sdkGetTimeNs(); }
+  void resumeTiming() { pausedNs_ += sdkGetTimeNs() - pauseStart_; }
+
+  //! Work done by one iteration, reported as throughput.
+  void setItemsProcessed(int64_t items) { items_ = items; }
+  void setBytesProcessed(int64_t bytes) { bytes_ = bytes; }
+
+  uint64_t elapsedNs() const { return elapsedNs_; }
+  int64_t items() const { return items_; }
+  int64_t bytes() const { return bytes_; }
+
+ private:
+  int64_t iterations_, done_;
+  uint64_t start_, pausedNs_, pauseStart_, elapsedNs_;
+  int64_t items_, bytes_;
+  const std::vector<std::pair<std::string, int64_t> > &params_;
+};
+
+//! A registered benchmark and its parameter sweep.
+class SdkBenchmark {
+ public:
+  typedef std::function<void(SdkBenchmarkState &)> Func;
+
+  SdkBenchmark(const char *name, Func func) : name_(name), func_(func) {}
+
+  //! Sweeps name over lo, lo*mult, ... up to hi. A geometric sequence
+  //! cannot start at 0, so lo = 0 gives 0, 1, mult, mult^2, ... Exits on
+  //! lo < 0 or mult < 2, which are mistakes in the registration.
+  SdkBenchmark *range(const char *name, int64_t lo, int64_t hi,
+                      int64_t mult = 2) {
+    if (lo < 0 || mult < 2) {
+      fprintf(stderr,
+              "Error: %s->range(\"%s\", %lld, %lld, %lld) needs lo >= 0 "
+              "and a multiplier > 1\n",
+              name_.c_str(), name, (long long)lo, (long long)hi,
+              (long long)mult);
+      exit(EXIT_FAILURE);
+    }
+
+    std::vector<int64_t> v;
+
+    if (lo == 0 && hi >= 0) v.push_back(0);
+
+    for (int64_t x = std::max<int64_t>(lo, 1); x <= hi; x *= mult) {
+      v.push_back(x);
+
+      if (x > hi / mult) break;  // the next step would pass hi or overflow
+    }
+
+    return values(name, v);
+  }
+
+  SdkBenchmark *values(const char *name, const std::vector<int64_t> &v) {
+    sweeps_.push_back(std::make_pair(std::string(name), v));
+    return this;
+  }
+
+  typedef std::vector<std::pair<std::string, int64_t> > Params;
+
+  //! All combinations of the sweeps, the last one varying fastest.
+  std::vector<Params> cases() const {
+    std::vector<Params> all(1);
+
+    for (size_t s = 0; s < sweeps_.size(); s++) {
+      std::vector<Params> next;
+
+      for (size_t c = 0; c < all.size(); c++) {
+        for (size_t v = 0; v < sweeps_[s].second.size(); v++) {
+          next.push_back(all[c]);
+          next.back().push_back(std::make_pair(sweeps_[s].first,
+                                               sweeps_[s].second[v]));
+        }
+      }
+
+      all.swap(next);
+    }
+
+    return all;
+  }
+
+  std::string caseName(const Params &params) const {
+    std::string name = name_;
+
+    for (size_t p = 0; p < params.size(); p++) {
+      char value[32];
+      snprintf(value, sizeof(value), "%lld", (long long)params[p].second);
+      name += "/" + params[p].first + "=" + value;
+    }
+
+    return name;
+  }
+
+  const Func &func() const { return func_; }
+
+ private:
+  std::string name_;
+  Func func_;
+  std::vector<std::pair<std::string, std::vector<int64_t> > > sweeps_;
+};
+
+inline std::vector<SdkBenchmark *> &sdkBenchmarkRegistry() {
+  static std::vector<SdkBenchmark *> registry;
+  return registry;
+}
+
+inline SdkBenchmark *sdkRegisterBenchmark(const char *name,
+                                          SdkBenchmark::Func func) {
+  sdkBenchmarkRegistry().push_back(new SdkBenchmark(name, func));
+  return sdkBenchmarkRegistry().back();
+}
+
+#define SDK_BENCHMARK_CONCAT2(a, b) a##b
+#define SDK_BENCHMARK_CONCAT(a, b) SDK_BENCHMARK_CONCAT2(a, b)
+
+//! Registers func(SdkBenchmarkState &) under its own name; the result can
+//! be followed by ->range(...) or ->values(...).
+#define SDK_BENCHMARK(func)                                          \
+  static SdkBenchmark *SDK_BENCHMARK_CONCAT(sdkBenchmark, __LINE__) = \
+      sdkRegisterBenchmark(#func, func)
+
+//! Statistics of one case, times per iteration in ns.
+struct SdkBenchmarkResult {
+  std::string name;
+  int64_t iterations;
+  int samples, rejected;
+  double mean, median, stddev, ci95, min, max;
+  double itemsPerSecond, bytesPerSecond;
+};
+
+//! Two-sided 95% quantile of Student's t distribution.
+inline double sdkStudentT95(int dof) {
+  static const double t[30] = {
+      12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+      2.201,  2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+      2.080,  2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+  if (dof < 1) return 0.0;
+  return dof <= 30 ? t[dof - 1] : 1.96;
+}
+
+//! Quantile q of sorted x, interpolated linearly.
+inline double sdkQuantile(const std::vector<double> &x, double q) {
+  const double pos = q * (x.size() - 1);
+  const size_t i = (size_t)pos;
+  if (i + 1 >= x.size()) return x.back();
+  return x[i] + (pos - i) * (x[i + 1] - x[i]);
+}
+
+//! Reduces per-iteration sample times to robust statistics.
+inline void sdkBenchmarkStatistics(std::vector<double> samples,
+                                   SdkBenchmarkResult &r) {
+  std::sort(samples.begin(), samples.end());
+  r.min = samples.front();
+  r.max = samples.back();
+
+  // Tukey fences
+  const double q1 = sdkQuantile(samples, 0.25), q3 = sdkQuantile(samples, 0.75);
+  const double lo = q1 - 1.5 * (q3 - q1), hi = q3 + 1.5 * (q3 - q1);
+  std::vector<double> kept;
+
+  for (size_t i = 0; i < samples.size(); i++) {
+    if (samples[i] >= lo && samples[i] <= hi) kept.push_back(samples[i]);
+  }
+
+  r.samples = (int)kept.size();
+  r.rejected = (int)(samples.size() - kept.size());
+  r.median = sdkQuantile(kept, 0.5);
+  r.mean = 0.0;
+
+  for (size_t i = 0; i < kept.size(); i++) r.mean += kept[i];
+  r.mean /= kept.size();
+
+  double var = 0.0;
+  for (size_t i = 0; i < kept.size(); i++) {
+    var += (kept[i] - r.mean) * (kept[i] - r.mean);
+  }
+
+  const int n = (int)kept.size();
+  r.stddev = n > 1 ? sqrt(var / (n - 1)) : 0.0;
+  r.ci95 = n > 1 ? sdkStudentT95(n - 1) * r.stddev / sqrt((double)n) : 0.0;
+}
+
+//! Warms up, calibrates and samples one case.
+inline SdkBenchmarkResult sdkRunBenchmarkCase(const SdkBenchmark &bench,
+                                              const SdkBenchmark::Params &params,
+                                              double minTime, int repetitions) {
+  const uint64_t minNs = (uint64_t)(minTime * 1e9);
+  int64_t iterations = 1;
+  SdkBenchmarkResult r;
+  r.name = bench.caseName(params);
+
+  {
+    SdkBenchmarkState warmup(1, params);
+    bench.func()(warmup);
+  }
+
+  // grow the batch until it takes minTime, by at most 10x per step
+  for (;;) {
+    SdkBenchmarkState state(iterations, params);
+    bench.func()(state);
+    const uint64_t ns = std::max<uint64_t>(state.elapsedNs(), 1);
+
+    if (ns >= minNs || iterations >= ((int64_t)1 << 40)) break;
+
+    const double grow = std::min(10.0, std::max(1.5, 1.2 * minNs / ns));
+    iterations = (int64_t)ceil(iterations * grow);
+  }
+
+  std::vector<double> samples;
+  int64_t items = 0, bytes = 0;
+
+  for (int s = 0; s < std::max(repetitions, 1); s++) {
+    SdkBenchmarkState state(iterations, params);
+    bench.func()(state);
+    samples.push_back((double)state.elapsedNs() / iterations);
+    items = state.items();
+    bytes = state.bytes();
+  }
+
+  r.iterations = iterations;
+  sdkBenchmarkStatistics(samples, r);
+  r.itemsPerSecond = items > 0 ? items * 1e9 / r.mean : 0.0;
+  r.bytesPerSecond = bytes > 0 ? bytes * 1e9 / r.mean : 0.0;
+  return r;
+}
+
+inline void sdkWriteBenchmarkText(FILE *out,
+                                  const std::vector<SdkBenchmarkResult> &res) {
+  fprintf(out, "%-44s %12s %12s %10s %9s %8s %14s\n", "Benchmark", "mean ns",
+          "median ns", "+/- 95%", "iters", "outliers", "throughput");
+
+  for (size_t i = 0; i < res.size(); i++) {
+    const SdkBenchmarkResult &r = res[i];
+    char throughput[32] = "";
+
+    if (r.bytesPerSecond > 0) {
+      snprintf(throughput, sizeof(throughput), "%.4f GB/s",
+               r.bytesPerSecond * 1e-9);
+    } else if (r.itemsPerSecond > 0) {
+      snprintf(throughput, sizeof(throughput), "%.4f G/s",
+               r.itemsPerSecond * 1e-9);
+    }
+
+    fprintf(out, "%-44s %12.1f %12.1f %9.2f%% %9lld %5d/%-2d %14s\n",
+            r.name.c_str(), r.mean, r.median, 100.0 * r.ci95 / r.mean,
+            (long long)r.iterations, r.rejected, r.samples + r.rejected,
+            throughput);
+  }
+}
+
+//! One benchmark object per line, which sdkReadBenchmarkBaseline() relies
+//! on.
+inline void sdkWriteBenchmarkJson(FILE *out,
+                                  const std::vector<SdkBenchmarkResult> &res,
+                                  double minTime, int repetitions) {
+  fprintf(out, "{\n\"context\": {\"host_threads\": %u, \"min_time\": %g, "
+          "\"repetitions\": %d},\n\"benchmarks\": [\n",
+          std::thread::hardware_concurrency(), minTime, repetitions);
+
+  for (size_t i = 0; i < res.size(); i++) {
+    const SdkBenchmarkResult &r = res[i];
+    fprintf(out, "{\"name\": \"%s\", \"iterations\": %lld, \"samples\": %d, "
+            "\"rejected\": %d, \"mean_ns\": %.3f, \"median_ns\": %.3f, "
+            "\"stddev_ns\": %.3f, \"ci95_ns\": %.3f, \"min_ns\": %.3f, "
+            "\"max_ns\": %.3f, \"items_per_second\": %.6g, "
+            "\"bytes_per_second\": %.6g}%s\n",
+            r.name.c_str(), (long long)r.iterations, r.samples, r.rejected,
+            r.mean, r.median, r.stddev, r.ci95, r.min, r.max, r.itemsPerSecond,
+            r.bytesPerSecond, i + 1 < res.size() ? "," : "");
+  }
+
+  fprintf(out, "]\n}\n");
+}
+
+inline void sdkWriteBenchmarkCsv(FILE *out,
+                                 const std::vector<SdkBenchmarkResult> &res) {
+  fprintf(out, "name,iterations,samples,rejected,mean_ns,median_ns,stddev_ns,"
+          "ci95_ns,min_ns,max_ns,items_per_second,bytes_per_second\n");
+
+  for (size_t i = 0; i < res.size(); i++) {
+    const SdkBenchmarkResult &r = res[i];
+    fprintf(out, "%s,%lld,%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.6g,%.6g\n",
+            r.name.c_str(), (long long)r.iterations, r.samples, r.rejected,
+            r.mean, r.median, r.stddev, r.ci95, r.min, r.max, r.itemsPerSecond,
+            r.bytesPerSecond);
+  }
+}
+
+//! True if path ends in .csv, otherwise results are JSON.
+inline bool sdkBenchmarkIsCsv(const char *path) {
+  const size_t len = strlen(path);
+  return len > 4 && !STRCASECMP(path + len - 4, ".csv");
+}
+
+//! Reads mean and ci95 per case from a file written by -benchmark_out.
+inline bool sdkReadBenchmarkBaseline(
+    const char *path, std::map<std::string, std::pair<double, double> > &base) {
+  FILE *in = fopen(path, "r");
+
+  if (in == NULL) return false;
+
+  const bool csv = sdkBenchmarkIsCsv(path);
+  char line[4096];
+
+  while (fgets(line, sizeof(line), in) != NULL) {
+    const char *name = strstr(line, "\"name\": \"");
+
+    if (!csv && name != NULL) {
+      name += 9;
+      const char *nameEnd = strchr(name, '"');
+      const char *mean = strstr(line, "\"mean_ns\": ");
+      const char *ci = strstr(line, "\"ci95_ns\": ");
+
+      if (nameEnd != NULL && mean != NULL && ci != NULL) {
+        base[std::string(name, nameEnd)] =
+            std::make_pair(atof(mean + 11), atof(ci + 11));
+      }
+    } else if (csv && strncmp(line, "name,", 5) != 0) {
+      // name,iterations,samples,rejected,mean_ns,median_ns,stddev_ns,ci95_ns
+      std::vector<std::string> field;
+      const char *f = line;
+
+      for (const char *c = line;; c++) {
+        if (*c == ',' || *c == '\n' || *c == '\0') {
+          field.push_back(std::string(f, c));
+          f = c + 1;
+          if (*c != ',') break;
+        }
+      }
+
+      if (field.size() >= 8) {
+        base[field[0]] =
+            std::make_pair(atof(field[4].c_str()), atof(field[7].c_str()));
+      }
+    }
+  }
+
+  fclose(in);
+  return true;
+}
+
+//! Prints the change of every case against the baseline. Returns the number
+//! of regressions.
+inline int sdkCompareBenchmarks(
+    FILE *out, const std::vector<SdkBenchmarkResult> &res,
+    const std::map<std::string, std::pair<double, double> > &base,
+    double tolerance) {
+  int regressions = 0;
+  fprintf(out, "\n%-44s %12s %12s %9s\n", "Benchmark vs baseline", "base ns",
+         "current ns", "change");
+
+  for (size_t i = 0; i < res.size(); i++) {
+    const SdkBenchmarkResult &r = res[i];
+    std::map<std::string, std::pair<double, double> >::const_iterator b =
+        base.find(r.name);
+
+    if (b == base.end()) {
+      fprintf(out, "%-44s %12s %12.1f %9s\n", r.name.c_str(), "-", r.mean, "new");
+      continue;
+    }
+
+    const double baseMean = b->second.first, baseCi = b->second.second;
+    const double change = (r.mean - baseMean) / baseMean;
+    const bool slower = r.mean - r.ci95 > baseMean + baseCi;
+    const bool faster = r.mean + r.ci95 < baseMean - baseCi;
+    const char *verdict = "";
+
+    if (slower && change > tolerance) {
+      verdict = "REGRESSION";
+      regressions++;
+    } else if (faster && -change > tolerance) {
+      verdict = "improved";
+    }
+
+    fprintf(out, "%-44s %12.1f %12.1f %+8.2f%% %s\n", r.name.c_str(),
+            baseMean, r.mean, 100.0 * change, verdict);
+  }
+
+  fprintf(out, "%d regression(s) beyond %.1f%%\n", regressions,
+          100.0 * tolerance);
+  return regressions;
+}
+
+//! True if the command line asks for the registered benchmarks.
+inline bool sdkBenchmarkRequested(int argc, const char **argv) {
+  return checkCmdLineFlag(argc, argv, "benchmark_cpu");
+}
+
+//! Runs the registered benchmarks as configured on the command line.
+//! Returns EXIT_SUCCESS, or EXIT_FAILURE on a regression or I/O error.
+inline int sdkRunBenchmarks(int argc, const char **argv) {
+  char *filter = NULL, *format = NULL, *outPath = NULL, *basePath = NULL;
+  double minTime = 0.01, tolerance = 0.05;
+  int repetitions = 15;
+
+  getCmdLineArgumentString(argc, argv, "benchmark_filter", &filter);
+  getCmdLineArgumentString(argc, argv, "benchmark_format", &format);
+  getCmdLineArgumentString(argc, argv, "benchmark_out", &outPath);
+  getCmdLineArgumentString(argc, argv, "benchmark_baseline", &basePath);
+
+  if (checkCmdLineFlag(argc, argv, "benchmark_min_time")) {
+    minTime = getCmdLineArgumentFloat(argc, argv, "benchmark_min_time");
+  }
+
+  if (checkCmdLineFlag(argc, argv, "benchmark_repetitions")) {
+    repetitions = getCmdLineArgumentInt(argc, argv, "benchmark_repetitions");
+  }
+
+  if (checkCmdLineFlag(argc, argv, "benchmark_tolerance")) {
+    tolerance = 0.01 * getCmdLineArgumentFloat(argc, argv, "benchmark_tolerance");
+  }
+
+  std::vector<SdkBenchmarkResult> results;
+  const std::vector<SdkBenchmark *> &registry = sdkBenchmarkRegistry();
+
+  for (size_t b = 0; b < registry.size(); b++) {
+    const std::vector<SdkBenchmark::Params> cases = registry[b]->cases();
+
+    for (size_t c = 0; c < cases.size(); c++) {
+      if (filter != NULL &&
+          registry[b]->caseName(cases[c]).find(filter) == std::string::npos) {
+        continue;
+      }
+
+      results.push_back(
+          sdkRunBenchmarkCase(*registry[b], cases[c], minTime, repetitions));
+    }
+  }
+
+  const bool text = format == NULL || !STRCASECMP(format, "text");
+
+  if (format != NULL && !STRCASECMP(format, "json")) {
+    sdkWriteBenchmarkJson(stdout, results, minTime, repetitions);
+  } else if (format != NULL && !STRCASECMP(format, "csv")) {
+    sdkWriteBenchmarkCsv(stdout, results);
+  } else {
+    sdkWriteBenchmarkText(stdout, results);
+  }
+
+  if (outPath != NULL) {
+    FILE *out = fopen(outPath, "w");
+
+    if (out == NULL) {
+      fprintf(stderr, "Error: cannot write %s\n", outPath);
+      return EXIT_FAILURE;
+    }
+
+    if (sdkBenchmarkIsCsv(outPath)) {
+      sdkWriteBenchmarkCsv(out, results);
+    } else {
+      sdkWriteBenchmarkJson(out, results, minTime, repetitions);
+    }
+
+    fclose(out);
+  }
+
+  if (basePath != NULL) {
+    std::map<std::string, std::pair<double, double> > base;
+
+    if (!sdkReadBenchmarkBaseline(basePath, base)) {
+      fprintf(stderr, "Error: cannot read baseline %s\n", basePath);
+      return EXIT_FAILURE;
+    }
+
+    // keeps stdout machine readable for json and csv
+    if (sdkCompareBenchmarks(text ? stdout : stderr, results, base,
+                             tolerance) > 0) {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
+
+#endif  // COMMON_HELPER_BENCHMARK_H_
@@ -0,0 +1,366 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Host Canny edge detector for 8-bit images, the counterpart of
+// nppiFilterCannyBorder_8u_C1R with a 3x3 Sobel gradient.
+//
+// The gradient and non-maximum suppression run in parallel bands of about
+// kSdkCannyTileBytes of source. Within a band the rows stream through small
+// rings, so the intermediate rows stay in cache:
+//  - each source row is read once through the border mode and filtered
+//    horizontally with the derivative and the smoothing kernel of the Sobel
+//    operator, optionally convolved with a Gaussian,
+//  - the vertical pass turns those rows into gradient magnitudes (L1 or L2
+//    norm) and a direction sector, so smoothing and Sobel are one pass,
+//  - non-maximum suppression evaluates all four directions with branch-free
+//    loads from the rows above and below, which vectorizes, and selects by
+//    sector; survivors above the low threshold are candidates, those above
+//    the high one strong.
+// Hysteresis does not trace edges from a stack: candidate pixels are
+// labelled with the band-parallel union-find of helper_labeling.h and a
+// component becomes an edge if it holds a strong pixel.
+//
+// As for the NPP border functions, src points at the ROI inside a source
+// image of srcWidth x srcHeight pixels that starts srcOffsetX/Y pixels
+// before it; pixels outside the source image come from the border mode.
+#ifndef COMMON_HELPER_CANNY_H_
+#define COMMON_HELPER_CANNY_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <helper_arena.h>
+#include <helper_labeling.h>
+#include <helper_parallel.h>
+
+//! Border modes, as NppiBorderType.
+enum SdkBorderType {
+  kSdkBorderConstant,   //!< pixels outside the image are borderValue
+  kSdkBorderReplicate,  //!< the nearest edge pixel is repeated
+  kSdkBorderMirror      //!< reflected about the edge pixel, not repeating it
+};
+
+// source bytes per band
+static const size_t kSdkCannyTileBytes = 256 << 10;
+
+//! Canny parameters. The thresholds compare with the gradient magnitude of
+//! the 3x3 Sobel operator, as nLowThreshold / nHighThreshold do.
+struct SdkCannyParams {
+  int lowThreshold;
+  int highThreshold;
+  bool l2Norm;          //!< sqrt(gx^2 + gy^2) rather than |gx| + |gy|
+  int border;           //!< SdkBorderType
+  uint8_t borderValue;  //!< for kSdkBorderConstant
+  float sigma;          //!< Gaussian pre-smoothing, 0 for none (as NPP)
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Internal helpers
+////////////////////////////////////////////////////////////////////////////////
+class SdkCanny {
+ public:
+  SdkCanny(const uint8_t *src, size_t srcPitch, int srcWidth, int srcHeight,
+           int srcOffsetX, int srcOffsetY, int width, int height,
+           const SdkCannyParams &params)
+      : src_(src),
+        srcPitch_(srcPitch),
+        srcWidth_(srcWidth),
+        srcHeight_(srcHeight),
+        offsetX_(srcOffsetX),
+        offsetY_(srcOffsetY),
+        width_(width),
+        height_(height),
+        params_(params) {
+    // Sobel: derivative [-1 0 1] across, smoothing [1 2 1] along
+    float gauss[64];
+    int g = 0;
+
+    if (params.sigma > 0.0f) {
+      g = std::min(30, (int)ceilf(3.0f * params.sigma));
+      float sum = 0.0f;
+
+      for (int k = -g; k <= g; k++) {
+        gauss[k + g] = expf(-0.5f * k * k / (params.sigma * params.sigma));
+        sum += gauss[k + g];
+      }
+
+      for (int k = 0; k <= 2 * g; k++) gauss[k] /= sum;
+    } else {
+      gauss[0] = 1.0f;
+    }
+
+    const float derivative[3] = {-1.0f, 0.0f, 1.0f};
+    const float smoothing[3] = {1.0f, 2.0f, 1.0f};
+    radius_ = g + 1;
+    deriv_.assign(2 * radius_ + 1, 0.0f);
+    smooth_.assign(2 * radius_ + 1, 0.0f);
+
+    for (int i = 0; i < 3; i++) {
+      for (int k = 0; k <= 2 * g; k++) {
+        deriv_[i + k] += derivative[i] * gauss[k];
+        smooth_[i + k] += smoothing[i] * gauss[k];
+      }
+    }
+  }
+
+  //! Writes 255 for edge pixels and 0 elsewhere.
+  void run(uint8_t *dst, size_t dstPitch) {
+    const size_t n = (size_t)width_ * height_;
+    SdkPoolVector<uint8_t> candidate(n), strong(n);
+    SdkPoolVector<uint32_t> labels(n);
+
+    // each band streams about a tile of source rows
+    const int bandRows =
+        std::max(2 * radius_ + 2, (int)(kSdkCannyTileBytes / width_));
+
+    sdkParallelFor(0, height_, bandRows, [&](int64_t b, int64_t e, int) {
+      for (int64_t y = b; y < e; y += bandRows) {
+        suppressBand((int)y, (int)std::min<int64_t>(e, y + bandRows),
+                     &candidate[0], &strong[0]);
+      }
+    });
+
+    // hysteresis: candidate components that hold a strong pixel are edges
+    sdkLabelMarkersUF(&candidate[0], width_, &labels[0],
+                      width_ * sizeof(uint32_t), width_, height_, 8);
+
+    std::vector<std::atomic<uint8_t>, SdkPoolAllocator<std::atomic<uint8_t> > >
+        hasStrong(n);
+    const int64_t grain = std::max(1, (1 << 16) / width_);
+
+    sdkParallelFor(0, height_, grain, [&](int64_t b, int64_t e, int) {
+      for (size_t i = (size_t)b * width_; i < (size_t)e * width_; i++) {
+        if (strong[i]) hasStrong[labels[i]].store(1, std::memory_order_relaxed);
+      }
+    });
+
+    sdkParallelFor(0, height_, grain, [&](int64_t b, int64_t e, int) {
+      for (int64_t y = b; y < e; y++) {
+        uint8_t *d = dst + y * dstPitch;
+        const size_t row = (size_t)y * width_;
+
+        for (int x = 0; x < width_; x++) {
+          const bool edge =
+              candidate[row + x] &&
+              hasStrong[labels[row + x]].load(std::memory_order_relaxed);
+          d[x] = edge ? 255 : 0;
+        }
+      }
+    });
+  }
+
+ private:
+  // Source coordinate c of an image of size n through the border mode, -1
+  // for the constant border.
+  int borderIndex(int c, int n) const {
+    if (c >= 0 && c < n) return c;
+
+    if (params_.border == kSdkBorderConstant) return -1;
+
+    if (params_.border == kSdkBorderReplicate || n == 1) {
+      return std::min(std::max(c, 0), n - 1);
+    }
+
+    const int period = 2 * (n - 1);
+    c = ((c % period) + period) % period;
+    return (c < n) ? c : period - c;
+  }
+
+  // ROI row y and columns [-r, width + r) of the source, as floats.
+  void loadRow(int y, int r, float *row) const {
+    const int sy = borderIndex(offsetY_ + y, srcHeight_);
+    const uint8_t *s =
+        (sy < 0) ? NULL
+                 : src_ + (ptrdiff_t)(sy - offsetY_) * (ptrdiff_t)srcPitch_ -
+                       offsetX_;
+
+    if (s == NULL) {
+      std::fill(row, row + width_ + 2 * r, (float)params_.borderValue);
+      return;
+    }
+
+    // columns inside the source image are converted directly
+    const int inner0 = std::min(width_ + r, std::max(-r, -offsetX_));
+    const int inner1 =
+        std::max(inner0, std::min(width_ + r, srcWidth_ - offsetX_));
+
+    for (int x = inner0; x < inner1; x++) row[x + r] = s[offsetX_ + x];
+
+    for (int x = -r; x < inner0; x++) {
+      const int sx = borderIndex(offsetX_ + x, srcWidth_);
+      row[x + r] = (sx < 0) ? params_.borderValue : (float)s[sx];
+    }
+
+    for (int x = inner1; x < width_ + r; x++) {
+      const int sx = borderIndex(offsetX_ + x, srcWidth_);
+      row[x + r] = (sx < 0) ? params_.borderValue : (float)s[sx];
+    }
+  }
+
+  // Horizontal pass of ROI row y, columns [-1, width]: derivative and
+  // smoothing kernels. The taps are the outer loop so the row loops
+  // vectorize.
+  void filterRow(int y, float *line, float *d, float *s) const {
+    const int r = radius_;
+    const int w = width_ + 2;
+    loadRow(y, r + 1, line);
+    std::fill(d, d + w, 0.0f);
+    std::fill(s, s + w, 0.0f);
+
+    for (int t = 0; t <= 2 * r; t++) {
+      const float cd = deriv_[t], cs = smooth_[t];
+      const float *l = line + t;
+
+      for (int x = 0; x < w; x++) {
+        d[x] += cd * l[x];
+        s[x] += cs * l[x];
+      }
+    }
+  }
+
+  // Vertical pass over the 2r + 1 filtered rows centred on a gradient row:
+  // gx smooths the horizontal derivative, gy differentiates the horizontal
+  // smoothing. Writes the magnitude and the direction sector.
+  void gradientRow(const float *const *d, const float *const *s, float *gx,
+                   float *gy, float *m, uint8_t *sec) const {
+    const int w = width_ + 2;
+    const float tan22 = 0.41421356f, tan67 = 2.41421356f;
+    std::fill(gx, gx + w, 0.0f);
+    std::fill(gy, gy + w, 0.0f);
+
+    for (int t = 0; t <= 2 * radius_; t++) {
+      const float cs = smooth_[t], cd = deriv_[t];
+      const float *dt = d[t];
+      const float *st = s[t];
+
+      for (int x = 0; x < w; x++) {
+        gx[x] += cs * dt[x];
+        gy[x] += cd * st[x];
+      }
+    }
+
+    if (params_.l2Norm) {
+      for (int x = 0; x < w; x++) m[x] = sqrtf(gx[x] * gx[x] + gy[x] * gy[x]);
+    } else {
+      for (int x = 0; x < w; x++) m[x] = fabsf(gx[x]) + fabsf(gy[x]);
+    }
+
+    // 0: across (horizontal gradient), 1: along, 2: \ diagonal, 3: /
+    for (int x = 0; x < w; x++) {
+      const float ax = fabsf(gx[x]), ay = fabsf(gy[x]);
+      const uint8_t diagonal = (gx[x] * gy[x] > 0.0f) ? 2 : 3;
+      const uint8_t steep = (ay >= ax * tan67) ? 1 : diagonal;
+      sec[x] = (ay <= ax * tan22) ? 0 : steep;
+    }
+  }
+
+  // Non-maximum suppression of one row from the magnitudes of the rows
+  // above, at and below it, all four directions evaluated without branches.
+  void suppressRow(const float *up, const float *mid, const float *down,
+                   const uint8_t *sec, uint8_t *c, uint8_t *s) const {
+    const float low = (float)params_.lowThreshold;
+    const float high = (float)params_.highThreshold;
+    sec++;
+
+    for (int x = 0; x < width_; x++) {
+      const float v = mid[x + 1];
+      const uint8_t across = (v > mid[x]) & (v >= mid[x + 2]);
+      const uint8_t along = (v > up[x + 1]) & (v >= down[x + 1]);
+      const uint8_t back = (v > up[x]) & (v >= down[x + 2]);
+      const uint8_t forward = (v > up[x + 2]) & (v >= down[x]);
+      const uint8_t t = sec[x];
+      const uint8_t keep = (uint8_t)(((t == 0) & across) | ((t == 1) & along) |
+                                     ((t == 2) & back) | ((t == 3) & forward));
+
+      c[x] = keep & (v > low);
+      s[x] = keep & (v > high);
+    }
+  }
+
+  // Gradient and non-maximum suppression for ROI rows [y0, y1). The rows
+  // stream through rings: 2r + 1 filtered source rows and 3 gradient rows,
+  // so the working set stays in cache whatever the band height.
+  void suppressBand(int y0, int y1, uint8_t *candidate, uint8_t *strong) {
+    const int r = radius_;
+    const int taps = 2 * r + 1;
+    const int w = width_ + 2;
+    SdkArenaFrame frame;
+    float *line = frame.alloc<float>(width_ + 2 + 2 * r);
+    float *hDeriv = frame.alloc<float>((size_t)taps * w);
+    float *hSmooth = frame.alloc<float>((size_t)taps * w);
+    float *gx = frame.alloc<float>(w);
+    float *gy = frame.alloc<float>(w);
+    float *mag = frame.alloc<float>((size_t)3 * w);
+    uint8_t *sector = frame.alloc<uint8_t>((size_t)3 * w);
+    const float *d[64];
+    const float *s[64];
+
+    // filtered rows [y0 - 1 - r, y0 - 1 + r) before the first gradient row
+    for (int y = y0 - 1 - r; y < y0 - 1 + r; y++) {
+      const int k = (y - (y0 - 1 - r)) % taps;
+      filterRow(y, line, hDeriv + (size_t)k * w, hSmooth + (size_t)k * w);
+    }
+
+    // gradient rows [y0 - 1, y1], each completing the suppression of the
+    // row before it
+    for (int g = y0 - 1; g <= y1; g++) {
+      const int first = g - r - (y0 - 1 - r);
+      const int k = (first + 2 * r) % taps;
+      filterRow(g + r, line, hDeriv + (size_t)k * w, hSmooth + (size_t)k * w);
+
+      for (int t = 0; t < taps; t++) {
+        d[t] = hDeriv + (size_t)((first + t) % taps) * w;
+        s[t] = hSmooth + (size_t)((first + t) % taps) * w;
+      }
+
+      const int j = (g - y0 + 1) % 3;
+      gradientRow(d, s, gx, gy, mag + (size_t)j * w, sector + (size_t)j * w);
+
+      if (g < y0 + 1) continue;
+
+      const int y = g - 1;
+      suppressRow(mag + (size_t)((j + 1) % 3) * w, mag + (size_t)((j + 2) % 3) * w,
+                  mag + (size_t)j * w, sector + (size_t)((j + 2) % 3) * w,
+                  candidate + (size_t)y * width_, strong + (size_t)y * width_);
+    }
+  }
+
+  const uint8_t *src_;
+  size_t srcPitch_;
+  int srcWidth_, srcHeight_;
+  int offsetX_, offsetY_;
+  int width_, height_;
+  SdkCannyParams params_;
+  int radius_;
+  std::vector<float> deriv_, smooth_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Canny edges of the width x height ROI at src into dst (255 / 0).
+////////////////////////////////////////////////////////////////////////////////
+inline void sdkFilterCannyBorder(const uint8_t *src, size_t srcPitch,
+                                 int srcWidth, int srcHeight, int srcOffsetX,
+                                 int srcOffsetY, uint8_t *dst, size_t dstPitch,
+                                 int width, int height,
+                                 const SdkCannyParams &params) {
+  if (width <= 0 || height <= 0) return;
+
+  SdkCanny canny(src, srcPitch, srcWidth, srcHeight, srcOffsetX, srcOffsetY,
+                 width, height, params);
+  canny.run(dst, dstPitch);
+}
+
+#endif  // COMMON_HELPER_CANNY_H_
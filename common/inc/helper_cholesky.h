@@ -0,0 +1,772 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Multithreaded supernodal sparse Cholesky factorization A = L*L^T on the
+// host, for symmetric positive definite matrices in CSR format.
+//
+// The work is split the same way as the cusolverSp low level csrchol API:
+//  - SupernodalSymbolic::analyze() depends on the nonzero pattern only. It
+//    orders A with a fill-reducing permutation (AMD from helper_reorder.h
+//    unless one is given), computes the elimination tree, postorders it,
+//    counts the columns of L, groups columns into relaxed supernodes and
+//    builds the row structure of every supernode together with the index
+//    maps used by the numeric phase. One analysis serves any number of
+//    matrices with the same pattern.
+//  - SupernodalCholesky::factor() is multifrontal. Every supernode assembles
+//    its front from A and the update matrices of its children, then makes a
+//    partial dense factorization: a blocked POTRF of the diagonal block, a
+//    TRSM of the rows below it and a SYRK that forms its own update matrix.
+//    The dense kernels work on column tiles with a register blocked GEMM.
+//  - Parallelism comes from the supernodal elimination tree: every supernode
+//    is a task on the helper_threadpool.h pool, the leaves start at once
+//    and a parent is spawned when its last child is done. Near the root the tree runs out of parallelism but
+//    the fronts get large, so the few supernodes whose subtree holds a
+//    sizeable share of the flops are factorized afterwards one at a time,
+//    each with multithreaded dense kernels.
+// Only the lower triangle of A (column <= row) is read, like csrchol.
+#ifndef COMMON_HELPER_CHOLESKY_H_
+#define COMMON_HELPER_CHOLESKY_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <vector>
+
+#include <helper_parallel.h>
+#include <helper_reorder.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Dense kernels on column-major blocks
+////////////////////////////////////////////////////////////////////////////////
+
+// columns per tile of the blocked kernels, and the row and depth blocking of
+// the GEMM that keeps an A panel in L2
+static const int kCholTile = 64;
+static const int kCholRowBlock = 128;
+static const int kCholDepthBlock = 128;
+
+//! C(0:m, 0:n) -= A(0:m, 0:k) * B(0:n, 0:k)^T
+inline void cholGemmNT(int m, int n, int k, const double *A, int lda,
+                       const double *B, int ldb, double *C, int ldc) {
+  for (int i0 = 0; i0 < m; i0 += kCholRowBlock) {
+    const int i1 = std::min(m, i0 + kCholRowBlock);
+
+    for (int p0 = 0; p0 < k; p0 += kCholDepthBlock) {
+      const int p1 = std::min(k, p0 + kCholDepthBlock);
+      int j = 0;
+
+      // four columns of C share every load of A
+      for (; j + 4 <= n; j += 4) {
+        double *c0 = C + (size_t)j * ldc, *c1 = c0 + ldc;
+        double *c2 = c1 + ldc, *c3 = c2 + ldc;
+
+        for (int p = p0; p < p1; p++) {
+          const double *a = A + (size_t)p * lda;
+          const double *b = B + (size_t)p * ldb + j;
+          const double b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3];
+
+          for (int i = i0; i < i1; i++) {
+            const double ai = a[i];
+            c0[i] -= ai * b0;
+            c1[i] -= ai * b1;
+            c2[i] -= ai * b2;
+            c3[i] -= ai * b3;
+          }
+        }
+      }
+
+      for (; j < n; j++) {
+        double *c = C + (size_t)j * ldc;
+
+        for (int p = p0; p < p1; p++) {
+          const double *a = A + (size_t)p * lda;
+          const double b = B[(size_t)p * ldb + j];
+          for (int i = i0; i < i1; i++) c[i] -= a[i] * b;
+        }
+      }
+    }
+  }
+}
+
+//! Lower triangle of C(0:n, 0:n) -= A(0:n, 0:k) * A(0:n, 0:k)^T
+inline void cholSyrkTile(int n, int k, const double *A, int lda, double *C,
+                         int ldc) {
+  for (int j = 0; j < n; j++) {
+    double *c = C + (size_t)j * ldc;
+
+    for (int p = 0; p < k; p++) {
+      const double *a = A + (size_t)p * lda;
+      const double b = a[j];
+      for (int i = j; i < n; i++) c[i] -= a[i] * b;
+    }
+  }
+}
+
+//! Lower trapezoid update C(i, j) -= sum_p A(i, p) * A(j, p) for
+//! 0 <= j < n, j <= i < m: a SYRK on the top n rows and a GEMM below them.
+//! The parallel version splits the (column tile, row block) pairs between
+//! threads.
+inline void cholUpdate(int m, int n, int k, const double *A, int lda,
+                       double *C, int ldc, bool parallel) {
+  if (m <= 0 || n <= 0 || k <= 0) return;
+
+  // rows [rb, re) of column tile j0; the first block holds the triangle
+  auto block = [&](int j0, int rb, int re) {
+    const int jn = std::min(kCholTile, n - j0);
+    double *c = C + (size_t)j0 * ldc;
+
+    if (rb == j0) {
+      cholSyrkTile(jn, k, A + j0, lda, c + j0, ldc);
+      rb = j0 + jn;
+    }
+
+    if (re > rb) cholGemmNT(re - rb, jn, k, A + rb, lda, A + j0, lda, c + rb, ldc);
+  };
+
+  if (!parallel) {
+    for (int j0 = 0; j0 < n; j0 += kCholTile) block(j0, j0, m);
+    return;
+  }
+
+  const int rowBlock = 4 * kCholRowBlock;
+  std::vector<int> tasks;
+
+  for (int j0 = 0; j0 < n; j0 += kCholTile) {
+    for (int rb = j0; rb < m; rb += rowBlock) {
+      tasks.push_back(j0);
+      tasks.push_back(rb);
+    }
+  }
+
+  sdkParallelFor(0, (int64_t)tasks.size() / 2, 1,
+                 [&](int64_t b, int64_t e, int) {
+    for (int64_t t = b; t < e; t++) {
+      const int rb = tasks[2 * t + 1];
+      block(tasks[2 * t], rb, std::min(m, rb + rowBlock));
+    }
+  });
+}
+
+//! Unblocked Cholesky of the n x n lower triangle of A, left-looking.
+//! Returns -1, or the column whose pivot is not positive.
+inline int cholPotf2(int n, double *A, int lda) {
+  for (int j = 0; j < n; j++) {
+    double *a = A + (size_t)j * lda;
+
+    for (int p = 0; p < j; p++) {
+      const double *l = A + (size_t)p * lda;
+      const double b = l[j];
+      for (int i = j; i < n; i++) a[i] -= l[i] * b;
+    }
+
+    if (!(a[j] > 0.0)) return j;
+
+    const double d = sqrt(a[j]);
+    const double inv = 1.0 / d;
+    a[j] = d;
+    for (int i = j + 1; i < n; i++) a[i] *= inv;
+  }
+
+  return -1;
+}
+
+//! X(0:m, 0:n) := X * L^-T with L the n x n lower triangle. Rows of X are
+//! independent, so the parallel version splits them between threads.
+inline void cholTrsm(int m, int n, const double *L, int ldl, double *X,
+                     int ldx, bool parallel) {
+  auto rows = [&](int64_t rb, int64_t re, int) {
+    const int mr = (int)(re - rb);
+    double *x = X + rb;
+
+    for (int j0 = 0; j0 < n; j0 += kCholTile) {
+      const int j1 = std::min(n, j0 + kCholTile);
+
+      if (j0 > 0) {
+        cholGemmNT(mr, j1 - j0, j0, x, ldx, L + j0, ldl, x + (size_t)j0 * ldx,
+                   ldx);
+      }
+
+      for (int j = j0; j < j1; j++) {
+        double *xj = x + (size_t)j * ldx;
+
+        for (int p = j0; p < j; p++) {
+          const double *xp = x + (size_t)p * ldx;
+          const double b = L[j + (size_t)p * ldl];
+          for (int i = 0; i < mr; i++) xj[i] -= xp[i] * b;
+        }
+
+        const double inv = 1.0 / L[j + (size_t)j * ldl];
+        for (int i = 0; i < mr; i++) xj[i] *= inv;
+      }
+    }
+  };
+
+  if (parallel) {
+    sdkParallelFor(0, m, kCholRowBlock, rows);
+  } else if (m > 0) {
+    rows(0, m, 0);
+  }
+}
+
+//! Partial factorization of an m x m front whose first w columns are F
+//! (leading dimension m) and whose trailing (m-w) x (m-w) block is C:
+//! F becomes the supernode's columns of L and C its update matrix. Returns
+//! -1, or the local column of a non-positive pivot.
+inline int cholFactorFront(int m, int w, double *F, double *C, bool parallel) {
+  for (int k = 0; k < w; k += kCholTile) {
+    const int kb = std::min(kCholTile, w - k);
+    double *Fkk = F + k + (size_t)k * m;
+
+    const int info = cholPotf2(kb, Fkk, m);
+    if (info >= 0) return k + info;
+
+    cholTrsm(m - k - kb, kb, Fkk, m, Fkk + kb, m, parallel);
+    cholUpdate(m - k - kb, w - k - kb, kb, Fkk + kb, m,
+               F + (k + kb) + (size_t)(k + kb) * m, m, parallel);
+  }
+
+  if (m > w) cholUpdate(m - w, m - w, w, F + w, m, C, m - w, parallel);
+
+  return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Symbolic analysis
+////////////////////////////////////////////////////////////////////////////////
+
+//! Relaxed supernode amalgamation (the CHOLMOD defaults): a column is merged
+//! into the supernode of its only-child predecessor if the merged supernode
+//! has at most relax[0] columns, or at most relax[1] / relax[2] columns and
+//! a fraction of explicit zeros below zeros[0] / zeros[1], or any width and
+//! fewer than zeros[2] explicit zeros.
+struct SupernodalOptions {
+  int relax[3];
+  double zeros[3];
+
+  SupernodalOptions() {
+    relax[0] = 4;
+    relax[1] = 16;
+    relax[2] = 48;
+    zeros[0] = 0.8;
+    zeros[1] = 0.1;
+    zeros[2] = 0.05;
+  }
+};
+
+class SupernodalSymbolic {
+ public:
+  SupernodalSymbolic() : n_(0), nnzL_(0), flops_(0.0), analysisMs_(0.0) {}
+
+  //! Analyzes the pattern of the n x n CSR matrix (index base rowPtr[0]).
+  //! Q, if given, is a fill-reducing ordering with B = A(Q,Q), otherwise
+  //! AMD is used. It is refined by an elimination tree postorder.
+  void analyze(int n, const int *rowPtr, const int *colInd,
+               const int *Q = NULL,
+               const SupernodalOptions &options = SupernodalOptions()) {
+    std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+    ReorderGraph G;
+    std::vector<int> perm, pinv(n), parent;
+    n_ = n;
+    reorderBuildGraph(n, rowPtr, colInd, G);
+
+    if (Q) {
+      perm.assign(Q, Q + n);
+    } else {
+      reorderCompute(G, REORDER_AMD, perm);
+    }
+
+    for (int k = 0; k < n; k++) pinv[perm[k]] = k;
+    reorderEliminationTree(G, perm.data(), pinv.data(), parent);
+
+    // postorder the tree so that every supernode is a range of columns
+    // and every subtree precedes its root
+    std::vector<int> head(n, -1), next(n, -1), post, stack;
+    post.reserve(n);
+
+    for (int j = n - 1; j >= 0; j--) {
+      if (parent[j] >= 0) {
+        next[j] = head[parent[j]];
+        head[parent[j]] = j;
+      }
+    }
+
+    for (int root = 0; root < n; root++) {
+      if (parent[root] >= 0) continue;
+      stack.push_back(root);
+
+      while (!stack.empty()) {
+        const int j = stack.back();
+
+        if (head[j] >= 0) {
+          const int child = head[j];
+          head[j] = next[child];
+          stack.push_back(child);
+        } else {
+          post.push_back(j);
+          stack.pop_back();
+        }
+      }
+    }
+
+    std::vector<int> ipost(n);
+    perm_.resize(n);
+    parent_.resize(n);
+
+    for (int k = 0; k < n; k++) {
+      ipost[post[k]] = k;
+      perm_[k] = perm[post[k]];
+    }
+
+    for (int k = 0; k < n; k++) {
+      const int p = parent[post[k]];
+      parent_[k] = (p >= 0) ? ipost[p] : -1;
+      pinv[perm_[k]] = k;
+    }
+
+    std::vector<int> colCount, numChildren(n, 0);
+    nnzL_ = reorderColumnCounts(G, perm_.data(), pinv.data(), parent_.data(),
+                                colCount);
+
+    for (int j = 0; j < n; j++) {
+      if (parent_[j] >= 0) numChildren[parent_[j]]++;
+    }
+
+    findSupernodes(colCount, numChildren, options);
+    buildStructure(G, pinv);
+    buildAssemblyMap(rowPtr, colInd, pinv);
+
+    analysisMs_ = std::chrono::duration<double, std::milli>(
+                      std::chrono::high_resolution_clock::now() - t0)
+                      .count();
+  }
+
+  int rows() const { return n_; }
+  int numSupernodes() const { return (int)superPtr_.size() - 1; }
+  //! nonzeros of L, and the entries stored including explicit zeros
+  int64_t nnzL() const { return nnzL_; }
+  int64_t factorSize() const { return lPtr_.empty() ? 0 : lPtr_.back(); }
+  double flops() const { return flops_; }
+  double analysisMs() const { return analysisMs_; }
+  //! Permutation of the factorization: B = A(perm, perm) = L*L^T.
+  const std::vector<int> &permutation() const { return perm_; }
+
+  void printStats() const {
+    const int ns = numSupernodes();
+    int maxWidth = 0, maxFront = 0;
+
+    for (int s = 0; s < ns; s++) {
+      maxWidth = std::max(maxWidth, superPtr_[s + 1] - superPtr_[s]);
+      maxFront = std::max(maxFront, rowPtr_[s + 1] - rowPtr_[s]);
+    }
+
+    printf("  n = %d, supernodes = %d (average width %.1f, max width %d, "
+           "max front %d)\n",
+           n_, ns, ns ? (double)n_ / ns : 0.0, maxWidth, maxFront);
+    printf("  nnz(L) = %lld, stored = %lld, flops = %.3e, analysis %.2f ms\n",
+           (long long)nnzL_, (long long)factorSize(), flops_, analysisMs_);
+  }
+
+ private:
+  friend class SupernodalCholesky;
+
+  void findSupernodes(const std::vector<int> &colCount,
+                      const std::vector<int> &numChildren,
+                      const SupernodalOptions &options) {
+    const int n = n_;
+    superPtr_.assign(1, 0);
+    int64_t actual = n ? colCount[0] : 0;
+
+    for (int j = 1; j <= n; j++) {
+      bool merge = false;
+
+      if (j < n && parent_[j - 1] == j) {
+        const int f = superPtr_.back();
+        const int64_t w = j - f + 1;
+        const int64_t m = w + colCount[j] - 1;
+        const int64_t stored = w * m - w * (w - 1) / 2;
+        const double zeros = (double)(stored - actual - colCount[j]) / stored;
+
+        merge = (colCount[j - 1] == colCount[j] + 1 && numChildren[j] == 1) ||
+                w <= options.relax[0] ||
+                (w <= options.relax[1] && zeros < options.zeros[0]) ||
+                (w <= options.relax[2] && zeros < options.zeros[1]) ||
+                zeros < options.zeros[2];
+      }
+
+      if (j == n) {
+        superPtr_.push_back(n);
+      } else if (merge) {
+        actual += colCount[j];
+      } else {
+        superPtr_.push_back(j);
+        actual = colCount[j];
+      }
+    }
+
+    if (n == 0) superPtr_.assign(1, 0);
+
+    const int ns = numSupernodes();
+    snode_.resize(n);
+    superParent_.resize(ns);
+
+    for (int s = 0; s < ns; s++) {
+      for (int j = superPtr_[s]; j < superPtr_[s + 1]; j++) snode_[j] = s;
+    }
+
+    for (int s = 0; s < ns; s++) {
+      const int p = parent_[superPtr_[s + 1] - 1];
+      superParent_[s] = (p >= 0) ? snode_[p] : -1;
+    }
+
+    childPtr_.assign(ns + 1, 0);
+    for (int s = 0; s < ns; s++) {
+      if (superParent_[s] >= 0) childPtr_[superParent_[s] + 1]++;
+    }
+    for (int s = 0; s < ns; s++) childPtr_[s + 1] += childPtr_[s];
+
+    std::vector<int> pos(childPtr_.begin(), childPtr_.end() - 1);
+    child_.resize(std::max(ns - 1, 0));
+    for (int s = 0; s < ns; s++) {
+      if (superParent_[s] >= 0) child_[pos[superParent_[s]]++] = s;
+    }
+  }
+
+  //! Row structure of every supernode: its own columns, then the rows below
+  //! it that appear in its columns of B or in the update matrices of its
+  //! children. Children precede parents, so one pass suffices.
+  void buildStructure(const ReorderGraph &G, const std::vector<int> &pinv) {
+    const int ns = numSupernodes();
+    std::vector<int> mark(n_, -1), where(n_, 0);
+    rowPtr_.assign(ns + 1, 0);
+    rowInd_.clear();
+    relInd_.clear();
+    lPtr_.assign(ns + 1, 0);
+    subtreeFlops_.assign(ns, 0.0);
+    flops_ = 0.0;
+
+    for (int s = 0; s < ns; s++) {
+      const int f = superPtr_[s], l = superPtr_[s + 1] - 1;
+      const size_t begin = rowInd_.size();
+
+      for (int j = f; j <= l; j++) {
+        rowInd_.push_back(j);
+        mark[j] = s;
+      }
+
+      for (int j = f; j <= l; j++) {
+        const int i = perm_[j];
+
+        for (int q = G.ptr[i]; q < G.ptr[i + 1]; q++) {
+          const int r = pinv[G.adj[q]];
+
+          if (r > l && mark[r] != s) {
+            mark[r] = s;
+            rowInd_.push_back(r);
+          }
+        }
+      }
+
+      for (int c = childPtr_[s]; c < childPtr_[s + 1]; c++) {
+        const int ch = child_[c];
+        const int w = superPtr_[ch + 1] - superPtr_[ch];
+
+        for (int q = rowPtr_[ch] + w; q < rowPtr_[ch + 1]; q++) {
+          const int r = rowInd_[q];
+
+          if (r > l && mark[r] != s) {
+            mark[r] = s;
+            rowInd_.push_back(r);
+          }
+        }
+      }
+
+      std::sort(rowInd_.begin() + begin + (l - f + 1), rowInd_.end());
+      rowPtr_[s + 1] = (int)rowInd_.size();
+
+      // where each row of the front sits, for the children's index maps
+      for (size_t q = begin; q < rowInd_.size(); q++) {
+        where[rowInd_[q]] = (int)(q - begin);
+      }
+
+      relInd_.resize(rowInd_.size());
+
+      for (int c = childPtr_[s]; c < childPtr_[s + 1]; c++) {
+        const int ch = child_[c];
+        const int w = superPtr_[ch + 1] - superPtr_[ch];
+
+        for (int q = rowPtr_[ch] + w; q < rowPtr_[ch + 1]; q++) {
+          relInd_[q] = where[rowInd_[q]];
+        }
+      }
+
+      const int64_t m = rowPtr_[s + 1] - rowPtr_[s], w = l - f + 1;
+      double frontFlops = 0.0;
+      for (int64_t c = 0; c < w; c++) frontFlops += (double)(m - c) * (m - c);
+
+      lPtr_[s + 1] = lPtr_[s] + m * w;
+      subtreeFlops_[s] += frontFlops;
+      flops_ += frontFlops;
+      if (superParent_[s] >= 0) subtreeFlops_[superParent_[s]] += subtreeFlops_[s];
+    }
+  }
+
+  //! Where every entry of the lower triangle of A goes in the storage of L,
+  //! grouped by supernode.
+  void buildAssemblyMap(const int *rowPtr, const int *colInd,
+                        const std::vector<int> &pinv) {
+    const int base = rowPtr[0], ns = numSupernodes();
+    std::vector<int> target;
+    assemblyPtr_.assign(ns + 1, 0);
+
+    for (int i = 0; i < n_; i++) {
+      for (int k = rowPtr[i] - base; k < rowPtr[i + 1] - base; k++) {
+        const int j = colInd[k] - base;
+        if (j > i) continue;
+        assemblyPtr_[snode_[std::min(pinv[i], pinv[j])] + 1]++;
+      }
+    }
+
+    for (int s = 0; s < ns; s++) assemblyPtr_[s + 1] += assemblyPtr_[s];
+
+    std::vector<int> pos(assemblyPtr_.begin(), assemblyPtr_.end() - 1);
+    assemblySrc_.resize(assemblyPtr_[ns]);
+    assemblyDst_.resize(assemblyPtr_[ns]);
+
+    for (int i = 0; i < n_; i++) {
+      for (int k = rowPtr[i] - base; k < rowPtr[i + 1] - base; k++) {
+        const int j = colInd[k] - base;
+        if (j > i) continue;
+
+        const int r = std::max(pinv[i], pinv[j]), c = std::min(pinv[i], pinv[j]);
+        const int s = snode_[c], f = superPtr_[s];
+        const int w = superPtr_[s + 1] - f, m = rowPtr_[s + 1] - rowPtr_[s];
+        const int *rows = rowInd_.data() + rowPtr_[s];
+        const int local = (r < f + w)
+                              ? r - f
+                              : (int)(std::lower_bound(rows + w, rows + m, r) - rows);
+
+        assemblySrc_[pos[s]] = k;
+        assemblyDst_[pos[s]++] = local + (int64_t)(c - f) * m;
+      }
+    }
+  }
+
+  int n_;
+  int64_t nnzL_;
+  double flops_;
+  double analysisMs_;
+  std::vector<int> perm_, parent_;
+  // supernode s has columns [superPtr[s], superPtr[s+1]) and the rows
+  // rowInd[rowPtr[s] .. rowPtr[s+1]), its own columns first
+  std::vector<int> superPtr_, snode_, superParent_, childPtr_, child_;
+  std::vector<int> rowPtr_, rowInd_;
+  // position of each row below a supernode in the front of its parent
+  std::vector<int> relInd_;
+  // the columns of supernode s are stored column-major at lPtr[s]
+  std::vector<int64_t> lPtr_;
+  std::vector<double> subtreeFlops_;
+  std::vector<int> assemblyPtr_, assemblySrc_;
+  std::vector<int64_t> assemblyDst_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Numeric factorization and solve
+////////////////////////////////////////////////////////////////////////////////
+
+class SupernodalCholesky {
+ public:
+  SupernodalCholesky() : S_(NULL), numTop_(0) {}
+
+  //! Factorizes the matrix with the values csrVal and the pattern that was
+  //! analyzed by symbolic, which must outlive this factor. Storage is reused
+  //! when called again. Returns -1, or the column of B = A(perm, perm) at
+  //! which a non-positive pivot showed that A is not positive definite.
+  int factor(const SupernodalSymbolic &symbolic, const double *csrVal) {
+    const SupernodalSymbolic &S = symbolic;
+    const int ns = S.numSupernodes();
+    const int numThreads = sdkGetNumThreads();
+    S_ = &symbolic;
+    L_.resize(S.factorSize());
+    update_.resize(ns);
+    y_.resize(S.rows());
+
+    // supernodes whose subtree holds a large share of the flops are left to
+    // the second phase; the set is closed under taking parents
+    std::vector<char> top(ns, 0);
+    std::vector<std::atomic<int> > pending(ns);
+    numTop_ = 0;
+
+    for (int s = 0; s < ns; s++) {
+      top[s] = numThreads > 1 &&
+               S.subtreeFlops_[s] > S.flops_ / (kTopShare * numThreads);
+      numTop_ += top[s];
+      pending[s].store(S.childPtr_[s + 1] - S.childPtr_[s]);
+    }
+
+    std::atomic<int> failed(-1);
+
+    // factorizes s and returns its parent if that became ready, else -1
+    auto visit = [&](int s) {
+      if (failed.load() >= 0) return -1;
+
+      const int info = factorSupernode(s, csrVal, false);
+
+      if (info >= 0) {
+        int expected = -1;
+        failed.compare_exchange_strong(expected, info);
+      }
+
+      const int p = S.superParent_[s];
+      return (p >= 0 && !top[p] && pending[p].fetch_sub(1) == 1) ? p : -1;
+    };
+
+    if (numThreads == 1) {
+      // children come before their parents
+      for (int s = 0; s < ns && failed.load() < 0; s++) visit(s);
+    } else {
+      // a task per supernode, spawned once its last child is done
+      SdkTaskGroup group(sdkThreadPool());
+      std::function<void(int)> task = [&](int s) {
+        const int p = visit(s);
+        if (p >= 0) group.run([&task, p]() { task(p); });
+      };
+
+      for (int s = 0; s < ns; s++) {
+        if (!top[s] && S.childPtr_[s + 1] == S.childPtr_[s]) {
+          group.run([&task, s]() { task(s); });
+        }
+      }
+
+      group.wait();
+    }
+
+    for (int s = 0; s < ns && failed.load() < 0; s++) {
+      if (!top[s]) continue;
+      const double w = S.superPtr_[s + 1] - S.superPtr_[s];
+      const double m = S.rowPtr_[s + 1] - S.rowPtr_[s];
+      const int info = factorSupernode(s, csrVal, m * m * w > kParallelFront);
+      if (info >= 0) failed.store(info);
+    }
+
+    for (int s = 0; s < ns; s++) std::vector<double>().swap(update_[s]);
+
+    return failed.load();
+  }
+
+  //! Number of supernodes the last factor() handled in the second phase.
+  int numTopSupernodes() const { return numTop_; }
+
+  //! x = A^-1 b by forward and backward substitution with the supernodes.
+  void solve(const double *b, double *x) {
+    const SupernodalSymbolic &S = *S_;
+    const int n = S.rows(), ns = S.numSupernodes();
+    const int *perm = S.perm_.data();
+    double *y = y_.data();
+
+    for (int k = 0; k < n; k++) y[k] = b[perm[k]];
+
+    for (int s = 0; s < ns; s++) {
+      const int f = S.superPtr_[s], w = S.superPtr_[s + 1] - f;
+      const int m = S.rowPtr_[s + 1] - S.rowPtr_[s];
+      const int *rows = S.rowInd_.data() + S.rowPtr_[s];
+      const double *F = L_.data() + S.lPtr_[s];
+
+      for (int j = 0; j < w; j++) {
+        const double *l = F + (size_t)j * m;
+        const double yj = (y[f + j] /= l[j]);
+        for (int i = j + 1; i < w; i++) y[f + i] -= l[i] * yj;
+        for (int i = w; i < m; i++) y[rows[i]] -= l[i] * yj;
+      }
+    }
+
+    for (int s = ns - 1; s >= 0; s--) {
+      const int f = S.superPtr_[s], w = S.superPtr_[s + 1] - f;
+      const int m = S.rowPtr_[s + 1] - S.rowPtr_[s];
+      const int *rows = S.rowInd_.data() + S.rowPtr_[s];
+      const double *F = L_.data() + S.lPtr_[s];
+
+      for (int j = w - 1; j >= 0; j--) {
+        const double *l = F + (size_t)j * m;
+        double sum = y[f + j];
+        for (int i = j + 1; i < m; i++) sum -= l[i] * y[rows[i]];
+        y[f + j] = sum / l[j];
+      }
+    }
+
+    for (int k = 0; k < n; k++) x[perm[k]] = y[k];
+  }
+
+ private:
+  // a subtree is left to the second phase if it holds more than
+  // 1/(kTopShare * threads) of the flops; fronts above kParallelFront
+  // flops use the multithreaded kernels there
+  static const int kTopShare = 4;
+  static constexpr double kParallelFront = 4e6;
+
+  //! Assembles and factorizes the front of supernode s. Returns -1 or the
+  //! column of B with a non-positive pivot.
+  int factorSupernode(int s, const double *csrVal, bool parallel) {
+    const SupernodalSymbolic &S = *S_;
+    const int f = S.superPtr_[s], w = S.superPtr_[s + 1] - f;
+    const int m = S.rowPtr_[s + 1] - S.rowPtr_[s], mc = m - w;
+    double *F = L_.data() + S.lPtr_[s];
+    std::vector<double> &C = update_[s];
+
+    std::fill(F, F + (size_t)m * w, 0.0);
+    C.assign((size_t)mc * mc, 0.0);
+
+    for (int k = S.assemblyPtr_[s]; k < S.assemblyPtr_[s + 1]; k++) {
+      F[S.assemblyDst_[k]] += csrVal[S.assemblySrc_[k]];
+    }
+
+    // extend-add the update matrices of the children
+    for (int c = S.childPtr_[s]; c < S.childPtr_[s + 1]; c++) {
+      const int ch = S.child_[c];
+      const int wc = S.superPtr_[ch + 1] - S.superPtr_[ch];
+      const int mcc = S.rowPtr_[ch + 1] - S.rowPtr_[ch] - wc;
+      const int *rel = S.relInd_.data() + S.rowPtr_[ch] + wc;
+      const double *U = update_[ch].data();
+
+      for (int jj = 0; jj < mcc; jj++) {
+        const int rj = rel[jj];
+        const double *u = U + (size_t)jj * mcc;
+
+        if (rj < w) {
+          double *dst = F + (size_t)rj * m;
+          for (int ii = jj; ii < mcc; ii++) dst[rel[ii]] += u[ii];
+        } else {
+          double *dst = C.data() + (size_t)(rj - w) * mc;
+          for (int ii = jj; ii < mcc; ii++) dst[rel[ii] - w] += u[ii];
+        }
+      }
+
+      std::vector<double>().swap(update_[ch]);
+    }
+
+    const int info = cholFactorFront(m, w, F, C.data(), parallel);
+    return (info < 0) ? -1 : f + info;
+  }
+
+  const SupernodalSymbolic *S_;
+  int numTop_;
+  std::vector<double> L_;
+  // update matrices of the supernodes whose parent is not yet assembled
+  std::vector<std::vector<double> > update_;
+  std::vector<double> y_;
+};
+
+#endif  // COMMON_HELPER_CHOLESKY_H_
@@ -27,6 +27,7 @@ struct  testOpts {
     char *sparse_mat_filename;   // by switch -F<filename>
     const char *testFunc; // by switch -R<name>
     const char *reorder; // by switch -P<name>
+    char *permFile; // by switch -permfile=<file>, saved host ordering
     int lda; // by switch -lda<int>
 };
 
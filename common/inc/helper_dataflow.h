@@ -0,0 +1,470 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Dataflow executor for heterogeneous pipelines such as
+// generate -> H2D -> kernel -> D2H -> postprocess.
+//
+// A graph is declared once: nodes are CPU stages, run as tasks on the
+// work-stealing pool of helper_threadpool.h, or device stages behind the
+// SdkDeviceStage interface, which start asynchronous work on one of their
+// lanes (e.g. CUDA streams) and report completion from any thread, e.g. a
+// stream callback. Edges say which stage consumes the result of which; a
+// node with several inputs waits until all of them are done.
+//
+// run() streams any number of workloads through the graph. A workload owns
+// one of maxInFlight Buffer slots from the moment it enters the graph until
+// every sink has finished with it; that buffer is what travels along the
+// edges, so memory stays bounded however many workloads there are. Every
+// edge has a capacity: a stage only starts an item when each consumer has
+// room for it, so a slow stage stalls its producers (backpressure) instead
+// of letting queues grow, and the sinks are always served first so the
+// pipeline drains. printStats() reports how busy every stage was.
+//
+// SdkCpuDeviceStage is a stand-in for a device: it runs a host function on
+// threads of its own, one per lane, with an optional extra latency, so a
+// pipeline can be tested and benchmarked on machines without GPUs.
+#ifndef COMMON_HELPER_DATAFLOW_H_
+#define COMMON_HELPER_DATAFLOW_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <helper_parallel.h>
+
+//! A device stage. lanes() items may be in flight at once; submit() starts
+//! the work for one item on a free lane and must not wait for it. done()
+//! has to be called exactly once per submit(), from any thread; the
+//! executor does not call into any stage from inside done(), so it is safe
+//! to call from a CUDA stream callback.
+template <typename Buffer>
+class SdkDeviceStage {
+ public:
+  virtual ~SdkDeviceStage() {}
+  virtual int lanes() const = 0;
+  virtual void submit(int lane, int64_t workload, Buffer &buffer,
+                      std::function<void()> done) = 0;
+};
+
+//! Host stand-in for a device stage: a queue and a thread per lane that
+//! runs func(workload, buffer), waits delayUs more to model e.g. transfer
+//! latency, then signals completion.
+template <typename Buffer>
+class SdkCpuDeviceStage : public SdkDeviceStage<Buffer> {
+ public:
+  typedef std::function<void(int64_t, Buffer &)> Func;
+
+  SdkCpuDeviceStage(int lanes, Func func, int delayUs = 0)
+      : func_(func), delayUs_(delayUs), stop_(false) {
+    for (int l = 0; l < std::max(lanes, 1); l++) {
+      lanes_.push_back(std::unique_ptr<Lane>(new Lane));
+    }
+
+    for (size_t l = 0; l < lanes_.size(); l++) {
+      lanes_[l]->thread = std::thread(&SdkCpuDeviceStage::laneLoop, this, l);
+    }
+  }
+
+  ~SdkCpuDeviceStage() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+
+    wake_.notify_all();
+
+    for (size_t l = 0; l < lanes_.size(); l++) lanes_[l]->thread.join();
+  }
+
+  int lanes() const { return (int)lanes_.size(); }
+
+  void submit(int lane, int64_t workload, Buffer &buffer,
+              std::function<void()> done) {
+    Work work = {workload, &buffer, done};
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      lanes_[lane]->queue.push_back(work);
+    }
+
+    wake_.notify_all();
+  }
+
+ private:
+  struct Work {
+    int64_t workload;
+    Buffer *buffer;
+    std::function<void()> done;
+  };
+
+  struct Lane {
+    std::deque<Work> queue;
+    std::thread thread;
+  };
+
+  void laneLoop(size_t l) {
+    Lane &lane = *lanes_[l];
+
+    for (;;) {
+      Work work;
+
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [&]() { return stop_ || !lane.queue.empty(); });
+
+        if (lane.queue.empty()) return;
+
+        work = lane.queue.front();
+        lane.queue.pop_front();
+      }
+
+      func_(work.workload, *work.buffer);
+
+      if (delayUs_ > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(delayUs_));
+      }
+
+      work.done();
+    }
+  }
+
+  Func func_;
+  int delayUs_;
+  std::vector<std::unique_ptr<Lane> > lanes_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stop_;
+};
+
+template <typename Buffer>
+class SdkDataflow {
+ public:
+  typedef std::function<void(int64_t, Buffer &)> CpuFunc;
+
+  //! maxInFlight bounds the number of workloads, and so of buffers, in the
+  //! graph at any time.
+  explicit SdkDataflow(int maxInFlight)
+      : buffers_(std::max(maxInFlight, 1)),
+        numSinks_(0),
+        pool_(NULL),
+        numWorkloads_(0),
+        nextWorkload_(0),
+        finished_(0),
+        wallMs_(0.0) {}
+
+  int maxInFlight() const { return (int)buffers_.size(); }
+
+  //! The buffer of slot s, e.g. to allocate it before run().
+  Buffer &buffer(int s) { return buffers_[s]; }
+
+  //! func(workload, buffer) runs on the thread pool, at most concurrency
+  //! items at a time.
+  int addCpuStage(const char *name, CpuFunc func, int concurrency = 1) {
+    Node node(name);
+    node.cpu = func;
+    node.concurrency = std::max(concurrency, 1);
+    nodes_.push_back(node);
+    return (int)nodes_.size() - 1;
+  }
+
+  //! The stage is shared, so it can outlive the graph, e.g. to reuse its
+  //! streams.
+  int addDeviceStage(const char *name,
+                     std::shared_ptr<SdkDeviceStage<Buffer> > stage) {
+    Node node(name);
+    node.device = stage;
+    node.concurrency = stage->lanes();
+    nodes_.push_back(node);
+    return (int)nodes_.size() - 1;
+  }
+
+  //! to consumes what from produces. At most capacity items wait for to on
+  //! this edge or are being produced for it; 0 means maxInFlight.
+  void connect(int from, int to, int capacity = 0) {
+    Edge edge;
+    edge.from = from;
+    edge.to = to;
+    edge.capacity = (capacity > 0) ? capacity : maxInFlight();
+    edges_.push_back(edge);
+  }
+
+  //! Streams workloads 0..numWorkloads-1 through the graph and returns when
+  //! all of them have left it. The calling thread helps the pool meanwhile.
+  void run(int64_t numWorkloads, SdkThreadPool &pool = sdkThreadPool()) {
+    prepare();
+    pool_ = &pool;
+    numWorkloads_ = numWorkloads;
+    nextWorkload_ = 0;
+    finished_ = 0;
+
+    const std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      schedule();
+    }
+
+    for (;;) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (finished_ == numWorkloads_) break;
+      }
+
+      if (!pool.runOne()) std::this_thread::yield();
+    }
+
+    wallMs_ = elapsedMs(t0);
+  }
+
+  //! Items, busy time and utilization (busy time over wall time and
+  //! concurrency) of every stage, for the last run().
+  void printStats() const {
+    printf("  %lld workloads in %.3f ms, %.1f workloads/s, %d in flight\n",
+           (long long)numWorkloads_, wallMs_,
+           wallMs_ > 0.0 ? numWorkloads_ / (wallMs_ * 1e-3) : 0.0,
+           maxInFlight());
+
+    for (size_t n = 0; n < nodes_.size(); n++) {
+      const Node &node = nodes_[n];
+      printf("  %-16s %-6s x%-3d items = %6lld, busy = %9.3f ms, "
+             "utilization = %5.1f%%, stalled = %6lld\n",
+             node.name.c_str(), node.device ? "device" : "cpu",
+             node.concurrency, (long long)node.items, node.busyMs,
+             wallMs_ > 0.0 ? 100.0 * node.busyMs / (wallMs_ * node.concurrency)
+                           : 0.0,
+             (long long)node.stalls);
+    }
+  }
+
+ private:
+  struct Node {
+    explicit Node(const char *label)
+        : name(label),
+          concurrency(1),
+          running(0),
+          items(0),
+          stalls(0),
+          busyMs(0.0) {}
+
+    std::string name;
+    CpuFunc cpu;
+    std::shared_ptr<SdkDeviceStage<Buffer> > device;
+    int concurrency;
+
+    std::vector<int> in, out;  // edge indices
+    std::deque<int> ready;     // slots whose inputs are all done
+    std::vector<int> arrived;  // per slot, inputs done so far
+    std::vector<int> freeLanes;
+    int running;
+    int64_t items, stalls;
+    double busyMs;
+  };
+
+  struct Edge {
+    int from, to, capacity;
+    int load;  // items being produced for to, or not yet started by it
+  };
+
+  struct Dispatch {
+    int node, slot, lane;
+  };
+
+  static double elapsedMs(std::chrono::high_resolution_clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::high_resolution_clock::now() - t0)
+        .count();
+  }
+
+  //! Resets the per-run state and orders the nodes sinks first, so that
+  //! schedule() drains the graph before it starts new work.
+  void prepare() {
+    const int numNodes = (int)nodes_.size();
+    const int slots = maxInFlight();
+    std::vector<int> pendingOut(numNodes, 0);
+
+    for (int n = 0; n < numNodes; n++) {
+      Node &node = nodes_[n];
+      node.in.clear();
+      node.out.clear();
+      node.ready.clear();
+      node.arrived.assign(slots, 0);
+      node.freeLanes.clear();
+      for (int l = node.concurrency - 1; l >= 0; l--) node.freeLanes.push_back(l);
+      node.running = 0;
+      node.items = node.stalls = 0;
+      node.busyMs = 0.0;
+    }
+
+    for (size_t e = 0; e < edges_.size(); e++) {
+      edges_[e].load = 0;
+      nodes_[edges_[e].from].out.push_back((int)e);
+      nodes_[edges_[e].to].in.push_back((int)e);
+      pendingOut[edges_[e].from]++;
+    }
+
+    sources_.clear();
+    numSinks_ = 0;
+    order_.clear();
+
+    for (int n = 0; n < numNodes; n++) {
+      if (nodes_[n].in.empty()) sources_.push_back(n);
+      if (nodes_[n].out.empty()) {
+        numSinks_++;
+        order_.push_back(n);
+      }
+    }
+
+    for (size_t k = 0; k < order_.size(); k++) {
+      const Node &node = nodes_[order_[k]];
+
+      for (size_t i = 0; i < node.in.size(); i++) {
+        const int from = edges_[node.in[i]].from;
+        if (--pendingOut[from] == 0) order_.push_back(from);
+      }
+    }
+
+    if ((int)order_.size() != numNodes) {
+      fprintf(stderr, "SdkDataflow: the graph has a cycle\n");
+      exit(EXIT_FAILURE);
+    }
+
+    freeSlots_.clear();
+    for (int s = slots - 1; s >= 0; s--) freeSlots_.push_back(s);
+    sinksDone_.assign(slots, 0);
+    slotWorkload_.assign(slots, -1);
+  }
+
+  bool hasRoom(const Node &node) const {
+    for (size_t o = 0; o < node.out.size(); o++) {
+      const Edge &edge = edges_[node.out[o]];
+      if (edge.load >= edge.capacity) return false;
+    }
+
+    return true;
+  }
+
+  //! Admits new workloads and starts every item that has a free lane and
+  //! room downstream. Called with mutex_ held; the work itself is handed to
+  //! the pool, so this never runs a stage on the caller's thread.
+  void schedule() {
+    // a new workload needs a free slot, which bounds the work in flight
+    while (nextWorkload_ < numWorkloads_ && !freeSlots_.empty()) {
+      const int slot = freeSlots_.back();
+      freeSlots_.pop_back();
+      slotWorkload_[slot] = nextWorkload_++;
+
+      for (size_t s = 0; s < sources_.size(); s++) {
+        nodes_[sources_[s]].ready.push_back(slot);
+      }
+    }
+
+    for (size_t k = 0; k < order_.size(); k++) {
+      const int n = order_[k];
+      Node &node = nodes_[n];
+
+      while (!node.ready.empty() && node.running < node.concurrency) {
+        if (!hasRoom(node)) {
+          node.stalls++;
+          break;
+        }
+
+        Dispatch dispatch;
+        dispatch.node = n;
+        dispatch.slot = node.ready.front();
+        dispatch.lane = node.freeLanes.back();
+        node.ready.pop_front();
+        node.freeLanes.pop_back();
+        node.running++;
+
+        for (size_t i = 0; i < node.in.size(); i++) edges_[node.in[i]].load--;
+        for (size_t o = 0; o < node.out.size(); o++) edges_[node.out[o]].load++;
+
+        pool_->spawn([this, dispatch]() { start(dispatch); });
+      }
+    }
+  }
+
+  void start(Dispatch dispatch) {
+    Node &node = nodes_[dispatch.node];
+    const int64_t workload = slotWorkload_[dispatch.slot];
+    Buffer &buffer = buffers_[dispatch.slot];
+    const std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+
+    if (node.device) {
+      node.device->submit(dispatch.lane, workload, buffer, [this, dispatch, t0]() {
+        complete(dispatch, elapsedMs(t0));
+      });
+    } else {
+      node.cpu(workload, buffer);
+      complete(dispatch, elapsedMs(t0));
+    }
+  }
+
+  //! Hands the slot to the consumers, or releases it once every sink is
+  //! done with it.
+  void complete(Dispatch dispatch, double busyMs) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Node &node = nodes_[dispatch.node];
+    const int slot = dispatch.slot;
+
+    node.running--;
+    node.items++;
+    node.busyMs += busyMs;
+    node.freeLanes.push_back(dispatch.lane);
+
+    for (size_t o = 0; o < node.out.size(); o++) {
+      Edge &edge = edges_[node.out[o]];
+      Node &to = nodes_[edge.to];
+
+      if (++to.arrived[slot] == (int)to.in.size()) {
+        to.arrived[slot] = 0;
+        to.ready.push_back(slot);
+      }
+    }
+
+    if (node.out.empty() && ++sinksDone_[slot] == numSinks_) {
+      sinksDone_[slot] = 0;
+      slotWorkload_[slot] = -1;
+      freeSlots_.push_back(slot);
+      finished_++;
+    }
+
+    schedule();
+  }
+
+  std::vector<Buffer> buffers_;
+  std::vector<Node> nodes_;
+  std::vector<Edge> edges_;
+  std::vector<int> sources_, order_;
+  int numSinks_;
+
+  std::mutex mutex_;
+  SdkThreadPool *pool_;
+  std::vector<int> freeSlots_, sinksDone_;
+  std::vector<int64_t> slotWorkload_;
+  int64_t numWorkloads_, nextWorkload_, finished_;
+  double wallMs_;
+};
+
+#endif  // COMMON_HELPER_DATAFLOW_H_
@@ -0,0 +1,768 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Multithreaded dense factorizations on the host, column-major like
+// cuSOLVER/LAPACK: LU with partial pivoting (getrf), Cholesky (potrf) and
+// Householder QR (geqrf), with the matching solves.
+//
+// All three are right-looking blocked algorithms whose trailing updates go
+// through denseGemm(), a packed GEMM with an 8x4 register block that the
+// compiler vectorizes; QR applies its panels as compact WY block
+// reflectors I - V T V^T. Two ways of running them in parallel:
+//  - DENSE_BLOCKED (fork-join): panels are factorized by one thread, every
+//    trailing update is a multithreaded GEMM,
+//  - DENSE_TILED (task DAG): the factorization is split into tasks on
+//    tiles, with a dependency graph built from the last writer of every
+//    tile, and the tasks run on the helper_threadpool.h pool as soon as
+//    their inputs are ready, panels first. This overlaps the panel of step
+//    k+1 with the updates of step k. Cholesky uses square tiles (POTRF,
+//    TRSM, SYRK and GEMM tasks); LU and QR use block columns, so LU keeps
+//    exact partial pivoting over the whole column.
+#ifndef COMMON_HELPER_DENSE_H_
+#define COMMON_HELPER_DENSE_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <helper_cholesky.h>
+#include <helper_parallel.h>
+#include <helper_profiler.h>
+
+enum DenseMode {
+  DENSE_BLOCKED = 0,  // fork-join parallel trailing updates
+  DENSE_TILED         // task DAG on tiles
+};
+
+inline const char *denseModeName(DenseMode mode) {
+  return (mode == DENSE_TILED) ? "tiled" : "blocked";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// GEMM
+////////////////////////////////////////////////////////////////////////////////
+
+// register block and the cache blocking of the packed panels
+static const int kDenseMR = 8;
+static const int kDenseNR = 4;
+static const int kDenseMC = 128;
+static const int kDenseKC = 256;
+static const int kDenseNC = 2048;
+
+//! C(0:mr, 0:nr) += alpha * a * b for packed slivers a (kDenseMR x kc) and
+//! b (kc x kDenseNR).
+inline void denseMicroKernel(int kc, const double *a, const double *b,
+                             double alpha, double *C, int ldc, int mr,
+                             int nr) {
+  double c[kDenseNR][kDenseMR];
+  memset(c, 0, sizeof(c));
+
+  for (int p = 0; p < kc; p++) {
+    const double *ap = a + p * kDenseMR;
+    const double *bp = b + p * kDenseNR;
+
+    for (int j = 0; j < kDenseNR; j++) {
+      const double bj = bp[j];
+      for (int i = 0; i < kDenseMR; i++) c[j][i] += ap[i] * bj;
+    }
+  }
+
+  for (int j = 0; j < nr; j++) {
+    double *cj = C + (size_t)j * ldc;
+    for (int i = 0; i < mr; i++) cj[i] += alpha * c[j][i];
+  }
+}
+
+//! C += alpha * op(A) * op(B) on the calling thread, op(A) is m x k and
+//! op(B) is k x n.
+inline void denseGemmSerial(bool transA, bool transB, int m, int n, int k,
+                            double alpha, const double *A, int lda,
+                            const double *B, int ldb, double *C, int ldc) {
+  if (m <= 0 || n <= 0 || k <= 0) return;
+
+  static thread_local std::vector<double> packA, packB;
+  packA.resize((size_t)(kDenseMC + kDenseMR) * kDenseKC);
+  packB.resize((size_t)(kDenseNC + kDenseNR) * kDenseKC);
+
+  for (int jc = 0; jc < n; jc += kDenseNC) {
+    const int nc = std::min(kDenseNC, n - jc);
+
+    for (int pc = 0; pc < k; pc += kDenseKC) {
+      const int kc = std::min(kDenseKC, k - pc);
+      double *bp = packB.data();
+
+      for (int jr = 0; jr < nc; jr += kDenseNR) {
+        for (int p = 0; p < kc; p++) {
+          for (int jj = 0; jj < kDenseNR; jj++) {
+            const int j = jc + jr + jj, q = pc + p;
+            *bp++ = (jr + jj >= nc)
+                        ? 0.0
+                        : (transB ? B[j + (size_t)q * ldb] : B[q + (size_t)j * ldb]);
+          }
+        }
+      }
+
+      for (int ic = 0; ic < m; ic += kDenseMC) {
+        const int mc = std::min(kDenseMC, m - ic);
+        double *ap = packA.data();
+
+        for (int ir = 0; ir < mc; ir += kDenseMR) {
+          for (int p = 0; p < kc; p++) {
+            for (int ii = 0; ii < kDenseMR; ii++) {
+              const int i = ic + ir + ii, q = pc + p;
+              *ap++ = (ir + ii >= mc)
+                          ? 0.0
+                          : (transA ? A[q + (size_t)i * lda] : A[i + (size_t)q * lda]);
+            }
+          }
+        }
+
+        for (int jr = 0; jr < nc; jr += kDenseNR) {
+          for (int ir = 0; ir < mc; ir += kDenseMR) {
+            denseMicroKernel(kc, packA.data() + (size_t)ir * kc,
+                             packB.data() + (size_t)jr * kc, alpha,
+                             C + (ic + ir) + (size_t)(jc + jr) * ldc, ldc,
+                             std::min(kDenseMR, mc - ir),
+                             std::min(kDenseNR, nc - jr));
+          }
+        }
+      }
+    }
+  }
+}
+
+//! C += alpha * op(A) * op(B). The parallel version splits the larger of
+//! the two dimensions of C between threads.
+inline void denseGemm(bool transA, bool transB, int m, int n, int k,
+                      double alpha, const double *A, int lda, const double *B,
+                      int ldb, double *C, int ldc, bool parallel) {
+  if (!parallel || (double)m * n * k < 1e6) {
+    denseGemmSerial(transA, transB, m, n, k, alpha, A, lda, B, ldb, C, ldc);
+    return;
+  }
+
+  if (n >= m) {
+    sdkParallelFor(0, (n + kDenseNR - 1) / kDenseNR, 16,
+                   [&](int64_t b, int64_t e, int) {
+      const int j0 = (int)b * kDenseNR, j1 = std::min(n, (int)e * kDenseNR);
+      const double *Bj = transB ? B + j0 : B + (size_t)j0 * ldb;
+      denseGemmSerial(transA, transB, m, j1 - j0, k, alpha, A, lda, Bj, ldb,
+                      C + (size_t)j0 * ldc, ldc);
+    });
+  } else {
+    sdkParallelFor(0, (m + kDenseMR - 1) / kDenseMR, 16,
+                   [&](int64_t b, int64_t e, int) {
+      const int i0 = (int)b * kDenseMR, i1 = std::min(m, (int)e * kDenseMR);
+      const double *Ai = transA ? A + (size_t)i0 * lda : A + i0;
+      denseGemmSerial(transA, transB, i1 - i0, n, k, alpha, Ai, lda, B, ldb,
+                      C + i0, ldc);
+    });
+  }
+}
+
+//! Lower triangle of C(0:n, 0:n) -= A(0:n, 0:k) * A(0:n, 0:k)^T, in column
+//! tiles of width nb: the diagonal blocks directly, the rest with GEMM. The
+//! parallel version splits the nb x nb tiles of the lower triangle, which
+//! all cost about the same, between threads.
+inline void denseSyrkLower(int n, int k, const double *A, int lda, double *C,
+                           int ldc, int nb, bool parallel) {
+  const int tiles = (n + nb - 1) / nb;
+
+  if (!parallel) {
+    for (int j0 = 0; j0 < n; j0 += nb) {
+      const int jn = std::min(nb, n - j0);
+      double *c = C + j0 + (size_t)j0 * ldc;
+      cholSyrkTile(jn, k, A + j0, lda, c, ldc);
+      denseGemmSerial(false, true, n - j0 - jn, jn, k, -1.0, A + j0 + jn, lda,
+                      A + j0, lda, c + jn, ldc);
+    }
+
+    return;
+  }
+
+  std::vector<std::pair<int, int> > blocks;
+
+  for (int j = 0; j < tiles; j++) {
+    for (int i = j; i < tiles; i++) blocks.push_back(std::make_pair(i, j));
+  }
+
+  sdkParallelFor(0, (int64_t)blocks.size(), 1, [&](int64_t b, int64_t e, int) {
+    for (int64_t t = b; t < e; t++) {
+      const int i0 = blocks[t].first * nb, in = std::min(nb, n - i0);
+      const int j0 = blocks[t].second * nb, jn = std::min(nb, n - j0);
+      double *c = C + i0 + (size_t)j0 * ldc;
+
+      if (i0 == j0) {
+        cholSyrkTile(jn, k, A + j0, lda, c, ldc);
+      } else {
+        denseGemmSerial(false, true, in, jn, k, -1.0, A + i0, lda, A + j0, lda,
+                        c, ldc);
+      }
+    }
+  });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Task graph
+////////////////////////////////////////////////////////////////////////////////
+
+//! Tasks with dependencies, run on the sdkThreadPool(). Tasks whose
+//! dependencies are done wait in a priority queue, and the ready task with
+//! the highest priority always starts first.
+class DenseTaskGraph {
+ public:
+  int add(int priority, std::function<void()> func) {
+    Task task;
+    task.func = func;
+    task.priority = priority;
+    task.deps = 0;
+    tasks_.push_back(task);
+    return (int)tasks_.size() - 1;
+  }
+
+  //! after does not start before before has finished; -1 is ignored.
+  void depend(int before, int after) {
+    if (before < 0 || before == after) return;
+    tasks_[before].succ.push_back(after);
+    tasks_[after].deps++;
+  }
+
+  int size() const { return (int)tasks_.size(); }
+
+  //! Runs all tasks, at most numThreads at a time, and returns when they
+  //! are done.
+  void run(int numThreads) {
+    const int numTasks = size();
+    const int maxRunners = std::max(1, numThreads);
+    std::vector<std::atomic<int> > pending(numTasks);
+    std::priority_queue<std::pair<int, int> > ready;
+    std::mutex readyMutex;
+    int runners = 0;
+    SdkTaskGroup group(sdkThreadPool());
+    std::vector<int> initial;
+
+    // a runner is a pool task that takes ready tasks, highest priority
+    // first, until there are none; tasks becoming ready start more runners
+    // up to maxRunners. A caller that is a runner itself keeps going, so it
+    // starts one runner fewer.
+    std::function<void()> runner;
+
+    auto release = [&](const std::vector<int> &tasks, int self) {
+      int start = 0;
+
+      {
+        std::lock_guard<std::mutex> lock(readyMutex);
+
+        for (size_t i = 0; i < tasks.size(); i++) {
+          ready.push(std::make_pair(tasks_[tasks[i]].priority, tasks[i]));
+        }
+
+        start = std::min((int)tasks.size() - self, maxRunners - runners);
+        start = std::max(start, 0);
+        runners += start;
+      }
+
+      for (int i = 0; i < start; i++) group.run(runner);
+    };
+
+    runner = [&]() {
+      std::vector<int> released;
+
+      for (;;) {
+        int t;
+
+        {
+          std::lock_guard<std::mutex> lock(readyMutex);
+
+          if (ready.empty()) {
+            runners--;
+            return;
+          }
+
+          t = ready.top().second;
+          ready.pop();
+        }
+
+        tasks_[t].func();
+        released.clear();
+
+        for (size_t s = 0; s < tasks_[t].succ.size(); s++) {
+          const int u = tasks_[t].succ[s];
+          if (pending[u].fetch_sub(1) == 1) released.push_back(u);
+        }
+
+        if (!released.empty()) release(released, 1);
+      }
+    };
+
+    for (int t = 0; t < numTasks; t++) {
+      pending[t].store(tasks_[t].deps);
+      if (tasks_[t].deps == 0) initial.push_back(t);
+    }
+
+    release(initial, 0);
+    group.wait();
+  }
+
+ private:
+  struct Task {
+    std::function<void()> func;
+    int priority;
+    int deps;
+    std::vector<int> succ;
+  };
+
+  std::vector<Task> tasks_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// LU with partial pivoting
+////////////////////////////////////////////////////////////////////////////////
+
+//! Unblocked LU of the m x n panel A with partial pivoting; ipiv gets the
+//! pivot rows relative to the panel. Returns 0 or the LAPACK style info.
+inline int denseGetf2(int m, int n, double *A, int lda, int *ipiv) {
+  int info = 0;
+
+  for (int j = 0; j < std::min(m, n); j++) {
+    double *aj = A + (size_t)j * lda;
+    int p = j;
+
+    for (int i = j + 1; i < m; i++) {
+      if (fabs(aj[i]) > fabs(aj[p])) p = i;
+    }
+
+    ipiv[j] = p;
+
+    if (p != j) {
+      for (int c = 0; c < n; c++) std::swap(A[j + (size_t)c * lda], A[p + (size_t)c * lda]);
+    }
+
+    if (aj[j] == 0.0) {
+      if (info == 0) info = j + 1;
+      continue;
+    }
+
+    const double inv = 1.0 / aj[j];
+    for (int i = j + 1; i < m; i++) aj[i] *= inv;
+
+    for (int c = j + 1; c < n; c++) {
+      double *ac = A + (size_t)c * lda;
+      const double u = ac[j];
+      for (int i = j + 1; i < m; i++) ac[i] -= aj[i] * u;
+    }
+  }
+
+  return info;
+}
+
+//! Applies step k0 (kb columns, pivots ipiv[k0..k0+kb)) of a blocked LU to
+//! the columns [j0, j1): row interchanges, U12 = L11^-1 A12 and
+//! A22 -= L21 * U12.
+inline void denseLuUpdate(int n, double *A, int lda, const int *ipiv, int k0,
+                          int kb, int j0, int j1, bool parallel) {
+  if (j1 <= j0) return;
+
+  SDK_PROFILE_ZONE("denseLuUpdate");
+
+  const double *L11 = A + k0 + (size_t)k0 * lda;
+
+  auto columns = [&](int64_t cb, int64_t ce, int) {
+    for (int c = (int)cb; c < (int)ce; c++) {
+      double *ac = A + (size_t)c * lda;
+
+      for (int j = k0; j < k0 + kb; j++) {
+        if (ipiv[j] != j) std::swap(ac[j], ac[ipiv[j]]);
+      }
+
+      for (int p = 0; p < kb; p++) {
+        const double u = ac[k0 + p];
+        const double *l = L11 + (size_t)p * lda;
+        for (int i = p + 1; i < kb; i++) ac[k0 + i] -= l[i] * u;
+      }
+    }
+  };
+
+  if (parallel) {
+    sdkParallelFor(j0, j1, 64, columns);
+  } else {
+    columns(j0, j1, 0);
+  }
+
+  denseGemm(false, false, n - k0 - kb, j1 - j0, kb, -1.0, L11 + kb, lda,
+            A + k0 + (size_t)j0 * lda, lda,
+            A + (k0 + kb) + (size_t)j0 * lda, lda, parallel);
+}
+
+//! Factorizes P*A = L*U in place (n x n); ipiv[j] is the zero-based row
+//! swapped with row j at step j, as in getrf. Returns 0 or j+1 if U(j,j)
+//! is exactly zero.
+inline int denseGetrf(int n, double *A, int lda, int *ipiv, DenseMode mode,
+                      int nb = 128) {
+  SDK_PROFILE_ZONE("denseGetrf");
+  const int steps = (n + nb - 1) / nb;
+  std::atomic<int> info(0);
+
+  auto panel = [=, &info](int k) {
+    SDK_PROFILE_ZONE("denseGetrf panel");
+    const int k0 = k * nb, kb = std::min(nb, n - k0);
+    const int panelInfo = denseGetf2(n - k0, kb, A + k0 + (size_t)k0 * lda,
+                                     lda, ipiv + k0);
+    for (int j = k0; j < k0 + kb; j++) ipiv[j] += k0;
+
+    int expected = 0;
+    if (panelInfo) info.compare_exchange_strong(expected, panelInfo + k0);
+  };
+
+  if (mode == DENSE_BLOCKED) {
+    for (int k = 0; k < steps; k++) {
+      const int k0 = k * nb, kb = std::min(nb, n - k0);
+      panel(k);
+      denseLuUpdate(n, A, lda, ipiv, k0, kb, k0 + kb, n, true);
+    }
+  } else {
+    DenseTaskGraph graph;
+    std::vector<int> lastWriter(steps, -1);
+
+    for (int k = 0; k < steps; k++) {
+      const int k0 = k * nb, kb = std::min(nb, n - k0);
+      const int p = graph.add(2 * (steps - k) + 1, [=]() { panel(k); });
+      graph.depend(lastWriter[k], p);
+      lastWriter[k] = p;
+
+      for (int j = k + 1; j < steps; j++) {
+        const int j0 = j * nb, j1 = std::min(n, j0 + nb);
+        const int u = graph.add(2 * (steps - k), [=]() {
+          denseLuUpdate(n, A, lda, ipiv, k0, kb, j0, j1, false);
+        });
+        graph.depend(p, u);
+        graph.depend(lastWriter[j], u);
+        lastWriter[j] = u;
+      }
+    }
+
+    graph.run(sdkGetNumThreads());
+  }
+
+  // the interchanges of later steps on the columns of L to their left
+  sdkParallelFor(0, n, 64, [&](int64_t cb, int64_t ce, int) {
+    for (int c = (int)cb; c < (int)ce; c++) {
+      double *ac = A + (size_t)c * lda;
+      for (int j = (c / nb + 1) * nb; j < n; j++) {
+        if (ipiv[j] != j) std::swap(ac[j], ac[ipiv[j]]);
+      }
+    }
+  });
+
+  return info.load();
+}
+
+//! Solves A*x = b with the factors of denseGetrf(); b is overwritten by x.
+inline void denseGetrs(int n, const double *A, int lda, const int *ipiv,
+                       double *b) {
+  for (int j = 0; j < n; j++) {
+    if (ipiv[j] != j) std::swap(b[j], b[ipiv[j]]);
+  }
+
+  for (int j = 0; j < n; j++) {
+    const double *a = A + (size_t)j * lda;
+    for (int i = j + 1; i < n; i++) b[i] -= a[i] * b[j];
+  }
+
+  for (int j = n - 1; j >= 0; j--) {
+    const double *a = A + (size_t)j * lda;
+    b[j] /= a[j];
+    for (int i = 0; i < j; i++) b[i] -= a[i] * b[j];
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Cholesky
+////////////////////////////////////////////////////////////////////////////////
+
+//! Factorizes A = L*L^T in the lower triangle of A. Returns 0 or j+1 if the
+//! leading minor of order j+1 is not positive definite.
+inline int densePotrf(int n, double *A, int lda, DenseMode mode,
+                      int nb = 128) {
+  SDK_PROFILE_ZONE("densePotrf");
+  const int steps = (n + nb - 1) / nb;
+  std::atomic<int> info(0);
+  auto tile = [=](int i, int j) { return A + i * nb + (size_t)j * nb * lda; };
+  auto size = [=](int i) { return std::min(nb, n - i * nb); };
+
+  auto potrf = [=, &info](int k) {
+    SDK_PROFILE_ZONE("densePotrf panel");
+    const int f = cholPotf2(size(k), tile(k, k), lda);
+    int expected = 0;
+    if (f >= 0) info.compare_exchange_strong(expected, k * nb + f + 1);
+  };
+
+  if (mode == DENSE_BLOCKED) {
+    for (int k = 0; k < steps && info.load() == 0; k++) {
+      const int k0 = k * nb, kb = size(k), m = n - k0 - kb;
+      potrf(k);
+      if (info.load() != 0) break;
+      cholTrsm(m, kb, tile(k, k), lda, tile(k, k) + kb, lda, true);
+      denseSyrkLower(m, kb, tile(k, k) + kb, lda, tile(k + 1, k + 1), lda, nb,
+                     true);
+    }
+
+    return info.load();
+  }
+
+  // tile algorithm; tasks on a tile after a failed POTRF do no work
+  DenseTaskGraph graph;
+  std::vector<int> lastWriter((size_t)steps * steps, -1);
+  auto writer = [&](int i, int j) -> int & { return lastWriter[i + (size_t)j * steps]; };
+
+  for (int k = 0; k < steps; k++) {
+    const int p = graph.add(4 * (steps - k) + 3, [=, &info]() {
+      if (info.load() == 0) potrf(k);
+    });
+    graph.depend(writer(k, k), p);
+    writer(k, k) = p;
+
+    for (int i = k + 1; i < steps; i++) {
+      const int t = graph.add(4 * (steps - k) + 2, [=, &info]() {
+        if (info.load() == 0) cholTrsm(size(i), size(k), tile(k, k), lda, tile(i, k), lda, false);
+      });
+      graph.depend(p, t);
+      graph.depend(writer(i, k), t);
+      writer(i, k) = t;
+    }
+
+    for (int j = k + 1; j < steps; j++) {
+      for (int i = j; i < steps; i++) {
+        const int u = graph.add(4 * (steps - k) + (i == j), [=, &info]() {
+          if (info.load() != 0) return;
+
+          if (i == j) {
+            cholSyrkTile(size(j), size(k), tile(j, k), lda, tile(j, j), lda);
+          } else {
+            denseGemmSerial(false, true, size(i), size(j), size(k), -1.0,
+                            tile(i, k), lda, tile(j, k), lda, tile(i, j), lda);
+          }
+        });
+        graph.depend(writer(i, k), u);
+        graph.depend(writer(j, k), u);
+        graph.depend(writer(i, j), u);
+        writer(i, j) = u;
+      }
+    }
+  }
+
+  graph.run(sdkGetNumThreads());
+  return info.load();
+}
+
+//! Solves A*x = b with the factor of densePotrf(); b is overwritten by x.
+inline void densePotrs(int n, const double *A, int lda, double *b) {
+  for (int j = 0; j < n; j++) {
+    const double *a = A + (size_t)j * lda;
+    b[j] /= a[j];
+    for (int i = j + 1; i < n; i++) b[i] -= a[i] * b[j];
+  }
+
+  for (int j = n - 1; j >= 0; j--) {
+    const double *a = A + (size_t)j * lda;
+    double sum = b[j];
+    for (int i = j + 1; i < n; i++) sum -= a[i] * b[i];
+    b[j] = sum / a[j];
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Householder QR
+////////////////////////////////////////////////////////////////////////////////
+
+//! Unblocked QR of the m x n panel A (m >= n): R on and above the diagonal,
+//! the Householder vectors v (v(0) = 1 implied) below it, as in geqr2.
+inline void denseGeqr2(int m, int n, double *A, int lda, double *tau) {
+  for (int j = 0; j < n; j++) {
+    double *x = A + j + (size_t)j * lda;
+    const int len = m - j;
+    double xnorm = 0.0;
+
+    for (int i = 1; i < len; i++) xnorm += x[i] * x[i];
+    xnorm = sqrt(xnorm);
+
+    if (xnorm == 0.0) {
+      tau[j] = 0.0;
+      continue;
+    }
+
+    const double alpha = x[0];
+    const double beta = -copysign(sqrt(alpha * alpha + xnorm * xnorm), alpha);
+    const double scale = 1.0 / (alpha - beta);
+    tau[j] = (beta - alpha) / beta;
+    x[0] = beta;
+    for (int i = 1; i < len; i++) x[i] *= scale;
+
+    // apply H = I - tau v v^T to the columns to the right
+    for (int c = j + 1; c < n; c++) {
+      double *y = A + j + (size_t)c * lda;
+      double w = y[0];
+      for (int i = 1; i < len; i++) w += x[i] * y[i];
+      w *= tau[j];
+      y[0] -= w;
+      for (int i = 1; i < len; i++) y[i] -= w * x[i];
+    }
+  }
+}
+
+//! Compact WY form of the panel at A (m x kb, after denseGeqr2): V gets the
+//! explicit unit lower trapezoidal reflectors (ld m), T the kb x kb upper
+//! triangular factor with H_0 H_1 ... = I - V T V^T (larft).
+inline void denseLarft(int m, int kb, const double *A, int lda,
+                       const double *tau, double *V, double *T) {
+  for (int j = 0; j < kb; j++) {
+    double *v = V + (size_t)j * m;
+    const double *a = A + (size_t)j * lda;
+    for (int i = 0; i < j; i++) v[i] = 0.0;
+    v[j] = 1.0;
+    for (int i = j + 1; i < m; i++) v[i] = a[i];
+  }
+
+  for (int j = 0; j < kb; j++) {
+    double *t = T + (size_t)j * kb;
+    const double *vj = V + (size_t)j * m;
+
+    // T(0:j, j) = -tau_j * T(0:j, 0:j) * V(:, 0:j)^T v_j
+    for (int i = 0; i < j; i++) {
+      const double *vi = V + (size_t)i * m;
+      double s = 0.0;
+      for (int r = j; r < m; r++) s += vi[r] * vj[r];
+      t[i] = -tau[j] * s;
+    }
+
+    for (int i = 0; i < j; i++) {
+      double s = 0.0;
+      for (int p = i; p < j; p++) s += T[i + (size_t)p * kb] * t[p];
+      t[i] = s;
+    }
+
+    t[j] = tau[j];
+    for (int i = j + 1; i < kb; i++) t[i] = 0.0;
+  }
+}
+
+//! C (m x nc) := (I - V T V^T)^T C with the compact WY factors of
+//! denseLarft(); W is kb x nc scratch.
+inline void denseApplyWY(int m, int kb, int nc, const double *V,
+                         const double *T, double *C, int ldc, double *W,
+                         bool parallel) {
+  memset(W, 0, sizeof(double) * kb * nc);
+  denseGemm(true, false, kb, nc, m, 1.0, V, m, C, ldc, W, kb, parallel);
+
+  // W = T^T W, bottom up since T^T is lower triangular
+  for (int c = 0; c < nc; c++) {
+    double *w = W + (size_t)c * kb;
+
+    for (int i = kb - 1; i >= 0; i--) {
+      double s = 0.0;
+      for (int p = 0; p <= i; p++) s += T[p + (size_t)i * kb] * w[p];
+      w[i] = s;
+    }
+  }
+
+  denseGemm(false, false, m, nc, kb, -1.0, V, m, W, kb, C, ldc, parallel);
+}
+
+//! Factorizes A = Q*R (n x n) in place; tau holds the scalar factors of
+//! the reflectors, as in geqrf.
+inline void denseGeqrf(int n, double *A, int lda, double *tau, DenseMode mode,
+                       int nb = 128) {
+  SDK_PROFILE_ZONE("denseGeqrf");
+  const int steps = (n + nb - 1) / nb;
+  std::vector<std::vector<double> > V(mode == DENSE_TILED ? steps : 1);
+  std::vector<std::vector<double> > T(V.size());
+
+  auto panel = [=, &V, &T](int k) {
+    SDK_PROFILE_ZONE("denseGeqrf panel");
+    const int k0 = k * nb, kb = std::min(nb, n - k0), m = n - k0;
+    double *a = A + k0 + (size_t)k0 * lda;
+    const int slot = (mode == DENSE_TILED) ? k : 0;
+    V[slot].resize((size_t)m * kb);
+    T[slot].resize((size_t)kb * kb);
+    denseGeqr2(m, kb, a, lda, tau + k0);
+    denseLarft(m, kb, a, lda, tau + k0, V[slot].data(), T[slot].data());
+  };
+
+  auto update = [=, &V, &T](int k, int j0, int j1, bool parallel) {
+    SDK_PROFILE_ZONE("denseGeqrf update");
+    const int k0 = k * nb, kb = std::min(nb, n - k0);
+    const int slot = (mode == DENSE_TILED) ? k : 0;
+    static thread_local std::vector<double> W;
+    W.resize((size_t)kb * (j1 - j0));
+    denseApplyWY(n - k0, kb, j1 - j0, V[slot].data(), T[slot].data(),
+                 A + k0 + (size_t)j0 * lda, lda, W.data(), parallel);
+  };
+
+  if (mode == DENSE_BLOCKED) {
+    for (int k = 0; k < steps; k++) {
+      const int j0 = std::min(n, (k + 1) * nb);
+      panel(k);
+      if (j0 < n) update(k, j0, n, true);
+    }
+
+    return;
+  }
+
+  DenseTaskGraph graph;
+  std::vector<int> lastWriter(steps, -1);
+
+  for (int k = 0; k < steps; k++) {
+    const int p = graph.add(2 * (steps - k) + 1, [=]() { panel(k); });
+    graph.depend(lastWriter[k], p);
+    lastWriter[k] = p;
+
+    for (int j = k + 1; j < steps; j++) {
+      const int j0 = j * nb, j1 = std::min(n, j0 + nb);
+      const int u = graph.add(2 * (steps - k), [=]() { update(k, j0, j1, false); });
+      graph.depend(p, u);
+      graph.depend(lastWriter[j], u);
+      lastWriter[j] = u;
+    }
+  }
+
+  graph.run(sdkGetNumThreads());
+}
+
+//! Solves A*x = b with the factors of denseGeqrf(): x = R^-1 Q^T b; b is
+//! overwritten by x.
+inline void denseGeqrs(int n, const double *A, int lda, const double *tau,
+                       double *b) {
+  for (int j = 0; j < n; j++) {
+    const double *v = A + (size_t)j * lda;
+    double w = b[j];
+    for (int i = j + 1; i < n; i++) w += v[i] * b[i];
+    w *= tau[j];
+    b[j] -= w;
+    for (int i = j + 1; i < n; i++) b[i] -= w * v[i];
+  }
+
+  for (int j = n - 1; j >= 0; j--) {
+    const double *a = A + (size_t)j * lda;
+    b[j] /= a[j];
+    for (int i = 0; i < j; i++) b[i] -= a[i] * b[j];
+  }
+}
+
+#endif  // COMMON_HELPER_DENSE_H_
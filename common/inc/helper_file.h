@@ -0,0 +1,69 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Small portable file helpers shared by the host-side caches and sidecars
+// (helper_mmio.h, helper_reorder.h, helper_nvrtc_cache.h): reading a whole
+// file, and the process id and atomic rename used to publish a file that
+// was written under a temporary name.
+#ifndef COMMON_HELPER_FILE_H_
+#define COMMON_HELPER_FILE_H_
+
+#include <stdio.h>
+
+#include <string>
+
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <process.h>
+#undef min
+#undef max
+#else
+#include <unistd.h>
+#endif
+
+//! Reads the file at path into text; false if it cannot be opened.
+inline bool sdkReadFile(const std::string &path, std::string &text) {
+  FILE *f = fopen(path.c_str(), "rb");
+
+  if (f == NULL) return false;
+
+  char buffer[1 << 14];
+  size_t n;
+  text.clear();
+
+  while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) text.append(buffer, n);
+
+  fclose(f);
+  return true;
+}
+
+//! Id of the calling process, e.g. to name temporary files.
+inline int sdkProcessId() {
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+  return _getpid();
+#else
+  return (int)getpid();
+#endif
+}
+
+//! Renames from to to, replacing to atomically if it exists.
+inline bool sdkReplaceFile(const std::string &from, const std::string &to) {
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+  return MoveFileExA(from.c_str(), to.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#else
+  return rename(from.c_str(), to.c_str()) == 0;
+#endif
+}
+
+#endif  // COMMON_HELPER_FILE_H_
@@ -0,0 +1,273 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Host histogram equalization of 8-bit images, global and contrast limited
+// adaptive (CLAHE).
+//
+// Histograms are privatized: every chunk of rows counts into its own bins,
+// split into four interleaved sub-histograms so that runs of equal pixels
+// do not serialize on one counter, and the chunks are summed at the end.
+// A lookup table then maps the image, with the rows split over threads.
+//
+// CLAHE divides the image into a grid of tiles and equalizes each with its
+// own clipped histogram, the tiles built in parallel. Every pixel blends
+// the tables of the four tiles whose centres surround it bilinearly; the
+// tile indices and weights of the columns are computed once per image.
+#ifndef COMMON_HELPER_HISTOGRAM_H_
+#define COMMON_HELPER_HISTOGRAM_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+
+#include <helper_arena.h>
+#include <helper_parallel.h>
+
+//! CLAHE parameters.
+struct SdkClaheParams {
+  int tilesX;       //!< tiles across, reduced for narrow images
+  int tilesY;       //!< tiles down, reduced for short images
+  float clipLimit;  //!< bin limit relative to a flat histogram, 0 for none
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Internal helpers
+////////////////////////////////////////////////////////////////////////////////
+// Adds the pixels of rows [y0, y1) to four interleaved sub-histograms.
+inline void sdkHistogramRows8u(const uint8_t *src, size_t pitch, int x0,
+                               int x1, int y0, int y1, uint32_t *bins) {
+  uint32_t *h0 = bins, *h1 = bins + 256, *h2 = bins + 512, *h3 = bins + 768;
+
+  for (int y = y0; y < y1; y++) {
+    const uint8_t *s = src + (size_t)y * pitch;
+    int x = x0;
+
+    for (; x + 4 <= x1; x += 4) {
+      h0[s[x]]++;
+      h1[s[x + 1]]++;
+      h2[s[x + 2]]++;
+      h3[s[x + 3]]++;
+    }
+
+    for (; x < x1; x++) h0[s[x]]++;
+  }
+
+  for (int v = 0; v < 256; v++) h0[v] += h1[v] + h2[v] + h3[v];
+}
+
+// Clips a tile histogram at limit and spreads the excess over all bins.
+inline void sdkClipHistogram(uint32_t *hist, uint32_t limit) {
+  uint32_t excess = 0;
+
+  for (int v = 0; v < 256; v++) {
+    if (hist[v] > limit) {
+      excess += hist[v] - limit;
+      hist[v] = limit;
+    }
+  }
+
+  const uint32_t share = excess / 256;
+  const uint32_t residual = excess % 256;
+
+  for (int v = 0; v < 256; v++) hist[v] += share;
+
+  if (residual > 0) {
+    const uint32_t step = std::max(256 / residual, 1u);
+
+    for (uint32_t v = 0, n = 0; v < 256 && n < residual; v += step, n++) {
+      hist[v]++;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! 256-bin histogram of a width x height 8-bit image, pitch in bytes.
+////////////////////////////////////////////////////////////////////////////////
+inline void sdkHistogram8u(const uint8_t *src, size_t pitch, int width,
+                           int height, uint32_t hist[256]) {
+  memset(hist, 0, 256 * sizeof(uint32_t));
+
+  if (width <= 0 || height <= 0) return;
+
+  const int64_t grain = std::max(1, (1 << 16) / width);
+  const int chunks = sdkParallelChunks(0, height, grain);
+  SdkPoolVector<uint32_t> bins((size_t)chunks * 1024, 0);
+
+  sdkParallelFor(0, height, grain, [&](int64_t b, int64_t e, int chunk) {
+    sdkHistogramRows8u(src, pitch, 0, width, (int)b, (int)e,
+                       &bins[(size_t)chunk * 1024]);
+  });
+
+  for (int c = 0; c < chunks; c++) {
+    for (int v = 0; v < 256; v++) hist[v] += bins[(size_t)c * 1024 + v];
+  }
+}
+
+//! Equalization table of a histogram: each level maps to the share of
+//! pixels below it, scaled to 0..255, as the histEqualizationNPP sample
+//! computes it; level 255 always maps to 255.
+inline void sdkEqualizationLut8u(const uint32_t hist[256], uint8_t lut[256]) {
+  uint64_t total = 0;
+
+  for (int v = 0; v < 256; v++) total += hist[v];
+
+  const float multiplier = 1.0f / (float)std::max<uint64_t>(total, 1) * 0xFF;
+  uint64_t running = 0;
+
+  for (int v = 0; v < 255; v++) {
+    lut[v] = (uint8_t)std::min(255.0f, running * multiplier + 0.5f);
+    running += hist[v];
+  }
+
+  lut[255] = 0xFF;
+}
+
+//! dst = lut[src] over a width x height image; src and dst may be equal.
+inline void sdkApplyLut8u(const uint8_t *src, size_t srcPitch, uint8_t *dst,
+                          size_t dstPitch, int width, int height,
+                          const uint8_t lut[256]) {
+  if (width <= 0 || height <= 0) return;
+
+  const int64_t grain = std::max(1, (1 << 16) / width);
+
+  sdkParallelFor(0, height, grain, [&](int64_t b, int64_t e, int) {
+    uint8_t table[256];
+    memcpy(table, lut, sizeof(table));
+
+    for (int64_t y = b; y < e; y++) {
+      const uint8_t *s = src + y * srcPitch;
+      uint8_t *d = dst + y * dstPitch;
+      int x = 0;
+
+      for (; x + 8 <= width; x += 8) {
+        const uint8_t v0 = table[s[x]], v1 = table[s[x + 1]];
+        const uint8_t v2 = table[s[x + 2]], v3 = table[s[x + 3]];
+        const uint8_t v4 = table[s[x + 4]], v5 = table[s[x + 5]];
+        const uint8_t v6 = table[s[x + 6]], v7 = table[s[x + 7]];
+        d[x] = v0;
+        d[x + 1] = v1;
+        d[x + 2] = v2;
+        d[x + 3] = v3;
+        d[x + 4] = v4;
+        d[x + 5] = v5;
+        d[x + 6] = v6;
+        d[x + 7] = v7;
+      }
+
+      for (; x < width; x++) d[x] = table[s[x]];
+    }
+  });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Global histogram equalization of src into dst; src and dst may be equal.
+////////////////////////////////////////////////////////////////////////////////
+inline void sdkEqualizeHistogram8u(const uint8_t *src, size_t srcPitch,
+                                   uint8_t *dst, size_t dstPitch, int width,
+                                   int height) {
+  uint32_t hist[256];
+  uint8_t lut[256];
+
+  sdkHistogram8u(src, srcPitch, width, height, hist);
+  sdkEqualizationLut8u(hist, lut);
+  sdkApplyLut8u(src, srcPitch, dst, dstPitch, width, height, lut);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Contrast limited adaptive histogram equalization of src into dst. The
+//! images must not overlap.
+////////////////////////////////////////////////////////////////////////////////
+inline void sdkClahe8u(const uint8_t *src, size_t srcPitch, uint8_t *dst,
+                       size_t dstPitch, int width, int height,
+                       const SdkClaheParams &params) {
+  if (width <= 0 || height <= 0) return;
+
+  // tile sizes, then drop the tiles that would lie past the image
+  const int tileW = (width + std::max(1, params.tilesX) - 1) /
+                    std::max(1, params.tilesX);
+  const int tileH = (height + std::max(1, params.tilesY) - 1) /
+                    std::max(1, params.tilesY);
+  const int tilesX = (width + tileW - 1) / tileW;
+  const int tilesY = (height + tileH - 1) / tileH;
+  SdkPoolVector<uint8_t> luts((size_t)tilesX * tilesY * 256);
+
+  sdkParallelFor(0, tilesX * tilesY, 1, [&](int64_t b, int64_t e, int) {
+    uint32_t bins[1024];
+
+    for (int64_t t = b; t < e; t++) {
+      const int x0 = (int)(t % tilesX) * tileW;
+      const int y0 = (int)(t / tilesX) * tileH;
+      const int x1 = std::min(width, x0 + tileW);
+      const int y1 = std::min(height, y0 + tileH);
+      const uint32_t area = (uint32_t)(x1 - x0) * (y1 - y0);
+
+      memset(bins, 0, sizeof(bins));
+      sdkHistogramRows8u(src, srcPitch, x0, x1, y0, y1, bins);
+
+      if (params.clipLimit > 0.0f) {
+        sdkClipHistogram(
+            bins, std::max(1u, (uint32_t)(params.clipLimit * area / 256)));
+      }
+
+      uint8_t *lut = &luts[(size_t)t * 256];
+      const float scale = 255.0f / area;
+      uint32_t running = 0;
+
+      for (int v = 0; v < 256; v++) {
+        running += bins[v];
+        lut[v] = (uint8_t)std::min(255.0f, running * scale + 0.5f);
+      }
+    }
+  });
+
+  // the two tiles whose centres enclose each column, and the weight of the
+  // right one
+  SdkPoolVector<int> left(width), right(width);
+  SdkPoolVector<float> weight(width);
+
+  for (int x = 0; x < width; x++) {
+    const float fx = (x + 0.5f) / tileW - 0.5f;
+    const int tx = (int)floorf(fx);
+    left[x] = std::max(tx, 0) * 256;
+    right[x] = std::min(tx + 1, tilesX - 1) * 256;
+    weight[x] = fx - tx;
+  }
+
+  const int64_t grain = std::max(1, (1 << 14) / width);
+
+  sdkParallelFor(0, height, grain, [&](int64_t b, int64_t e, int) {
+    for (int64_t y = b; y < e; y++) {
+      const float fy = (y + 0.5f) / tileH - 0.5f;
+      const int ty = (int)floorf(fy);
+      const float wy = fy - ty;
+      const uint8_t *top = &luts[(size_t)std::max(ty, 0) * tilesX * 256];
+      const uint8_t *bottom =
+          &luts[(size_t)std::min(ty + 1, tilesY - 1) * tilesX * 256];
+      const uint8_t *s = src + y * srcPitch;
+      uint8_t *d = dst + y * dstPitch;
+
+      for (int x = 0; x < width; x++) {
+        const int v = s[x];
+        const float wx = weight[x];
+        const float t = top[left[x] + v] +
+                        wx * (top[right[x] + v] - top[left[x] + v]);
+        const float u = bottom[left[x] + v] +
+                        wx * (bottom[right[x] + v] - bottom[left[x] + v]);
+        d[x] = (uint8_t)(t + wy * (u - t) + 0.5f);
+      }
+    }
+  });
+}
+
+#endif  // COMMON_HELPER_HISTOGRAM_H_
@@ -0,0 +1,388 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Multithreaded stationary iterative solvers for A*x = b on the host:
+// Jacobi, red-black (multicolor) Gauss-Seidel and SOR.
+//
+// The matrix is stored in single precision, the right-hand side, iterate and
+// all accumulations in double precision. Two storage adapters are provided:
+// StationaryDenseMatrix (row-major, the dot products use AVX when the
+// compiler targets it) and StationaryCsrMatrix. The whole solve runs in one
+// persistent sdkParallelTeam:
+//  - Jacobi ping-pongs between two iterates, so an iteration is a single
+//    pass over A followed by one barrier,
+//  - Gauss-Seidel/SOR update the rows of one color at a time in place, with a
+//    barrier between colors. CSR matrices are colored greedily (a 5-point
+//    stencil gets the classic red-black ordering). Dense matrices couple
+//    every pair of rows, so every row is its own color and the sweep is
+//    sequential: the team splits the dot product of each row by columns
+//    instead, and the thread owning column i updates x_i.
+// The convergence measure is the same as in the jacobiCudaGraphs sample,
+// sum_i |(b - A x)_i / a_ii|. It is accumulated in the sweep itself, into
+// per-thread slots that alternate between iterations, so checking it costs
+// neither an extra pass nor an extra barrier. The work vectors come from
+// the size-class pool of helper_arena.h, so setting up a solver of a size
+// that has been solved before does not allocate.
+#ifndef COMMON_HELPER_JACOBI_H_
+#define COMMON_HELPER_JACOBI_H_
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <helper_arena.h>
+#include <helper_parallel.h>
+#include <helper_spmv.h>
+
+enum StationaryMethod {
+  STATIONARY_JACOBI = 0,
+  STATIONARY_GAUSS_SEIDEL,  // multicolor (red-black) ordering
+  STATIONARY_SOR            // multicolor ordering with over-relaxation
+};
+
+inline const char *stationaryMethodName(StationaryMethod method) {
+  switch (method) {
+    case STATIONARY_JACOBI:
+      return "Jacobi";
+    case STATIONARY_GAUSS_SEIDEL:
+      return "red-black Gauss-Seidel";
+    default:
+      return "red-black SOR";
+  }
+}
+
+//! sum_j a[j] * x[j] with single precision a and double accumulation
+inline double stationaryDot(const float *a, const double *x, int n) {
+  int j = 0;
+  double sum = 0.0;
+#if defined(__AVX__)
+  __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+
+  for (; j + 8 <= n; j += 8) {
+    const __m256 a8 = _mm256_loadu_ps(a + j);
+    const __m256d lo = _mm256_cvtps_pd(_mm256_castps256_ps128(a8));
+    const __m256d hi = _mm256_cvtps_pd(_mm256_extractf128_ps(a8, 1));
+    s0 = _mm256_add_pd(s0, _mm256_mul_pd(lo, _mm256_loadu_pd(x + j)));
+    s1 = _mm256_add_pd(s1, _mm256_mul_pd(hi, _mm256_loadu_pd(x + j + 4)));
+  }
+
+  double lanes[4];
+  _mm256_storeu_pd(lanes, _mm256_add_pd(s0, s1));
+  sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#else
+  // independent accumulators let the compiler vectorize without reassociating
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+
+  for (; j + 4 <= n; j += 4) {
+    s0 += (double)a[j] * x[j];
+    s1 += (double)a[j + 1] * x[j + 1];
+    s2 += (double)a[j + 2] * x[j + 2];
+    s3 += (double)a[j + 3] * x[j + 3];
+  }
+
+  sum = (s0 + s1) + (s2 + s3);
+#endif
+
+  for (; j < n; j++) sum += (double)a[j] * x[j];
+
+  return sum;
+}
+
+//! Row-major dense n x n matrix with leading dimension lda.
+struct StationaryDenseMatrix {
+  int n;
+  size_t lda;
+  const float *a;
+
+  StationaryDenseMatrix() : n(0), lda(0), a(NULL) {}
+  StationaryDenseMatrix(int rows, const float *A, size_t ld = 0)
+      : n(rows), lda(ld ? ld : (size_t)rows), a(A) {}
+
+  int rows() const { return n; }
+  double diag(int i) const { return a[i * lda + i]; }
+  double rowDot(int i, const double *x) const {
+    return stationaryDot(a + i * lda, x, n);
+  }
+
+  //! sum_{jb <= j < je} a_ij x_j
+  double rowDot(int i, const double *x, int jb, int je) const {
+    return stationaryDot(a + i * lda + jb, x + jb, je - jb);
+  }
+
+  //! Every row depends on all others, so each row is a color of its own.
+  int colorRows(SdkPoolVector<int> &color) const {
+    color.resize(n);
+    for (int i = 0; i < n; i++) color[i] = i;
+    return n;
+  }
+};
+
+//! Zero-based CSR matrix with single precision values.
+struct StationaryCsrMatrix {
+  CsrMatrixView<float> A;
+
+  StationaryCsrMatrix() {}
+  explicit StationaryCsrMatrix(const CsrMatrixView<float> &view) : A(view) {}
+
+  int rows() const { return A.rows; }
+
+  double diag(int i) const {
+    for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+      if (A.colInd[k] == i) return A.val[k];
+    }
+
+    return 0.0;
+  }
+
+  double rowDot(int i, const double *x) const {
+    double sum = 0.0;
+
+    for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+      sum += (double)A.val[k] * x[A.colInd[k]];
+    }
+
+    return sum;
+  }
+
+  //! sum_{jb <= j < je} a_ij x_j
+  double rowDot(int i, const double *x, int jb, int je) const {
+    double sum = 0.0;
+
+    for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+      const int j = A.colInd[k];
+      if (j >= jb && j < je) sum += (double)A.val[k] * x[j];
+    }
+
+    return sum;
+  }
+
+  //! Greedy coloring: every row takes the smallest color that none of its
+  //! already colored neighbours has.
+  int colorRows(SdkPoolVector<int> &color) const {
+    color.assign(A.rows, -1);
+    SdkPoolVector<int> used;
+    int numColors = 0;
+
+    for (int i = 0; i < A.rows; i++) {
+      used.assign(numColors + 1, 0);
+
+      for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+        const int c = color[A.colInd[k]];
+        if (c >= 0) used[c] = 1;
+      }
+
+      int c = 0;
+      while (used[c]) c++;
+      color[i] = c;
+      numColors = std::max(numColors, c + 1);
+    }
+
+    return numColors;
+  }
+};
+
+struct StationaryStats {
+  int iterations;
+  double update;  // sum |(b - A x)_i / a_ii| of the last sweep
+  double solveMs;
+  bool converged;
+};
+
+inline void stationaryPrintStats(const char *label, int n,
+                                 const StationaryStats &stats,
+                                 double flopsPerSweep, double bytesPerSweep) {
+  const double s = stats.solveMs * 1e-3;
+  printf("  %-24s n = %7d, iterations = %6d, update = %.3e, %9.3f ms, "
+         "%7.2f GFLOP/s, %7.2f GB/s %s\n",
+         label, n, stats.iterations, stats.update, stats.solveMs,
+         s > 0.0 ? flopsPerSweep * stats.iterations / s * 1e-9 : 0.0,
+         s > 0.0 ? bytesPerSweep * stats.iterations / s * 1e-9 : 0.0,
+         stats.converged ? "" : "(not converged)");
+}
+
+template <typename Matrix>
+class StationarySolver {
+ public:
+  StationarySolver() : method_(STATIONARY_JACOBI), omega_(1.0), numColors_(1) {}
+
+  //! omega is the relaxation factor of STATIONARY_SOR and ignored by the
+  //! other methods. Returns -1 on a zero diagonal.
+  int setup(const Matrix &A, StationaryMethod method, double omega = 1.0) {
+    A_ = A;
+    method_ = method;
+    omega_ = (method == STATIONARY_SOR) ? omega : 1.0;
+    const int n = A.rows();
+    invDiag_.resize(n);
+
+    for (int i = 0; i < n; i++) {
+      const double d = A.diag(i);
+      if (d == 0.0) return -1;
+      invDiag_[i] = 1.0 / d;
+    }
+
+    // rows grouped by color, in increasing row order inside a color
+    SdkPoolVector<int> color;
+    numColors_ = 1;
+    colorPtr_.assign(2, 0);
+    colorPtr_[1] = n;
+    colorRows_.resize(n);
+
+    for (int i = 0; i < n; i++) colorRows_[i] = i;
+
+    if (method != STATIONARY_JACOBI) {
+      numColors_ = A.colorRows(color);
+      colorPtr_.assign(numColors_ + 1, 0);
+      for (int i = 0; i < n; i++) colorPtr_[color[i] + 1]++;
+      for (int c = 0; c < numColors_; c++) colorPtr_[c + 1] += colorPtr_[c];
+      SdkPoolVector<int> pos(colorPtr_.begin(), colorPtr_.end() - 1);
+      for (int i = 0; i < n; i++) colorRows_[pos[color[i]]++] = i;
+    }
+
+    xAlt_.assign(n, 0.0);
+    numThreads_ = std::max(1, std::min(sdkGetNumThreads(), n / 64));
+    partial_.assign(2 * numThreads_ * kStride, 0.0);
+    rowPartial_.assign(2 * numThreads_ * kStride, 0.0);
+    return 0;
+  }
+
+  int numColors() const { return numColors_; }
+
+  //! Iterates from the initial guess in x until the update measure drops to
+  //! tol or maxIter sweeps have been made.
+  StationaryStats solve(const double *b, double *x, double tol, int maxIter) {
+    std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+    const Matrix &A = A_;
+    const int n = A.rows();
+    const int numThreads = numThreads_;
+    const double *invDiag = invDiag_.data();
+    const double omega = omega_;
+    const bool jacobi = (method_ == STATIONARY_JACOBI);
+    SdkSpinBarrier barrier(numThreads);
+    double *partial = partial_.data(), *rowPartial = rowPartial_.data();
+    StationaryStats stats;
+    stats.iterations = 0;
+    stats.update = 0.0;
+
+    if (jacobi) std::copy(x, x + n, xAlt_.begin());
+
+    sdkParallelTeam(numThreads, [&](int tid, int nt) {
+      double *xCur = x, *xNext = xAlt_.data();
+      const int jb = (int)((int64_t)n * tid / nt);
+      const int je = (int)((int64_t)n * (tid + 1) / nt);
+      int k = 0, rowParity = 0;
+      double update = 0.0;
+
+      while (k < maxIter) {
+        double *acc = partial + ((k & 1) * nt + tid) * kStride;
+        double sum = 0.0;
+
+        for (int c = 0; c < numColors_; c++) {
+          const int cb = colorPtr_[c], len = colorPtr_[c + 1] - cb;
+
+          if (len == 1 && nt > 1 && !jacobi) {
+            // a single row: split its dot product by columns and let the
+            // owner of column i update x_i, nobody else reads it before the
+            // next barrier; the slots alternate so one barrier is enough
+            const int i = colorRows_[cb];
+            double *slot = rowPartial + ((rowParity & 1) * nt) * kStride;
+            slot[tid * kStride] = A.rowDot(i, xCur, jb, je);
+            barrier.wait();
+            double dot = 0.0;
+            for (int t = 0; t < nt; t++) dot += slot[t * kStride];
+            rowParity++;
+
+            if (i >= jb && i < je) {
+              const double dx = (b[i] - dot) * invDiag[i];
+              sum += fabs(dx);
+              xCur[i] += omega * dx;
+            }
+
+            // rows of a following multi-row color read all of x
+            if (c < numColors_ - 1 && colorPtr_[c + 2] - colorPtr_[c + 1] > 1) {
+              barrier.wait();
+            }
+
+            continue;
+          }
+
+          const int rb = cb + (int)((int64_t)len * tid / nt);
+          const int re = cb + (int)((int64_t)len * (tid + 1) / nt);
+
+          for (int r = rb; r < re; r++) {
+            const int i = colorRows_[r];
+            const double dx = (b[i] - A.rowDot(i, xCur)) * invDiag[i];
+            sum += fabs(dx);
+
+            if (jacobi) {
+              xNext[i] = xCur[i] + omega * dx;
+            } else {
+              xCur[i] += omega * dx;
+            }
+          }
+
+          if (c < numColors_ - 1) barrier.wait();
+        }
+
+        acc[0] = sum;
+        barrier.wait();
+        update = 0.0;
+
+        for (int t = 0; t < nt; t++) {
+          update += partial[((k & 1) * nt + t) * kStride];
+        }
+
+        k++;
+        if (jacobi) std::swap(xCur, xNext);
+        if (update <= tol) break;
+      }
+
+      if (tid == 0) {
+        stats.iterations = k;
+        stats.update = update;
+
+        // an odd number of Jacobi sweeps leaves the result in the work vector
+        if (xCur != x) std::copy(xCur, xCur + n, x);
+      }
+    });
+
+    stats.converged = stats.update <= tol;
+    stats.solveMs = std::chrono::duration<double, std::milli>(
+                        std::chrono::high_resolution_clock::now() - t0)
+                        .count();
+    return stats;
+  }
+
+ private:
+  // per-thread partial sums are kStride doubles apart to avoid false sharing
+  static const int kStride = 8;
+
+  Matrix A_;
+  StationaryMethod method_;
+  double omega_;
+  int numColors_;
+  int numThreads_;
+  SdkPoolVector<double> invDiag_;
+  SdkPoolVector<int> colorPtr_, colorRows_;
+  SdkPoolVector<double> xAlt_;
+  SdkPoolVector<double> partial_, rowPartial_;
+};
+
+#endif  // COMMON_HELPER_JACOBI_H_
@@ -0,0 +1,293 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Compressed kernel images (PTX, CUBIN, fatbins) embedded in a program.
+//
+// An embedding tool (e.g. 6_Advanced/matrixMulDynlinkJIT/
+// embedKernelImages.cpp) compresses every image in the LZ4 block format and
+// writes one C source holding the compressed bytes and a table of
+// SdkKernelImage entries. Only the compressed bytes are linked in, and
+// nothing is decompressed at startup: an SdkKernelImageTable decodes an
+// image the first time it is asked for, keeps the result, and hands the
+// same copy to later callers. Decoded images are NUL terminated so that
+// PTX can be passed to cuModuleLoadData directly.
+//
+// The table part is plain C so that generated files compile as C; the
+// codec and the lazy table are C++.
+#ifndef COMMON_HELPER_KERNEL_IMAGES_H_
+#define COMMON_HELPER_KERNEL_IMAGES_H_
+
+//! One embedded image. compressedSize == size means stored uncompressed.
+typedef struct SdkKernelImage {
+  const char *name;
+  const unsigned char *data;
+  unsigned int compressedSize;
+  unsigned int size;
+} SdkKernelImage;
+
+#if defined(__cplusplus)
+
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////
+// LZ4 block format
+////////////////////////////////////////////////////////////////////////////////
+// Every sequence is a token (literal length in the high nibble, match length
+// - 4 in the low one; 15 continues in extra bytes of up to 255 each), the
+// literals, and a 16-bit little-endian match offset with the extra match
+// length bytes. The last sequence has literals only; matches end at least 5
+// bytes before the end and start at least 12 before it.
+static const int kSdkLzMinMatch = 4;
+static const int kSdkLzLastLiterals = 5;
+static const int kSdkLzMatchLimit = 12;
+static const int kSdkLzWindow = 65535;
+
+//! Decodes src into exactly dstSize bytes of dst; false if src is malformed.
+inline bool sdkLzDecompress(const unsigned char *src, size_t srcSize,
+                            unsigned char *dst, size_t dstSize) {
+  const unsigned char *ip = src, *const ipEnd = src + srcSize;
+  unsigned char *op = dst, *const opEnd = dst + dstSize;
+
+  while (ip < ipEnd) {
+    const unsigned token = *ip++;
+    size_t length = token >> 4;
+
+    if (length == 15) {
+      unsigned char b;
+
+      do {
+        if (ip >= ipEnd) return false;
+
+        b = *ip++;
+        length += b;
+      } while (b == 255);
+    }
+
+    if (length > (size_t)(ipEnd - ip) || length > (size_t)(opEnd - op)) {
+      return false;
+    }
+
+    memcpy(op, ip, length);
+    ip += length;
+    op += length;
+
+    // the last sequence has no match
+    if (ip == ipEnd) break;
+
+    if (ipEnd - ip < 2) return false;
+
+    const size_t offset = ip[0] | (ip[1] << 8);
+    ip += 2;
+
+    if (offset == 0 || offset > (size_t)(op - dst)) return false;
+
+    length = token & 15;
+
+    if (length == 15) {
+      unsigned char b;
+
+      do {
+        if (ip >= ipEnd) return false;
+
+        b = *ip++;
+        length += b;
+      } while (b == 255);
+    }
+
+    length += kSdkLzMinMatch;
+
+    if (length > (size_t)(opEnd - op)) return false;
+
+    // byte by byte, matches may overlap their own output
+    const unsigned char *match = op - offset;
+
+    for (size_t i = 0; i < length; i++) op[i] = match[i];
+
+    op += length;
+  }
+
+  return op == opEnd;
+}
+
+// Appends a length continuation: 255s and a final byte below 255.
+inline void sdkLzPutLength(std::vector<unsigned char> &out, size_t length) {
+  for (; length >= 255; length -= 255) out.push_back(255);
+
+  out.push_back((unsigned char)length);
+}
+
+inline void sdkLzPutSequence(std::vector<unsigned char> &out,
+                             const unsigned char *literals, size_t numLiterals,
+                             size_t offset, size_t matchLength) {
+  const size_t m = matchLength ? matchLength - kSdkLzMinMatch : 0;
+  out.push_back((unsigned char)((std::min<size_t>(numLiterals, 15) << 4) |
+                                std::min<size_t>(m, 15)));
+
+  if (numLiterals >= 15) sdkLzPutLength(out, numLiterals - 15);
+
+  if (numLiterals > 0) out.insert(out.end(), literals, literals + numLiterals);
+
+  if (matchLength == 0) return;
+
+  out.push_back((unsigned char)(offset & 0xFF));
+  out.push_back((unsigned char)(offset >> 8));
+
+  if (m >= 15) sdkLzPutLength(out, m - 15);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Compresses src in the LZ4 block format. Meant for embedding tools: it
+//! searches hash chains up to maxAttempts deep for the longest match, which
+//! trades encoding time for ratio; decoding speed does not depend on it.
+////////////////////////////////////////////////////////////////////////////////
+inline std::vector<unsigned char> sdkLzCompress(const unsigned char *src,
+                                                size_t size,
+                                                int maxAttempts = 256) {
+  static const int kHashBits = 16;
+  std::vector<unsigned char> out;
+  std::vector<int32_t> head((size_t)1 << kHashBits, -1);
+  std::vector<int32_t> prev(kSdkLzWindow + 1, -1);
+
+  auto hash = [&](size_t i) {
+    uint32_t v;
+    memcpy(&v, src + i, sizeof(v));
+    return (v * 2654435761u) >> (32 - kHashBits);
+  };
+
+  auto insert = [&](size_t i) {
+    const uint32_t h = hash(i);
+    prev[i & kSdkLzWindow] = head[h];
+    head[h] = (int32_t)i;
+  };
+
+  size_t anchor = 0, i = 0;
+  const size_t matchEnd = (size > kSdkLzLastLiterals) ? size - kSdkLzLastLiterals
+                                                      : 0;
+  const size_t searchEnd = (size > kSdkLzMatchLimit) ? size - kSdkLzMatchLimit
+                                                     : 0;
+
+  while (i < searchEnd) {
+    size_t bestLength = 0, bestOffset = 0;
+    int32_t candidate = head[hash(i)];
+
+    for (int attempt = 0;
+         candidate >= 0 && i - candidate <= (size_t)kSdkLzWindow &&
+         attempt < maxAttempts;
+         attempt++) {
+      const unsigned char *a = src + candidate, *b = src + i;
+      size_t length = 0;
+
+      while (i + length < matchEnd && a[length] == b[length]) length++;
+
+      if (length > bestLength) {
+        bestLength = length;
+        bestOffset = i - candidate;
+      }
+
+      const int32_t next = prev[candidate & kSdkLzWindow];
+
+      if (next >= candidate) break;  // overwritten slot of an older position
+
+      candidate = next;
+    }
+
+    if (bestLength < (size_t)kSdkLzMinMatch) {
+      insert(i++);
+      continue;
+    }
+
+    sdkLzPutSequence(out, src + anchor, i - anchor, bestOffset, bestLength);
+
+    for (size_t j = i; j < i + bestLength && j < searchEnd; j++) insert(j);
+
+    i += bestLength;
+    anchor = i;
+  }
+
+  sdkLzPutSequence(out, src + anchor, size - anchor, 0, 0);
+  return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Embedded images decoded on first use. Thread safe; each image is decoded
+//! once and stays valid for the lifetime of the table.
+////////////////////////////////////////////////////////////////////////////////
+class SdkKernelImageTable {
+ public:
+  SdkKernelImageTable(const SdkKernelImage *images, int count)
+      : images_(images),
+        count_(count),
+        once_(new std::once_flag[count]),
+        decoded_(count),
+        valid_(count, 0) {}
+
+  int count() const { return count_; }
+
+  //! Index of the image called name, -1 if there is none.
+  int find(const char *name) const {
+    for (int i = 0; i < count_; i++) {
+      if (strcmp(images_[i].name, name) == 0) return i;
+    }
+
+    return -1;
+  }
+
+  //! The decoded, NUL terminated image i, NULL if it does not decode.
+  const void *get(int i, size_t *size = NULL) {
+    if (i < 0 || i >= count_) return NULL;
+
+    std::call_once(once_[i], [this, i]() { decode(i); });
+
+    if (!valid_[i]) return NULL;
+
+    if (size) *size = images_[i].size;
+
+    return decoded_[i].data();
+  }
+
+  //! The decoded image called name, NULL if there is none.
+  const void *get(const char *name, size_t *size = NULL) {
+    return get(find(name), size);
+  }
+
+ private:
+  void decode(int i) {
+    const SdkKernelImage &image = images_[i];
+    std::vector<unsigned char> &out = decoded_[i];
+    out.resize((size_t)image.size + 1);
+
+    if (image.compressedSize == image.size) {
+      memcpy(out.data(), image.data, image.size);
+      valid_[i] = 1;
+    } else {
+      valid_[i] = sdkLzDecompress(image.data, image.compressedSize, out.data(),
+                                  image.size);
+    }
+
+    out[image.size] = '\0';
+  }
+
+  const SdkKernelImage *images_;
+  int count_;
+  std::unique_ptr<std::once_flag[]> once_;
+  std::vector<std::vector<unsigned char> > decoded_;
+  std::vector<char> valid_;
+};
+
+#endif  // __cplusplus
+
+#endif  // COMMON_HELPER_KERNEL_IMAGES_H_
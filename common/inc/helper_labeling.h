@@ -0,0 +1,400 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Host connected-component labelling of marker images, the counterpart of
+// nppiLabelMarkersUF and nppiCompressMarkerLabelsUF.
+//
+// Neighbouring pixels with the same marker value belong to the same
+// component, with 4-way (nppiNormL1) or 8-way (nppiNormInf) connectivity.
+// As with the NPP UF functions every pixel is labelled, and the label of a
+// component is a pixel index y * width + x. Here it is always the index of
+// the first pixel of the component in raster order, so the output does not
+// depend on the number of threads.
+//
+// The label image itself is the union-find forest, parents always have a
+// smaller index than their children:
+//  1. the image is cut into bands of rows that are labelled in parallel,
+//     each with a raster scan that unions equal neighbours (union by
+//     smaller index, path splitting) and then flattens its band in one pass,
+//  2. the first row of every band is merged with the last row of the band
+//     above; only band roots are linked, and the linked roots are recorded,
+//  3. the linked roots are resolved in increasing order,
+//  4. the bands are relabelled in parallel, every pixel reading only the
+//     root of its own band.
+// The batch variants schedule the bands of all images of a batch together.
+//
+// sdkCompressMarkerLabels() renumbers the labels of an image to consecutive
+// values in increasing label order, which for the labels above is the order
+// in which the components first appear in the image.
+#ifndef COMMON_HELPER_LABELING_H_
+#define COMMON_HELPER_LABELING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <helper_arena.h>
+#include <helper_parallel.h>
+
+//! One image of a batch, pitches are in bytes as in NppiImageDescriptor. As
+//! for the NPP UF functions the label image must be contiguous, labelPitch
+//! equal to width * sizeof(uint32_t), because labels index into it.
+template <typename T>
+struct SdkLabelImage {
+  const T *src;
+  size_t srcPitch;
+  uint32_t *labels;
+  size_t labelPitch;
+  int width;
+  int height;
+};
+
+// rows per band, smaller bands cost more boundary merges than they save
+static const int kSdkLabelMinBandRows = 32;
+
+////////////////////////////////////////////////////////////////////////////////
+// Internal helpers
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class SdkLabelTask {
+ public:
+  explicit SdkLabelTask(const SdkLabelImage<T> &image, int connectivity,
+                        int bands)
+      : image_(image), eightWay_(connectivity == 8), bands_(bands) {}
+
+  int bands() const { return bands_; }
+
+  int bandBegin(int b) const {
+    return (int)((int64_t)image_.height * b / bands_);
+  }
+
+  //! Step 1: label the rows of band b on their own.
+  void labelBand(int b) {
+    const int w = image_.width;
+    const int y0 = bandBegin(b), y1 = bandBegin(b + 1);
+
+    for (int y = y0; y < y1; y++) {
+      const T *s = src(y);
+      const T *sUp = (y > y0) ? src(y - 1) : NULL;
+      uint32_t *l = labelRow(y);
+      const uint32_t base = (uint32_t)y * (uint32_t)w;
+
+      for (int x = 0; x < w; x++) {
+        const uint32_t i = base + x;
+        const T v = s[x];
+
+        // Equal neighbours that touch each other are connected already, so
+        // at most two of them need a union. With 8-way connectivity W, NW
+        // and NE all touch N, and W touches NW.
+        uint32_t n[2];
+        int count = 0;
+
+        if (sUp != NULL && sUp[x] == v) n[count++] = i - w;
+
+        if (!eightWay_) {
+          if (x > 0 && s[x - 1] == v) n[count++] = i - 1;
+        } else if (count == 0) {
+          if (x > 0 && s[x - 1] == v) {
+            n[count++] = i - 1;
+          } else if (sUp != NULL && x > 0 && sUp[x - 1] == v) {
+            n[count++] = i - w - 1;
+          }
+
+          if (sUp != NULL && x + 1 < w && sUp[x + 1] == v) n[count++] = i - w + 1;
+        }
+
+        // a new pixel joins its first neighbour's tree without a search
+        l[x] = (count > 0) ? label(n[0]) : i;
+
+        if (count > 1) unite(i, n[1]);
+      }
+    }
+
+    // parents precede their children, one raster pass flattens the band
+    for (int y = y0; y < y1; y++) {
+      uint32_t *l = labelRow(y);
+
+      for (int x = 0; x < image_.width; x++) l[x] = label(l[x]);
+    }
+  }
+
+  //! Step 2: merge the first row of band b > 0 with the row above it.
+  void mergeBand(int b) {
+    const int w = image_.width;
+    const int y = bandBegin(b);
+
+    if (y == bandBegin(b - 1)) return;
+
+    const T *s = src(y);
+    const T *sUp = src(y - 1);
+    const uint32_t base = (uint32_t)y * (uint32_t)w;
+
+    for (int x = 0; x < w; x++) {
+      const uint32_t i = base + x;
+      const T v = s[x];
+
+      if (sUp[x] == v) link(i, i - w);
+
+      if (eightWay_) {
+        if (x > 0 && sUp[x - 1] == v) link(i, i - w - 1);
+        if (x + 1 < w && sUp[x + 1] == v) link(i, i - w + 1);
+      }
+    }
+  }
+
+  //! Step 3: give the linked band roots their final root.
+  void resolveLinks() {
+    std::sort(linked_.begin(), linked_.end());
+
+    for (size_t k = 0; k < linked_.size(); k++) {
+      const uint32_t r = linked_[k];
+      label(r) = label(label(r));
+    }
+
+    linked_.clear();
+  }
+
+  //! Step 4: relabel band b from the roots of its own band.
+  void relabelBand(int b) {
+    const int w = image_.width;
+    const int y0 = bandBegin(b), y1 = bandBegin(b + 1);
+    const uint32_t first = (uint32_t)y0 * (uint32_t)w;
+
+    for (int y = y0; y < y1; y++) {
+      uint32_t *l = labelRow(y);
+      const uint32_t base = (uint32_t)y * (uint32_t)w;
+
+      for (int x = 0; x < w; x++) {
+        const uint32_t r = l[x];
+
+        // band roots are final already; linked ones point out of the band
+        if (r >= first && r != base + x) l[x] = label(r);
+      }
+    }
+  }
+
+ private:
+  const T *src(int y) const {
+    return (const T *)((const char *)image_.src + y * image_.srcPitch);
+  }
+
+  uint32_t *labelRow(int y) const {
+    return image_.labels + (size_t)y * image_.width;
+  }
+
+  uint32_t &label(uint32_t i) const { return image_.labels[i]; }
+
+  uint32_t find(uint32_t i) const {
+    uint32_t p = label(i);
+
+    while (p != i) {
+      const uint32_t g = label(p);
+      label(i) = g;
+      i = p;
+      p = g;
+    }
+
+    return i;
+  }
+
+  void unite(uint32_t a, uint32_t b) {
+    a = find(a);
+    b = find(b);
+
+    if (a == b) return;
+
+    if (a < b) std::swap(a, b);
+
+    label(a) = b;
+  }
+
+  // Like unite(), but starts from the band roots of a and b. The labels of
+  // the other pixels of a band are left alone so that step 4 reads nothing
+  // but roots.
+  void link(uint32_t a, uint32_t b) {
+    a = find(label(a));
+    b = find(label(b));
+
+    if (a == b) return;
+
+    if (a < b) std::swap(a, b);
+
+    label(a) = b;
+    linked_.push_back(a);
+  }
+
+  SdkLabelImage<T> image_;
+  bool eightWay_;
+  int bands_;
+  SdkPoolVector<uint32_t> linked_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Label the markers of count images with 4- or 8-way connectivity.
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+inline void sdkLabelMarkersUFBatch(const SdkLabelImage<T> *images, int count,
+                                   int connectivity) {
+  std::vector<SdkLabelTask<T> > tasks;
+  std::vector<int64_t> firstBand(count + 1, 0);
+  tasks.reserve(count);
+
+  // bands of at least kSdkLabelMinBandRows rows, enough of them overall to
+  // keep every thread busy when the images differ in size
+  int64_t rows = 0;
+
+  for (int k = 0; k < count; k++) rows += images[k].height;
+
+  const int64_t bandRows = std::max<int64_t>(
+      kSdkLabelMinBandRows, rows / (4 * (int64_t)sdkGetNumThreads()) + 1);
+
+  for (int k = 0; k < count; k++) {
+    const int bands =
+        (int)std::max<int64_t>(1, images[k].height / bandRows);
+    tasks.push_back(SdkLabelTask<T>(images[k], connectivity, bands));
+    firstBand[k + 1] = firstBand[k] + bands;
+  }
+
+  // maps a global band number to its image
+  std::vector<int> imageOf((size_t)firstBand[count]);
+
+  for (int k = 0; k < count; k++) {
+    std::fill(imageOf.begin() + firstBand[k], imageOf.begin() + firstBand[k + 1],
+              k);
+  }
+
+  sdkParallelFor(0, firstBand[count], 1, [&](int64_t b, int64_t e, int) {
+    for (int64_t g = b; g < e; g++) {
+      const int k = imageOf[g];
+      tasks[k].labelBand((int)(g - firstBand[k]));
+    }
+  });
+
+  // the merges touch a few rows per band, images are merged independently
+  sdkParallelFor(0, count, 1, [&](int64_t b, int64_t e, int) {
+    for (int64_t k = b; k < e; k++) {
+      for (int band = 1; band < tasks[k].bands(); band++) {
+        tasks[k].mergeBand(band);
+      }
+
+      tasks[k].resolveLinks();
+    }
+  });
+
+  sdkParallelFor(0, firstBand[count], 1, [&](int64_t b, int64_t e, int) {
+    for (int64_t g = b; g < e; g++) {
+      const int k = imageOf[g];
+      tasks[k].relabelBand((int)(g - firstBand[k]));
+    }
+  });
+}
+
+//! Label the markers of one image, pitches are in bytes and labelPitch must
+//! be width * sizeof(uint32_t).
+template <typename T>
+inline void sdkLabelMarkersUF(const T *src, size_t srcPitch, uint32_t *labels,
+                              size_t labelPitch, int width, int height,
+                              int connectivity) {
+  SdkLabelImage<T> image = {src, srcPitch, labels, labelPitch, width, height};
+  sdkLabelMarkersUFBatch(&image, 1, connectivity);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Renumber the labels of an image in place to startingNumber,
+//! startingNumber + 1, ... in increasing label order. All labels must be
+//! smaller than labelBound. Returns the number of distinct labels, or -1 if
+//! a label is out of bounds (the image is left unchanged then).
+////////////////////////////////////////////////////////////////////////////////
+inline int sdkCompressMarkerLabels(uint32_t *labels, size_t labelPitch,
+                                   int width, int height, uint32_t labelBound,
+                                   uint32_t startingNumber = 1) {
+  if (width <= 0 || height <= 0) return 0;
+
+  // used[] marks the labels that occur, then holds their new numbers
+  std::vector<std::atomic<uint32_t>, SdkPoolAllocator<std::atomic<uint32_t> > >
+      used(labelBound);
+  std::atomic<bool> outOfBounds(false);
+  const int64_t grain = std::max(1, (1 << 16) / width);
+
+  sdkParallelFor(0, height, grain, [&](int64_t b, int64_t e, int) {
+    for (int64_t y = b; y < e; y++) {
+      const uint32_t *l =
+          (const uint32_t *)((const char *)labels + y * labelPitch);
+
+      for (int x = 0; x < width; x++) {
+        if (l[x] >= labelBound) {
+          outOfBounds.store(true, std::memory_order_relaxed);
+          return;
+        }
+
+        used[l[x]].store(1, std::memory_order_relaxed);
+      }
+    }
+  });
+
+  if (outOfBounds.load()) return -1;
+
+  // per chunk counts, scanned, then the new numbers
+  const int chunks = sdkParallelChunks(0, labelBound, 1 << 16);
+  std::vector<uint32_t> offsets(chunks + 1, 0);
+
+  sdkParallelFor(0, labelBound, 1 << 16, [&](int64_t b, int64_t e, int c) {
+    uint32_t n = 0;
+
+    for (int64_t i = b; i < e; i++) n += used[i].load(std::memory_order_relaxed);
+
+    offsets[c] = n;
+  });
+
+  sdkExclusiveScan(&offsets[0], chunks);
+
+  sdkParallelFor(0, labelBound, 1 << 16, [&](int64_t b, int64_t e, int c) {
+    uint32_t next = startingNumber + offsets[c];
+
+    for (int64_t i = b; i < e; i++) {
+      if (used[i].load(std::memory_order_relaxed)) {
+        used[i].store(next++, std::memory_order_relaxed);
+      }
+    }
+  });
+
+  sdkParallelFor(0, height, grain, [&](int64_t b, int64_t e, int) {
+    for (int64_t y = b; y < e; y++) {
+      uint32_t *l = (uint32_t *)((char *)labels + y * labelPitch);
+
+      for (int x = 0; x < width; x++) {
+        l[x] = used[l[x]].load(std::memory_order_relaxed);
+      }
+    }
+  });
+
+  return (int)offsets[chunks];
+}
+
+//! Compress the labels of every image of a batch, which must hold labels
+//! from sdkLabelMarkersUF(), i.e. smaller than width * height. counts[k]
+//! receives the number of labels of image k.
+template <typename T>
+inline void sdkCompressMarkerLabelsBatch(const SdkLabelImage<T> *images,
+                                         int count, int *counts,
+                                         uint32_t startingNumber = 1) {
+  for (int k = 0; k < count; k++) {
+    counts[k] = sdkCompressMarkerLabels(
+        images[k].labels, images[k].labelPitch, images[k].width,
+        images[k].height,
+        (uint32_t)images[k].width * (uint32_t)images[k].height, startingNumber);
+  }
+}
+
+#endif  // COMMON_HELPER_LABELING_H_
@@ -0,0 +1,856 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Fast Matrix Market (.mtx) loader producing CSR or CSC storage.
+//
+// The file is memory mapped and the coordinate section is parsed in parallel
+// line-aligned chunks. The compressed structure is then built with a parallel
+// counting sort on the major index followed by a per-row sort on the minor
+// index, instead of a global qsort over all entries. The result is stored in
+// a binary sidecar next to the .mtx file and reused on the next load as long
+// as the content digest of the source file still matches.
+#ifndef COMMON_HELPER_MMIO_H_
+#define COMMON_HELPER_MMIO_H_
+
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <io.h>
+#undef min
+#undef max
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <helper_file.h>
+#include <helper_parallel.h>
+
+enum MMLoadStatus {
+  MMLOAD_SUCCESS = 0,
+  MMLOAD_COULD_NOT_READ_FILE,
+  MMLOAD_NO_HEADER,
+  MMLOAD_UNSUPPORTED_TYPE,
+  MMLOAD_PREMATURE_EOF,
+  MMLOAD_INDEX_OUT_OF_RANGE,
+  MMLOAD_MIXED_BASE,
+  MMLOAD_TOO_MANY_ENTRIES
+};
+
+enum MMField { MM_FIELD_REAL, MM_FIELD_INTEGER, MM_FIELD_COMPLEX, MM_FIELD_PATTERN };
+
+enum MMSymmetry {
+  MM_SYMMETRY_GENERAL,
+  MM_SYMMETRY_SYMMETRIC,
+  MM_SYMMETRY_SKEW,
+  MM_SYMMETRY_HERMITIAN
+};
+
+//! Compressed sparse matrix as loaded from a Matrix Market file. For CSR the
+//! row pointers are in ptr (m+1 entries) and column indices in ind, for CSC
+//! ptr holds n+1 column pointers and ind holds row indices. Indices keep the
+//! base of the file (ptr[0] == base), values are stored as doubles with
+//! interleaved real/imaginary parts for complex matrices.
+struct MMCsrMatrix {
+  int m;
+  int n;
+  int nnz;
+  int base;
+  bool csrFormat;
+  MMField field;
+  MMSymmetry symmetry;
+  std::vector<int> ptr;
+  std::vector<int> ind;
+  std::vector<double> val;
+
+  MMCsrMatrix()
+      : m(0),
+        n(0),
+        nnz(0),
+        base(0),
+        csrFormat(true),
+        field(MM_FIELD_REAL),
+        symmetry(MM_SYMMETRY_GENERAL) {}
+
+  bool isComplex() const { return field == MM_FIELD_COMPLEX; }
+};
+
+inline const char *mmLoadErrorString(int status) {
+  switch (status) {
+    case MMLOAD_SUCCESS:
+      return "success";
+    case MMLOAD_COULD_NOT_READ_FILE:
+      return "can not open file";
+    case MMLOAD_NO_HEADER:
+      return "missing or malformed MatrixMarket header";
+    case MMLOAD_UNSUPPORTED_TYPE:
+      return "unsupported matrix type (only sparse coordinate matrices)";
+    case MMLOAD_PREMATURE_EOF:
+      return "premature end of file";
+    case MMLOAD_INDEX_OUT_OF_RANGE:
+      return "row or column index out of range";
+    case MMLOAD_MIXED_BASE:
+      return "input matrix is base-0 and base-1";
+    case MMLOAD_TOO_MANY_ENTRIES:
+      return "number of entries exceeds the 32-bit index range";
+  }
+
+  return "unknown error";
+}
+
+//! Read-only mapping of a whole file.
+class MMFileMapping {
+ public:
+  MMFileMapping() : data_(NULL), size_(0) {
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+    file_ = INVALID_HANDLE_VALUE;
+    mapping_ = NULL;
+#endif
+  }
+
+  ~MMFileMapping() { close(); }
+
+  bool open(const char *filename) {
+    close();
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+    file_ = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                        OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+
+    if (file_ == INVALID_HANDLE_VALUE) {
+      return false;
+    }
+
+    LARGE_INTEGER size;
+
+    if (!GetFileSizeEx(file_, &size)) {
+      close();
+      return false;
+    }
+
+    size_ = (size_t)size.QuadPart;
+
+    if (size_ == 0) {
+      return true;
+    }
+
+    mapping_ = CreateFileMappingA(file_, NULL, PAGE_READONLY, 0, 0, NULL);
+
+    if (mapping_ == NULL) {
+      close();
+      return false;
+    }
+
+    data_ = (const char *)MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+#else
+    int fd = ::open(filename, O_RDONLY);
+
+    if (fd < 0) {
+      return false;
+    }
+
+    struct stat st;
+
+    if (fstat(fd, &st) != 0) {
+      ::close(fd);
+      return false;
+    }
+
+    size_ = (size_t)st.st_size;
+
+    if (size_ == 0) {
+      ::close(fd);
+      return true;
+    }
+
+    void *addr = mmap(NULL, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (addr == MAP_FAILED) {
+      size_ = 0;
+      return false;
+    }
+
+    madvise(addr, size_, MADV_SEQUENTIAL);
+    data_ = (const char *)addr;
+#endif
+    return data_ != NULL;
+  }
+
+  void close() {
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+    if (data_) UnmapViewOfFile(data_);
+    if (mapping_) CloseHandle(mapping_);
+    if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+    mapping_ = NULL;
+    file_ = INVALID_HANDLE_VALUE;
+#else
+    if (data_) munmap((void *)data_, size_);
+#endif
+    data_ = NULL;
+    size_ = 0;
+  }
+
+  const char *data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  MMFileMapping(const MMFileMapping &);
+  MMFileMapping &operator=(const MMFileMapping &);
+
+  const char *data_;
+  size_t size_;
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+  HANDLE file_;
+  HANDLE mapping_;
+#endif
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Tokenizers
+////////////////////////////////////////////////////////////////////////////////
+inline const char *mmSkipBlanks(const char *p, const char *end) {
+  while (p < end && (*p == ' ' || *p == '\t' || *p == '\r')) p++;
+  return p;
+}
+
+inline const char *mmSkipLine(const char *p, const char *end) {
+  while (p < end && *p != '\n') p++;
+  return (p < end) ? p + 1 : end;
+}
+
+inline const char *mmParseInt(const char *p, const char *end, int64_t *out) {
+  p = mmSkipBlanks(p, end);
+  bool neg = false;
+
+  if (p < end && (*p == '-' || *p == '+')) {
+    neg = (*p == '-');
+    p++;
+  }
+
+  if (p >= end || (unsigned)(*p - '0') > 9) {
+    return NULL;
+  }
+
+  int64_t v = 0;
+
+  while (p < end && (unsigned)(*p - '0') <= 9) {
+    v = v * 10 + (*p - '0');
+    p++;
+  }
+
+  *out = neg ? -v : v;
+  return p;
+}
+
+//! Parses a floating point token. Plain decimal numbers whose significand and
+//! exponent are exactly representable take the fast path (exact, so results
+//! match strtod), everything else falls back to strtod on a copy of the token.
+inline const char *mmParseDouble(const char *p, const char *end, double *out) {
+  static const double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                  1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                  1e18, 1e19, 1e20, 1e21, 1e22};
+  p = mmSkipBlanks(p, end);
+  const char *start = p;
+  bool neg = false;
+
+  if (p < end && (*p == '-' || *p == '+')) {
+    neg = (*p == '-');
+    p++;
+  }
+
+  uint64_t mant = 0;
+  int digits = 0;
+  int exp10 = 0;
+  bool any = false;
+
+  while (p < end && (unsigned)(*p - '0') <= 9) {
+    if (digits < 19) {
+      mant = mant * 10 + (*p - '0');
+      if (mant) digits++;
+    } else {
+      exp10++;
+      digits++;
+    }
+    any = true;
+    p++;
+  }
+
+  if (p < end && *p == '.') {
+    p++;
+
+    while (p < end && (unsigned)(*p - '0') <= 9) {
+      if (digits < 19) {
+        mant = mant * 10 + (*p - '0');
+        if (mant) digits++;
+        exp10--;
+      } else {
+        digits++;
+      }
+      any = true;
+      p++;
+    }
+  }
+
+  if (any && p < end && (*p == 'e' || *p == 'E')) {
+    const char *q = p + 1;
+    bool expNeg = false;
+
+    if (q < end && (*q == '-' || *q == '+')) {
+      expNeg = (*q == '-');
+      q++;
+    }
+
+    if (q < end && (unsigned)(*q - '0') <= 9) {
+      int e = 0;
+
+      while (q < end && (unsigned)(*q - '0') <= 9) {
+        if (e < 100000) e = e * 10 + (*q - '0');
+        q++;
+      }
+
+      exp10 += expNeg ? -e : e;
+      p = q;
+    } else {
+      any = false;
+    }
+  }
+
+  bool delimited = (p >= end || isspace((unsigned char)*p));
+
+  if (any && delimited && digits <= 15 && exp10 >= -22 && exp10 <= 22) {
+    double v = (double)mant;
+    v = (exp10 < 0) ? v / kPow10[-exp10] : v * kPow10[exp10];
+    *out = neg ? -v : v;
+    return p;
+  }
+
+  // slow path: inf/nan, long significands or large exponents
+  char buf[128];
+  size_t len = 0;
+  p = start;
+
+  while (p < end && !isspace((unsigned char)*p) && len < sizeof(buf) - 1) {
+    buf[len++] = *p++;
+  }
+
+  buf[len] = '\0';
+  char *stop = NULL;
+  *out = strtod(buf, &stop);
+  return (stop == buf) ? NULL : start + (stop - buf);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Binary CSR sidecar
+////////////////////////////////////////////////////////////////////////////////
+struct MMCacheHeader {
+  char magic[8];
+  int64_t sourceSize;
+  uint64_t sourceDigest;
+  int32_t m;
+  int32_t n;
+  int32_t nnz;
+  int32_t base;
+  int32_t csrFormat;
+  int32_t extendSymMatrix;
+  int32_t field;
+  int32_t symmetry;
+};
+
+static const char kMMCacheMagic[8] = {'S', 'D', 'K', 'C', 'S', 'R', '0', '2'};
+
+//! Content digest of the source file the sidecar was built from. Timestamps
+//! are too coarse to notice a rewrite within the same second (or a copy that
+//! preserves them), so the whole file is hashed instead: 64-bit FNV-1a over
+//! fixed 1 MiB blocks in parallel, with the block digests folded in order.
+//! The block size is fixed so the result does not depend on the thread count.
+inline uint64_t mmSourceDigest(const char *data, size_t size) {
+  static const uint64_t kOffset = 14695981039346656037ull;
+  static const uint64_t kPrime = 1099511628211ull;
+  static const int64_t kBlock = (int64_t)1 << 20;
+  const int64_t numBlocks = ((int64_t)size + kBlock - 1) / kBlock;
+  std::vector<uint64_t> blocks((size_t)numBlocks);
+
+  sdkParallelFor(0, numBlocks, 1, [&](int64_t b0, int64_t b1, int) {
+    for (int64_t b = b0; b < b1; b++) {
+      const size_t first = (size_t)(b * kBlock);
+      const size_t last = std::min(size, first + (size_t)kBlock);
+      uint64_t h = kOffset;
+      size_t i = first;
+
+      // eight bytes per step, then the tail byte by byte
+      for (; i + sizeof(uint64_t) <= last; i += sizeof(uint64_t)) {
+        uint64_t w;
+        memcpy(&w, data + i, sizeof(w));
+        h = (h ^ w) * kPrime;
+        h ^= h >> 29;
+      }
+
+      for (; i < last; i++) h = (h ^ (unsigned char)data[i]) * kPrime;
+
+      blocks[b] = h;
+    }
+  });
+
+  uint64_t h = kOffset ^ (uint64_t)size;
+
+  for (int64_t b = 0; b < numBlocks; b++) {
+    h = (h ^ blocks[b]) * kPrime;
+    h ^= h >> 32;
+  }
+
+  return h;
+}
+
+inline std::string mmCacheFilename(const char *filename, bool csrFormat,
+                                   bool extendSymMatrix) {
+  std::string name(filename);
+  name += csrFormat ? ".csr" : ".csc";
+  if (extendSymMatrix) name += ".ext";
+  return name + ".bin";
+}
+
+//! Loads the sidecar of filename if it was built from a source of the given
+//! size and digest.
+inline bool mmReadCache(const char *filename, int64_t sourceSize,
+                        uint64_t sourceDigest, bool csrFormat,
+                        bool extendSymMatrix, MMCsrMatrix *A) {
+  std::string cacheName = mmCacheFilename(filename, csrFormat, extendSymMatrix);
+  MMFileMapping map;
+
+  if (!map.open(cacheName.c_str()) || map.size() < sizeof(MMCacheHeader)) {
+    return false;
+  }
+
+  MMCacheHeader h;
+  memcpy(&h, map.data(), sizeof(h));
+
+  if (memcmp(h.magic, kMMCacheMagic, sizeof(h.magic)) != 0 ||
+      h.sourceSize != sourceSize || h.sourceDigest != sourceDigest ||
+      h.csrFormat != (int)csrFormat ||
+      h.extendSymMatrix != (int)extendSymMatrix || h.nnz < 0 || h.m < 0 ||
+      h.n < 0) {
+    return false;
+  }
+
+  size_t major = (size_t)(csrFormat ? h.m : h.n);
+  size_t valCount = (size_t)h.nnz * (h.field == MM_FIELD_COMPLEX ? 2 : 1);
+  size_t expected = sizeof(h) + (major + 1) * sizeof(int) +
+                    (size_t)h.nnz * sizeof(int) + valCount * sizeof(double);
+
+  if (map.size() != expected) {
+    return false;
+  }
+
+  A->m = h.m;
+  A->n = h.n;
+  A->nnz = h.nnz;
+  A->base = h.base;
+  A->csrFormat = csrFormat;
+  A->field = (MMField)h.field;
+  A->symmetry = (MMSymmetry)h.symmetry;
+  A->ptr.resize(major + 1);
+  A->ind.resize(h.nnz);
+  A->val.resize(valCount);
+
+  const char *p = map.data() + sizeof(h);
+  memcpy(A->ptr.data(), p, A->ptr.size() * sizeof(int));
+  p += A->ptr.size() * sizeof(int);
+  memcpy(A->ind.data(), p, A->ind.size() * sizeof(int));
+  p += A->ind.size() * sizeof(int);
+  memcpy(A->val.data(), p, A->val.size() * sizeof(double));
+  return true;
+}
+
+//! Writes the sidecar through a temporary file and a rename, so concurrent
+//! readers never observe a partially written cache.
+inline bool mmWriteCache(const char *filename, int64_t sourceSize,
+                         uint64_t sourceDigest, bool extendSymMatrix,
+                         const MMCsrMatrix &A) {
+  MMCacheHeader h;
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, kMMCacheMagic, sizeof(h.magic));
+  h.sourceSize = sourceSize;
+  h.sourceDigest = sourceDigest;
+  h.m = A.m;
+  h.n = A.n;
+  h.nnz = A.nnz;
+  h.base = A.base;
+  h.csrFormat = A.csrFormat;
+  h.extendSymMatrix = extendSymMatrix;
+  h.field = A.field;
+  h.symmetry = A.symmetry;
+
+  std::string cacheName =
+      mmCacheFilename(filename, A.csrFormat, extendSymMatrix);
+  char suffix[32];
+  snprintf(suffix, sizeof(suffix), ".%d.tmp", sdkProcessId());
+  std::string tmpName = cacheName + suffix;
+  FILE *f = fopen(tmpName.c_str(), "wb");
+
+  if (f == NULL) {
+    return false;
+  }
+
+  bool ok = fwrite(&h, sizeof(h), 1, f) == 1;
+  ok = ok && fwrite(A.ptr.data(), sizeof(int), A.ptr.size(), f) == A.ptr.size();
+  ok = ok && fwrite(A.ind.data(), sizeof(int), A.ind.size(), f) == A.ind.size();
+  ok = ok && fwrite(A.val.data(), sizeof(double), A.val.size(), f) == A.val.size();
+  ok = (fclose(f) == 0) && ok;
+
+  ok = ok && sdkReplaceFile(tmpName, cacheName);
+
+  if (!ok) {
+    remove(tmpName.c_str());
+  }
+
+  return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Parser
+////////////////////////////////////////////////////////////////////////////////
+inline int mmParseHeader(const char *&p, const char *end, MMField *field,
+                         MMSymmetry *symmetry, int64_t *M, int64_t *N,
+                         int64_t *nz) {
+  // banner: %%MatrixMarket object format field symmetry
+  char tok[5][64];
+  int ntok = 0;
+  const char *q = p;
+
+  while (q < end && *q != '\n' && ntok < 5) {
+    q = mmSkipBlanks(q, end);
+    size_t len = 0;
+
+    while (q < end && !isspace((unsigned char)*q)) {
+      if (len < sizeof(tok[0]) - 1) tok[ntok][len++] = (char)tolower(*q);
+      q++;
+    }
+
+    if (len) tok[ntok++][len] = '\0';
+  }
+
+  if (ntok != 5 || strcmp(tok[0], "%%matrixmarket") != 0) {
+    return MMLOAD_NO_HEADER;
+  }
+
+  if (strcmp(tok[1], "matrix") != 0 || strcmp(tok[2], "coordinate") != 0) {
+    return MMLOAD_UNSUPPORTED_TYPE;
+  }
+
+  if (!strcmp(tok[3], "real")) *field = MM_FIELD_REAL;
+  else if (!strcmp(tok[3], "integer")) *field = MM_FIELD_INTEGER;
+  else if (!strcmp(tok[3], "complex")) *field = MM_FIELD_COMPLEX;
+  else if (!strcmp(tok[3], "pattern")) *field = MM_FIELD_PATTERN;
+  else return MMLOAD_UNSUPPORTED_TYPE;
+
+  if (!strcmp(tok[4], "general")) *symmetry = MM_SYMMETRY_GENERAL;
+  else if (!strcmp(tok[4], "symmetric")) *symmetry = MM_SYMMETRY_SYMMETRIC;
+  else if (!strcmp(tok[4], "skew-symmetric")) *symmetry = MM_SYMMETRY_SKEW;
+  else if (!strcmp(tok[4], "hermitian")) *symmetry = MM_SYMMETRY_HERMITIAN;
+  else return MMLOAD_UNSUPPORTED_TYPE;
+
+  p = mmSkipLine(q, end);
+
+  // comments and blank lines, then the size line
+  for (;;) {
+    if (p >= end) return MMLOAD_PREMATURE_EOF;
+    const char *s = mmSkipBlanks(p, end);
+    if (s < end && *s != '%' && *s != '\n') break;
+    p = mmSkipLine(s, end);
+  }
+
+  if ((p = mmParseInt(p, end, M)) == NULL ||
+      (p = mmParseInt(p, end, N)) == NULL ||
+      (p = mmParseInt(p, end, nz)) == NULL) {
+    return MMLOAD_PREMATURE_EOF;
+  }
+
+  if (*M < 0 || *N < 0 || *nz < 0 || *M >= INT32_MAX || *N >= INT32_MAX ||
+      *nz > INT32_MAX) {
+    return MMLOAD_TOO_MANY_ENTRIES;
+  }
+
+  p = mmSkipLine(p, end);
+  return MMLOAD_SUCCESS;
+}
+
+inline bool mmIsEntryLine(const char *p, const char *end) {
+  p = mmSkipBlanks(p, end);
+  return p < end && *p != '\n' && *p != '%';
+}
+
+//! Parse the coordinate data, build the compressed structure and, if
+//! useCache is set, store/reuse the binary sidecar. Symmetric, skew-symmetric
+//! and hermitian matrices are expanded to full storage when extendSymMatrix
+//! is set. Returns MMLOAD_SUCCESS or one of the MMLoadStatus error codes.
+inline int mmLoadCsr(const char *filename, bool csrFormat,
+                     bool extendSymMatrix, MMCsrMatrix *A,
+                     bool useCache = true) {
+  MMFileMapping map;
+
+  if (!map.open(filename)) {
+    return MMLOAD_COULD_NOT_READ_FILE;
+  }
+
+  // digest the bytes that are parsed below, so the sidecar always describes
+  // exactly this version of the file
+  const uint64_t digest = useCache ? mmSourceDigest(map.data(), map.size()) : 0;
+
+  if (useCache && mmReadCache(filename, (int64_t)map.size(), digest,
+                              csrFormat, extendSymMatrix, A)) {
+    return MMLOAD_SUCCESS;
+  }
+
+  const char *p = map.data();
+  const char *end = p + map.size();
+  MMField field = MM_FIELD_REAL;
+  MMSymmetry symmetry = MM_SYMMETRY_GENERAL;
+  int64_t M, N, NZ;
+  int status = mmParseHeader(p, end, &field, &symmetry, &M, &N, &NZ);
+
+  if (status != MMLOAD_SUCCESS) {
+    return status;
+  }
+
+  const int nz = (int)NZ;
+  const int valsPerEntry = (field == MM_FIELD_COMPLEX) ? 2 : 1;
+
+  // split the data section into line aligned chunks
+  const int64_t bytes = end - p;
+  const int chunks = sdkParallelChunks(0, bytes, 1 << 20);
+  std::vector<const char *> chunkBegin(chunks + 1, end);
+
+  for (int c = 0; c < chunks; c++) {
+    const char *s = p + bytes * c / chunks;
+    chunkBegin[c] = (c == 0) ? s : mmSkipLine(s - 1, end);
+  }
+
+  for (int c = chunks - 1; c > 0; c--) {
+    chunkBegin[c] = std::min(chunkBegin[c], chunkBegin[c + 1]);
+  }
+
+  // pass 1: count the entries in each chunk
+  std::vector<int64_t> chunkOffset(chunks + 1, 0);
+  sdkParallelFor(0, chunks, 1, [&](int64_t cb, int64_t ce, int) {
+    for (int64_t c = cb; c < ce; c++) {
+      int64_t count = 0;
+
+      for (const char *q = chunkBegin[c]; q < chunkBegin[c + 1];
+           q = mmSkipLine(q, end)) {
+        if (mmIsEntryLine(q, end)) count++;
+      }
+
+      chunkOffset[c] = count;
+    }
+  });
+  sdkExclusiveScan(chunkOffset.data(), chunks);
+
+  if (chunkOffset[chunks] < nz) {
+    return MMLOAD_PREMATURE_EOF;
+  }
+
+  // pass 2: parse into coordinate arrays
+  std::vector<int> rowInd(nz), colInd(nz);
+  std::vector<double> values((size_t)nz * valsPerEntry, 1.0);
+  std::vector<int> chunkStatus(chunks, MMLOAD_SUCCESS);
+  std::vector<int64_t> chunkOffDiag(chunks, 0);
+  std::vector<char> chunkBase0(chunks, 0), chunkBase1(chunks, 0);
+
+  sdkParallelFor(0, chunks, 1, [&](int64_t cb, int64_t ce, int) {
+    for (int64_t c = cb; c < ce; c++) {
+      int64_t k = chunkOffset[c];
+      int64_t offDiag = 0;
+      bool base0 = false, base1 = false;
+
+      for (const char *q = chunkBegin[c]; q < chunkBegin[c + 1] && k < nz;
+           q = mmSkipLine(q, end)) {
+        if (!mmIsEntryLine(q, end)) continue;
+
+        int64_t i, j;
+
+        if ((q = mmParseInt(q, end, &i)) == NULL ||
+            (q = mmParseInt(q, end, &j)) == NULL) {
+          chunkStatus[c] = MMLOAD_PREMATURE_EOF;
+          return;
+        }
+
+        for (int v = 0; v < valsPerEntry && field != MM_FIELD_PATTERN; v++) {
+          if ((q = mmParseDouble(q, end, &values[k * valsPerEntry + v])) ==
+              NULL) {
+            chunkStatus[c] = MMLOAD_PREMATURE_EOF;
+            return;
+          }
+        }
+
+        if (i < 0 || j < 0 || i > M || j > N) {
+          chunkStatus[c] = MMLOAD_INDEX_OUT_OF_RANGE;
+          return;
+        }
+
+        base0 |= (i == 0 || j == 0);
+        base1 |= (i == M || j == N);
+        offDiag += (i != j);
+        rowInd[k] = (int)i;
+        colInd[k] = (int)j;
+        k++;
+      }
+
+      chunkOffDiag[c] = offDiag;
+      chunkBase0[c] = base0;
+      chunkBase1[c] = base1;
+    }
+  });
+
+  int64_t offDiag = 0;
+  bool base0 = false, base1 = false;
+
+  for (int c = 0; c < chunks; c++) {
+    if (chunkStatus[c] != MMLOAD_SUCCESS) return chunkStatus[c];
+    offDiag += chunkOffDiag[c];
+    base0 |= chunkBase0[c] != 0;
+    base1 |= chunkBase1[c] != 0;
+  }
+
+  if (base0 && base1) {
+    return MMLOAD_MIXED_BASE;
+  }
+
+  const int base = base1 ? 1 : 0;
+  const bool expand = extendSymMatrix && symmetry != MM_SYMMETRY_GENERAL;
+  const int64_t total = nz + (expand ? offDiag : 0);
+
+  if (total > INT32_MAX) {
+    return MMLOAD_TOO_MANY_ENTRIES;
+  }
+
+  // counting sort on the major index. Entry e is referenced as e, its
+  // mirrored counterpart (when expanding symmetric storage) as ~e.
+  const int *majorInd = csrFormat ? rowInd.data() : colInd.data();
+  const int *minorInd = csrFormat ? colInd.data() : rowInd.data();
+  const int majorDim = (int)(csrFormat ? M : N);
+  std::vector<std::atomic<int> > counts(majorDim + 1);
+
+  sdkParallelFor(0, majorDim + 1, 1 << 16, [&](int64_t b, int64_t e, int) {
+    for (int64_t r = b; r < e; r++) counts[r].store(0, std::memory_order_relaxed);
+  });
+
+  sdkParallelFor(0, nz, 1 << 16, [&](int64_t b, int64_t e, int) {
+    for (int64_t k = b; k < e; k++) {
+      counts[majorInd[k] - base].fetch_add(1, std::memory_order_relaxed);
+
+      if (expand && majorInd[k] != minorInd[k]) {
+        counts[minorInd[k] - base].fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  });
+
+  A->m = (int)M;
+  A->n = (int)N;
+  A->nnz = (int)total;
+  A->base = base;
+  A->csrFormat = csrFormat;
+  A->field = field;
+  A->symmetry = symmetry;
+  A->ptr.resize(majorDim + 1);
+
+  int sum = 0;
+
+  for (int r = 0; r < majorDim; r++) {
+    int c = counts[r].load(std::memory_order_relaxed);
+    counts[r].store(sum, std::memory_order_relaxed);
+    A->ptr[r] = sum + base;
+    sum += c;
+  }
+
+  A->ptr[majorDim] = sum + base;
+
+  struct Slot {
+    int minor;
+    int src;
+  };
+  std::vector<Slot> slots((size_t)total);
+
+  sdkParallelFor(0, nz, 1 << 16, [&](int64_t b, int64_t e, int) {
+    for (int64_t k = b; k < e; k++) {
+      int pos = counts[majorInd[k] - base].fetch_add(1, std::memory_order_relaxed);
+      slots[pos].minor = minorInd[k];
+      slots[pos].src = (int)k;
+
+      if (expand && majorInd[k] != minorInd[k]) {
+        pos = counts[minorInd[k] - base].fetch_add(1, std::memory_order_relaxed);
+        slots[pos].minor = majorInd[k];
+        slots[pos].src = ~(int)k;
+      }
+    }
+  });
+
+  // sort each row by minor index (ties by source position, so the result is
+  // deterministic) and gather the values
+  A->ind.resize((size_t)total);
+  A->val.resize((size_t)total * valsPerEntry);
+  const bool conjugate = (symmetry == MM_SYMMETRY_HERMITIAN);
+  const bool negate = (symmetry == MM_SYMMETRY_SKEW);
+
+  sdkParallelFor(0, majorDim, 1 << 12, [&](int64_t rb, int64_t re, int) {
+    for (int64_t r = rb; r < re; r++) {
+      Slot *first = slots.data() + A->ptr[r] - base;
+      Slot *last = slots.data() + A->ptr[r + 1] - base;
+      std::sort(first, last, [](const Slot &a, const Slot &b) {
+        if (a.minor != b.minor) return a.minor < b.minor;
+        int ka = a.src < 0 ? ~a.src : a.src, kb = b.src < 0 ? ~b.src : b.src;
+        return (ka != kb) ? ka < kb : a.src > b.src;
+      });
+
+      for (Slot *s = first; s < last; s++) {
+        size_t k = s - slots.data();
+        bool mirrored = s->src < 0;
+        size_t e = mirrored ? ~s->src : s->src;
+        A->ind[k] = s->minor;
+
+        if (valsPerEntry == 2) {
+          A->val[2 * k] = values[2 * e];
+          A->val[2 * k + 1] = (mirrored && conjugate) ? -values[2 * e + 1]
+                                                      : values[2 * e + 1];
+          if (mirrored && negate) {
+            A->val[2 * k] = -A->val[2 * k];
+            A->val[2 * k + 1] = -A->val[2 * k + 1];
+          }
+        } else {
+          A->val[k] = (mirrored && negate) ? -values[e] : values[e];
+        }
+      }
+    }
+  });
+
+  if (useCache) {
+    mmWriteCache(filename, (int64_t)map.size(), digest, extendSymMatrix, *A);
+  }
+
+  return MMLOAD_SUCCESS;
+}
+
+#endif  // COMMON_HELPER_MMIO_H_
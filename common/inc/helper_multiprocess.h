@@ -101,4 +101,56 @@ ipcSendShareableHandles(ipcHandle *handle, const std::vector<ShareableHandle>& s
 int
 ipcCloseShareableHandle(ShareableHandle shHandle);
 
+// Single-producer/multi-consumer ring of fixed-size slots in shared memory,
+// for passing frames between processes without copies or serialization.
+// The producer writes a frame in place into the slot returned by
+// shmRingReserve and publishes it with shmRingCommit; every frame goes to
+// exactly one consumer, which reads it in place between shmRingAcquire and
+// shmRingRelease. Each handle holds at most one slot at a time, a process
+// with several consumer threads opens one handle per thread.
+//
+// The ring is lock-free: consumers claim frames with a compare-and-swap on
+// a shared tail, and a per-slot sequence number tells the producer when a
+// slot has been released. An empty or full ring blocks in a futex on Linux
+// after a short spin, elsewhere the wait yields the processor.
+struct shmRingHeader_st;
+
+typedef struct shmRingInfo_st {
+    sharedMemoryInfo shm;
+    struct shmRingHeader_st *header;
+    unsigned char *slots;
+    unsigned long long position;  // slot held by this handle
+    int owner;
+    char name[256];
+} shmRingInfo;
+
+// Creates a ring of slotCount slots (rounded up to a power of two, at least
+// two) of slotSize bytes each. The creator is the producer and removes the ring
+// when it closes it.
+int shmRingCreate(const char *name, size_t slotSize, unsigned int slotCount,
+                  shmRingInfo *ring);
+
+// Opens a ring created by another process, as a consumer.
+int shmRingOpen(const char *name, shmRingInfo *ring);
+
+void shmRingClose(shmRingInfo *ring);
+
+// Bytes available in a slot.
+size_t shmRingSlotSize(const shmRingInfo *ring);
+
+// Producer: waits for a free slot and returns it.
+void *shmRingReserve(shmRingInfo *ring);
+
+// Producer: publishes the reserved slot holding size bytes.
+void shmRingCommit(shmRingInfo *ring, size_t size);
+
+// Producer: ends the stream, consumers get NULL once the ring is drained.
+void shmRingShutdown(shmRingInfo *ring);
+
+// Consumer: waits for a frame and returns it, NULL after shmRingShutdown.
+const void *shmRingAcquire(shmRingInfo *ring, size_t *size);
+
+// Consumer: hands the acquired slot back to the producer.
+void shmRingRelease(shmRingInfo *ring);
+
 #endif // HELPER_MULTIPROCESS_H
@@ -0,0 +1,368 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Ahead-of-time builds of kernel variants into one indexed bundle file.
+//
+// A variant is a kernel source with an instantiation appended (explicit
+// template instantiations or extern "C" wrappers that pick the template
+// arguments) and its own options (macros, target architecture). All
+// variants of a build are compiled concurrently on the helper_parallel.h
+// pool through an SdkKernelCompiler, by way of the kernel cache, so
+// unchanged variants are not recompiled, and are packed into a bundle:
+//
+//   header   magic, version, variant count, index offset, file size
+//   payloads the binaries, each aligned to kSdkBundleAlignment
+//   index    one entry per variant (key hash, build digest, payload offset
+//            and size, key offset and length), sorted by hash
+//   keys     the variant keys
+//
+// The build digest of a variant is its kernel cache key (compiler identity,
+// source with the instantiation, included headers, options), so
+// sdkKernelBundleCurrent can tell a bundle built from other sources or
+// options from a current one without compiling anything.
+//
+// The bundle is written to a temporary file and renamed into place. An
+// SdkKernelBundle maps the whole file once and finds a variant with a
+// binary search of the index; the binaries are used in place.
+#ifndef COMMON_HELPER_NVRTC_BUNDLE_H_
+#define COMMON_HELPER_NVRTC_BUNDLE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <helper_file.h>
+#include <helper_mmio.h>
+#include <helper_nvrtc_cache.h>
+#include <helper_parallel.h>
+
+static const uint64_t kSdkBundleMagic = 0x31444e424c4e524bull;  // "KRNLBND1"
+static const uint32_t kSdkBundleVersion = 2;
+static const uint64_t kSdkBundleAlignment = 256;
+
+//! One variant of a bundle build.
+struct SdkKernelVariant {
+  std::string key;                   //!< name of the variant in the bundle
+  std::string source;                //!< kernel source
+  std::string name;                  //!< source file name, for includes
+  std::string instantiation;         //!< appended to the source
+  std::vector<std::string> options;  //!< compiler options
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Internal helpers
+////////////////////////////////////////////////////////////////////////////////
+struct SdkBundleHeader {
+  uint64_t magic;
+  uint32_t version;
+  uint32_t count;
+  uint64_t indexOffset;
+  uint64_t fileSize;
+};
+
+struct SdkBundleEntry {
+  uint64_t hash;
+  uint64_t digest;
+  uint64_t offset;
+  uint64_t size;
+  uint64_t keyOffset;
+  uint64_t keyLength;
+};
+
+inline uint64_t sdkBundleKeyHash(const char *key, size_t length) {
+  SdkDigest digest;
+  digest.add(key, length);
+  return digest.value();
+}
+
+// The source a variant is compiled from.
+inline std::string sdkKernelVariantSource(const SdkKernelVariant &v) {
+  return v.source + "\n" + v.instantiation + "\n";
+}
+
+// Build digest of a variant, see the top of this file.
+inline uint64_t sdkKernelVariantDigest(SdkKernelCompiler &compiler,
+                                       const SdkKernelCache &cache,
+                                       const SdkKernelVariant &v) {
+  SdkDigest digest;
+  digest.add(cache.key(compiler, sdkKernelVariantSource(v), v.name, v.options));
+  return digest.value();
+}
+
+inline uint64_t sdkBundleAlign(uint64_t offset) {
+  return (offset + kSdkBundleAlignment - 1) & ~(kSdkBundleAlignment - 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Compiles variants concurrently and writes them to a bundle at path.
+//! Returns false if a key is repeated or a variant does not compile, with
+//! the compiler output of the failed variants in log; the bundle is not
+//! written then.
+////////////////////////////////////////////////////////////////////////////////
+inline bool sdkBuildKernelBundle(SdkKernelCompiler &compiler,
+                                 SdkKernelCache &cache,
+                                 const std::vector<SdkKernelVariant> &variants,
+                                 const std::string &path, std::string &log) {
+  const int count = (int)variants.size();
+  std::vector<std::vector<char> > binaries(count);
+  std::vector<std::string> logs(count);
+  std::vector<uint64_t> digests(count);
+  std::vector<char> compiled(count, 0);
+  log.clear();
+
+  std::vector<std::string> keys(count);
+
+  for (int i = 0; i < count; i++) keys[i] = variants[i].key;
+
+  std::sort(keys.begin(), keys.end());
+
+  if (std::adjacent_find(keys.begin(), keys.end()) != keys.end()) {
+    log = "repeated variant key " + *std::adjacent_find(keys.begin(), keys.end());
+    return false;
+  }
+
+  sdkParallelFor(0, count, 1, [&](int64_t b, int64_t e, int) {
+    for (int64_t i = b; i < e; i++) {
+      const SdkKernelVariant &v = variants[i];
+      digests[i] = sdkKernelVariantDigest(compiler, cache, v);
+      compiled[i] = sdkCompileCached(compiler, cache, sdkKernelVariantSource(v),
+                                     v.name, v.options, binaries[i], logs[i]);
+    }
+  });
+
+  bool ok = true;
+
+  for (int i = 0; i < count; i++) {
+    if (!compiled[i]) {
+      log += variants[i].key + ":\n" + logs[i] + "\n";
+      ok = false;
+    }
+  }
+
+  if (!ok) return false;
+
+  // payloads, then the index sorted by key hash, then the keys
+  std::vector<SdkBundleEntry> index(count);
+  uint64_t offset = sdkBundleAlign(sizeof(SdkBundleHeader));
+
+  for (int i = 0; i < count; i++) {
+    index[i].hash =
+        sdkBundleKeyHash(variants[i].key.data(), variants[i].key.size());
+    index[i].digest = digests[i];
+    index[i].offset = offset;
+    index[i].size = binaries[i].size();
+    offset = sdkBundleAlign(offset + binaries[i].size());
+  }
+
+  const uint64_t indexOffset = offset;
+  uint64_t keyOffset = indexOffset + count * sizeof(SdkBundleEntry);
+
+  for (int i = 0; i < count; i++) {
+    index[i].keyOffset = keyOffset;
+    index[i].keyLength = variants[i].key.size();
+    keyOffset += variants[i].key.size();
+  }
+
+  SdkBundleHeader header = {kSdkBundleMagic, kSdkBundleVersion,
+                            (uint32_t)count, indexOffset, keyOffset};
+
+  std::vector<SdkBundleEntry> sorted = index;
+  std::sort(sorted.begin(), sorted.end(),
+            [](const SdkBundleEntry &a, const SdkBundleEntry &b) {
+              return a.hash < b.hash;
+            });
+
+  // the address of header tells concurrent builds of one process apart
+  char suffix[64];
+  snprintf(suffix, sizeof(suffix), ".%d.%llx.tmp", sdkProcessId(),
+           (unsigned long long)(uintptr_t)&header);
+  const std::string temp = path + suffix;
+  FILE *f = fopen(temp.c_str(), "wb");
+
+  if (f == NULL) {
+    log = "unable to write " + temp;
+    return false;
+  }
+
+  const char zeros[kSdkBundleAlignment] = {0};
+  uint64_t written = 0;
+
+  auto put = [&](const void *data, uint64_t bytes) {
+    if (bytes > 0 && fwrite(data, (size_t)bytes, 1, f) != 1) ok = false;
+
+    written += bytes;
+  };
+
+  put(&header, sizeof(header));
+
+  for (int i = 0; i < count; i++) {
+    put(zeros, index[i].offset - written);
+    put(binaries[i].data(), binaries[i].size());
+  }
+
+  put(zeros, indexOffset - written);
+  put(sorted.data(), count * sizeof(SdkBundleEntry));
+
+  for (int i = 0; i < count; i++) {
+    put(variants[i].key.data(), variants[i].key.size());
+  }
+
+  ok = (fclose(f) == 0) && ok;
+
+  if (!ok || !sdkReplaceFile(temp, path)) {
+    remove(temp.c_str());
+    log = "unable to write " + path;
+    return false;
+  }
+
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! Read-only view of a bundle, mapped with a single mmap.
+////////////////////////////////////////////////////////////////////////////////
+class SdkKernelBundle {
+ public:
+  SdkKernelBundle() : index_(NULL), count_(0) {}
+
+  //! Maps the bundle at path and checks its layout; false if it is missing
+  //! or not a valid bundle.
+  bool open(const char *path) {
+    close();
+
+    if (!map_.open(path) || map_.size() < sizeof(SdkBundleHeader)) {
+      close();
+      return false;
+    }
+
+    SdkBundleHeader header;
+    memcpy(&header, map_.data(), sizeof(header));
+    const uint64_t size = map_.size();
+
+    bool valid = header.magic == kSdkBundleMagic &&
+                 header.version == kSdkBundleVersion &&
+                 header.fileSize == size && header.indexOffset <= size &&
+                 header.count <= (size - header.indexOffset) /
+                                     sizeof(SdkBundleEntry) &&
+                 header.indexOffset % sizeof(uint64_t) == 0;
+
+    index_ = (const SdkBundleEntry *)(map_.data() + header.indexOffset);
+    count_ = valid ? header.count : 0;
+
+    for (int i = 0; valid && i < count_; i++) {
+      const SdkBundleEntry &e = index_[i];
+      valid = e.offset <= size && e.size <= size - e.offset &&
+              e.keyOffset <= size && e.keyLength <= size - e.keyOffset &&
+              (i == 0 || index_[i - 1].hash <= e.hash);
+    }
+
+    if (!valid) close();
+
+    return valid;
+  }
+
+  void close() {
+    map_.close();
+    index_ = NULL;
+    count_ = 0;
+  }
+
+  //! Number of variants.
+  int count() const { return count_; }
+
+  //! Key of variant i, in index order.
+  std::string key(int i) const {
+    return std::string(map_.data() + index_[i].keyOffset,
+                       (size_t)index_[i].keyLength);
+  }
+
+  //! Binary of the variant named key, NULL if there is none. The pointer is
+  //! into the mapping and valid until the bundle is closed.
+  const char *find(const std::string &key, size_t *size) const {
+    const SdkBundleEntry *e = entry(key);
+
+    if (e == NULL) return NULL;
+
+    if (size) *size = (size_t)e->size;
+
+    return map_.data() + e->offset;
+  }
+
+  //! Build digest of the variant named key; false if there is none.
+  bool digest(const std::string &key, uint64_t &digest) const {
+    const SdkBundleEntry *e = entry(key);
+
+    if (e == NULL) return false;
+
+    digest = e->digest;
+    return true;
+  }
+
+ private:
+  SdkKernelBundle(const SdkKernelBundle &);
+  SdkKernelBundle &operator=(const SdkKernelBundle &);
+
+  const SdkBundleEntry *entry(const std::string &key) const {
+    const uint64_t hash = sdkBundleKeyHash(key.data(), key.size());
+    int lo = 0, hi = count_;
+
+    while (lo < hi) {
+      const int mid = (lo + hi) / 2;
+
+      if (index_[mid].hash < hash) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+
+    for (int i = lo; i < count_ && index_[i].hash == hash; i++) {
+      const SdkBundleEntry &e = index_[i];
+
+      if (e.keyLength == key.size() &&
+          memcmp(map_.data() + e.keyOffset, key.data(), key.size()) == 0) {
+        return &e;
+      }
+    }
+
+    return NULL;
+  }
+
+  MMFileMapping map_;
+  const SdkBundleEntry *index_;
+  int count_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! True if bundle holds every variant, built from the same sources and
+//! options; false if one is missing or stale and the bundle needs a rebuild.
+////////////////////////////////////////////////////////////////////////////////
+inline bool sdkKernelBundleCurrent(SdkKernelCompiler &compiler,
+                                   const SdkKernelCache &cache,
+                                   const SdkKernelBundle &bundle,
+                                   const std::vector<SdkKernelVariant> &variants) {
+  for (size_t i = 0; i < variants.size(); i++) {
+    uint64_t digest;
+
+    if (!bundle.digest(variants[i].key, digest) ||
+        digest != sdkKernelVariantDigest(compiler, cache, variants[i])) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+#endif  // COMMON_HELPER_NVRTC_BUNDLE_H_
@@ -0,0 +1,478 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Persistent, content-addressed cache of runtime compiled kernels.
+//
+// A cache entry is named by a 128-bit digest of everything that determines
+// the binary: the compiler identity (name and version), the source and its
+// file name, the contents of the headers it includes (found through the
+// source folder and the --include-path / -I options, recursively), and the
+// options, which carry the target architecture. Changing any of them gives
+// a new name, so entries are never invalidated, only evicted.
+//
+//  - Entries are written to a temporary file in the cache folder and
+//    renamed into place, so concurrent processes never see partial ones.
+//    Every entry carries a checksum of its payload and a damaged entry is
+//    dropped as a miss.
+//  - Hits refresh the entry's modification time; when the folder grows past
+//    its size cap after a store, the least recently used entries go first.
+//  - The compiler is an SdkKernelCompiler, so the cache logic does not
+//    depend on a toolkit; nvrtc_helper.h provides the NVRTC one.
+//
+// SDK_NVRTC_CACHE selects the folder ("0" disables the cache), by default
+// cuda-samples-nvrtc under the user's cache folder, and SDK_NVRTC_CACHE_MB
+// the size cap (256 MB).
+#ifndef COMMON_HELPER_NVRTC_CACHE_H_
+#define COMMON_HELPER_NVRTC_CACHE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <algorithm>
+#include <atomic>
+#include <set>
+#include <string>
+#include <vector>
+
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#include <direct.h>
+#include <sys/utime.h>
+#undef min
+#undef max
+#else
+#include <dirent.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+#include <helper_file.h>
+
+//! Compiler backend of the cache.
+class SdkKernelCompiler {
+ public:
+  virtual ~SdkKernelCompiler() {}
+
+  //! Name and version; part of every cache key.
+  virtual std::string identity() = 0;
+
+  //! Compiles source (named name) with options into binary. Returns false
+  //! on failure; log receives the compiler output either way. May be called
+  //! from several threads at once.
+  virtual bool compile(const std::string &source, const std::string &name,
+                       const std::vector<std::string> &options,
+                       std::vector<char> &binary, std::string &log) = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Internal helpers
+////////////////////////////////////////////////////////////////////////////////
+// Two independent 64-bit FNV-1a lanes with a final mix, 128 bits of key.
+class SdkDigest {
+ public:
+  SdkDigest() : a_(0xcbf29ce484222325ull), b_(0x84222325cbf29ce4ull) {}
+
+  void add(const void *data, size_t bytes) {
+    const unsigned char *p = (const unsigned char *)data;
+
+    for (size_t i = 0; i < bytes; i++) {
+      a_ = (a_ ^ p[i]) * 0x100000001b3ull;
+      b_ = (b_ ^ p[i]) * 0x100000001b3ull + 0x9e3779b97f4a7c15ull;
+    }
+  }
+
+  // Length-prefixed, so that field boundaries are part of the digest.
+  void add(const std::string &s) {
+    const uint64_t n = s.size();
+    add(&n, sizeof(n));
+    add(s.data(), s.size());
+  }
+
+  std::string hex() const {
+    char text[33];
+    snprintf(text, sizeof(text), "%016llx%016llx",
+             (unsigned long long)mix(a_), (unsigned long long)mix(b_ ^ a_));
+    return text;
+  }
+
+  uint64_t value() const { return mix(a_) ^ b_; }
+
+ private:
+  static uint64_t mix(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+  }
+
+  uint64_t a_, b_;
+};
+
+inline std::string sdkDirName(const std::string &path) {
+  const size_t slash = path.find_last_of("/\\");
+  return (slash == std::string::npos) ? std::string(".")
+                                      : path.substr(0, slash);
+}
+
+// Names in the #include directives of a source, quoted or angled.
+inline std::vector<std::string> sdkIncludedNames(const std::string &source) {
+  std::vector<std::string> names;
+  size_t pos = 0;
+
+  while ((pos = source.find("#", pos)) != std::string::npos) {
+    size_t p = pos + 1;
+
+    while (p < source.size() && (source[p] == ' ' || source[p] == '\t')) p++;
+
+    pos = p;
+
+    if (source.compare(p, 7, "include") != 0) continue;
+
+    p += 7;
+
+    while (p < source.size() && (source[p] == ' ' || source[p] == '\t')) p++;
+
+    if (p >= source.size() || (source[p] != '"' && source[p] != '<')) continue;
+
+    const char close = (source[p] == '"') ? '"' : '>';
+    const size_t end = source.find_first_of(std::string(1, close) + "\n",
+                                            p + 1);
+
+    if (end != std::string::npos && source[end] == close) {
+      names.push_back(source.substr(p + 1, end - p - 1));
+    }
+  }
+
+  return names;
+}
+
+// Adds the headers included by source, found in dir or the include
+// folders, and the headers they include. Headers that are not found (the
+// compiler's own) are keyed by name, the compiler identity covers them.
+inline void sdkDigestIncludes(SdkDigest &digest, const std::string &source,
+                              const std::string &dir,
+                              const std::vector<std::string> &includeDirs,
+                              std::set<std::string> &seen, int depth) {
+  if (depth > 32) return;
+
+  const std::vector<std::string> names = sdkIncludedNames(source);
+
+  for (size_t i = 0; i < names.size(); i++) {
+    std::string path, text;
+    bool found = sdkReadFile(dir + "/" + names[i], text);
+
+    if (found) path = dir + "/" + names[i];
+
+    for (size_t d = 0; !found && d < includeDirs.size(); d++) {
+      found = sdkReadFile(includeDirs[d] + "/" + names[i], text);
+
+      if (found) path = includeDirs[d] + "/" + names[i];
+    }
+
+    digest.add(names[i]);
+
+    if (!found) continue;
+
+    digest.add(text);
+
+    if (seen.insert(path).second) {
+      sdkDigestIncludes(digest, text, sdkDirName(path), includeDirs, seen,
+                        depth + 1);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//! On-disk kernel cache, see the top of this file.
+////////////////////////////////////////////////////////////////////////////////
+class SdkKernelCache {
+ public:
+  static const uint64_t kMagic = 0x3143454e52454b53ull;  // "SKERNEC1"
+
+  //! Cache in folder, which is created if needed, capped at maxBytes. An
+  //! empty folder disables the cache.
+  SdkKernelCache(const std::string &folder, uint64_t maxBytes)
+      : folder_(folder), maxBytes_(maxBytes), hits_(0), misses_(0) {
+    if (!folder_.empty() && !makeFolders(folder_)) folder_.clear();
+  }
+
+  //! The cache configured by SDK_NVRTC_CACHE and SDK_NVRTC_CACHE_MB.
+  static SdkKernelCache &instance() {
+    static SdkKernelCache cache(defaultFolder(), defaultMaxBytes());
+    return cache;
+  }
+
+  bool enabled() const { return !folder_.empty(); }
+  const std::string &folder() const { return folder_; }
+  int hits() const { return hits_; }
+  int misses() const { return misses_; }
+
+  //! Cache key of a compilation of source (from file name) with options.
+  std::string key(SdkKernelCompiler &compiler, const std::string &source,
+                  const std::string &name,
+                  const std::vector<std::string> &options) const {
+    SdkDigest digest;
+    std::vector<std::string> includeDirs;
+    std::set<std::string> seen;
+
+    for (size_t i = 0; i < options.size(); i++) {
+      const std::string &o = options[i];
+
+      if (o.compare(0, 15, "--include-path=") == 0) {
+        includeDirs.push_back(o.substr(15));
+      } else if (o.compare(0, 2, "-I") == 0) {
+        includeDirs.push_back(o.substr(2));
+      }
+    }
+
+    digest.add(compiler.identity());
+    digest.add(name);
+    digest.add(source);
+    digest.add(std::string("options"));
+
+    for (size_t i = 0; i < options.size(); i++) digest.add(options[i]);
+
+    digest.add(std::string("includes"));
+    sdkDigestIncludes(digest, source, sdkDirName(name), includeDirs, seen, 0);
+    return digest.hex();
+  }
+
+  //! Reads the entry of key into binary; false on a miss.
+  bool load(const std::string &key, std::vector<char> &binary) {
+    if (!enabled()) return false;
+
+    const std::string path = entryPath(key);
+    std::string text;
+
+    if (!sdkReadFile(path, text)) {
+      misses_++;
+      return false;
+    }
+
+    uint64_t header[3];
+
+    if (text.size() < sizeof(header)) return dropEntry(path);
+
+    memcpy(header, text.data(), sizeof(header));
+
+    if (header[0] != kMagic || header[1] != text.size() - sizeof(header)) {
+      return dropEntry(path);
+    }
+
+    SdkDigest check;
+    check.add(text.data() + sizeof(header), (size_t)header[1]);
+
+    if (check.value() != header[2]) return dropEntry(path);
+
+    binary.assign(text.begin() + sizeof(header), text.end());
+    touch(path);
+    hits_++;
+    return true;
+  }
+
+  //! Stores binary under key, atomically, then enforces the size cap.
+  void store(const std::string &key, const std::vector<char> &binary) {
+    if (!enabled()) return;
+
+    char suffix[64];
+    snprintf(suffix, sizeof(suffix), ".%d.%llx.tmp", sdkProcessId(),
+             (unsigned long long)(uintptr_t)&binary);
+    const std::string path = entryPath(key);
+    const std::string temp = path + suffix;
+
+    uint64_t header[3] = {kMagic, binary.size(), 0};
+    SdkDigest check;
+    check.add(binary.data(), binary.size());
+    header[2] = check.value();
+
+    FILE *f = fopen(temp.c_str(), "wb");
+
+    if (f == NULL) return;
+
+    bool ok = fwrite(header, sizeof(header), 1, f) == 1;
+    ok = ok && (binary.empty() ||
+                fwrite(binary.data(), binary.size(), 1, f) == 1);
+    ok = (fclose(f) == 0) && ok;
+
+    if (!ok || !sdkReplaceFile(temp, path)) {
+      remove(temp.c_str());
+      return;
+    }
+
+    evict();
+  }
+
+  //! Removes the least recently used entries until the folder fits the cap.
+  void evict() {
+    struct Entry {
+      std::string path;
+      uint64_t bytes;
+      time_t used;
+      bool operator<(const Entry &e) const {
+        return used != e.used ? used < e.used : path < e.path;
+      }
+    };
+
+    std::vector<Entry> entries;
+    uint64_t total = 0;
+    const std::vector<std::string> names = listEntries();
+
+    for (size_t i = 0; i < names.size(); i++) {
+      struct stat info;
+      const std::string path = folder_ + "/" + names[i];
+
+      if (stat(path.c_str(), &info) != 0) continue;
+
+      Entry e = {path, (uint64_t)info.st_size, info.st_mtime};
+      entries.push_back(e);
+      total += e.bytes;
+    }
+
+    std::sort(entries.begin(), entries.end());
+
+    for (size_t i = 0; i < entries.size() && total > maxBytes_; i++) {
+      if (remove(entries[i].path.c_str()) == 0) total -= entries[i].bytes;
+    }
+  }
+
+ private:
+  static std::string defaultFolder() {
+    const char *env = getenv("SDK_NVRTC_CACHE");
+
+    if (env != NULL) return strcmp(env, "0") == 0 ? std::string() : env;
+
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+    const char *base = getenv("LOCALAPPDATA");
+    return base ? std::string(base) + "\\cuda-samples-nvrtc" : std::string();
+#else
+    const char *base = getenv("XDG_CACHE_HOME");
+
+    if (base != NULL && base[0] != '\0') {
+      return std::string(base) + "/cuda-samples-nvrtc";
+    }
+
+    base = getenv("HOME");
+    return base ? std::string(base) + "/.cache/cuda-samples-nvrtc"
+                : std::string();
+#endif
+  }
+
+  static uint64_t defaultMaxBytes() {
+    const char *env = getenv("SDK_NVRTC_CACHE_MB");
+    const long long mb = (env != NULL) ? atoll(env) : 0;
+    return (uint64_t)(mb > 0 ? mb : 256) << 20;
+  }
+
+  std::string entryPath(const std::string &key) const {
+    return folder_ + "/" + key + ".bin";
+  }
+
+  bool dropEntry(const std::string &path) {
+    remove(path.c_str());
+    misses_++;
+    return false;
+  }
+
+  static bool makeFolders(const std::string &folder) {
+    for (size_t p = folder.find_first_of("/\\", 1); ;
+         p = folder.find_first_of("/\\", p + 1)) {
+      const std::string prefix = folder.substr(0, p);
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+      _mkdir(prefix.c_str());
+#else
+      mkdir(prefix.c_str(), 0755);
+#endif
+
+      if (p == std::string::npos) break;
+    }
+
+    struct stat info;
+    return stat(folder.c_str(), &info) == 0 && (info.st_mode & S_IFDIR);
+  }
+
+  static void touch(const std::string &path) {
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+    _utime(path.c_str(), NULL);
+#else
+    utime(path.c_str(), NULL);
+#endif
+  }
+
+  // Names of the entries in the folder, not the temporary files.
+  std::vector<std::string> listEntries() const {
+    std::vector<std::string> names;
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+    WIN32_FIND_DATAA found;
+    HANDLE find = FindFirstFileA((folder_ + "\\*.bin").c_str(), &found);
+
+    if (find != INVALID_HANDLE_VALUE) {
+      do {
+        names.push_back(found.cFileName);
+      } while (FindNextFileA(find, &found));
+
+      FindClose(find);
+    }
+#else
+    DIR *dir = opendir(folder_.c_str());
+
+    if (dir != NULL) {
+      for (struct dirent *e = readdir(dir); e != NULL; e = readdir(dir)) {
+        const std::string name = e->d_name;
+
+        if (name.size() > 4 && name.compare(name.size() - 4, 4, ".bin") == 0) {
+          names.push_back(name);
+        }
+      }
+
+      closedir(dir);
+    }
+#endif
+    return names;
+  }
+
+  std::string folder_;
+  uint64_t maxBytes_;
+  std::atomic<int> hits_, misses_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Compiles source through the cache: a hit returns the stored binary
+//! without invoking the compiler, a miss compiles and stores the result.
+//! Returns false if the compilation fails; log holds the compiler output
+//! of a miss.
+////////////////////////////////////////////////////////////////////////////////
+inline bool sdkCompileCached(SdkKernelCompiler &compiler, SdkKernelCache &cache,
+                             const std::string &source, const std::string &name,
+                             const std::vector<std::string> &options,
+                             std::vector<char> &binary, std::string &log) {
+  log.clear();
+  std::string key;
+
+  if (cache.enabled()) {
+    key = cache.key(compiler, source, name, options);
+
+    if (cache.load(key, binary)) return true;
+  }
+
+  if (!compiler.compile(source, name, options, binary, log)) return false;
+
+  if (cache.enabled()) cache.store(key, binary);
+
+  return true;
+}
+
+#endif  // COMMON_HELPER_NVRTC_CACHE_H_
@@ -0,0 +1,184 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Helper functions for multithreaded host-side loops. sdkParallelFor() runs
+// its chunks as tasks on the persistent work-stealing pool of
+// helper_threadpool.h, sdkParallelTeam() starts threads of its own because
+// its members must run concurrently.
+#ifndef COMMON_HELPER_PARALLEL_H_
+#define COMMON_HELPER_PARALLEL_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <helper_threadpool.h>
+
+inline int &sdkNumThreadsSetting() {
+  static int numThreads = 0;
+  return numThreads;
+}
+
+//! Number of host threads used by the sdkParallel* helpers. The value of the
+//! SDK_NUM_THREADS environment variable takes precedence over the number of
+//! hardware threads reported by the OS, sdkSetNumThreads() overrides both.
+inline int sdkGetNumThreads() {
+  int &numThreads = sdkNumThreadsSetting();
+
+  if (numThreads == 0) {
+    int n = 0;
+    const char *env = getenv("SDK_NUM_THREADS");
+
+    if (env != NULL) {
+      n = atoi(env);
+    }
+
+    if (n <= 0) {
+      n = (int)std::thread::hardware_concurrency();
+    }
+
+    numThreads = (n > 0) ? n : 1;
+  }
+
+  return numThreads;
+}
+
+//! Change the number of threads used by subsequent calls, e.g. for scaling
+//! runs. Passing 0 restores the default.
+inline void sdkSetNumThreads(int numThreads) {
+  sdkNumThreadsSetting() = (numThreads > 0) ? numThreads : 0;
+}
+
+//! The process-wide work-stealing pool, started on first use. Its workers
+//! and the thread that waits for a parallel loop make max(sdkGetNumThreads(),
+//! hardware threads) threads; later sdkSetNumThreads() calls change how
+//! work is split but not the size of the pool.
+inline SdkThreadPool &sdkThreadPool() {
+  static SdkThreadPool pool(
+      std::max(sdkGetNumThreads(), (int)std::thread::hardware_concurrency()) -
+      1);
+  return pool;
+}
+
+//! Split [begin, end) into at most sdkGetNumThreads() contiguous chunks of at
+//! least grain elements each and call func(chunkBegin, chunkEnd, chunkId) for
+//! every chunk in parallel. Returns the number of chunks that were used, so
+//! callers can size per-chunk scratch arrays up front with
+//! sdkParallelChunks().
+inline int sdkParallelChunks(int64_t begin, int64_t end, int64_t grain = 1) {
+  int64_t n = end - begin;
+
+  if (n <= 0) {
+    return 0;
+  }
+
+  grain = std::max<int64_t>(grain, 1);
+  int64_t chunks = std::min<int64_t>(sdkGetNumThreads(), (n + grain - 1) / grain);
+  return (int)std::max<int64_t>(chunks, 1);
+}
+
+template <typename Func>
+inline int sdkParallelFor(int64_t begin, int64_t end, int64_t grain,
+                          Func func) {
+  int chunks = sdkParallelChunks(begin, end, grain);
+
+  if (chunks <= 1) {
+    if (chunks == 1) {
+      func(begin, end, 0);
+    }
+
+    return chunks;
+  }
+
+  int64_t n = end - begin;
+  SdkTaskGroup group(sdkThreadPool());
+
+  for (int c = 1; c < chunks; c++) {
+    int64_t b = begin + n * c / chunks;
+    int64_t e = begin + n * (c + 1) / chunks;
+    group.run([&func, b, e, c]() { func(b, e, c); });
+  }
+
+  func(begin, begin + n / chunks, 0);
+  group.wait();
+
+  return chunks;
+}
+
+//! Run func(threadId, numThreads) on numThreads threads that are guaranteed
+//! to execute concurrently, so they may synchronize with an SdkSpinBarrier.
+template <typename Func>
+inline void sdkParallelTeam(int numThreads, Func func) {
+  if (numThreads <= 1) {
+    func(0, 1);
+    return;
+  }
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads - 1);
+
+  for (int t = 1; t < numThreads; t++) {
+    threads.push_back(std::thread(func, t, numThreads));
+  }
+
+  func(0, numThreads);
+
+  for (size_t t = 0; t < threads.size(); t++) {
+    threads[t].join();
+  }
+}
+
+//! Reusable barrier for the members of an sdkParallelTeam.
+class SdkSpinBarrier {
+ public:
+  explicit SdkSpinBarrier(int numThreads)
+      : numThreads_(numThreads), count_(0), generation_(0) {}
+
+  void wait() {
+    const unsigned generation = generation_.load(std::memory_order_acquire);
+
+    if (count_.fetch_add(1, std::memory_order_acq_rel) == numThreads_ - 1) {
+      count_.store(0, std::memory_order_relaxed);
+      generation_.fetch_add(1, std::memory_order_release);
+      return;
+    }
+
+    for (int spin = 0;
+         generation_.load(std::memory_order_acquire) == generation; spin++) {
+      if (spin > 64) std::this_thread::yield();
+    }
+  }
+
+ private:
+  int numThreads_;
+  std::atomic<int> count_;
+  std::atomic<unsigned> generation_;
+};
+
+//! Exclusive prefix sum over counts[0..n), writing the total to counts[n].
+template <typename T>
+inline void sdkExclusiveScan(T *counts, int64_t n) {
+  T sum = 0;
+
+  for (int64_t i = 0; i < n; i++) {
+    T c = counts[i];
+    counts[i] = sum;
+    sum += c;
+  }
+
+  counts[n] = sum;
+}
+
+#endif  // COMMON_HELPER_PARALLEL_H_
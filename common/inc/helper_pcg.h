@@ -0,0 +1,664 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Host preconditioned conjugate gradient solver.
+//
+// Preconditioners: Jacobi, incomplete Cholesky IC(0), incomplete LU ILU(0)
+// and symmetric Gauss-Seidel. The sparse triangular solves of IC(0), ILU(0)
+// and SGS run in parallel with level-set scheduling: rows whose dependencies
+// are all in earlier levels are solved concurrently on the sdkThreadPool(),
+// and narrow levels run on the calling thread. The CG vector updates are
+// fused so an iteration with a pointwise (Jacobi) preconditioner makes three
+// passes over the vectors:
+//   q = A*p and p.q  |  x,r update, r.r, z = D^-1 r and r.z  |  p = z + b*p
+#ifndef COMMON_HELPER_PCG_H_
+#define COMMON_HELPER_PCG_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <helper_parallel.h>
+#include <helper_spmv.h>
+
+//! Abstract preconditioner z = M^-1 r used by PcgSolver.
+template <typename T>
+class HostPreconditioner {
+ public:
+  virtual ~HostPreconditioner() {}
+
+  //! Builds the preconditioner for A. Returns 0 on success or -1 on
+  //! breakdown (e.g. a non-positive pivot in IC(0)).
+  virtual int setup(const CsrMatrixView<T> &A) = 0;
+
+  //! z = M^-1 r
+  virtual void apply(const T *r, T *z) = 0;
+
+  //! Pointwise preconditioners return their scaling vector (z_i = d_i r_i)
+  //! so the solver can fuse the application into the residual update.
+  virtual const T *pointwiseScaling() const { return NULL; }
+
+  virtual const char *name() const = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Level scheduled sparse triangular solve
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class LevelScheduledTriangularSolver {
+ public:
+  LevelScheduledTriangularSolver() : n_(0), lower_(true), parallel_(false) {}
+
+  //! Takes a CSR triangular factor (lower or upper, including the diagonal
+  //! unless unitDiagonal is set) and computes its level schedule.
+  void init(int n, const int *rowPtr, const int *colInd, const T *val,
+            bool lower, bool unitDiagonal) {
+    n_ = n;
+    lower_ = lower;
+    rowPtr_.assign(n + 1, 0);
+    colInd_.clear();
+    val_.clear();
+    invDiag_.assign(n, T(1));
+
+    for (int i = 0; i < n; i++) {
+      for (int k = rowPtr[i]; k < rowPtr[i + 1]; k++) {
+        const int j = colInd[k];
+
+        if (j == i) {
+          if (!unitDiagonal) invDiag_[i] = T(1) / val[k];
+        } else if ((j < i) == lower) {
+          colInd_.push_back(j);
+          val_.push_back(val[k]);
+        }
+      }
+
+      rowPtr_[i + 1] = (int)colInd_.size();
+    }
+
+    buildLevels();
+  }
+
+  //! Replace the stored values after a numeric refactorization with the
+  //! same pattern, keeping the level schedule.
+  void updateValues(const int *rowPtr, const int *colInd, const T *val,
+                    bool unitDiagonal) {
+    for (int i = 0, dst = 0; i < n_; i++) {
+      for (int k = rowPtr[i]; k < rowPtr[i + 1]; k++) {
+        const int j = colInd[k];
+
+        if (j == i) {
+          if (!unitDiagonal) invDiag_[i] = T(1) / val[k];
+        } else if ((j < i) == lower_) {
+          val_[dst++] = val[k];
+        }
+      }
+    }
+  }
+
+  //! Solve T x = b. x and b may alias.
+  void solve(const T *b, T *x) const {
+    if (!parallel_) {
+      if (lower_) {
+        for (int i = 0; i < n_; i++) solveRow(i, b, x);
+      } else {
+        for (int i = n_ - 1; i >= 0; i--) solveRow(i, b, x);
+      }
+
+      return;
+    }
+
+    // Wide levels are split across the persistent pool; a level of at most
+    // kRowsPerTask rows is a single chunk and runs on the calling thread.
+    // The wait at the end of each sdkParallelFor is the level barrier.
+    const int numLevels = (int)levelPtr_.size() - 1;
+
+    for (int l = 0; l < numLevels; l++) {
+      sdkParallelFor(levelPtr_[l], levelPtr_[l + 1], kRowsPerTask,
+                     [&](int64_t begin, int64_t end, int) {
+                       for (int64_t k = begin; k < end; k++) {
+                         solveRow(levelRows_[k], b, x);
+                       }
+                     });
+    }
+  }
+
+  int numLevels() const { return (int)levelPtr_.size() - 1; }
+
+ private:
+  static const int kRowsPerTask = 128;
+
+  inline void solveRow(int i, const T *b, T *x) const {
+    T sum = b[i];
+
+    for (int k = rowPtr_[i]; k < rowPtr_[i + 1]; k++) {
+      sum -= val_[k] * x[colInd_[k]];
+    }
+
+    x[i] = sum * invDiag_[i];
+  }
+
+  void buildLevels() {
+    std::vector<int> level(n_, 0);
+    int numLevels = 0;
+
+    for (int s = 0; s < n_; s++) {
+      const int i = lower_ ? s : n_ - 1 - s;
+      int l = 0;
+
+      for (int k = rowPtr_[i]; k < rowPtr_[i + 1]; k++) {
+        l = std::max(l, level[colInd_[k]] + 1);
+      }
+
+      level[i] = l;
+      numLevels = std::max(numLevels, l + 1);
+    }
+
+    levelPtr_.assign(numLevels + 1, 0);
+
+    for (int i = 0; i < n_; i++) levelPtr_[level[i] + 1]++;
+    for (int l = 0; l < numLevels; l++) levelPtr_[l + 1] += levelPtr_[l];
+
+    std::vector<int> pos(levelPtr_.begin(), levelPtr_.end() - 1);
+    levelRows_.resize(n_);
+
+    for (int i = 0; i < n_; i++) levelRows_[pos[level[i]]++] = i;
+
+    // a pool round trip per level only pays off when levels are wide
+    parallel_ = sdkGetNumThreads() > 1 && numLevels > 0 &&
+                n_ / numLevels >= kRowsPerTask;
+  }
+
+  int n_;
+  bool lower_;
+  bool parallel_;
+  std::vector<int> rowPtr_;
+  std::vector<int> colInd_;
+  std::vector<T> val_;
+  std::vector<T> invDiag_;
+  std::vector<int> levelPtr_;
+  std::vector<int> levelRows_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Preconditioners
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+inline bool pcgExtractDiagonal(const CsrMatrixView<T> &A, std::vector<T> &d) {
+  d.assign(A.rows, T(0));
+
+  for (int i = 0; i < A.rows; i++) {
+    for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+      if (A.colInd[k] == i) d[i] = A.val[k];
+    }
+
+    if (d[i] == T(0)) return false;
+  }
+
+  return true;
+}
+
+template <typename T>
+class IdentityPreconditioner : public HostPreconditioner<T> {
+ public:
+  int setup(const CsrMatrixView<T> &A) {
+    one_.assign(A.rows, T(1));
+    return 0;
+  }
+  void apply(const T *r, T *z) { std::copy(r, r + one_.size(), z); }
+  const T *pointwiseScaling() const { return one_.data(); }
+  const char *name() const { return "none"; }
+
+ private:
+  std::vector<T> one_;
+};
+
+template <typename T>
+class JacobiPreconditioner : public HostPreconditioner<T> {
+ public:
+  int setup(const CsrMatrixView<T> &A) {
+    if (!pcgExtractDiagonal(A, invDiag_)) return -1;
+    for (size_t i = 0; i < invDiag_.size(); i++) invDiag_[i] = T(1) / invDiag_[i];
+    return 0;
+  }
+  void apply(const T *r, T *z) {
+    for (size_t i = 0; i < invDiag_.size(); i++) z[i] = invDiag_[i] * r[i];
+  }
+  const T *pointwiseScaling() const { return invDiag_.data(); }
+  const char *name() const { return "Jacobi"; }
+
+ private:
+  std::vector<T> invDiag_;
+};
+
+//! Incomplete Cholesky with zero fill, A ~ L L^T on the lower pattern of A.
+template <typename T>
+class IC0Preconditioner : public HostPreconditioner<T> {
+ public:
+  int setup(const CsrMatrixView<T> &A) {
+    const int n = A.rows;
+    std::vector<int> Lptr(n + 1, 0), Lind;
+    std::vector<T> Lval;
+
+    for (int i = 0; i < n; i++) {
+      for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+        if (A.colInd[k] <= i) {
+          Lind.push_back(A.colInd[k]);
+          Lval.push_back(A.val[k]);
+        }
+      }
+
+      Lptr[i + 1] = (int)Lind.size();
+
+      if (Lptr[i + 1] == Lptr[i] || Lind[Lptr[i + 1] - 1] != i) {
+        return -1;  // missing diagonal
+      }
+    }
+
+    // row-oriented (up-looking) factorization; rows are sorted, so the
+    // diagonal is the last entry of each row
+    for (int i = 0; i < n; i++) {
+      for (int k = Lptr[i]; k < Lptr[i + 1]; k++) {
+        const int j = Lind[k];
+        T sum = Lval[k];
+
+        // sparse dot of rows i and j over columns < j
+        int a = Lptr[i], b = Lptr[j];
+
+        while (a < k && b < Lptr[j + 1] - 1) {
+          if (Lind[a] == Lind[b]) {
+            sum -= Lval[a++] * Lval[b++];
+          } else if (Lind[a] < Lind[b]) {
+            a++;
+          } else {
+            b++;
+          }
+        }
+
+        if (j < i) {
+          Lval[k] = sum / Lval[Lptr[j + 1] - 1];
+        } else {
+          if (sum <= T(0)) return -1;
+          Lval[k] = sqrt(sum);
+        }
+      }
+    }
+
+    // L^T as an upper CSR factor for the backward solve
+    std::vector<int> Uptr(n + 1, 0), Uind(Lind.size());
+    std::vector<T> Uval(Lind.size());
+
+    for (size_t k = 0; k < Lind.size(); k++) Uptr[Lind[k] + 1]++;
+    for (int i = 0; i < n; i++) Uptr[i + 1] += Uptr[i];
+
+    std::vector<int> pos(Uptr.begin(), Uptr.end() - 1);
+
+    for (int i = 0; i < n; i++) {
+      for (int k = Lptr[i]; k < Lptr[i + 1]; k++) {
+        const int dst = pos[Lind[k]]++;
+        Uind[dst] = i;
+        Uval[dst] = Lval[k];
+      }
+    }
+
+    L_.init(n, Lptr.data(), Lind.data(), Lval.data(), true, false);
+    U_.init(n, Uptr.data(), Uind.data(), Uval.data(), false, false);
+    y_.assign(n, T(0));
+    return 0;
+  }
+
+  void apply(const T *r, T *z) {
+    L_.solve(r, y_.data());
+    U_.solve(y_.data(), z);
+  }
+
+  const char *name() const { return "IC(0)"; }
+
+ private:
+  LevelScheduledTriangularSolver<T> L_, U_;
+  std::vector<T> y_;
+};
+
+//! Incomplete LU with zero fill, A ~ L U with unit lower L.
+template <typename T>
+class ILU0Preconditioner : public HostPreconditioner<T> {
+ public:
+  int setup(const CsrMatrixView<T> &A) {
+    const int n = A.rows;
+    std::vector<T> lu(A.val, A.val + A.nnz);
+    std::vector<int> diag(n, -1), marker(n, -1);
+
+    for (int i = 0; i < n; i++) {
+      for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+        if (A.colInd[k] == i) diag[i] = k;
+      }
+
+      if (diag[i] < 0) return -1;
+    }
+
+    // IKJ variant
+    for (int i = 0; i < n; i++) {
+      for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+        marker[A.colInd[k]] = k;
+      }
+
+      for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1] && A.colInd[k] < i; k++) {
+        const int p = A.colInd[k];
+        const T lik = lu[k] / lu[diag[p]];
+        lu[k] = lik;
+
+        for (int kk = diag[p] + 1; kk < A.rowPtr[p + 1]; kk++) {
+          const int m = marker[A.colInd[kk]];
+          if (m >= 0) lu[m] -= lik * lu[kk];
+        }
+      }
+
+      if (lu[diag[i]] == T(0)) return -1;
+
+      for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+        marker[A.colInd[k]] = -1;
+      }
+    }
+
+    L_.init(n, A.rowPtr, A.colInd, lu.data(), true, true);
+    U_.init(n, A.rowPtr, A.colInd, lu.data(), false, false);
+    y_.assign(n, T(0));
+    return 0;
+  }
+
+  void apply(const T *r, T *z) {
+    L_.solve(r, y_.data());
+    U_.solve(y_.data(), z);
+  }
+
+  const char *name() const { return "ILU(0)"; }
+
+ private:
+  LevelScheduledTriangularSolver<T> L_, U_;
+  std::vector<T> y_;
+};
+
+//! Symmetric Gauss-Seidel, M = (D+L) D^-1 (D+U).
+template <typename T>
+class SGSPreconditioner : public HostPreconditioner<T> {
+ public:
+  int setup(const CsrMatrixView<T> &A) {
+    if (!pcgExtractDiagonal(A, diag_)) return -1;
+    L_.init(A.rows, A.rowPtr, A.colInd, A.val, true, false);
+    U_.init(A.rows, A.rowPtr, A.colInd, A.val, false, false);
+    y_.assign(A.rows, T(0));
+    return 0;
+  }
+
+  void apply(const T *r, T *z) {
+    L_.solve(r, y_.data());
+    for (size_t i = 0; i < diag_.size(); i++) y_[i] *= diag_[i];
+    U_.solve(y_.data(), z);
+  }
+
+  const char *name() const { return "SGS"; }
+
+ private:
+  LevelScheduledTriangularSolver<T> L_, U_;
+  std::vector<T> diag_;
+  std::vector<T> y_;
+};
+
+enum PcgPreconditionerType {
+  PCG_PRECOND_NONE,
+  PCG_PRECOND_JACOBI,
+  PCG_PRECOND_IC0,
+  PCG_PRECOND_ILU0,
+  PCG_PRECOND_SGS
+};
+
+template <typename T>
+inline HostPreconditioner<T> *pcgCreatePreconditioner(
+    PcgPreconditionerType type) {
+  switch (type) {
+    case PCG_PRECOND_JACOBI:
+      return new JacobiPreconditioner<T>();
+    case PCG_PRECOND_IC0:
+      return new IC0Preconditioner<T>();
+    case PCG_PRECOND_ILU0:
+      return new ILU0Preconditioner<T>();
+    case PCG_PRECOND_SGS:
+      return new SGSPreconditioner<T>();
+    default:
+      return new IdentityPreconditioner<T>();
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Solver
+////////////////////////////////////////////////////////////////////////////////
+//! Growth of ||r||^2 over the smallest value seen in a solve beyond which
+//! the solvers give up and report divergence.
+static const double kCgDivergence = 1e6;
+
+struct PcgStats {
+  int iterations;
+  double relResidual;
+  double setupMs;
+  double solveMs;
+  bool converged;
+  bool diverged;  // residual became non-finite or grew, or the solver broke down
+
+  PcgStats()
+      : iterations(0),
+        relResidual(0.0),
+        setupMs(0.0),
+        solveMs(0.0),
+        converged(false),
+        diverged(false) {}
+};
+
+inline void pcgPrintStats(const char *label, const PcgStats &stats) {
+  printf("  %-24s iterations = %5d, rel. residual = %e, setup = %8.3f ms, "
+         "solve = %9.3f ms  %s\n",
+         label, stats.iterations, stats.relResidual, stats.setupMs,
+         stats.solveMs,
+         stats.converged ? "OK" : (stats.diverged ? "DIVERGED" : "FAIL"));
+}
+
+template <typename T>
+class PcgSolver {
+ public:
+  PcgSolver() : M_(NULL), ownsM_(false), setupMs_(0.0) {}
+  ~PcgSolver() { release(); }
+
+  //! Set up for A with one of the built-in preconditioners.
+  int setup(const CsrMatrixView<T> &A, PcgPreconditionerType type) {
+    return setup(A, pcgCreatePreconditioner<T>(type), true);
+  }
+
+  //! Set up for A with a caller supplied preconditioner. When takeOwnership
+  //! is set the solver deletes M.
+  int setup(const CsrMatrixView<T> &A, HostPreconditioner<T> *M,
+            bool takeOwnership) {
+    release();
+    std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+    M_ = M;
+    ownsM_ = takeOwnership;
+    spmv_.init(A);
+    const int n = A.rows;
+    r_.assign(n, T(0));
+    z_.assign(n, T(0));
+    p_.assign(n, T(0));
+    q_.assign(n, T(0));
+    partial_.assign(spmv_.partition().size() * kStride, 0.0);
+    int status = M_->setup(A);
+    setupMs_ = msSince(t0);
+    return status;
+  }
+
+  //! Solve A x = b starting from the given x, until ||r|| <= tol * ||b||.
+  PcgStats solve(const T *b, T *x, double tol, int maxIter) {
+    PcgStats stats;
+    std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+    const std::vector<int> &bounds = spmv_.partition();
+    const int parts = (int)bounds.size() - 1;
+    T *r = r_.data(), *z = z_.data(), *p = p_.data(), *q = q_.data();
+    const T *dinv = M_->pointwiseScaling();
+
+    // r = b - A*x, ||b||^2, ||r||^2
+    forParts([&](int part, double *acc) {
+      spmv_.multiplyRows(bounds[part], bounds[part + 1], x, q);
+
+      for (int i = bounds[part]; i < bounds[part + 1]; i++) {
+        r[i] = b[i] - q[i];
+        acc[0] += (double)b[i] * b[i];
+        acc[1] += (double)r[i] * r[i];
+      }
+    });
+    double bb = reduce(0, parts), rr = reduce(1, parts);
+    const double bnorm = (bb > 0.0) ? sqrt(bb) : 1.0;
+
+    M_->apply(r, z);
+    forParts([&](int part, double *acc) {
+      for (int i = bounds[part]; i < bounds[part + 1]; i++) {
+        p[i] = z[i];
+        acc[0] += (double)r[i] * z[i];
+      }
+    });
+    double rz = reduce(0, parts);
+    double rrMin = rr;
+    int k = 0;
+    bool diverged = false;
+
+    while (sqrt(rr) > tol * bnorm && k < maxIter) {
+      // q = A*p, p.q
+      forParts([&](int part, double *acc) {
+        spmv_.multiplyRows(bounds[part], bounds[part + 1], p, q);
+
+        for (int i = bounds[part]; i < bounds[part + 1]; i++) {
+          acc[0] += (double)p[i] * q[i];
+        }
+      });
+      const double pq = reduce(0, parts);
+
+      // p.q = 0 breaks the recurrence down, A or M is not positive definite
+      if (!(pq != 0.0) || !(fabs(pq) < HUGE_VAL) || !(fabs(rz) < HUGE_VAL)) {
+        diverged = true;
+        break;
+      }
+
+      const T alpha = (T)(rz / pq);
+
+      // x += alpha p, r -= alpha q, r.r and for pointwise M also z and r.z
+      forParts([&](int part, double *acc) {
+        for (int i = bounds[part]; i < bounds[part + 1]; i++) {
+          x[i] += alpha * p[i];
+          const T ri = r[i] - alpha * q[i];
+          r[i] = ri;
+          acc[0] += (double)ri * ri;
+
+          if (dinv) {
+            const T zi = dinv[i] * ri;
+            z[i] = zi;
+            acc[1] += (double)ri * zi;
+          }
+        }
+      });
+      rr = reduce(0, parts);
+      double rzNew = reduce(1, parts);
+      k++;
+
+      if (!(rr < HUGE_VAL) || rr > kCgDivergence * rrMin) {
+        diverged = true;
+        break;
+      }
+
+      rrMin = std::min(rrMin, rr);
+
+      if (!dinv) {
+        M_->apply(r, z);
+        forParts([&](int part, double *acc) {
+          for (int i = bounds[part]; i < bounds[part + 1]; i++) {
+            acc[0] += (double)r[i] * z[i];
+          }
+        });
+        rzNew = reduce(0, parts);
+      }
+
+      const T beta = (T)(rzNew / rz);
+      rz = rzNew;
+
+      // p = z + beta p
+      forParts([&](int part, double *) {
+        for (int i = bounds[part]; i < bounds[part + 1]; i++) {
+          p[i] = z[i] + beta * p[i];
+        }
+      });
+    }
+
+    stats.iterations = k;
+    stats.relResidual = sqrt(rr) / bnorm;
+    stats.diverged = diverged;
+    stats.converged = !diverged && sqrt(rr) <= tol * bnorm;
+    stats.setupMs = setupMs_;
+    stats.solveMs = msSince(t0);
+    return stats;
+  }
+
+  const char *preconditionerName() const { return M_ ? M_->name() : "none"; }
+  const CsrSpMV<T> &spmv() const { return spmv_; }
+
+ private:
+  // partial sums of a part are kStride doubles apart to avoid false sharing
+  static const int kStride = 8;
+
+  template <typename Func>
+  void forParts(Func func) {
+    const int parts = (int)spmv_.partition().size() - 1;
+    std::fill(partial_.begin(), partial_.end(), 0.0);
+    sdkParallelFor(0, parts, 1, [&](int64_t pb, int64_t pe, int) {
+      for (int64_t part = pb; part < pe; part++) {
+        func((int)part, &partial_[part * kStride]);
+      }
+    });
+  }
+
+  double reduce(int slot, int parts) const {
+    double sum = 0.0;
+    for (int p = 0; p < parts; p++) sum += partial_[p * kStride + slot];
+    return sum;
+  }
+
+  static double msSince(std::chrono::high_resolution_clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(
+               std::chrono::high_resolution_clock::now() - t0)
+        .count();
+  }
+
+  void release() {
+    if (ownsM_) delete M_;
+    M_ = NULL;
+    ownsM_ = false;
+  }
+
+  PcgSolver(const PcgSolver &);
+  PcgSolver &operator=(const PcgSolver &);
+
+  CsrSpMV<T> spmv_;
+  HostPreconditioner<T> *M_;
+  bool ownsM_;
+  double setupMs_;
+  std::vector<T> r_, z_, p_, q_;
+  std::vector<double> partial_;
+};
+
+#endif  // COMMON_HELPER_PCG_H_
@@ -0,0 +1,585 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Communication reducing conjugate gradient variants for many-core hosts.
+//
+// Classic CG needs two global reductions per iteration, each a point where
+// every thread waits for the slowest one. Both solvers here run the whole
+// solve inside one persistent thread team (one thread per nnz-balanced row
+// block) and batch the reductions:
+//
+//  - PipelinedCgSolver: Ghysels & Vanroose pipelined CG. The three dot
+//    products of an iteration are accumulated in the same pass as the SpMV,
+//    and the recurrences for z, q, s, p, x, r, u, w are fused into one
+//    update pass, so an iteration costs two barriers and one reduction.
+//    The recurred residual is replaced by b - A x every 50 iterations and
+//    before convergence is reported. Supports no preconditioning or Jacobi,
+//    which is applied on the fly.
+//
+//  - SStepCgSolver: s-step CG (Chronopoulos & Gear). Every outer step builds
+//    a Chebyshev basis [T0(Z) r, ..., Ts(Z) r], Z = (A - c) / h, for the
+//    Gershgorin interval [c - h, c + h] of A with s SpMVs and gathers all
+//    Gram products in a single reduction, then performs s CG iterations
+//    worth of progress with small dense s x s solves. It is unpreconditioned
+//    and s is capped at 4: on 2D Laplacians of up to 1.2M rows s <= 4 needs
+//    within 1-2% of the iterations of classic CG, while s = 5 already needs
+//    12% more and larger s lose more as the basis loses conditioning.
+//
+// Both report a diverged PcgStats when ||r|| becomes non-finite or grows by
+// more than 1000x over its smallest value.
+#ifndef COMMON_HELPER_PIPECG_H_
+#define COMMON_HELPER_PIPECG_H_
+
+#include <math.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include <helper_parallel.h>
+#include <helper_pcg.h>
+#include <helper_spmv.h>
+
+//! Solves the small dense system A x = b (n x n, row-major) in place by
+//! Gaussian elimination with partial pivoting. The solution overwrites b.
+inline bool cgDenseSolve(int n, double *A, double *b) {
+  for (int k = 0; k < n; k++) {
+    int piv = k;
+
+    for (int i = k + 1; i < n; i++) {
+      if (fabs(A[i * n + k]) > fabs(A[piv * n + k])) piv = i;
+    }
+
+    if (A[piv * n + k] == 0.0) return false;
+
+    if (piv != k) {
+      for (int j = 0; j < n; j++) std::swap(A[k * n + j], A[piv * n + j]);
+      std::swap(b[k], b[piv]);
+    }
+
+    for (int i = k + 1; i < n; i++) {
+      const double f = A[i * n + k] / A[k * n + k];
+      for (int j = k; j < n; j++) A[i * n + j] -= f * A[k * n + j];
+      b[i] -= f * b[k];
+    }
+  }
+
+  for (int k = n - 1; k >= 0; k--) {
+    double sum = b[k];
+    for (int j = k + 1; j < n; j++) sum -= A[k * n + j] * b[j];
+    b[k] = sum / A[k * n + k];
+  }
+
+  return true;
+}
+
+inline double cgMsSince(std::chrono::high_resolution_clock::time_point t0) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::high_resolution_clock::now() - t0)
+      .count();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Pipelined CG
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class PipelinedCgSolver {
+ public:
+  PipelinedCgSolver() : jacobi_(false), setupMs_(0.0) {}
+
+  //! Set up for A. With jacobi set, M = diag(A)^-1 is used as preconditioner.
+  int setup(const CsrMatrixView<T> &A, bool jacobi) {
+    std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+    spmv_.init(A);
+    const int n = A.rows;
+    dinv_.assign(n, T(1));
+
+    if (jacobi) {
+      if (!pcgExtractDiagonal(A, dinv_)) return -1;
+      for (int i = 0; i < n; i++) dinv_[i] = T(1) / dinv_[i];
+    }
+
+    r_.assign(n, T(0));
+    u_.assign(n, T(0));
+    w_.assign(n, T(0));
+    nv_.assign(n, T(0));
+    z_.assign(n, T(0));
+    q_.assign(n, T(0));
+    s_.assign(n, T(0));
+    p_.assign(n, T(0));
+    partial_.assign((spmv_.partition().size() - 1) * kStride, 0.0);
+    jacobi_ = jacobi;
+    setupMs_ = cgMsSince(t0);
+    return 0;
+  }
+
+  const char *name() const {
+    return jacobi_ ? "pipelined CG + Jacobi" : "pipelined CG";
+  }
+
+  //! Solve A x = b starting from the given x, until ||b - A x|| <= tol *
+  //! ||b||. The recurred residual drifts from the true one, so every
+  //! kReplaceInterval iterations, and before convergence is reported, r, u
+  //! and w (and s, q, z, which depend on p) are recomputed from x and p.
+  PcgStats solve(const T *b, T *x, double tol, int maxIter) {
+    std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+    const CsrMatrixView<T> &A = spmv_.matrix();
+    const std::vector<int> &bounds = spmv_.partition();
+    const int parts = (int)bounds.size() - 1;
+    SdkSpinBarrier barrier(parts);
+    T *r = r_.data(), *u = u_.data(), *w = w_.data(), *nv = nv_.data();
+    T *z = z_.data(), *q = q_.data(), *s = s_.data(), *p = p_.data();
+    const T *dinv = dinv_.data();
+    double *partial = partial_.data();
+    PcgStats stats;
+
+    sdkParallelTeam(parts, [&](int tid, int) {
+      const int rb = bounds[tid], re = bounds[tid + 1];
+      double *acc = partial + tid * kStride;
+
+      // r = b - A x, u = M r, s = A p, q = M s (p = 0 on the first call),
+      // then w = A u, z = A q
+      auto replaceResidual = [&]() {
+        spmv_.multiplyRows(rb, re, x, r);
+        spmv_.multiplyRows(rb, re, p, s);
+
+        for (int i = rb; i < re; i++) {
+          r[i] = b[i] - r[i];
+          u[i] = dinv[i] * r[i];
+          q[i] = dinv[i] * s[i];
+        }
+
+        barrier.wait();
+        spmv_.multiplyRows(rb, re, u, w);
+        spmv_.multiplyRows(rb, re, q, z);
+        barrier.wait();
+      };
+
+      double bbLocal = 0.0;
+
+      for (int i = rb; i < re; i++) {
+        p[i] = T(0);
+        bbLocal += (double)b[i] * b[i];
+      }
+
+      acc[0] = bbLocal;
+      barrier.wait();
+      double bb = 0.0;
+      for (int t = 0; t < parts; t++) bb += partial[t * kStride];
+      const double bnorm = (bb > 0.0) ? sqrt(bb) : 1.0;
+      replaceResidual();
+
+      double gammaOld = 0.0, alphaOld = 0.0, rrMin = 0.0;
+      int k = 0, lastReplace = 0;
+
+      for (;;) {
+        // m = M w and n = A m, with the three dot products in the same pass
+        double gamma = 0.0, delta = 0.0, rr = 0.0;
+
+        for (int i = rb; i < re; i++) {
+          T sum = 0;
+
+          for (int kk = A.rowPtr[i]; kk < A.rowPtr[i + 1]; kk++) {
+            const int j = A.colInd[kk];
+            sum += A.val[kk] * (dinv[j] * w[j]);
+          }
+
+          nv[i] = sum;
+          gamma += (double)r[i] * u[i];
+          delta += (double)w[i] * u[i];
+          rr += (double)r[i] * r[i];
+        }
+
+        acc[0] = gamma;
+        acc[1] = delta;
+        acc[2] = rr;
+        barrier.wait();
+        gamma = delta = rr = 0.0;
+
+        for (int t = 0; t < parts; t++) {
+          gamma += partial[t * kStride];
+          delta += partial[t * kStride + 1];
+          rr += partial[t * kStride + 2];
+        }
+
+        // every thread sees the same sums, so they all take the same branch
+        const bool trueResidual = (lastReplace == k);
+        const bool done = sqrt(rr) <= tol * bnorm || k >= maxIter;
+        const bool diverged =
+            !(rr < HUGE_VAL) || (k > 0 && rr > kCgDivergence * rrMin);
+
+        if (diverged || (done && trueResidual)) {
+          if (tid == 0) {
+            stats.iterations = k;
+            stats.relResidual = sqrt(rr) / bnorm;
+            stats.converged = !diverged && sqrt(rr) <= tol * bnorm;
+            stats.diverged = diverged;
+          }
+
+          break;
+        }
+
+        if (done || k - lastReplace >= kReplaceInterval) {
+          replaceResidual();
+          lastReplace = k;
+          continue;
+        }
+
+        rrMin = (k == 0) ? rr : std::min(rrMin, rr);
+        double alpha, beta;
+
+        if (k > 0) {
+          beta = gamma / gammaOld;
+          alpha = gamma / (delta - beta * gamma / alphaOld);
+        } else {
+          beta = 0.0;
+          alpha = gamma / delta;
+        }
+
+        const T a = (T)alpha, bt = (T)beta;
+
+        for (int i = rb; i < re; i++) {
+          const T mi = dinv[i] * w[i];
+          z[i] = nv[i] + bt * z[i];
+          q[i] = mi + bt * q[i];
+          s[i] = w[i] + bt * s[i];
+          p[i] = u[i] + bt * p[i];
+          x[i] += a * p[i];
+          r[i] -= a * s[i];
+          u[i] -= a * q[i];
+          w[i] -= a * z[i];
+        }
+
+        gammaOld = gamma;
+        alphaOld = alpha;
+        k++;
+        barrier.wait();
+      }
+    });
+
+    stats.setupMs = setupMs_;
+    stats.solveMs = cgMsSince(t0);
+    return stats;
+  }
+
+ private:
+  static const int kStride = 8;
+  static const int kReplaceInterval = 50;
+
+  CsrSpMV<T> spmv_;
+  bool jacobi_;
+  double setupMs_;
+  std::vector<T> dinv_;
+  std::vector<T> r_, u_, w_, nv_, z_, q_, s_, p_;
+  std::vector<double> partial_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// s-step CG
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class SStepCgSolver {
+ public:
+  SStepCgSolver()
+      : s_(4), stride_(0), center_(0.0), halfWidth_(1.0), setupMs_(0.0) {}
+
+  //! Set up for A with s iterations per outer step, clamped to [1, kMaxS].
+  int setup(const CsrMatrixView<T> &A, int s) {
+    std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+    s_ = std::max(1, std::min(s, (int)kMaxS));
+    spmv_.init(A);
+
+    // Gershgorin interval of the spectrum, clipped at 0 for an SPD matrix;
+    // the Chebyshev basis is built for it
+    double lmin = HUGE_VAL, lmax = 0.0;
+
+    for (int i = 0; i < A.rows; i++) {
+      double diag = 0.0, radius = 0.0;
+
+      for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+        if (A.colInd[k] == i) {
+          diag = (double)A.val[k];
+        } else {
+          radius += fabs((double)A.val[k]);
+        }
+      }
+
+      lmin = std::min(lmin, diag - radius);
+      lmax = std::max(lmax, diag + radius);
+    }
+
+    if (lmax <= 0.0) lmax = 1.0;
+
+    lmin = std::max(lmin, 0.0);
+    center_ = 0.5 * (lmax + lmin);
+    halfWidth_ = std::max(0.5 * (lmax - lmin), 1e-3 * lmax);
+
+    const size_t n = A.rows;
+    V_.assign((s_ + 1) * n, T(0));
+    P_.assign(s_ * n, T(0));
+    AP_.assign(s_ * n, T(0));
+    stride_ = ((s_ + 1) * (s_ + 1) + s_ * s_ + 1 + 7) / 8 * 8;
+    partial_.assign((spmv_.partition().size() - 1) * stride_, 0.0);
+    setupMs_ = cgMsSince(t0);
+    return 0;
+  }
+
+  const char *name() const { return "s-step CG"; }
+  int s() const { return s_; }
+
+  //! Solve A x = b starting from the given x, until ||b - A x|| <= tol *
+  //! ||b||. When the recurred residual meets the tolerance the true residual
+  //! is computed and, if it does not, the iteration restarts from it.
+  PcgStats solve(const T *b, T *x, double tol, int maxIter) {
+    std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+    const int s = s_;
+    const size_t n = spmv_.matrix().rows;
+    const std::vector<int> &bounds = spmv_.partition();
+    const int parts = (int)bounds.size() - 1;
+    const double c = center_, h = halfWidth_;
+    const T tc = (T)center_, invH = (T)(1.0 / halfWidth_);
+    SdkSpinBarrier barrier(parts);
+    T *V = V_.data(), *P = P_.data(), *AP = AP_.data();
+    double *partial = partial_.data();
+    const int gOff = 0, cOff = (s + 1) * (s + 1), rrOff = cOff + s * s;
+    PcgStats stats;
+
+    sdkParallelTeam(parts, [&](int tid, int) {
+      const int rb = bounds[tid], re = bounds[tid + 1];
+      double *acc = partial + tid * stride_;
+      double G[(kMaxS + 1) * (kMaxS + 1)], C[kMaxS * kMaxS];
+      double W[kMaxS * kMaxS], Wprev[kMaxS * kMaxS], B[kMaxS * kMaxS];
+      double Wtmp[kMaxS * kMaxS], a[kMaxS];
+
+      // v0 = r = b - A x
+      double bbLocal = 0.0, rrLocal = 0.0;
+      spmv_.multiplyRows(rb, re, x, V);
+
+      for (int i = rb; i < re; i++) {
+        V[i] = b[i] - V[i];
+        bbLocal += (double)b[i] * b[i];
+        rrLocal += (double)V[i] * V[i];
+      }
+
+      acc[0] = bbLocal;
+      acc[1] = rrLocal;
+      barrier.wait();
+      double bb = 0.0, rr = 0.0;
+
+      for (int t = 0; t < parts; t++) {
+        bb += partial[t * stride_];
+        rr += partial[t * stride_ + 1];
+      }
+
+      const double bnorm = (bb > 0.0) ? sqrt(bb) : 1.0;
+      double rrMin = rr;
+      int k = 0;
+      bool first = true, trueResidual = true, breakdown = false;
+      bool diverged = false;
+
+      for (;;) {
+        const bool done = sqrt(rr) <= tol * bnorm || k >= maxIter;
+        diverged = !(rr < HUGE_VAL) || rr > kCgDivergence * rrMin;
+
+        if (diverged || breakdown || (done && trueResidual)) break;
+
+        // all threads are done with partial, x and v0 before they change
+        barrier.wait();
+
+        if (done) {
+          // the recurred residual has drifted, restart from the true one
+          double rrPart = 0.0;
+          spmv_.multiplyRows(rb, re, x, V);
+
+          for (int i = rb; i < re; i++) {
+            V[i] = b[i] - V[i];
+            rrPart += (double)V[i] * V[i];
+          }
+
+          acc[rrOff] = rrPart;
+          barrier.wait();
+          rr = 0.0;
+          for (int t = 0; t < parts; t++) rr += partial[t * stride_ + rrOff];
+          first = true;
+          trueResidual = true;
+          continue;
+        }
+
+        rrMin = std::min(rrMin, rr);
+        trueResidual = false;
+
+        // Chebyshev basis on [c - h, c + h]: v1 = (A - c) v0 / h,
+        // v_{j+1} = 2 (A - c) v_j / h - v_{j-1}
+        for (int j = 0; j < s; j++) {
+          T *vj = V + j * n, *vn = V + (j + 1) * n;
+          spmv_.multiplyRows(rb, re, vj, vn);
+
+          for (int i = rb; i < re; i++) {
+            const T t = (vn[i] - tc * vj[i]) * invH;
+            vn[i] = (j == 0) ? t : T(2) * t - V[(j - 1) * n + i];
+          }
+
+          if (j < s - 1) barrier.wait();
+        }
+
+        // all Gram products of the step in one batched reduction
+        for (int e = 0; e < stride_; e++) acc[e] = 0.0;
+
+        for (int i = rb; i < re; i++) {
+          for (int l = 0; l <= s; l++) {
+            const double vl = V[l * n + i];
+            for (int j = l; j <= s; j++) acc[gOff + l * (s + 1) + j] += vl * V[j * n + i];
+          }
+
+          if (!first) {
+            for (int l = 0; l < s; l++) {
+              const double apl = AP[l * n + i];
+              for (int j = 0; j < s; j++) acc[cOff + l * s + j] += apl * V[j * n + i];
+            }
+          }
+        }
+
+        barrier.wait();
+
+        for (int e = 0; e < rrOff; e++) {
+          double sum = 0.0;
+          for (int t = 0; t < parts; t++) sum += partial[t * stride_ + e];
+          if (e < cOff) G[e] = sum; else C[e - cOff] = sum;
+        }
+
+        for (int l = 0; l <= s; l++) {
+          for (int j = 0; j < l; j++) G[l * (s + 1) + j] = G[j * (s + 1) + l];
+        }
+
+        // W = R'AR (+ corrections against the previous block), a = W^-1 R'r,
+        // with A v0 = c v0 + h v1 and A v_j = c v_j + h (v_{j-1} + v_{j+1}) / 2
+        for (int l = 0; l < s; l++) {
+          const double *g = G + l * (s + 1);
+          W[l * s] = c * g[0] + h * g[1];
+
+          for (int j = 1; j < s; j++) {
+            W[l * s + j] = c * g[j] + 0.5 * h * (g[j - 1] + g[j + 1]);
+          }
+
+          a[l] = g[0];
+        }
+
+        if (first) {
+          std::fill(B, B + s * s, 0.0);
+        } else {
+          // B = -Wprev^-1 C, solved column by column
+          for (int j = 0; j < s && !breakdown; j++) {
+            double col[kMaxS];
+            for (int l = 0; l < s; l++) col[l] = -C[l * s + j];
+            std::copy(Wprev, Wprev + s * s, Wtmp);
+            breakdown = !cgDenseSolve(s, Wtmp, col);
+            for (int l = 0; l < s; l++) B[l * s + j] = col[l];
+          }
+
+          // W += C'B + B'C + B'Wprev B
+          for (int l = 0; l < s; l++) {
+            for (int j = 0; j < s; j++) {
+              double sum = 0.0;
+
+              for (int e = 0; e < s; e++) {
+                sum += C[e * s + l] * B[e * s + j] + B[e * s + l] * C[e * s + j];
+
+                for (int f = 0; f < s; f++) {
+                  sum += B[e * s + l] * Wprev[e * s + f] * B[f * s + j];
+                }
+              }
+
+              W[l * s + j] += sum;
+            }
+          }
+        }
+
+        std::copy(W, W + s * s, Wprev);
+        std::copy(W, W + s * s, Wtmp);
+        breakdown = breakdown || !cgDenseSolve(s, Wtmp, a);
+
+        if (breakdown) break;
+
+        // P = R + Pprev B, AP = AR + APprev B, x += P a, r -= AP a
+        double rrPart = 0.0;
+
+        for (int i = rb; i < re; i++) {
+          T pNew[kMaxS], apNew[kMaxS];
+
+          for (int j = 0; j < s; j++) {
+            double pj = V[j * n + i];
+            double apj = c * pj + ((j == 0) ? h * V[n + i]
+                                            : 0.5 * h * (V[(j - 1) * n + i] +
+                                                         V[(j + 1) * n + i]));
+
+            for (int l = 0; l < s; l++) {
+              pj += P[l * n + i] * B[l * s + j];
+              apj += AP[l * n + i] * B[l * s + j];
+            }
+
+            pNew[j] = (T)pj;
+            apNew[j] = (T)apj;
+          }
+
+          double xi = x[i], ri = V[i];
+
+          for (int j = 0; j < s; j++) {
+            P[j * n + i] = pNew[j];
+            AP[j * n + i] = apNew[j];
+            xi += pNew[j] * a[j];
+            ri -= apNew[j] * a[j];
+          }
+
+          x[i] = (T)xi;
+          V[i] = (T)ri;
+          rrPart += ri * ri;
+        }
+
+        acc[rrOff] = rrPart;
+        barrier.wait();
+        rr = 0.0;
+        for (int t = 0; t < parts; t++) rr += partial[t * stride_ + rrOff];
+        first = false;
+        k += s;
+      }
+
+      if (tid == 0) {
+        stats.iterations = k;
+        stats.relResidual = sqrt(rr) / bnorm;
+        stats.diverged = diverged || breakdown;
+        stats.converged = !stats.diverged && sqrt(rr) <= tol * bnorm;
+      }
+    });
+
+    stats.setupMs = setupMs_;
+    stats.solveMs = cgMsSince(t0);
+    return stats;
+  }
+
+ private:
+  static const int kMaxS = 4;
+
+  CsrSpMV<T> spmv_;
+  int s_;
+  int stride_;
+  double center_;
+  double halfWidth_;
+  double setupMs_;
+  std::vector<T> V_, P_, AP_;
+  std::vector<double> partial_;
+};
+
+#endif  // COMMON_HELPER_PIPECG_H_
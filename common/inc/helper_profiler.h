@@ -0,0 +1,346 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Scoped-zone profiler for host code, on top of sdkGetTimeNs() from
+// helper_timer.h.
+//
+//   void convolutionRowCPU(...) {
+//     SDK_PROFILE_ZONE("convolutionRowCPU");
+//     ...
+//   }
+//
+// A zone measures the enclosing scope. Zones nest, on any number of
+// threads. Every thread appends its finished zones to a ring buffer of its
+// own. Only that thread writes it and the head index is published with
+// release semantics, so recording takes no lock and costs two clock reads
+// and a store. Readers see every completed event. A thread that wraps its
+// ring keeps the most recent kSdkProfileRing events.
+//
+// Profiling is off unless the SDK_PROFILE environment variable is set or
+// sdkProfiler().enable() is called; a disabled zone costs one relaxed load.
+// Define SDK_PROFILE_DISABLE to compile the zones out entirely.
+// sdkProfilerReport() prints, per zone, the number of calls, the inclusive
+// and self (minus nested zones) time and the min/median/p99/max duration,
+// with a log2 histogram of the durations if SDK_PROFILE=hist. If
+// SDK_PROFILE_TRACE=<file.json> is set, it also writes a Chrome trace
+// (chrome://tracing, Perfetto) with one track per thread. Report when the
+// profiled threads are quiescent, e.g. at the end of main().
+#ifndef COMMON_HELPER_PROFILER_H_
+#define COMMON_HELPER_PROFILER_H_
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <helper_timer.h>
+
+// events kept per thread, a power of two
+static const uint64_t kSdkProfileRing = 1 << 16;
+
+struct SdkProfileEvent {
+  uint64_t start, end;  // sdkGetTimeNs()
+  int zone;
+  int depth;
+};
+
+class SdkProfiler {
+ public:
+  SdkProfiler() : enabled_(false), histograms_(false), epoch_(sdkGetTimeNs()) {
+    const char *env = getenv("SDK_PROFILE");
+    const char *trace = getenv("SDK_PROFILE_TRACE");
+
+    if (env != NULL && strcmp(env, "0") != 0) enabled_.store(true);
+    if (env != NULL && strcmp(env, "hist") == 0) histograms_ = true;
+
+    if (trace != NULL && trace[0] != '\0') {
+      tracePath_ = trace;
+      enabled_.store(true);
+    }
+  }
+
+  ~SdkProfiler() {
+    for (size_t t = 0; t < threads_.size(); t++) delete threads_[t];
+  }
+
+  bool enabled() const { return enabled_.load(std::memory_order_relaxed); }
+  void enable(bool on = true) { enabled_.store(on); }
+  void setTracePath(const char *path) { tracePath_ = path ? path : ""; }
+  void setHistograms(bool on) { histograms_ = on; }
+
+  //! Id of the zone called name; zones with the same name are merged.
+  int registerZone(const char *name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    for (size_t z = 0; z < zones_.size(); z++) {
+      if (zones_[z] == name) return (int)z;
+    }
+
+    zones_.push_back(name);
+    return (int)zones_.size() - 1;
+  }
+
+  struct ThreadRing {
+    int tid;
+    int depth;
+    std::atomic<uint64_t> head;  // events written so far
+    std::vector<SdkProfileEvent> events;
+  };
+
+  //! The calling thread's ring, created on first use.
+  ThreadRing &threadRing() {
+    static thread_local ThreadRing *ring = NULL;
+
+    if (ring == NULL) {
+      ring = new ThreadRing;
+      ring->depth = 0;
+      ring->head.store(0);
+      ring->events.resize(kSdkProfileRing);
+      std::lock_guard<std::mutex> lock(mutex_);
+      ring->tid = (int)threads_.size();
+      threads_.push_back(ring);
+    }
+
+    return *ring;
+  }
+
+  //! Forgets all events recorded so far.
+  void reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t t = 0; t < threads_.size(); t++) threads_[t]->head.store(0);
+    epoch_ = sdkGetTimeNs();
+  }
+
+  //! Per zone statistics, sorted by inclusive time.
+  void report(FILE *out) {
+    std::vector<std::vector<SdkProfileEvent> > rings;
+    std::vector<std::string> zones;
+    bool wrapped = snapshot(rings, zones);
+    std::vector<std::vector<uint64_t> > durations(zones.size());
+    std::vector<uint64_t> selfNs(zones.size(), 0);
+
+    for (size_t t = 0; t < rings.size(); t++) {
+      // events are stored when a zone ends, so children precede their
+      // parent; child[d] sums the zones at depth d since the last zone at
+      // depth d-1 ended
+      std::vector<uint64_t> child(2, 0);
+
+      for (size_t i = 0; i < rings[t].size(); i++) {
+        const SdkProfileEvent &e = rings[t][i];
+        const uint64_t dur = e.end - e.start;
+        if ((int)child.size() < e.depth + 2) child.resize(e.depth + 2, 0);
+
+        durations[e.zone].push_back(dur);
+        selfNs[e.zone] += dur - std::min(dur, child[e.depth + 1]);
+        child[e.depth + 1] = 0;
+        child[e.depth] += dur;
+      }
+    }
+
+    std::vector<int> order;
+    std::vector<uint64_t> totalNs(zones.size(), 0);
+
+    for (size_t z = 0; z < zones.size(); z++) {
+      for (size_t i = 0; i < durations[z].size(); i++) totalNs[z] += durations[z][i];
+      if (!durations[z].empty()) order.push_back((int)z);
+    }
+
+    std::sort(order.begin(), order.end(),
+              [&](int a, int b) { return totalNs[a] > totalNs[b]; });
+
+    fprintf(out, "Profile: %d thread(s)%s\n", (int)rings.size(),
+            wrapped ? ", oldest events dropped" : "");
+    fprintf(out, "  %-32s %8s %11s %11s %10s %10s %10s %10s\n", "zone",
+            "calls", "total ms", "self ms", "min us", "median us", "p99 us",
+            "max us");
+
+    for (size_t k = 0; k < order.size(); k++) {
+      const int z = order[k];
+      std::vector<uint64_t> &d = durations[z];
+      std::sort(d.begin(), d.end());
+      const size_t n = d.size();
+
+      fprintf(out, "  %-32s %8zu %11.3f %11.3f %10.2f %10.2f %10.2f %10.2f\n",
+              zones[z].c_str(), n, totalNs[z] * 1e-6, selfNs[z] * 1e-6,
+              d[0] * 1e-3, d[(n - 1) / 2] * 1e-3,
+              d[std::min(n - 1, (size_t)(0.99 * n))] * 1e-3, d[n - 1] * 1e-3);
+
+      if (histograms_) printHistogram(out, d);
+    }
+  }
+
+  //! Chrome trace event format, complete ("X") events in microseconds.
+  bool writeChromeTrace(const char *path) {
+    std::vector<std::vector<SdkProfileEvent> > rings;
+    std::vector<std::string> zones;
+    snapshot(rings, zones);
+    FILE *out = fopen(path, "w");
+
+    if (out == NULL) {
+      fprintf(stderr, "SdkProfiler: cannot write %s\n", path);
+      return false;
+    }
+
+    fprintf(out, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+
+    for (size_t t = 0; t < rings.size(); t++) {
+      fprintf(out, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+              "\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+              first ? "" : ",\n", (int)t, (int)t);
+      first = false;
+
+      for (size_t i = 0; i < rings[t].size(); i++) {
+        const SdkProfileEvent &e = rings[t][i];
+        fprintf(out, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,"
+                "\"ts\":%.3f,\"dur\":%.3f}",
+                zones[e.zone].c_str(), (int)t,
+                (e.start > epoch_ ? e.start - epoch_ : 0) * 1e-3,
+                (e.end - e.start) * 1e-3);
+      }
+    }
+
+    fprintf(out, "\n]}\n");
+    fclose(out);
+    return true;
+  }
+
+  const std::string &tracePath() const { return tracePath_; }
+
+ private:
+  //! Copies the completed events of every thread in the order they were
+  //! recorded. Returns true if some thread wrapped its ring.
+  bool snapshot(std::vector<std::vector<SdkProfileEvent> > &rings,
+                std::vector<std::string> &zones) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bool wrapped = false;
+    zones = zones_;
+    rings.resize(threads_.size());
+
+    for (size_t t = 0; t < threads_.size(); t++) {
+      const ThreadRing &ring = *threads_[t];
+      const uint64_t head = ring.head.load(std::memory_order_acquire);
+      const uint64_t n = std::min(head, kSdkProfileRing);
+      wrapped = wrapped || head > kSdkProfileRing;
+      rings[t].clear();
+
+      for (uint64_t i = head - n; i < head; i++) {
+        rings[t].push_back(ring.events[i & (kSdkProfileRing - 1)]);
+      }
+    }
+
+    return wrapped;
+  }
+
+  //! One row per power of two of the duration in ns.
+  static void printHistogram(FILE *out, const std::vector<uint64_t> &sorted) {
+    int counts[64] = {0};
+    int lo = 63, hi = 0, peak = 0;
+
+    for (size_t i = 0; i < sorted.size(); i++) {
+      int b = 0;
+      while (b < 63 && (2ULL << b) <= sorted[i]) b++;
+      counts[b]++;
+      lo = std::min(lo, b);
+      hi = std::max(hi, b);
+      peak = std::max(peak, counts[b]);
+    }
+
+    for (int b = lo; b <= hi; b++) {
+      const int width = (int)(40.0 * counts[b] / peak + 0.5);
+      fprintf(out, "    %12.2f us %8d |%.*s\n", (1ULL << b) * 1e-3, counts[b],
+              width, "########################################");
+    }
+  }
+
+  std::atomic<bool> enabled_;
+  bool histograms_;
+  uint64_t epoch_;
+  std::string tracePath_;
+  std::mutex mutex_;
+  std::vector<std::string> zones_;
+  std::vector<ThreadRing *> threads_;
+};
+
+inline SdkProfiler &sdkProfiler() {
+  static SdkProfiler profiler;
+  return profiler;
+}
+
+//! Records the lifetime of the object as one event of zone id.
+class SdkProfileZone {
+ public:
+  explicit SdkProfileZone(int zone) : ring_(NULL), zone_(zone), start_(0) {
+    SdkProfiler &profiler = sdkProfiler();
+
+    if (profiler.enabled()) {
+      ring_ = &profiler.threadRing();
+      ring_->depth++;
+      start_ = sdkGetTimeNs();
+    }
+  }
+
+  ~SdkProfileZone() {
+    if (ring_ == NULL) return;
+
+    const uint64_t end = sdkGetTimeNs();
+    const uint64_t head = ring_->head.load(std::memory_order_relaxed);
+    SdkProfileEvent &e = ring_->events[head & (kSdkProfileRing - 1)];
+    e.start = start_;
+    e.end = end;
+    e.zone = zone_;
+    e.depth = --ring_->depth;
+    ring_->head.store(head + 1, std::memory_order_release);
+  }
+
+ private:
+  SdkProfiler::ThreadRing *ring_;
+  int zone_;
+  uint64_t start_;
+};
+
+//! Prints the report and writes the trace requested through the
+//! environment; does nothing if profiling is off.
+inline void sdkProfilerReport() {
+  SdkProfiler &profiler = sdkProfiler();
+
+  if (!profiler.enabled()) return;
+
+  profiler.report(stdout);
+
+  if (!profiler.tracePath().empty() &&
+      profiler.writeChromeTrace(profiler.tracePath().c_str())) {
+    printf("Profile: Chrome trace written to %s\n",
+           profiler.tracePath().c_str());
+  }
+}
+
+#define SDK_PROFILE_CONCAT2(a, b) a##b
+#define SDK_PROFILE_CONCAT(a, b) SDK_PROFILE_CONCAT2(a, b)
+
+#if defined(SDK_PROFILE_DISABLE)
+#define SDK_PROFILE_ZONE(name)
+#else
+//! Profiles the rest of the enclosing scope as zone name (a string literal).
+#define SDK_PROFILE_ZONE(name)                                      \
+  static const int SDK_PROFILE_CONCAT(sdkProfileZoneId, __LINE__) = \
+      sdkProfiler().registerZone(name);                             \
+  SdkProfileZone SDK_PROFILE_CONCAT(sdkProfileZone, __LINE__)(      \
+      SDK_PROFILE_CONCAT(sdkProfileZoneId, __LINE__))
+#endif
+
+#endif  // COMMON_HELPER_PROFILER_H_
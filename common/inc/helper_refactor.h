@@ -0,0 +1,518 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Host sparse LU refactorization, the CPU counterpart of cusolverRf.
+//
+// HostRefactorLU follows the cusolverRf flow: setup() takes P, Q and the
+// patterns of L and U with P*A*Q^T = L*U from a first factorization with
+// pivoting, resetValues() loads a new matrix with the same pattern,
+// refactor() recomputes L and U in the fixed pivot order and solve() solves
+// A*x = b. Everything that depends on the pattern only is done in setup():
+//  - L and U are merged into one CSR matrix M = L + U - I with sorted rows,
+//  - every entry of A gets its position in M,
+//  - the update schedule of the row-wise (IKJ) elimination is precomputed:
+//    for every entry M(i,k) of L the positions in row i hit by row k of U,
+//    so refactor() is a sequence of indexed AXPYs with no searching,
+//    scattering, pivoting or allocation,
+//  - rows are grouped into level sets of the dependency graph of L (and of
+//    U for the backward solve). Wide levels are split across the workers of
+//    sdkThreadPool(), which stay alive between calls; runs of narrow levels,
+//    typical of the long dependency chains in circuit matrices, are done on
+//    the calling thread.
+// refactorBatch()/solveBatch() handle many matrices with the same pattern,
+// the inner loop of circuit and power flow simulation. Matrices are
+// processed in groups of kLanes whose values are interleaved, so every
+// update of the schedule is a short SIMD loop over the group, and groups
+// are spread across threads.
+// Like cusolverRf, pivots with |u_ii| <= zero are replaced by boost.
+#ifndef COMMON_HELPER_REFACTOR_H_
+#define COMMON_HELPER_REFACTOR_H_
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#include <helper_parallel.h>
+
+class HostRefactorLU {
+ public:
+  //! matrices per interleaved group of the batched mode
+  static const int kLanes = 8;
+
+  HostRefactorLU()
+      : n_(0), zero_(0.0), boost_(0.0), numThreads_(1), maxBatch_(0) {}
+
+  //! Sets up P*A*Q^T = L*U. All CSR arrays may have base 0 or 1 (taken from
+  //! their row pointers); P and Q are zero-based with (P*A*Q^T)(i,j) =
+  //! A(P[i], Q[j]), the convention of cusolverRfSetupHost. L has a unit
+  //! diagonal, stored or not. Returns 0, or -1 if A has an entry outside
+  //! the pattern of L + U.
+  int setup(int n, const int *rowPtrA, const int *colIndA,
+            const int *rowPtrL, const int *colIndL,
+            const int *rowPtrU, const int *colIndU,
+            const int *P, const int *Q) {
+    const int baseA = rowPtrA[0], baseL = rowPtrL[0], baseU = rowPtrU[0];
+    n_ = n;
+    P_.assign(P, P + n);
+    Q_.assign(Q, Q + n);
+    numThreads_ = sdkGetNumThreads();
+
+    // M = L + U - I, row i holds L(i, 0:i), then the diagonal, then U
+    mPtr_.assign(n + 1, 0);
+    diagPos_.resize(n);
+    mCol_.clear();
+
+    for (int i = 0; i < n; i++) {
+      for (int k = rowPtrL[i] - baseL; k < rowPtrL[i + 1] - baseL; k++) {
+        if (colIndL[k] - baseL < i) mCol_.push_back(colIndL[k] - baseL);
+      }
+
+      std::sort(mCol_.begin() + mPtr_[i], mCol_.end());
+      diagPos_[i] = (int)mCol_.size();
+      mCol_.push_back(i);
+      const size_t upper = mCol_.size();
+
+      for (int k = rowPtrU[i] - baseU; k < rowPtrU[i + 1] - baseU; k++) {
+        if (colIndU[k] - baseU > i) mCol_.push_back(colIndU[k] - baseU);
+      }
+
+      std::sort(mCol_.begin() + upper, mCol_.end());
+      mPtr_[i + 1] = (int)mCol_.size();
+    }
+
+    const int nnzM = mPtr_[n];
+    std::vector<int> qinv(n);
+
+    for (int i = 0; i < n; i++) qinv[Q[i]] = i;
+
+    // position of every entry of A in M; position nnzM marks fill that the
+    // pattern does not hold, refactor() drops those updates
+    const int nnzA = rowPtrA[n] - baseA;
+    aPos_.resize(nnzA);
+    updatePtr_.assign(nnzM + 1, 0);
+    std::atomic<int> outside(0);
+
+    for (int i = 0; i < n; i++) {
+      for (int p = mPtr_[i]; p < diagPos_[i]; p++) {
+        const int k = mCol_[p];
+        updatePtr_[p + 1] = mPtr_[k + 1] - diagPos_[k] - 1;
+      }
+    }
+
+    for (int p = 0; p < nnzM; p++) updatePtr_[p + 1] += updatePtr_[p];
+    updateDst_.resize(updatePtr_[nnzM]);
+    numDropped_ = 0;
+    std::atomic<int64_t> dropped(0);
+
+    sdkParallelFor(0, n, 256, [&](int64_t rb, int64_t re, int) {
+      std::vector<int> where(n, nnzM);
+      int64_t chunkDropped = 0;
+
+      for (int i = (int)rb; i < (int)re; i++) {
+        for (int p = mPtr_[i]; p < mPtr_[i + 1]; p++) where[mCol_[p]] = p;
+
+        const int row = P_[i];
+
+        for (int k = rowPtrA[row] - baseA; k < rowPtrA[row + 1] - baseA; k++) {
+          const int pos = where[qinv[colIndA[k] - baseA]];
+          if (pos == nnzM) outside.fetch_add(1);
+          aPos_[k] = pos;
+        }
+
+        for (int p = mPtr_[i]; p < diagPos_[i]; p++) {
+          const int k = mCol_[p];
+          int *dst = updateDst_.data() + updatePtr_[p];
+
+          for (int q = diagPos_[k] + 1; q < mPtr_[k + 1]; q++) {
+            const int pos = where[mCol_[q]];
+            chunkDropped += (pos == nnzM);
+            *dst++ = pos;
+          }
+        }
+
+        for (int p = mPtr_[i]; p < mPtr_[i + 1]; p++) where[mCol_[p]] = nnzM;
+      }
+
+      dropped.fetch_add(chunkDropped);
+    });
+
+    numDropped_ = dropped.load();
+    aRowPtr_.assign(rowPtrA, rowPtrA + n + 1);
+    for (int i = 0; i <= n; i++) aRowPtr_[i] -= baseA;
+
+    buildSchedule(false, lower_);
+    buildSchedule(true, upper_);
+    M_.assign(nnzM + 1, 0.0);
+    y_.assign(n, 0.0);
+    maxBatch_ = 0;
+    return outside.load() ? -1 : 0;
+  }
+
+  //! Pivots with |u_ii| <= zero are replaced by boost, cf.
+  //! cusolverRfSetNumericProperties().
+  void setNumericProperties(double zero, double boost) {
+    zero_ = zero;
+    boost_ = boost;
+  }
+
+  //! Loads the values of a matrix with the pattern given to setup().
+  void resetValues(const double *valA) {
+    sdkParallelFor(0, n_, 1024, [&](int64_t rb, int64_t re, int) {
+      for (int i = (int)rb; i < (int)re; i++) loadRow(i, valA, M_.data(), 1, 0);
+    });
+  }
+
+  //! Refactorization in the pivot order of setup(). Returns -1, or the
+  //! first row whose pivot had to be boosted.
+  int refactor() {
+    std::atomic<int> boosted(n_);
+    double *M = M_.data();
+
+    runStages(lower_, [&](int i) {
+      if (factorRow(i, M)) atomicMin(boosted, i);
+    });
+
+    return (boosted.load() < n_) ? boosted.load() : -1;
+  }
+
+  //! x = A^-1 b = Q^T U^-1 L^-1 P b.
+  void solve(const double *b, double *x) {
+    double *y = y_.data();
+    const double *M = M_.data();
+
+    for (int i = 0; i < n_; i++) y[i] = b[P_[i]];
+
+    runStages(lower_, [&](int i) {
+      double sum = y[i];
+      for (int p = mPtr_[i]; p < diagPos_[i]; p++) sum -= M[p] * y[mCol_[p]];
+      y[i] = sum;
+    });
+
+    runStages(upper_, [&](int i) {
+      double sum = y[i];
+      for (int p = diagPos_[i] + 1; p < mPtr_[i + 1]; p++) {
+        sum -= M[p] * y[mCol_[p]];
+      }
+      y[i] = sum / M[diagPos_[i]];
+    });
+
+    for (int i = 0; i < n_; i++) x[Q_[i]] = y[i];
+  }
+
+  //! Reserves the storage for refactorBatch() of up to maxBatch matrices,
+  //! so the batched calls do not allocate.
+  void setupBatch(int maxBatch) {
+    const int groups = (maxBatch + kLanes - 1) / kLanes;
+    maxBatch_ = maxBatch;
+    batchM_.assign((size_t)groups * (mPtr_[n_] + 1) * kLanes, 0.0);
+    batchY_.assign((size_t)std::min(groups, numThreads_) * n_ * kLanes, 0.0);
+  }
+
+  //! Loads and refactorizes valA[0..batch), batch <= maxBatch of
+  //! setupBatch(). Returns -1, or the first matrix that needed a boost.
+  int refactorBatch(int batch, const double *const *valA) {
+    const int groups = (batch + kLanes - 1) / kLanes;
+    const size_t groupSize = (size_t)(mPtr_[n_] + 1) * kLanes;
+    std::atomic<int> boosted(batch);
+
+    if (batch > maxBatch_) setupBatch(batch);
+
+    sdkParallelFor(0, groups, 1, [&](int64_t gb, int64_t ge, int) {
+      for (int g = (int)gb; g < (int)ge; g++) {
+        double *M = batchM_.data() + g * groupSize;
+
+        // lanes past the end of the batch repeat its last matrix
+        for (int l = 0; l < kLanes; l++) {
+          const double *val = valA[std::min(g * kLanes + l, batch - 1)];
+          for (int i = 0; i < n_; i++) loadRow(i, val, M, kLanes, l);
+        }
+
+        int lanes = 0;
+        for (int i = 0; i < n_; i++) lanes |= factorRowLanes(i, M);
+
+        for (int l = 0; l < kLanes && g * kLanes + l < batch; l++) {
+          if (lanes >> l & 1) atomicMin(boosted, g * kLanes + l);
+        }
+      }
+    });
+
+    return (boosted.load() < batch) ? boosted.load() : -1;
+  }
+
+  //! x[j] = A_j^-1 b[j] for the matrices of the last refactorBatch().
+  void solveBatch(int batch, const double *const *b, double *const *x) {
+    const int groups = (batch + kLanes - 1) / kLanes;
+    const size_t groupSize = (size_t)(mPtr_[n_] + 1) * kLanes;
+    const int chunks = sdkParallelChunks(0, groups, 1);
+
+    if ((size_t)chunks * n_ * kLanes > batchY_.size()) {
+      batchY_.resize((size_t)chunks * n_ * kLanes);
+    }
+
+    sdkParallelFor(0, groups, 1, [&](int64_t gb, int64_t ge, int chunk) {
+      double *y = batchY_.data() + (size_t)chunk * n_ * kLanes;
+
+      for (int g = (int)gb; g < (int)ge; g++) {
+        const double *M = batchM_.data() + g * groupSize;
+        const int lanes = std::min(kLanes, batch - g * kLanes);
+
+        for (int l = 0; l < kLanes; l++) {
+          const double *bl = b[g * kLanes + std::min(l, lanes - 1)];
+          for (int i = 0; i < n_; i++) y[i * kLanes + l] = bl[P_[i]];
+        }
+
+        for (int i = 0; i < n_; i++) {
+          double *yi = y + i * kLanes;
+
+          for (int p = mPtr_[i]; p < diagPos_[i]; p++) {
+            const double *m = M + (size_t)p * kLanes;
+            const double *yk = y + mCol_[p] * kLanes;
+            for (int l = 0; l < kLanes; l++) yi[l] -= m[l] * yk[l];
+          }
+        }
+
+        for (int i = n_ - 1; i >= 0; i--) {
+          double *yi = y + i * kLanes;
+          const double *d = M + (size_t)diagPos_[i] * kLanes;
+
+          for (int p = diagPos_[i] + 1; p < mPtr_[i + 1]; p++) {
+            const double *m = M + (size_t)p * kLanes;
+            const double *yk = y + mCol_[p] * kLanes;
+            for (int l = 0; l < kLanes; l++) yi[l] -= m[l] * yk[l];
+          }
+
+          for (int l = 0; l < kLanes; l++) yi[l] /= d[l];
+        }
+
+        for (int l = 0; l < lanes; l++) {
+          double *xl = x[g * kLanes + l];
+          for (int i = 0; i < n_; i++) xl[Q_[i]] = y[i * kLanes + l];
+        }
+      }
+    });
+  }
+
+  int nnzLU() const { return mPtr_.empty() ? 0 : mPtr_[n_]; }
+  int64_t numUpdates() const { return updateDst_.size(); }
+  //! updates whose target is not in the pattern of L + U, they are dropped
+  int64_t numDropped() const { return numDropped_; }
+
+  void printStats() const {
+    printf("  n = %d, nnz(L+U-I) = %d, updates = %lld (dropped %lld), "
+           "%d threads\n",
+           n_, nnzLU(), (long long)numUpdates(), (long long)numDropped_,
+           numThreads_);
+    printStages("refactor/L solve", lower_);
+    printStages("U solve", upper_);
+  }
+
+ private:
+  // a level with fewer rows than kMinLevelRows per thread is merged with
+  // its narrow neighbours into a stage that runs on a single thread
+  static const int kMinLevelRows = 32;
+
+  //! Rows levelRows[begin..end) in level order; parallel stages hold one
+  //! level, serial stages any number of consecutive levels.
+  struct Stage {
+    int begin, end;
+    bool parallel;
+  };
+
+  struct Schedule {
+    std::vector<int> rows;
+    std::vector<Stage> stages;
+    int numLevels;
+  };
+
+  static void atomicMin(std::atomic<int> &a, int v) {
+    int expected = a.load();
+    while (v < expected && !a.compare_exchange_weak(expected, v)) {
+    }
+  }
+
+  //! Copies row P[i] of A into row i of M, lane l of an interleaved group.
+  void loadRow(int i, const double *valA, double *M, int stride,
+               int l) const {
+    for (int p = mPtr_[i]; p < mPtr_[i + 1]; p++) M[(size_t)p * stride + l] = 0.0;
+
+    const int row = P_[i];
+    for (int k = aRowPtr_[row]; k < aRowPtr_[row + 1]; k++) {
+      M[(size_t)aPos_[k] * stride + l] += valA[k];
+    }
+  }
+
+  //! Eliminates row i of M with the rows above it. Returns true if the
+  //! pivot was boosted.
+  bool factorRow(int i, double *M) const {
+    for (int p = mPtr_[i]; p < diagPos_[i]; p++) {
+      const int k = mCol_[p];
+      const double l = (M[p] /= M[diagPos_[k]]);
+      const double *u = M + diagPos_[k] + 1;
+      const int *dst = updateDst_.data() + updatePtr_[p];
+      const int len = mPtr_[k + 1] - diagPos_[k] - 1;
+
+      if (numDropped_ == 0) {
+        for (int t = 0; t < len; t++) M[dst[t]] -= l * u[t];
+      } else {
+        // dropped updates go to a slot of the calling thread, rows of one
+        // level are factored concurrently
+        const int nnzM = mPtr_[n_];
+        double scratch = 0.0;
+
+        for (int t = 0; t < len; t++) {
+          double *m = (dst[t] == nnzM) ? &scratch : M + dst[t];
+          *m -= l * u[t];
+        }
+      }
+    }
+
+    if (fabs(M[diagPos_[i]]) <= zero_) {
+      M[diagPos_[i]] = boost_;
+      return true;
+    }
+
+    return false;
+  }
+
+  //! factorRow() on kLanes interleaved matrices. Returns the lanes whose
+  //! pivot was boosted as a bit mask.
+  int factorRowLanes(int i, double *M) const {
+    for (int p = mPtr_[i]; p < diagPos_[i]; p++) {
+      const int k = mCol_[p];
+      double *lp = M + (size_t)p * kLanes;
+      const double *d = M + (size_t)diagPos_[k] * kLanes;
+      const double *u = M + (size_t)(diagPos_[k] + 1) * kLanes;
+      const int *dst = updateDst_.data() + updatePtr_[p];
+      const int len = mPtr_[k + 1] - diagPos_[k] - 1;
+
+      for (int l = 0; l < kLanes; l++) lp[l] /= d[l];
+
+      for (int t = 0; t < len; t++) {
+        double *m = M + (size_t)dst[t] * kLanes;
+        const double *ut = u + (size_t)t * kLanes;
+        for (int l = 0; l < kLanes; l++) m[l] -= lp[l] * ut[l];
+      }
+    }
+
+    double *d = M + (size_t)diagPos_[i] * kLanes;
+    int boosted = 0;
+
+    for (int l = 0; l < kLanes; l++) {
+      if (fabs(d[l]) <= zero_) {
+        d[l] = boost_;
+        boosted |= 1 << l;
+      }
+    }
+
+    return boosted;
+  }
+
+  //! Level sets of the rows, forward through L or backward through U.
+  void buildSchedule(bool upper, Schedule &s) const {
+    const int n = n_;
+    std::vector<int> level(n, 0), count;
+    s.numLevels = 0;
+
+    for (int r = 0; r < n; r++) {
+      const int i = upper ? n - 1 - r : r;
+      const int pb = upper ? diagPos_[i] + 1 : mPtr_[i];
+      const int pe = upper ? mPtr_[i + 1] : diagPos_[i];
+      int lev = 0;
+
+      for (int p = pb; p < pe; p++) lev = std::max(lev, level[mCol_[p]] + 1);
+      level[i] = lev;
+      s.numLevels = std::max(s.numLevels, lev + 1);
+    }
+
+    count.assign(s.numLevels + 1, 0);
+    for (int i = 0; i < n; i++) count[level[i] + 1]++;
+    for (int l = 0; l < s.numLevels; l++) count[l + 1] += count[l];
+
+    std::vector<int> pos(count.begin(), count.end() - 1);
+    s.rows.resize(n);
+    for (int i = 0; i < n; i++) s.rows[pos[level[i]]++] = i;
+
+    s.stages.clear();
+    const int minRows = kMinLevelRows * numThreads_;
+
+    for (int l = 0; l < s.numLevels; l++) {
+      const bool parallel =
+          numThreads_ > 1 && count[l + 1] - count[l] >= minRows;
+
+      if (!parallel && !s.stages.empty() && !s.stages.back().parallel) {
+        s.stages.back().end = count[l + 1];
+      } else {
+        Stage stage = {count[l], count[l + 1], parallel};
+        s.stages.push_back(stage);
+      }
+    }
+  }
+
+  void printStages(const char *label, const Schedule &s) const {
+    int parallel = 0;
+    for (size_t k = 0; k < s.stages.size(); k++) parallel += s.stages[k].parallel;
+
+    printf("  %-16s %6d levels, %6d stages (%d parallel)\n", label,
+           s.numLevels, (int)s.stages.size(), parallel);
+  }
+
+  //! Calls func(row) for all rows, stage after stage.
+  template <typename Func>
+  void runStages(const Schedule &s, Func func) const {
+    const std::vector<Stage> &stages = s.stages;
+    const int *rows = s.rows.data();
+    bool anyParallel = false;
+
+    for (size_t k = 0; k < stages.size(); k++) anyParallel |= stages[k].parallel;
+
+    if (!anyParallel) {
+      for (int r = 0; r < n_; r++) func(rows[r]);
+      return;
+    }
+
+    // the wait at the end of each parallel stage orders it with the next
+    for (size_t k = 0; k < stages.size(); k++) {
+      const Stage &stage = stages[k];
+
+      if (stage.parallel) {
+        sdkParallelFor(stage.begin, stage.end, kMinLevelRows,
+                       [&](int64_t rb, int64_t re, int) {
+                         for (int64_t r = rb; r < re; r++) func(rows[r]);
+                       });
+      } else {
+        for (int r = stage.begin; r < stage.end; r++) func(rows[r]);
+      }
+    }
+  }
+
+  int n_;
+  double zero_, boost_;
+  int numThreads_;
+  int maxBatch_;
+  int64_t numDropped_;
+  std::vector<int> P_, Q_;
+  // M = L + U - I in CSR, and the position of every entry of A in it
+  std::vector<int> mPtr_, mCol_, diagPos_;
+  std::vector<int> aRowPtr_, aPos_;
+  // update targets of L entry p: updateDst[updatePtr[p] .. updatePtr[p+1])
+  std::vector<int64_t> updatePtr_;
+  std::vector<int> updateDst_;
+  // refactor() and the L solve share the levels of L
+  Schedule lower_, upper_;
+  std::vector<double> M_, y_;
+  std::vector<double> batchM_, batchY_;
+};
+
+#endif  // COMMON_HELPER_REFACTOR_H_
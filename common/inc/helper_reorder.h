@@ -0,0 +1,861 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Host fill-reducing orderings for sparse factorizations.
+//
+// All orderings work on the adjacency graph of A + A^T without the diagonal
+// and return a permutation Q with B = A(Q,Q), i.e. Q[k] is the row of A that
+// becomes row k of B (the convention of cusolverSpXcsrsymrcmHost):
+//  - RCM: reverse Cuthill-McKee from a pseudo-peripheral node (George-Liu),
+//    per connected component,
+//  - AMD: minimum degree on the quotient graph with approximate external
+//    degrees and element absorption (Amestoy, Davis, Duff),
+//  - ND:  nested dissection by recursive level structure bisection with a
+//    refined vertex separator. The two halves are ordered concurrently and
+//    small subgraphs are finished with AMD.
+// reorderComputeStats() reports bandwidth, profile and the exact nnz(L) and
+// flop count of a Cholesky factorization of B from the elimination tree, so
+// the cheapest ordering can be chosen before factorizing. reorderSelectBest()
+// runs the three orderings concurrently and does exactly that. Permutations
+// can be stored with the pattern hash and reused for matrices with the same
+// nonzero pattern.
+#ifndef COMMON_HELPER_REORDER_H_
+#define COMMON_HELPER_REORDER_H_
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <helper_file.h>
+#include <helper_parallel.h>
+#include <helper_string.h>
+
+enum ReorderMethod {
+  REORDER_NATURAL = 0,
+  REORDER_RCM,
+  REORDER_AMD,
+  REORDER_ND
+};
+
+inline const char *reorderMethodName(ReorderMethod method) {
+  switch (method) {
+    case REORDER_RCM:
+      return "rcm";
+    case REORDER_AMD:
+      return "amd";
+    case REORDER_ND:
+      return "nd";
+    default:
+      return "natural";
+  }
+}
+
+//! Undirected graph in compressed adjacency form, no self loops.
+struct ReorderGraph {
+  int n;
+  std::vector<int> ptr;
+  std::vector<int> adj;
+
+  ReorderGraph() : n(0) {}
+  int degree(int i) const { return ptr[i + 1] - ptr[i]; }
+};
+
+//! Builds the graph of A + A^T from a CSR pattern with base rowPtr[0].
+inline void reorderBuildGraph(int n, const int *rowPtr, const int *colInd,
+                              ReorderGraph &G) {
+  const int base = rowPtr[0];
+  std::vector<int> count(n + 1, 0);
+
+  for (int i = 0; i < n; i++) {
+    for (int k = rowPtr[i] - base; k < rowPtr[i + 1] - base; k++) {
+      const int j = colInd[k] - base;
+
+      if (j != i && j >= 0 && j < n) {
+        count[i]++;
+        count[j]++;
+      }
+    }
+  }
+
+  sdkExclusiveScan(count.data(), n);
+  std::vector<int> raw(count[n]), pos(count.begin(), count.end() - 1);
+
+  for (int i = 0; i < n; i++) {
+    for (int k = rowPtr[i] - base; k < rowPtr[i + 1] - base; k++) {
+      const int j = colInd[k] - base;
+
+      if (j != i && j >= 0 && j < n) {
+        raw[pos[i]++] = j;
+        raw[pos[j]++] = i;
+      }
+    }
+  }
+
+  // sort and drop the duplicates of symmetric entries, in parallel
+  std::vector<int> unique(n + 1, 0);
+  sdkParallelFor(0, n, 4096, [&](int64_t b, int64_t e, int) {
+    for (int64_t i = b; i < e; i++) {
+      int *first = raw.data() + count[i], *last = raw.data() + count[i + 1];
+      std::sort(first, last);
+      unique[i] = (int)(std::unique(first, last) - first);
+    }
+  });
+
+  G.n = n;
+  G.ptr.assign(unique.begin(), unique.end());
+  sdkExclusiveScan(G.ptr.data(), n);
+  G.adj.resize(G.ptr[n]);
+  sdkParallelFor(0, n, 4096, [&](int64_t b, int64_t e, int) {
+    for (int64_t i = b; i < e; i++) {
+      std::copy(raw.begin() + count[i], raw.begin() + count[i] + unique[i],
+                G.adj.begin() + G.ptr[i]);
+    }
+  });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Level structures and RCM
+////////////////////////////////////////////////////////////////////////////////
+
+//! Breadth-first level structure from root over the nodes with
+//! mark[i] != stamp; visited nodes get mark[i] = stamp. Nodes are appended to
+//! order, levelPtr gets the start of every level plus the end. Neighbours are
+//! visited in increasing degree when sortByDegree is set (Cuthill-McKee).
+inline int reorderLevelStructure(const ReorderGraph &G, int root,
+                                 std::vector<int> &mark, int stamp,
+                                 std::vector<int> &order,
+                                 std::vector<int> &levelPtr,
+                                 bool sortByDegree) {
+  const size_t first = order.size();
+  levelPtr.assign(1, (int)first);
+  order.push_back(root);
+  mark[root] = stamp;
+  size_t levelBegin = first;
+
+  while (levelBegin < order.size()) {
+    const size_t levelEnd = order.size();
+
+    for (size_t q = levelBegin; q < levelEnd; q++) {
+      const int v = order[q];
+      const size_t added = order.size();
+
+      for (int k = G.ptr[v]; k < G.ptr[v + 1]; k++) {
+        const int w = G.adj[k];
+
+        if (mark[w] != stamp) {
+          mark[w] = stamp;
+          order.push_back(w);
+        }
+      }
+
+      if (sortByDegree) {
+        std::sort(order.begin() + added, order.end(), [&](int a, int b) {
+          return G.degree(a) < G.degree(b) || (G.degree(a) == G.degree(b) && a < b);
+        });
+      }
+    }
+
+    levelPtr.push_back((int)levelEnd);
+    levelBegin = levelEnd;
+  }
+
+  levelPtr.back() = (int)order.size();
+  return (int)levelPtr.size() - 1;
+}
+
+//! George-Liu pseudo-peripheral node of the component containing start.
+//! Every level structure it builds takes a fresh stamp (++stamp).
+inline int reorderPseudoPeripheral(const ReorderGraph &G, int start,
+                                   std::vector<int> &mark, int &stamp) {
+  std::vector<int> order, levelPtr;
+  int root = start;
+  int height = reorderLevelStructure(G, root, mark, ++stamp, order, levelPtr,
+                                     false);
+
+  for (;;) {
+    // the minimum degree node of the last level
+    int candidate = order[levelPtr[height - 1]];
+
+    for (int q = levelPtr[height - 1]; q < levelPtr[height]; q++) {
+      if (G.degree(order[q]) < G.degree(candidate)) candidate = order[q];
+    }
+
+    order.clear();
+    const int h = reorderLevelStructure(G, candidate, mark, ++stamp, order,
+                                        levelPtr, false);
+
+    if (h <= height) {
+      return root;
+    }
+
+    root = candidate;
+    height = h;
+  }
+}
+
+inline void reorderRcm(const ReorderGraph &G, std::vector<int> &Q) {
+  const int n = G.n;
+  std::vector<int> mark(n, 0), visited(n, 0), levelPtr, component;
+  int stamp = 0;
+  Q.clear();
+  Q.reserve(n);
+
+  for (int i = 0; i < n; i++) {
+    if (visited[i]) continue;
+
+    const int root = reorderPseudoPeripheral(G, i, mark, stamp);
+    component.clear();
+    reorderLevelStructure(G, root, mark, ++stamp, component, levelPtr, true);
+
+    for (size_t q = 0; q < component.size(); q++) {
+      visited[component[q]] = 1;
+      Q.push_back(component[q]);
+    }
+  }
+
+  std::reverse(Q.begin(), Q.end());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Approximate minimum degree
+////////////////////////////////////////////////////////////////////////////////
+inline void reorderAmd(const ReorderGraph &G, std::vector<int> &Q) {
+  enum { VARIABLE = 0, ELEMENT, ABSORBED };
+  const int n = G.n;
+  std::vector<std::vector<int> > vars(n), elems(n), Le(n);
+  std::vector<char> status(n, VARIABLE);
+  std::vector<int> degree(n), head(n + 1, -1), next(n, -1), prev(n, -1);
+  std::vector<int> mark(n, -1), w(n, 0), wStamp(n, -1);
+  Q.clear();
+  Q.reserve(n);
+
+  auto insert = [&](int i) {
+    const int d = degree[i];
+    prev[i] = -1;
+    next[i] = head[d];
+    if (head[d] >= 0) prev[head[d]] = i;
+    head[d] = i;
+  };
+  auto remove = [&](int i) {
+    if (prev[i] >= 0) next[prev[i]] = next[i]; else head[degree[i]] = next[i];
+    if (next[i] >= 0) prev[next[i]] = prev[i];
+  };
+
+  for (int i = 0; i < n; i++) {
+    vars[i].assign(G.adj.begin() + G.ptr[i], G.adj.begin() + G.ptr[i + 1]);
+    degree[i] = G.degree(i);
+    insert(i);
+  }
+
+  int minDegree = 0;
+  std::vector<int> Lp;
+
+  for (int k = 0; k < n; k++) {
+    while (head[minDegree] < 0) minDegree++;
+
+    const int p = head[minDegree];
+    remove(p);
+    status[p] = ELEMENT;
+    Q.push_back(p);
+
+    // Lp = variables adjacent to p directly or through its elements, which
+    // are absorbed into the new element p
+    Lp.clear();
+    mark[p] = k;
+
+    for (size_t q = 0; q < vars[p].size(); q++) {
+      const int j = vars[p][q];
+
+      if (status[j] == VARIABLE && mark[j] != k) {
+        mark[j] = k;
+        Lp.push_back(j);
+      }
+    }
+
+    for (size_t q = 0; q < elems[p].size(); q++) {
+      const int e = elems[p][q];
+      if (status[e] != ELEMENT) continue;
+
+      for (size_t r = 0; r < Le[e].size(); r++) {
+        const int j = Le[e][r];
+
+        if (status[j] == VARIABLE && mark[j] != k) {
+          mark[j] = k;
+          Lp.push_back(j);
+        }
+      }
+
+      status[e] = ABSORBED;
+      std::vector<int>().swap(Le[e]);
+    }
+
+    std::vector<int>().swap(vars[p]);
+    std::vector<int>().swap(elems[p]);
+    Le[p] = Lp;
+
+    // w(e) = |Le \ Lp| for every element adjacent to a variable of Lp
+    for (size_t q = 0; q < Lp.size(); q++) {
+      const int i = Lp[q];
+      remove(i);
+      std::vector<int> &ei = elems[i];
+      size_t live = 0;
+
+      for (size_t r = 0; r < ei.size(); r++) {
+        const int e = ei[r];
+        if (status[e] != ELEMENT) continue;
+        ei[live++] = e;
+
+        if (wStamp[e] != k) {
+          wStamp[e] = k;
+          size_t size = 0;
+
+          for (size_t s = 0; s < Le[e].size(); s++) {
+            if (status[Le[e][s]] == VARIABLE) Le[e][size++] = Le[e][s];
+          }
+
+          Le[e].resize(size);
+          w[e] = (int)size;
+        }
+
+        w[e]--;
+      }
+
+      ei.resize(live);
+    }
+
+    // approximate external degrees of the variables in Lp
+    const int remaining = n - k - 1;
+
+    for (size_t q = 0; q < Lp.size(); q++) {
+      const int i = Lp[q];
+      int d = (int)Lp.size() - 1;
+      std::vector<int> &ei = elems[i];
+      size_t live = 0;
+
+      for (size_t r = 0; r < ei.size(); r++) {
+        const int e = ei[r];
+
+        if (w[e] == 0) {
+          status[e] = ABSORBED;  // aggressive absorption, Le is inside Lp
+          std::vector<int>().swap(Le[e]);
+          continue;
+        }
+
+        ei[live++] = e;
+        d += w[e];
+      }
+
+      ei.resize(live);
+      ei.push_back(p);
+
+      // direct neighbours covered by element p are no longer needed
+      std::vector<int> &vi = vars[i];
+      live = 0;
+
+      for (size_t r = 0; r < vi.size(); r++) {
+        const int j = vi[r];
+        if (status[j] != VARIABLE || mark[j] == k) continue;
+        vi[live++] = j;
+        d++;
+      }
+
+      vi.resize(live);
+      degree[i] = std::max(0, std::min(std::min(d, remaining - 1),
+                                       degree[i] + (int)Lp.size() - 1));
+      insert(i);
+      minDegree = std::min(minDegree, degree[i]);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Nested dissection
+////////////////////////////////////////////////////////////////////////////////
+
+//! Subgraph of G induced by nodes (global ids in the same order).
+inline void reorderSubgraph(const ReorderGraph &G,
+                            const std::vector<int> &nodes,
+                            std::vector<int> &localId, ReorderGraph &S) {
+  S.n = (int)nodes.size();
+  S.ptr.assign(S.n + 1, 0);
+  S.adj.clear();
+
+  for (int q = 0; q < S.n; q++) localId[nodes[q]] = q;
+
+  for (int q = 0; q < S.n; q++) {
+    const int v = nodes[q];
+
+    for (int k = G.ptr[v]; k < G.ptr[v + 1]; k++) {
+      if (localId[G.adj[k]] >= 0) S.adj.push_back(localId[G.adj[k]]);
+    }
+
+    S.ptr[q + 1] = (int)S.adj.size();
+  }
+
+  for (int q = 0; q < S.n; q++) localId[nodes[q]] = -1;
+}
+
+inline void reorderNdRecurse(const ReorderGraph &G, const int *ids, int *out,
+                             int depth, int parallelDepth) {
+  const int n = G.n;
+  const int kLeafSize = 128;
+  std::vector<int> Qleaf;
+
+  if (n <= kLeafSize) {
+    reorderAmd(G, Qleaf);
+    for (int k = 0; k < n; k++) out[k] = ids[Qleaf[k]];
+    return;
+  }
+
+  // level structure from a pseudo-peripheral node
+  std::vector<int> mark(n, 0), order, levelPtr;
+  int stamp = 0;
+  const int root = reorderPseudoPeripheral(G, 0, mark, stamp);
+  const int height = reorderLevelStructure(G, root, mark, ++stamp, order,
+                                           levelPtr, false);
+  std::vector<char> part(n, 2);  // 0: A, 1: separator, 2: B
+
+  if ((int)order.size() < n) {
+    // disconnected: the component of node 0 against the rest
+    for (size_t q = 0; q < order.size(); q++) part[order[q]] = 0;
+  } else if (height < 3) {
+    reorderAmd(G, Qleaf);
+    for (int k = 0; k < n; k++) out[k] = ids[Qleaf[k]];
+    return;
+  } else {
+    // the smallest level whose cut leaves 35% - 65% of the nodes in front
+    int sep = -1;
+
+    for (int l = 1; l < height - 1; l++) {
+      const double before = (double)levelPtr[l] / n;
+      const double after = (double)levelPtr[l + 1] / n;
+      if (before > 0.65 || after < 0.35) continue;
+
+      if (sep < 0 ||
+          levelPtr[l + 1] - levelPtr[l] < levelPtr[sep + 1] - levelPtr[sep]) {
+        sep = l;
+      }
+    }
+
+    if (sep < 0) {
+      // no level in the window, cut at the level holding the median node
+      sep = 1;
+      while (sep < height - 2 && levelPtr[sep + 1] < n / 2) sep++;
+    }
+
+    for (int q = 0; q < levelPtr[sep]; q++) part[order[q]] = 0;
+    for (int q = levelPtr[sep]; q < levelPtr[sep + 1]; q++) part[order[q]] = 1;
+
+    // refine: separator nodes touching only one side move to that side
+    for (int q = levelPtr[sep]; q < levelPtr[sep + 1]; q++) {
+      const int v = order[q];
+      bool touchesA = false, touchesB = false;
+
+      for (int k = G.ptr[v]; k < G.ptr[v + 1]; k++) {
+        touchesA = touchesA || part[G.adj[k]] == 0;
+        touchesB = touchesB || part[G.adj[k]] == 2;
+      }
+
+      if (!touchesB) {
+        part[v] = 0;
+      } else if (!touchesA) {
+        part[v] = 2;
+      }
+    }
+  }
+
+  std::vector<int> nodes[3];
+
+  for (int v = 0; v < n; v++) nodes[(int)part[v]].push_back(v);
+
+  ReorderGraph sub[2];
+  std::vector<int> subIds[2], localId(n, -1);
+  const int halves[2] = {0, 2};
+
+  for (int h = 0; h < 2; h++) {
+    reorderSubgraph(G, nodes[halves[h]], localId, sub[h]);
+    subIds[h].resize(nodes[halves[h]].size());
+    for (size_t q = 0; q < subIds[h].size(); q++) subIds[h][q] = ids[nodes[halves[h]][q]];
+  }
+
+  // order: A, B, then the separator last
+  int *outB = out + sub[0].n;
+  int *outS = outB + sub[1].n;
+
+  for (size_t q = 0; q < nodes[1].size(); q++) outS[q] = ids[nodes[1][q]];
+
+  if (depth < parallelDepth && sub[0].n > 0 && sub[1].n > 0) {
+    std::thread left([&]() {
+      reorderNdRecurse(sub[0], subIds[0].data(), out, depth + 1, parallelDepth);
+    });
+    reorderNdRecurse(sub[1], subIds[1].data(), outB, depth + 1, parallelDepth);
+    left.join();
+  } else {
+    if (sub[0].n > 0) reorderNdRecurse(sub[0], subIds[0].data(), out, depth + 1, parallelDepth);
+    if (sub[1].n > 0) reorderNdRecurse(sub[1], subIds[1].data(), outB, depth + 1, parallelDepth);
+  }
+}
+
+inline void reorderNd(const ReorderGraph &G, std::vector<int> &Q) {
+  std::vector<int> ids(G.n);
+  int parallelDepth = 0;
+
+  for (int i = 0; i < G.n; i++) ids[i] = i;
+  while ((1 << parallelDepth) < sdkGetNumThreads()) parallelDepth++;
+
+  Q.resize(G.n);
+  if (G.n > 0) reorderNdRecurse(G, ids.data(), Q.data(), 0, parallelDepth);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Statistics and selection
+////////////////////////////////////////////////////////////////////////////////
+struct ReorderStats {
+  int bandwidth;    // max |i - j| over the nonzeros of B
+  int64_t profile;  // sum over rows of the distance to the first nonzero
+  int64_t nnzL;     // nonzeros of the Cholesky factor of B, with diagonal
+  double flops;     // sum of squared column counts of L
+  double ms;        // time to compute the ordering
+};
+
+//! Elimination tree of B = A(Q,Q), pinv the inverse of Q: parent[k] is the
+//! parent of column k of B, or -1 for a root (Liu, with path compression).
+inline void reorderEliminationTree(const ReorderGraph &G, const int *Q,
+                                   const int *pinv, std::vector<int> &parent) {
+  const int n = G.n;
+  std::vector<int> ancestor(n, -1);
+  parent.assign(n, -1);
+
+  for (int k = 0; k < n; k++) {
+    const int i = Q[k];
+
+    for (int q = G.ptr[i]; q < G.ptr[i + 1]; q++) {
+      int l = pinv[G.adj[q]];
+
+      while (l != -1 && l < k) {
+        const int next = ancestor[l];
+        ancestor[l] = k;
+        if (next == -1) parent[l] = k;
+        l = next;
+      }
+    }
+  }
+}
+
+//! Nonzeros per column of the Cholesky factor of B = A(Q,Q), diagonal
+//! included: row k of L is the union of the etree paths from the entries of
+//! row k of B up to k. Returns nnz(L).
+inline int64_t reorderColumnCounts(const ReorderGraph &G, const int *Q,
+                                   const int *pinv, const int *parent,
+                                   std::vector<int> &colCount) {
+  const int n = G.n;
+  std::vector<int> mark(n, -1);
+  int64_t nnz = n;
+  colCount.assign(n, 1);
+
+  for (int k = 0; k < n; k++) {
+    const int i = Q[k];
+    mark[k] = k;
+
+    for (int q = G.ptr[i]; q < G.ptr[i + 1]; q++) {
+      for (int l = pinv[G.adj[q]]; l < k && mark[l] != k; l = parent[l]) {
+        mark[l] = k;
+        colCount[l]++;
+        nnz++;
+      }
+    }
+  }
+
+  return nnz;
+}
+
+//! Statistics of B = A(Q,Q). nnz(L) is exact for a symmetric pattern; it
+//! is computed from the elimination tree by row subtree traversal.
+inline void reorderComputeStats(const ReorderGraph &G, const int *Q,
+                                ReorderStats &stats) {
+  const int n = G.n;
+  std::vector<int> pinv(n), parent, colCount;
+
+  for (int k = 0; k < n; k++) pinv[Q[k]] = k;
+
+  stats.bandwidth = 0;
+  stats.profile = 0;
+
+  for (int k = 0; k < n; k++) {
+    const int i = Q[k];
+    int first = k;
+
+    for (int q = G.ptr[i]; q < G.ptr[i + 1]; q++) {
+      const int l = pinv[G.adj[q]];
+      stats.bandwidth = std::max(stats.bandwidth, std::abs(l - k));
+      first = std::min(first, l);
+    }
+
+    stats.profile += k - first;
+  }
+
+  reorderEliminationTree(G, Q, pinv.data(), parent);
+  stats.nnzL = reorderColumnCounts(G, Q, pinv.data(), parent.data(), colCount);
+  stats.flops = 0.0;
+  for (int k = 0; k < n; k++) stats.flops += (double)colCount[k] * colCount[k];
+}
+
+inline void reorderCompute(const ReorderGraph &G, ReorderMethod method,
+                           std::vector<int> &Q) {
+  switch (method) {
+    case REORDER_RCM:
+      reorderRcm(G, Q);
+      break;
+    case REORDER_AMD:
+      reorderAmd(G, Q);
+      break;
+    case REORDER_ND:
+      reorderNd(G, Q);
+      break;
+    default:
+      Q.resize(G.n);
+      for (int i = 0; i < G.n; i++) Q[i] = i;
+  }
+}
+
+inline void reorderPrintStats(const char *label, const ReorderStats &stats) {
+  printf("  %-8s bandwidth = %8d, profile = %12lld, nnz(L) = %12lld, "
+         "flops = %.3e, %8.2f ms\n",
+         label, stats.bandwidth, (long long)stats.profile,
+         (long long)stats.nnzL, stats.flops, stats.ms);
+}
+
+//! Computes RCM, AMD and ND concurrently and returns the method whose
+//! Cholesky factor has the fewest nonzeros (flops break ties), with its
+//! permutation in Q. stats, if given, receives one entry per ReorderMethod.
+inline ReorderMethod reorderSelectBest(const ReorderGraph &G,
+                                       std::vector<int> &Q,
+                                       ReorderStats *stats = NULL) {
+  const int kMethods = 4;
+  std::vector<int> perms[kMethods];
+  ReorderStats all[kMethods];
+
+  sdkParallelFor(0, kMethods, 1, [&](int64_t b, int64_t e, int) {
+    for (int64_t m = b; m < e; m++) {
+      std::chrono::high_resolution_clock::time_point t0 =
+          std::chrono::high_resolution_clock::now();
+      reorderCompute(G, (ReorderMethod)m, perms[m]);
+      all[m].ms = std::chrono::duration<double, std::milli>(
+                      std::chrono::high_resolution_clock::now() - t0)
+                      .count();
+      reorderComputeStats(G, perms[m].data(), all[m]);
+    }
+  });
+
+  int best = REORDER_NATURAL;
+
+  for (int m = 1; m < kMethods; m++) {
+    if (all[m].nnzL < all[best].nnzL ||
+        (all[m].nnzL == all[best].nnzL && all[m].flops < all[best].flops)) {
+      best = m;
+    }
+  }
+
+  if (stats) std::copy(all, all + kMethods, stats);
+  Q.swap(perms[best]);
+  return (ReorderMethod)best;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Reuse across matrices with the same pattern
+////////////////////////////////////////////////////////////////////////////////
+
+//! FNV-1a hash of a CSR pattern, independent of the index base.
+inline uint64_t reorderPatternHash(int n, const int *rowPtr,
+                                   const int *colInd) {
+  const int base = rowPtr[0];
+  uint64_t h = 14695981039346656037ULL;
+  auto mix = [&h](uint32_t v) {
+    for (int b = 0; b < 4; b++) {
+      h ^= (v >> (8 * b)) & 0xff;
+      h *= 1099511628211ULL;
+    }
+  };
+
+  mix((uint32_t)n);
+
+  for (int i = 0; i < n; i++) {
+    mix((uint32_t)(rowPtr[i + 1] - rowPtr[i]));
+
+    for (int k = rowPtr[i] - base; k < rowPtr[i + 1] - base; k++) {
+      mix((uint32_t)(colInd[k] - base));
+    }
+  }
+
+  return h;
+}
+
+//! Key of a permutation saved for a pattern and an ordering method: the
+//! pattern hash with the method name (in any case) mixed in, so an ordering
+//! saved for one method is not reused for another.
+inline uint64_t reorderPermutationKey(uint64_t patternHash, const char *name) {
+  uint64_t h = patternHash;
+
+  for (const char *c = name; *c; c++) {
+    h ^= (unsigned char)tolower((unsigned char)*c);
+    h *= 1099511628211ULL;
+  }
+
+  return h;
+}
+
+static const char kReorderMagic[8] = {'S', 'D', 'K', 'P', 'E', 'R', 'M', '1'};
+
+//! Writes through a temporary file and a rename, so a concurrent or
+//! interrupted run never leaves a truncated permutation behind.
+inline bool reorderSavePermutation(const char *filename, uint64_t patternHash,
+                                   const std::vector<int> &Q) {
+  char suffix[32];
+  snprintf(suffix, sizeof(suffix), ".%d.tmp", sdkProcessId());
+  const std::string temp = std::string(filename) + suffix;
+  FILE *f = fopen(temp.c_str(), "wb");
+
+  if (f == NULL) {
+    return false;
+  }
+
+  const int n = (int)Q.size();
+  bool ok = fwrite(kReorderMagic, sizeof(kReorderMagic), 1, f) == 1;
+  ok = ok && fwrite(&patternHash, sizeof(patternHash), 1, f) == 1;
+  ok = ok && fwrite(&n, sizeof(n), 1, f) == 1;
+  ok = ok && fwrite(Q.data(), sizeof(int), Q.size(), f) == Q.size();
+  ok = (fclose(f) == 0) && ok;
+
+  if (!ok || !sdkReplaceFile(temp, filename)) {
+    remove(temp.c_str());
+    return false;
+  }
+
+  return true;
+}
+
+//! Loads a permutation saved for the same pattern. Returns false if the file
+//! is missing, was written for a different pattern or is not a permutation.
+inline bool reorderLoadPermutation(const char *filename, uint64_t patternHash,
+                                   int n, std::vector<int> &Q) {
+  FILE *f = fopen(filename, "rb");
+
+  if (f == NULL) {
+    return false;
+  }
+
+  char magic[8];
+  uint64_t hash = 0;
+  int size = -1;
+  bool ok = fread(magic, sizeof(magic), 1, f) == 1 &&
+            memcmp(magic, kReorderMagic, sizeof(magic)) == 0;
+  ok = ok && fread(&hash, sizeof(hash), 1, f) == 1 && hash == patternHash;
+  ok = ok && fread(&size, sizeof(size), 1, f) == 1 && size == n;
+
+  if (ok) {
+    Q.resize(n);
+    ok = fread(Q.data(), sizeof(int), n, f) == (size_t)n;
+  }
+
+  fclose(f);
+
+  if (ok) {
+    std::vector<char> seen(n, 0);
+
+    for (int k = 0; k < n && ok; k++) {
+      ok = Q[k] >= 0 && Q[k] < n && !seen[Q[k]];
+      if (ok) seen[Q[k]] = 1;
+    }
+  }
+
+  return ok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Driver for the solver samples
+////////////////////////////////////////////////////////////////////////////////
+
+//! True for the orderings implemented here: rcm, amd, nd and auto, in any
+//! case, like the other ordering names the samples accept.
+inline bool reorderIsHostMethod(const char *name) {
+  return name != NULL &&
+         (STRCASECMP(name, "rcm") == 0 || STRCASECMP(name, "amd") == 0 ||
+          STRCASECMP(name, "nd") == 0 || STRCASECMP(name, "auto") == 0);
+}
+
+//! Orders the CSR pattern (base rowPtr[0]) with the named method, or with
+//! the best of all for "auto", prints the statistics of every ordering that
+//! was computed and writes the zero-based permutation to Q. With permFile,
+//! a permutation saved there for the same pattern and method is reused, and
+//! a newly computed one is saved. Returns false for an unknown method.
+inline bool reorderHostPattern(const char *name, const char *permFile, int n,
+                               const int *rowPtr, const int *colInd, int *Q) {
+  if (!reorderIsHostMethod(name)) return false;
+
+  const uint64_t key =
+      reorderPermutationKey(reorderPatternHash(n, rowPtr, colInd), name);
+  std::vector<int> perm;
+  ReorderGraph G;
+  reorderBuildGraph(n, rowPtr, colInd, G);
+
+  const bool reused = permFile && reorderLoadPermutation(permFile, key, n, perm);
+
+  if (reused) {
+    ReorderStats stats;
+    stats.ms = 0.0;
+    reorderComputeStats(G, perm.data(), stats);
+    printf("  reusing the ordering saved in %s\n", permFile);
+    reorderPrintStats("saved", stats);
+  } else if (STRCASECMP(name, "auto") == 0) {
+    ReorderStats stats[4];
+    const ReorderMethod best = reorderSelectBest(G, perm, stats);
+
+    for (int m = 0; m < 4; m++) {
+      reorderPrintStats(reorderMethodName((ReorderMethod)m), stats[m]);
+    }
+
+    printf("  selected %s\n", reorderMethodName(best));
+  } else {
+    const ReorderMethod method =
+        (STRCASECMP(name, "rcm") == 0)   ? REORDER_RCM
+        : (STRCASECMP(name, "amd") == 0) ? REORDER_AMD
+                                         : REORDER_ND;
+    ReorderStats natural, stats;
+    std::vector<int> identity;
+    std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+    reorderCompute(G, method, perm);
+    stats.ms = std::chrono::duration<double, std::milli>(
+                   std::chrono::high_resolution_clock::now() - t0)
+                   .count();
+    reorderComputeStats(G, perm.data(), stats);
+    reorderCompute(G, REORDER_NATURAL, identity);
+    reorderComputeStats(G, identity.data(), natural);
+    natural.ms = 0.0;
+    reorderPrintStats("natural", natural);
+    reorderPrintStats(reorderMethodName(method), stats);
+  }
+
+  if (permFile && !reused) reorderSavePermutation(permFile, key, perm);
+
+  std::copy(perm.begin(), perm.end(), Q);
+  return true;
+}
+
+#endif  // COMMON_HELPER_REORDER_H_
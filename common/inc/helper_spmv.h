@@ -0,0 +1,480 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Multithreaded host sparse matrix-vector products (y = A*x).
+//
+// Three storage schemes are provided:
+//  - CsrSpMV:       plain CSR, rows split across threads so that every thread
+//                   gets roughly the same number of nonzeros,
+//  - SellCSigmaSpMV: SELL-C-sigma (sliced ELLPACK). Rows are sorted by length
+//                   inside windows of sigma rows and packed C at a time in
+//                   column-major slices, so the inner loop runs over C
+//                   independent rows and vectorizes,
+//  - SymCsrSpMV:    symmetric matrices storing only the upper triangle, which
+//                   roughly halves the matrix traffic.
+//
+// All matrices are zero-based. spmvPrintPerf() reports GFLOP/s and effective
+// GB/s against the bandwidth roofline measured by spmvStreamBandwidth().
+#ifndef COMMON_HELPER_SPMV_H_
+#define COMMON_HELPER_SPMV_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <vector>
+
+#include <helper_parallel.h>
+
+//! Non-owning view of a zero-based CSR matrix.
+template <typename T>
+struct CsrMatrixView {
+  int rows;
+  int cols;
+  int nnz;
+  const int *rowPtr;
+  const int *colInd;
+  const T *val;
+
+  CsrMatrixView()
+      : rows(0), cols(0), nnz(0), rowPtr(NULL), colInd(NULL), val(NULL) {}
+  CsrMatrixView(int m, int n, int nz, const int *ptr, const int *ind,
+                const T *v)
+      : rows(m), cols(n), nnz(nz), rowPtr(ptr), colInd(ind), val(v) {}
+};
+
+//! Split rows [0, rows) into parts ranges of roughly equal cost, where the
+//! cost of a row is its number of nonzeros plus one (loop overhead and the
+//! store to y). Returns parts+1 row boundaries.
+inline std::vector<int> spmvBalancedPartition(int rows, const int *rowPtr,
+                                              int parts) {
+  parts = std::max(1, std::min(parts, std::max(rows, 1)));
+  std::vector<int> bounds(parts + 1, rows);
+  const int64_t base = rowPtr[0];
+  const int64_t total = (int64_t)(rowPtr[rows] - base) + rows;
+  bounds[0] = 0;
+
+  for (int p = 1; p < parts; p++) {
+    int64_t target = total * p / parts;
+    int lo = bounds[p - 1], hi = rows;
+
+    while (lo < hi) {
+      int mid = lo + (hi - lo) / 2;
+
+      if ((int64_t)(rowPtr[mid] - base) + mid < target) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+
+    bounds[p] = lo;
+  }
+
+  return bounds;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// CSR
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class CsrSpMV {
+ public:
+  CsrSpMV() {}
+  explicit CsrSpMV(const CsrMatrixView<T> &A) { init(A); }
+
+  void init(const CsrMatrixView<T> &A) {
+    A_ = A;
+    bounds_ = spmvBalancedPartition(A.rows, A.rowPtr, sdkGetNumThreads());
+  }
+
+  //! y = A*x
+  void multiply(const T *x, T *y) const {
+    const int parts = (int)bounds_.size() - 1;
+    sdkParallelFor(0, parts, 1, [&](int64_t pb, int64_t pe, int) {
+      for (int64_t p = pb; p < pe; p++) {
+        multiplyRows(bounds_[p], bounds_[p + 1], x, y);
+      }
+    });
+  }
+
+  //! y = A*x on rows [rowBegin, rowEnd) only, for callers that fuse the
+  //! product with other per-row work inside their own parallel loop.
+  void multiplyRows(int rowBegin, int rowEnd, const T *x, T *y) const {
+    const int *rowPtr = A_.rowPtr;
+    const int *colInd = A_.colInd;
+    const T *val = A_.val;
+
+    for (int i = rowBegin; i < rowEnd; i++) {
+      T sum = 0;
+
+      for (int k = rowPtr[i]; k < rowPtr[i + 1]; k++) {
+        sum += val[k] * x[colInd[k]];
+      }
+
+      y[i] = sum;
+    }
+  }
+
+  const CsrMatrixView<T> &matrix() const { return A_; }
+  const std::vector<int> &partition() const { return bounds_; }
+
+  int64_t flops() const { return 2 * (int64_t)A_.nnz; }
+
+  //! Compulsory memory traffic of one product: matrix, x read once, y
+  //! written once.
+  int64_t bytes() const {
+    return (int64_t)A_.nnz * (sizeof(T) + sizeof(int)) +
+           (int64_t)(A_.rows + 1) * sizeof(int) +
+           (int64_t)A_.cols * sizeof(T) + (int64_t)A_.rows * sizeof(T);
+  }
+
+ private:
+  CsrMatrixView<T> A_;
+  std::vector<int> bounds_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// SELL-C-sigma
+////////////////////////////////////////////////////////////////////////////////
+template <typename T, int C = 8>
+class SellCSigmaSpMV {
+ public:
+  SellCSigmaSpMV() : rows_(0), cols_(0), nnz_(0), sigma_(0) {}
+  SellCSigmaSpMV(const CsrMatrixView<T> &A, int sigma) { init(A, sigma); }
+
+  //! Convert from CSR. sigma is rounded up to a multiple of C; sigma == C
+  //! disables sorting, sigma >= rows sorts globally.
+  void init(const CsrMatrixView<T> &A, int sigma) {
+    rows_ = A.rows;
+    cols_ = A.cols;
+    nnz_ = A.nnz;
+    sigma_ = std::max(C, (sigma + C - 1) / C * C);
+
+    const int numSlices = (rows_ + C - 1) / C;
+    perm_.resize((size_t)numSlices * C);
+    std::iota(perm_.begin(), perm_.end(), 0);
+
+    // sort rows by decreasing length inside each sigma window
+    sdkParallelFor(0, (rows_ + sigma_ - 1) / sigma_, 1,
+                   [&](int64_t wb, int64_t we, int) {
+      for (int64_t w = wb; w < we; w++) {
+        int *first = perm_.data() + w * sigma_;
+        int *last = perm_.data() + std::min<int64_t>((w + 1) * sigma_, rows_);
+        std::stable_sort(first, last, [&](int a, int b) {
+          return A.rowPtr[a + 1] - A.rowPtr[a] > A.rowPtr[b + 1] - A.rowPtr[b];
+        });
+      }
+    });
+
+    sliceStart_.resize(numSlices + 1);
+    sliceStart_[0] = 0;
+
+    for (int s = 0; s < numSlices; s++) {
+      int width = 0;
+
+      for (int lane = 0; lane < C; lane++) {
+        int r = perm_[s * C + lane];
+        if (r < rows_) width = std::max(width, A.rowPtr[r + 1] - A.rowPtr[r]);
+      }
+
+      sliceStart_[s + 1] = sliceStart_[s] + (int64_t)width * C;
+    }
+
+    col_.resize(sliceStart_[numSlices]);
+    val_.resize(sliceStart_[numSlices]);
+
+    sdkParallelFor(0, numSlices, 256, [&](int64_t sb, int64_t se, int) {
+      for (int64_t s = sb; s < se; s++) {
+        const int64_t width = (sliceStart_[s + 1] - sliceStart_[s]) / C;
+
+        for (int lane = 0; lane < C; lane++) {
+          int r = perm_[s * C + lane];
+          int len = (r < rows_) ? A.rowPtr[r + 1] - A.rowPtr[r] : 0;
+
+          for (int64_t j = 0; j < width; j++) {
+            int64_t dst = sliceStart_[s] + j * C + lane;
+
+            if (j < len) {
+              col_[dst] = A.colInd[A.rowPtr[r] + j];
+              val_[dst] = A.val[A.rowPtr[r] + j];
+            } else {
+              // padding: reuse a valid column so the gather stays in bounds
+              col_[dst] = (len > 0) ? A.colInd[A.rowPtr[r] + len - 1] : 0;
+              val_[dst] = 0;
+            }
+          }
+        }
+      }
+    });
+
+    // balance slices across threads by stored elements
+    const int parts = std::min(sdkGetNumThreads(), std::max(numSlices, 1));
+    bounds_.assign(parts + 1, numSlices);
+    bounds_[0] = 0;
+
+    for (int p = 1; p < parts; p++) {
+      int64_t target = (sliceStart_[numSlices] + numSlices) * p / parts;
+      int s = bounds_[p - 1];
+      while (s < numSlices && sliceStart_[s] + s < target) s++;
+      bounds_[p] = s;
+    }
+  }
+
+  //! y = A*x
+  void multiply(const T *x, T *y) const {
+    const int parts = (int)bounds_.size() - 1;
+    sdkParallelFor(0, parts, 1, [&](int64_t pb, int64_t pe, int) {
+      for (int64_t p = pb; p < pe; p++) {
+        for (int s = bounds_[p]; s < bounds_[p + 1]; s++) {
+          multiplySlice(s, x, y);
+        }
+      }
+    });
+  }
+
+  int sigma() const { return sigma_; }
+  int64_t storedElements() const { return sliceStart_.back(); }
+
+  //! Ratio of stored (padded) to actual nonzeros, 1.0 means no padding.
+  double fillRatio() const {
+    return nnz_ ? (double)storedElements() / nnz_ : 1.0;
+  }
+
+  int64_t flops() const { return 2 * (int64_t)nnz_; }
+
+  //! Compulsory traffic including padding and the permutation.
+  int64_t bytes() const {
+    return storedElements() * (sizeof(T) + sizeof(int)) +
+           (int64_t)sliceStart_.size() * sizeof(int64_t) +
+           (int64_t)rows_ * sizeof(int) + (int64_t)cols_ * sizeof(T) +
+           (int64_t)rows_ * sizeof(T);
+  }
+
+ private:
+  void multiplySlice(int s, const T *x, T *y) const {
+    T acc[C];
+
+    for (int lane = 0; lane < C; lane++) acc[lane] = 0;
+
+    const int *col = col_.data() + sliceStart_[s];
+    const T *val = val_.data() + sliceStart_[s];
+    const int64_t width = (sliceStart_[s + 1] - sliceStart_[s]) / C;
+
+    for (int64_t j = 0; j < width; j++) {
+      for (int lane = 0; lane < C; lane++) {
+        acc[lane] += val[j * C + lane] * x[col[j * C + lane]];
+      }
+    }
+
+    for (int lane = 0; lane < C; lane++) {
+      int r = perm_[s * C + lane];
+      if (r < rows_) y[r] = acc[lane];
+    }
+  }
+
+  int rows_;
+  int cols_;
+  int nnz_;
+  int sigma_;
+  std::vector<int> perm_;
+  std::vector<int64_t> sliceStart_;
+  std::vector<int> col_;
+  std::vector<T> val_;
+  std::vector<int> bounds_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Symmetric, upper triangle storage
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class SymCsrSpMV {
+ public:
+  SymCsrSpMV() : rows_(0), fullNnz_(0) {}
+  explicit SymCsrSpMV(const CsrMatrixView<T> &A) { init(A); }
+
+  //! Extract the upper triangle (including the diagonal) of a symmetric
+  //! matrix given in full CSR storage.
+  void init(const CsrMatrixView<T> &A) {
+    rows_ = A.rows;
+    fullNnz_ = A.nnz;
+    rowPtr_.assign(rows_ + 1, 0);
+
+    for (int i = 0; i < rows_; i++) {
+      int count = 0;
+
+      for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+        count += (A.colInd[k] >= i);
+      }
+
+      rowPtr_[i + 1] = rowPtr_[i] + count;
+    }
+
+    colInd_.resize(rowPtr_[rows_]);
+    val_.resize(rowPtr_[rows_]);
+
+    for (int i = 0, dst = 0; i < rows_; i++) {
+      for (int k = A.rowPtr[i]; k < A.rowPtr[i + 1]; k++) {
+        if (A.colInd[k] >= i) {
+          colInd_[dst] = A.colInd[k];
+          val_[dst] = A.val[k];
+          dst++;
+        }
+      }
+    }
+
+    bounds_ = spmvBalancedPartition(rows_, rowPtr_.data(), sdkGetNumThreads());
+
+    // transposed contributions of a part to rows past its own range go to a
+    // private buffer covering [end of part, largest column of the part]
+    const int parts = (int)bounds_.size() - 1;
+    spillBegin_.resize(parts);
+    spillEnd_.resize(parts);
+    spill_.resize(parts);
+
+    for (int p = 0; p < parts; p++) {
+      int maxCol = bounds_[p + 1];
+
+      for (int i = bounds_[p]; i < bounds_[p + 1]; i++) {
+        if (rowPtr_[i + 1] > rowPtr_[i]) {
+          maxCol = std::max(maxCol, colInd_[rowPtr_[i + 1] - 1] + 1);
+        }
+      }
+
+      spillBegin_[p] = bounds_[p + 1];
+      spillEnd_[p] = maxCol;
+      spill_[p].assign(maxCol - bounds_[p + 1], 0);
+    }
+  }
+
+  //! y = A*x
+  void multiply(const T *x, T *y) {
+    const int parts = (int)bounds_.size() - 1;
+
+    sdkParallelFor(0, parts, 1, [&](int64_t pb, int64_t pe, int) {
+      for (int64_t p = pb; p < pe; p++) {
+        const int begin = bounds_[p], end = bounds_[p + 1];
+        T *spill = spill_[p].data() - end;
+        std::fill(spill_[p].begin(), spill_[p].end(), T(0));
+        std::fill(y + begin, y + end, T(0));
+
+        for (int i = begin; i < end; i++) {
+          const T xi = x[i];
+          T sum = 0;
+
+          for (int k = rowPtr_[i]; k < rowPtr_[i + 1]; k++) {
+            const int j = colInd_[k];
+            const T a = val_[k];
+            sum += a * x[j];
+
+            if (j != i) {
+              if (j < end) {
+                y[j] += a * xi;
+              } else {
+                spill[j] += a * xi;
+              }
+            }
+          }
+
+          y[i] += sum;
+        }
+      }
+    });
+
+    // fold the spilled transposed contributions back into y
+    sdkParallelFor(0, rows_, 1 << 14, [&](int64_t rb, int64_t re, int) {
+      for (int p = 0; p < parts; p++) {
+        const int64_t b = std::max<int64_t>(rb, spillBegin_[p]);
+        const int64_t e = std::min<int64_t>(re, spillEnd_[p]);
+
+        for (int64_t i = b; i < e; i++) {
+          y[i] += spill_[p][i - spillBegin_[p]];
+        }
+      }
+    });
+  }
+
+  int storedNnz() const { return rowPtr_[rows_]; }
+  int64_t flops() const { return 2 * (int64_t)fullNnz_; }
+
+  int64_t bytes() const {
+    int64_t spill = 0;
+
+    for (size_t p = 0; p < spill_.size(); p++) spill += spill_[p].size();
+
+    return (int64_t)storedNnz() * (sizeof(T) + sizeof(int)) +
+           (int64_t)(rows_ + 1) * sizeof(int) + 2 * (int64_t)rows_ * sizeof(T) +
+           3 * spill * sizeof(T);
+  }
+
+ private:
+  int rows_;
+  int fullNnz_;
+  std::vector<int> rowPtr_;
+  std::vector<int> colInd_;
+  std::vector<T> val_;
+  std::vector<int> bounds_;
+  std::vector<int> spillBegin_;
+  std::vector<int> spillEnd_;
+  std::vector<std::vector<T> > spill_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Roofline reporting
+////////////////////////////////////////////////////////////////////////////////
+
+//! Sustainable host memory bandwidth in GB/s, measured with a threaded
+//! STREAM-like triad a[i] = b[i] + s*c[i] over arrays much larger than the
+//! last level cache. Counts 3 words per element (no write-allocate).
+inline double spmvStreamBandwidth(size_t n = (size_t)1 << 25, int reps = 5) {
+  std::vector<double> a(n), b(n), c(n);
+
+  sdkParallelFor(0, (int64_t)n, 1 << 16, [&](int64_t ib, int64_t ie, int) {
+    for (int64_t i = ib; i < ie; i++) {
+      a[i] = 0.0;
+      b[i] = 1.0;
+      c[i] = 2.0;
+    }
+  });
+
+  double best = 0.0;
+
+  for (int r = 0; r < reps; r++) {
+    std::chrono::high_resolution_clock::time_point t0 =
+        std::chrono::high_resolution_clock::now();
+    sdkParallelFor(0, (int64_t)n, 1 << 16, [&](int64_t ib, int64_t ie, int) {
+      for (int64_t i = ib; i < ie; i++) a[i] = b[i] + 3.0 * c[i];
+    });
+    double sec = std::chrono::duration<double>(
+                     std::chrono::high_resolution_clock::now() - t0)
+                     .count();
+    best = std::max(best, 3.0 * sizeof(double) * n / sec * 1e-9);
+  }
+
+  return best;
+}
+
+//! Print one result line. msPerProduct is the time of a single y = A*x.
+inline void spmvPrintPerf(const char *label, double msPerProduct,
+                          int64_t flops, int64_t bytes, double peakGBs) {
+  const double gflops = flops / (msPerProduct * 1e6);
+  const double gbs = bytes / (msPerProduct * 1e6);
+  const double intensity = (double)flops / bytes;
+  const double roof = peakGBs * intensity;
+  printf("%-24s Time = %8.4f msec, Perf = %7.3f GFlop/s, BW = %7.2f GB/s, "
+         "roofline %6.3f GFlop/s (%5.1f%%)\n",
+         label, msPerProduct, gflops, gbs, roof,
+         roof > 0 ? 100.0 * gflops / roof : 0.0);
+}
+
+#endif  // COMMON_HELPER_SPMV_H_
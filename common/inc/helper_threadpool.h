@@ -0,0 +1,338 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Persistent work-stealing thread pool for host-side tasks.
+//
+// Every worker owns a deque: tasks spawned by a worker go to the back of its
+// own deque and are popped from there (LIFO, cache warm), idle workers steal
+// from the front of the other deques (FIFO, which hands out the largest
+// pieces of a recursively split range). Tasks spawned by threads outside
+// the pool, e.g. the main thread or a CUDA stream callback, go to a shared
+// injection queue. Workers with nothing to do sleep on a condition variable.
+//
+// Threads that wait for tasks (SdkTaskGroup::wait, SdkThreadPool::get,
+// SdkLatch::wait) run pending tasks meanwhile instead of blocking, so
+// nested parallelism cannot deadlock and a pool without workers still makes
+// progress. The flip side is that tasks must not wait for each other
+// through anything but these primitives; use sdkParallelTeam() for threads
+// that need to run concurrently, e.g. around a barrier.
+//
+// The process-wide pool is sdkThreadPool() in helper_parallel.h.
+#ifndef COMMON_HELPER_THREADPOOL_H_
+#define COMMON_HELPER_THREADPOOL_H_
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class SdkThreadPool {
+ public:
+  typedef std::function<void()> Task;
+
+  //! Starts numWorkers threads; the threads that wait for tasks add to them.
+  explicit SdkThreadPool(int numWorkers) : pending_(0), stop_(false) {
+    for (int w = 0; w < std::max(numWorkers, 0); w++) {
+      workers_.push_back(std::unique_ptr<Worker>(new Worker));
+    }
+
+    for (int w = 0; w < (int)workers_.size(); w++) {
+      workers_[w]->thread = std::thread(&SdkThreadPool::workerLoop, this, w);
+    }
+  }
+
+  //! Runs the tasks that are still queued, then joins the workers.
+  ~SdkThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(sleepMutex_);
+      stop_ = true;
+    }
+
+    wake_.notify_all();
+
+    for (size_t w = 0; w < workers_.size(); w++) workers_[w]->thread.join();
+  }
+
+  int numWorkers() const { return (int)workers_.size(); }
+
+  //! Queues task, on the calling worker's own deque if there is one.
+  void spawn(Task task) {
+    const int self = workerIndex();
+
+    if (self >= 0) {
+      Worker &worker = *workers_[self];
+      std::lock_guard<std::mutex> lock(worker.mutex);
+      worker.tasks.push_back(std::move(task));
+    } else {
+      std::lock_guard<std::mutex> lock(injectMutex_);
+      inject_.push_back(std::move(task));
+    }
+
+    pending_.fetch_add(1);
+
+    {
+      std::lock_guard<std::mutex> lock(sleepMutex_);
+    }
+
+    wake_.notify_one();
+  }
+
+  //! Queues func() and returns a future for its result; exceptions are
+  //! delivered through the future. Wait for it with get() rather than
+  //! future::get() from inside a task.
+  template <typename Func>
+  auto submit(Func func) -> std::future<decltype(func())> {
+    typedef decltype(func()) Result;
+    std::shared_ptr<std::packaged_task<Result()> > task(
+        new std::packaged_task<Result()>(func));
+    std::future<Result> future = task->get_future();
+    spawn([task]() { (*task)(); });
+    return future;
+  }
+
+  //! future.get(), running pending tasks until the result is ready.
+  template <typename T>
+  T get(std::future<T> &future) {
+    while (future.wait_for(std::chrono::seconds(0)) !=
+           std::future_status::ready) {
+      if (!runOne()) std::this_thread::yield();
+    }
+
+    return future.get();
+  }
+
+  //! Runs one pending task on the calling thread. Returns false if there
+  //! was none.
+  bool runOne() {
+    Task task;
+
+    if (!take(workerIndex(), task)) return false;
+
+    task();
+    return true;
+  }
+
+  //! Calls func(b, e) on subranges of [begin, end) with at most grain
+  //! elements each. The range is split in halves recursively, so idle
+  //! workers steal large pieces and uneven work balances itself.
+  template <typename Func>
+  void parallelFor(int64_t begin, int64_t end, int64_t grain, Func func);
+
+ private:
+  struct Worker {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+    std::thread thread;
+  };
+
+  struct ThreadState {
+    const SdkThreadPool *pool;
+    int index;
+  };
+
+  static ThreadState &threadState() {
+    static thread_local ThreadState state = {NULL, -1};
+    return state;
+  }
+
+  int workerIndex() const {
+    const ThreadState &state = threadState();
+    return (state.pool == this) ? state.index : -1;
+  }
+
+  //! Own deque from the back, then the injection queue, then the front of
+  //! the other deques starting after self.
+  bool take(int self, Task &task) {
+    if (self >= 0 && popBack(*workers_[self], task)) return true;
+
+    {
+      std::lock_guard<std::mutex> lock(injectMutex_);
+
+      if (!inject_.empty()) {
+        task = std::move(inject_.front());
+        inject_.pop_front();
+        pending_.fetch_sub(1);
+        return true;
+      }
+    }
+
+    const int n = (int)workers_.size();
+
+    for (int k = 1; k <= n; k++) {
+      const int victim = (std::max(self, 0) + k) % n;
+      if (victim == self) continue;
+
+      Worker &worker = *workers_[victim];
+      std::lock_guard<std::mutex> lock(worker.mutex);
+
+      if (!worker.tasks.empty()) {
+        task = std::move(worker.tasks.front());
+        worker.tasks.pop_front();
+        pending_.fetch_sub(1);
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  bool popBack(Worker &worker, Task &task) {
+    std::lock_guard<std::mutex> lock(worker.mutex);
+
+    if (worker.tasks.empty()) return false;
+
+    task = std::move(worker.tasks.back());
+    worker.tasks.pop_back();
+    pending_.fetch_sub(1);
+    return true;
+  }
+
+  void workerLoop(int self) {
+    threadState().pool = this;
+    threadState().index = self;
+
+    for (int idle = 0;;) {
+      Task task;
+
+      if (take(self, task)) {
+        task();
+        idle = 0;
+        continue;
+      }
+
+      // spin briefly before sleeping, a new task is often just around
+      // the corner when a range is being split
+      if (++idle < 64) {
+        std::this_thread::yield();
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(sleepMutex_);
+
+      if (stop_ && pending_.load() == 0) return;
+
+      wake_.wait(lock, [this]() { return stop_ || pending_.load() > 0; });
+      idle = 0;
+    }
+  }
+
+  std::vector<std::unique_ptr<Worker> > workers_;
+  std::mutex injectMutex_;
+  std::deque<Task> inject_;
+  std::atomic<int> pending_;  // tasks in the queues, not yet taken
+
+  std::mutex sleepMutex_;
+  std::condition_variable wake_;
+  bool stop_;
+};
+
+//! Tasks that are waited for together. The first exception thrown by a
+//! task is rethrown by wait().
+class SdkTaskGroup {
+ public:
+  explicit SdkTaskGroup(SdkThreadPool &pool) : pool_(pool), count_(0) {}
+  ~SdkTaskGroup() { waitAll(); }
+
+  template <typename Func>
+  void run(Func func) {
+    count_.fetch_add(1);
+
+    pool_.spawn([this, func]() {
+      try {
+        func();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(errorMutex_);
+        if (!error_) error_ = std::current_exception();
+      }
+
+      count_.fetch_sub(1);
+    });
+  }
+
+  //! Returns once every task run() so far has finished, running pending
+  //! tasks of the pool meanwhile.
+  void wait() {
+    waitAll();
+
+    std::exception_ptr error;
+
+    {
+      std::lock_guard<std::mutex> lock(errorMutex_);
+      std::swap(error, error_);
+    }
+
+    if (error) std::rethrow_exception(error);
+  }
+
+ private:
+  void waitAll() {
+    while (count_.load() > 0) {
+      if (!pool_.runOne()) std::this_thread::yield();
+    }
+  }
+
+  SdkThreadPool &pool_;
+  std::atomic<int> count_;
+  std::mutex errorMutex_;
+  std::exception_ptr error_;
+};
+
+//! Single use countdown: wait() returns after count calls to countDown(),
+//! which may come from any thread, including ones outside the pool.
+class SdkLatch {
+ public:
+  explicit SdkLatch(int count) : count_(count) {}
+
+  void countDown() { count_.fetch_sub(1); }
+
+  void wait(SdkThreadPool &pool) {
+    while (count_.load() > 0) {
+      if (!pool.runOne()) std::this_thread::yield();
+    }
+  }
+
+ private:
+  std::atomic<int> count_;
+};
+
+template <typename Func>
+void SdkThreadPool::parallelFor(int64_t begin, int64_t end, int64_t grain,
+                                Func func) {
+  grain = std::max<int64_t>(grain, 1);
+  SdkTaskGroup group(*this);
+
+  // keeps the lower half, hands the upper half to the pool
+  std::function<void(int64_t, int64_t)> split = [&](int64_t b, int64_t e) {
+    while (e - b > grain) {
+      const int64_t mid = b + (e - b) / 2;
+      group.run([&split, mid, e]() { split(mid, e); });
+      e = mid;
+    }
+
+    func(b, e);
+  };
+
+  if (end > begin) split(begin, end);
+
+  group.wait();
+}
+
+#endif  // COMMON_HELPER_THREADPOOL_H_
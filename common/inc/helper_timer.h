@@ -342,6 +342,30 @@ inline float StopWatchLinux::getDiffTime() {
 }
 #endif  // WIN32
 
+////////////////////////////////////////////////////////////////////////////////
+//! Monotonic time in nanoseconds from an arbitrary origin, for intervals that
+//! are too short for the millisecond resolution of the stop watches.
+////////////////////////////////////////////////////////////////////////////////
+inline unsigned long long sdkGetTimeNs() {
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+  static LARGE_INTEGER freq = {0};
+  LARGE_INTEGER counter;
+
+  if (freq.QuadPart == 0) {
+    QueryPerformanceFrequency(&freq);
+  }
+
+  QueryPerformanceCounter(&counter);
+  return (unsigned long long)(counter.QuadPart / freq.QuadPart) * 1000000000ULL +
+         (unsigned long long)(counter.QuadPart % freq.QuadPart) * 1000000000ULL /
+             freq.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //! Timer functionality exported
 
@@ -0,0 +1,304 @@
+/**
+ * Copyright 2021 NVIDIA Corporation.  All rights reserved.
+ *
+ * Please refer to the NVIDIA end user license agreement (EULA) associated
+ * with this source code for terms and conditions that govern your use of
+ * this software. Any use, reproduction, disclosure, or distribution of
+ * this software and related documentation outside the terms of the EULA
+ * is strictly prohibited.
+ *
+ */
+
+// Host watershed segmentation of 8- and 16-bit images, the counterpart of
+// nppiSegmentWatershed_8u_C1IR / _16u_C1IR.
+//
+// The image is treated as a relief (typically a gradient magnitude) and is
+// flooded from its regional minima, which serve as markers:
+//  1. plateaus of equal value are found with the band-parallel union-find
+//     labelling of helper_labeling.h, and those without a lower neighbour
+//     become the seeds, labelled with the index of their first pixel,
+//  2. a priority flood (Meyer) grows the seeds in order of height with a
+//     hierarchical queue, one FIFO bucket per grey level, threaded through
+//     a next-pixel array so that it needs no allocation per pixel,
+//  3. the output image is written in parallel bands: every pixel receives
+//     the value of the minimum its segment was grown from, and with the
+//     boundary modes the pixels whose right or lower neighbours (and with
+//     8-way connectivity the lower diagonal ones) belong to another segment
+//     are marked.
+// The flood of an image is sequential and deterministic, so the batch
+// variant runs the images of a batch concurrently.
+//
+// The segment labels are pixel indices like those of nppiLabelMarkersUF and
+// can be compressed with sdkCompressMarkerLabels().
+#ifndef COMMON_HELPER_WATERSHED_H_
+#define COMMON_HELPER_WATERSHED_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <vector>
+
+#include <helper_arena.h>
+#include <helper_labeling.h>
+#include <helper_parallel.h>
+
+//! Output modes, as NppiWatershedSegmentBoundaryType.
+enum SdkWatershedBoundaries {
+  //! each pixel gets the value of its segment's minimum
+  kSdkWatershedBoundariesNone,
+  //! boundary pixels are set to the maximum value, all others to 0
+  kSdkWatershedBoundariesOnly,
+  //! segment values, with boundaries in black or white, whichever contrasts
+  //! more with the segment
+  kSdkWatershedBoundariesContrast
+};
+
+//! One image of a batch. The image is segmented in place, its pitch is in
+//! bytes. labels may be NULL; otherwise it is a contiguous width x height
+//! image that receives the segment labels.
+template <typename T>
+struct SdkWatershedImage {
+  T *image;
+  size_t pitch;
+  uint32_t *labels;
+  int width;
+  int height;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Internal helpers
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+class SdkWatershed {
+ public:
+  static const uint32_t kNone = 0xFFFFFFFFu;
+  static const int kLevels = 1 << (8 * sizeof(T));
+
+  SdkWatershed(const SdkWatershedImage<T> &image, int connectivity)
+      : image_(image), eightWay_(connectivity == 8) {}
+
+  void run(int boundaries) {
+    const size_t n = (size_t)image_.width * image_.height;
+    SdkPoolVector<uint32_t> labels;
+
+    if (image_.labels == NULL) {
+      labels.resize(n);
+      image_.labels = &labels[0];
+    }
+
+    findSeeds();
+    flood();
+    writeSegments(boundaries);
+  }
+
+ private:
+  T *row(int y) const { return (T *)((char *)image_.image + y * image_.pitch); }
+
+  T value(uint32_t i) const {
+    return row((int)(i / image_.width))[i % image_.width];
+  }
+
+  // Calls f(neighbour) for the neighbours of pixel (x, y) inside the image.
+  template <typename Func>
+  void forNeighbours(int x, int y, Func f) const {
+    const int w = image_.width, h = image_.height;
+    const uint32_t i = (uint32_t)y * w + x;
+
+    if (x > 0) f(i - 1);
+    if (x + 1 < w) f(i + 1);
+    if (y > 0) f(i - w);
+    if (y + 1 < h) f(i + w);
+
+    if (!eightWay_) return;
+
+    if (y > 0 && x > 0) f(i - w - 1);
+    if (y > 0 && x + 1 < w) f(i - w + 1);
+    if (y + 1 < h && x > 0) f(i + w - 1);
+    if (y + 1 < h && x + 1 < w) f(i + w + 1);
+  }
+
+  // Step 1: regional minima, plateaus without a lower neighbour, keep their
+  // plateau label, every other pixel is unlabelled.
+  void findSeeds() {
+    const int w = image_.width, h = image_.height;
+    uint32_t *labels = image_.labels;
+
+    sdkLabelMarkersUF((const T *)image_.image, image_.pitch, labels,
+                      w * sizeof(uint32_t), w, h, eightWay_ ? 8 : 4);
+
+    std::vector<std::atomic<uint8_t>, SdkPoolAllocator<std::atomic<uint8_t> > >
+        notMinimum((size_t)w * h);
+    const int64_t grain = std::max(1, (1 << 16) / w);
+
+    sdkParallelFor(0, h, grain, [&](int64_t b, int64_t e, int) {
+      for (int y = (int)b; y < (int)e; y++) {
+        const T *s = row(y);
+
+        for (int x = 0; x < w; x++) {
+          const T v = s[x];
+          bool lower = false;
+
+          forNeighbours(x, y, [&](uint32_t j) { lower |= value(j) < v; });
+
+          if (lower) {
+            notMinimum[labels[(size_t)y * w + x]].store(
+                1, std::memory_order_relaxed);
+          }
+        }
+      }
+    });
+
+    sdkParallelFor(0, h, grain, [&](int64_t b, int64_t e, int) {
+      for (size_t i = (size_t)b * w; i < (size_t)e * w; i++) {
+        if (notMinimum[labels[i]].load(std::memory_order_relaxed)) {
+          labels[i] = kNone;
+        }
+      }
+    });
+  }
+
+  // Step 2: priority flood with one FIFO per level. A pixel takes the label
+  // of the pixel that reaches it first and is queued at its own height, or
+  // at the current one if it lies lower.
+  void flood() {
+    const int w = image_.width, h = image_.height;
+    uint32_t *labels = image_.labels;
+    SdkPoolVector<uint32_t> next((size_t)w * h);
+    SdkPoolVector<uint32_t> head(kLevels, kNone), tail(kLevels, kNone);
+
+    auto push = [&](uint32_t i, int level) {
+      next[i] = kNone;
+
+      if (tail[level] == kNone) {
+        head[level] = i;
+      } else {
+        next[tail[level]] = i;
+      }
+
+      tail[level] = i;
+    };
+
+    // seed pixels next to unlabelled ones start the flood, in raster order
+    for (int y = 0; y < h; y++) {
+      const T *s = row(y);
+
+      for (int x = 0; x < w; x++) {
+        const uint32_t i = (uint32_t)y * w + x;
+
+        if (labels[i] == kNone) continue;
+
+        bool front = false;
+        forNeighbours(x, y, [&](uint32_t j) { front |= labels[j] == kNone; });
+
+        if (front) push(i, s[x]);
+      }
+    }
+
+    for (int level = 0; level < kLevels; level++) {
+      while (head[level] != kNone) {
+        const uint32_t i = head[level];
+        head[level] = next[i];
+
+        if (head[level] == kNone) tail[level] = kNone;
+
+        const uint32_t label = labels[i];
+
+        forNeighbours((int)(i % w), (int)(i / w), [&](uint32_t j) {
+          if (labels[j] != kNone) return;
+
+          labels[j] = label;
+          push(j, std::max<int>(level, value(j)));
+        });
+      }
+    }
+  }
+
+  // Step 3: the output image. The seed values are gathered first because
+  // the image is overwritten in place.
+  void writeSegments(int boundaries) {
+    const int w = image_.width, h = image_.height;
+    const uint32_t *labels = image_.labels;
+    const T maxValue = std::numeric_limits<T>::max();
+    const T half = (T)(maxValue / 2 + 1);
+    SdkPoolVector<T> seedValue((size_t)w * h);
+    const int64_t grain = std::max(1, (1 << 16) / w);
+
+    sdkParallelFor(0, h, grain, [&](int64_t b, int64_t e, int) {
+      for (int y = (int)b; y < (int)e; y++) {
+        const T *s = row(y);
+
+        for (int x = 0; x < w; x++) {
+          const uint32_t i = (uint32_t)y * w + x;
+
+          if (labels[i] == i) seedValue[i] = s[x];
+        }
+      }
+    });
+
+    sdkParallelFor(0, h, grain, [&](int64_t b, int64_t e, int) {
+      for (int y = (int)b; y < (int)e; y++) {
+        T *s = row(y);
+        const uint32_t *l = labels + (size_t)y * w;
+        const uint32_t *lDown = (y + 1 < h) ? l + w : NULL;
+
+        for (int x = 0; x < w; x++) {
+          const T segment = seedValue[l[x]];
+
+          if (boundaries == kSdkWatershedBoundariesNone) {
+            s[x] = segment;
+            continue;
+          }
+
+          bool edge = x + 1 < w && l[x + 1] != l[x];
+
+          if (lDown != NULL) {
+            edge |= lDown[x] != l[x];
+
+            if (eightWay_) {
+              edge |= x > 0 && lDown[x - 1] != l[x];
+              edge |= x + 1 < w && lDown[x + 1] != l[x];
+            }
+          }
+
+          if (boundaries == kSdkWatershedBoundariesOnly) {
+            s[x] = edge ? maxValue : 0;
+          } else {
+            s[x] = !edge ? segment : (segment < half ? maxValue : 0);
+          }
+        }
+      }
+    });
+  }
+
+  SdkWatershedImage<T> image_;
+  bool eightWay_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+//! Segment count images in place, connectivity 4 or 8, boundaries one of
+//! SdkWatershedBoundaries. The images are processed concurrently.
+////////////////////////////////////////////////////////////////////////////////
+template <typename T>
+inline void sdkSegmentWatershedBatch(const SdkWatershedImage<T> *images,
+                                     int count, int connectivity,
+                                     int boundaries) {
+  sdkParallelFor(0, count, 1, [&](int64_t b, int64_t e, int) {
+    for (int64_t k = b; k < e; k++) {
+      SdkWatershed<T>(images[k], connectivity).run(boundaries);
+    }
+  });
+}
+
+//! Segment one image in place; labels may be NULL.
+template <typename T>
+inline void sdkSegmentWatershed(T *image, size_t pitch, uint32_t *labels,
+                                int width, int height, int connectivity,
+                                int boundaries) {
+  SdkWatershedImage<T> one = {image, pitch, labels, width, height};
+  SdkWatershed<T>(one, connectivity).run(boundaries);
+}
+
+#endif  // COMMON_HELPER_WATERSHED_H_
@@ -15,11 +15,15 @@
 
 #include <cuda.h>
 #include <helper_cuda_drvapi.h>
+#include <helper_nvrtc_bundle.h>
+#include <helper_nvrtc_cache.h>
 #include <nvrtc.h>
+#include <string.h>
 #include <fstream>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #define NVRTC_SAFE_CALL(Name, x)                                \
   do {                                                          \
@@ -31,72 +35,103 @@
     }                                                           \
   } while (0)
 
-void compileFileToCUBIN(char *filename, int argc, char **argv, char **cubinResult,
-                      size_t *cubinResultSize, int requiresCGheaders) {
-  std::ifstream inputFile(filename,
-                          std::ios::in | std::ios::binary | std::ios::ate);
+// NVRTC backend of the kernel cache.
+class SdkNvrtcCompiler : public SdkKernelCompiler {
+ public:
+  std::string identity() {
+    int major = 0, minor = 0;
+    NVRTC_SAFE_CALL("nvrtcVersion", nvrtcVersion(&major, &minor));
 
-  if (!inputFile.is_open()) {
-    std::cerr << "\nerror: unable to open " << filename << " for reading!\n";
-    exit(1);
+    std::ostringstream text;
+    text << "nvrtc " << major << "." << minor;
+    return text.str();
   }
 
-  std::streampos pos = inputFile.tellg();
-  size_t inputSize = (size_t)pos;
-  char *memBlock = new char[inputSize + 1];
+  bool compile(const std::string &source, const std::string &name,
+               const std::vector<std::string> &options,
+               std::vector<char> &binary, std::string &log) {
+    std::vector<const char *> params;
 
-  inputFile.seekg(0, std::ios::beg);
-  inputFile.read(memBlock, inputSize);
-  inputFile.close();
-  memBlock[inputSize] = '\x0';
+    for (size_t i = 0; i < options.size(); i++) {
+      params.push_back(options[i].c_str());
+    }
 
-  int numCompileOptions = 0;
+    nvrtcProgram prog;
+    NVRTC_SAFE_CALL("nvrtcCreateProgram",
+                    nvrtcCreateProgram(&prog, source.c_str(), name.c_str(), 0,
+                                       NULL, NULL));
+
+    nvrtcResult res = nvrtcCompileProgram(
+        prog, (int)params.size(), params.empty() ? NULL : &params[0]);
+
+    size_t logSize;
+    NVRTC_SAFE_CALL("nvrtcGetProgramLogSize",
+                    nvrtcGetProgramLogSize(prog, &logSize));
+    log.assign(logSize + 1, '\x0');
+    NVRTC_SAFE_CALL("nvrtcGetProgramLog", nvrtcGetProgramLog(prog, &log[0]));
+    log.resize(strlen(log.c_str()));
+
+    if (res != NVRTC_SUCCESS) {
+      log += "\nerror: nvrtcCompileProgram failed with error ";
+      log += nvrtcGetErrorString(res);
+      nvrtcDestroyProgram(&prog);
+      return false;
+    }
 
-  char *compileParams[2];
+    size_t codeSize;
+    NVRTC_SAFE_CALL("nvrtcGetCUBINSize", nvrtcGetCUBINSize(prog, &codeSize));
+    binary.resize(codeSize);
+    NVRTC_SAFE_CALL("nvrtcGetCUBIN", nvrtcGetCUBIN(prog, &binary[0]));
+    NVRTC_SAFE_CALL("nvrtcDestroyProgram", nvrtcDestroyProgram(&prog));
+    return true;
+  }
+};
 
+// Target architecture option for cuDevice, e.g. --gpu-architecture=sm_80.
+std::string deviceArchitectureOption(CUdevice cuDevice) {
   int major = 0, minor = 0;
 
-  // Picks the best CUDA device available
-  CUdevice cuDevice = findCudaDeviceDRV(argc, (const char **)argv);
-
   // get compute capabilities and the devicename
   checkCudaErrors(cuDeviceGetAttribute(
       &major, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR, cuDevice));
   checkCudaErrors(cuDeviceGetAttribute(
       &minor, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR, cuDevice));
-  
-  {
-  // Compile cubin for the GPU arch on which are going to run cuda kernel.
-  std::string compileOptions;
-  compileOptions = "--gpu-architecture=sm_";
-
-  compileParams[numCompileOptions] = reinterpret_cast<char *>(
-                  malloc(sizeof(char) * (compileOptions.length() + 10)));
-#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
-  sprintf_s(compileParams[numCompileOptions], sizeof(char) * (compileOptions.length() + 10),
-            "%s%d%d", compileOptions.c_str(), major, minor);
-#else
-  snprintf(compileParams[numCompileOptions], compileOptions.size() + 10, "%s%d%d",
-           compileOptions.c_str(), major, minor);
-#endif
+
+  std::ostringstream arch;
+  arch << "--gpu-architecture=sm_" << major << minor;
+  return arch.str();
+}
+
+// Target architecture option for the device selected on the command line.
+std::string deviceArchitectureOption(int argc, char **argv) {
+  // Picks the best CUDA device available
+  return deviceArchitectureOption(findCudaDeviceDRV(argc, (const char **)argv));
+}
+
+// Compiles filename to a CUBIN for the device selected on the command line.
+// Compilations are cached on disk (see helper_nvrtc_cache.h), a warm start
+// reads the CUBIN back without invoking NVRTC. The result is allocated with
+// malloc and released by loadCUBIN.
+void compileFileToCUBIN(char *filename, int argc, char **argv, char **cubinResult,
+                      size_t *cubinResultSize, int requiresCGheaders) {
+  std::string source;
+
+  if (!sdkReadFile(filename, source)) {
+    std::cerr << "\nerror: unable to open " << filename << " for reading!\n";
+    exit(1);
   }
 
-  numCompileOptions++;
+  // Compile cubin for the GPU arch on which are going to run cuda kernel.
+  std::vector<std::string> compileOptions;
+  compileOptions.push_back(deviceArchitectureOption(argc, argv));
 
   if (requiresCGheaders) {
-    std::string compileOptions;
-    char HeaderNames[256];
-#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
-    sprintf_s(HeaderNames, sizeof(HeaderNames), "%s", "cooperative_groups.h");
-#else
-    snprintf(HeaderNames, sizeof(HeaderNames), "%s", "cooperative_groups.h");
-#endif
-
-    compileOptions = "--include-path=";
+    const char *headerName = "cooperative_groups.h";
+    char *headerPath = sdkFindFilePath(headerName, argv[0]);
+    std::string path = headerPath ? headerPath : "";
 
-    std::string path = sdkFindFilePath(HeaderNames, argv[0]);
     if (!path.empty()) {
-      std::size_t found = path.find(HeaderNames);
+      std::size_t found = path.find(headerName);
       path.erase(found);
     } else {
       printf(
@@ -104,56 +139,101 @@ void compileFileToCUBIN(char *filename, int argc, char **argv, char **cubinResul
           "sample directory..\n Exiting..\n",
           argv[0]);
     }
-    compileOptions += path.c_str();
-    compileParams[numCompileOptions] = reinterpret_cast<char *>(
-        malloc(sizeof(char) * (compileOptions.length() + 1)));
-#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
-    sprintf_s(compileParams[numCompileOptions], sizeof(char) * (compileOptions.length() + 1),
-              "%s", compileOptions.c_str());
-#else
-    snprintf(compileParams[numCompileOptions], compileOptions.size(), "%s",
-             compileOptions.c_str());
-#endif
-    numCompileOptions++;
-  }
 
-  // compile
-  nvrtcProgram prog;
-  NVRTC_SAFE_CALL("nvrtcCreateProgram",
-                  nvrtcCreateProgram(&prog, memBlock, filename, 0, NULL, NULL));
+    compileOptions.push_back("--include-path=" + path);
+  }
 
-  nvrtcResult res = nvrtcCompileProgram(prog, numCompileOptions, compileParams);
+  SdkNvrtcCompiler compiler;
+  std::vector<char> code;
+  std::string log;
+  bool compiled = sdkCompileCached(compiler, SdkKernelCache::instance(),
+                                   source, filename, compileOptions, code, log);
 
   // dump log
-  size_t logSize;
-  NVRTC_SAFE_CALL("nvrtcGetProgramLogSize",
-                  nvrtcGetProgramLogSize(prog, &logSize));
-  char *log = reinterpret_cast<char *>(malloc(sizeof(char) * logSize + 1));
-  NVRTC_SAFE_CALL("nvrtcGetProgramLog", nvrtcGetProgramLog(prog, log));
-  log[logSize] = '\x0';
-
-  if (strlen(log) >= 2) {
+  if (log.size() >= 2) {
     std::cerr << "\n compilation log ---\n";
     std::cerr << log;
     std::cerr << "\n end log ---\n";
   }
 
-  free(log);
+  if (!compiled) {
+    exit(1);
+  }
 
-  NVRTC_SAFE_CALL("nvrtcCompileProgram", res);
+  *cubinResult = reinterpret_cast<char *>(malloc(code.size()));
+  memcpy(*cubinResult, code.data(), code.size());
+  *cubinResultSize = code.size();
+}
 
-  size_t codeSize;
-  NVRTC_SAFE_CALL("nvrtcGetCUBINSize", nvrtcGetCUBINSize(prog, &codeSize));
-  char *code = new char[codeSize];
-  NVRTC_SAFE_CALL("nvrtcGetCUBIN", nvrtcGetCUBIN(prog, code));
-  *cubinResult = code;
-  *cubinResultSize = codeSize;
+// Gives the variants the source of filename and the target architecture
+// option arch; keys, instantiations and further options are the caller's.
+void prepareFileVariants(char *filename, const std::string &arch,
+                         std::vector<SdkKernelVariant> &variants) {
+  std::string source;
 
-  for (int i = 0; i < numCompileOptions; i++) {
-    free(compileParams[i]);
+  if (!sdkReadFile(filename, source)) {
+    std::cerr << "\nerror: unable to open " << filename << " for reading!\n";
+    exit(1);
+  }
+
+  for (size_t i = 0; i < variants.size(); i++) {
+    variants[i].source = source;
+    variants[i].name = filename;
+    variants[i].options.push_back(arch);
+  }
+}
+
+// True if bundle holds all the prepared variants, built from their current
+// sources and options.
+bool kernelBundleIsCurrent(const SdkKernelBundle &bundle,
+                           const std::vector<SdkKernelVariant> &variants) {
+  SdkNvrtcCompiler compiler;
+  return sdkKernelBundleCurrent(compiler, SdkKernelCache::instance(), bundle,
+                                variants);
+}
+
+// Compiles the prepared variants concurrently and writes them to the bundle
+// at bundlePath (see helper_nvrtc_bundle.h). Compilations go through the
+// kernel cache.
+void compileVariantsToBundle(const std::vector<SdkKernelVariant> &variants,
+                             const char *bundlePath) {
+  SdkNvrtcCompiler compiler;
+  std::string log;
+
+  if (!sdkBuildKernelBundle(compiler, SdkKernelCache::instance(), variants,
+                            bundlePath, log)) {
+    std::cerr << "\n compilation log ---\n";
+    std::cerr << log;
+    std::cerr << "\n end log ---\n";
+    exit(1);
   }
 }
 
+// Loads the CUBIN of the variant key of a bundle in place, creating a
+// context on cuDevice if there is none.
+CUmodule loadBundledCUBIN(const SdkKernelBundle &bundle, const char *key,
+                          CUdevice cuDevice) {
+  CUmodule module;
+  CUcontext context = NULL;
+  const char *cubin = bundle.find(key, NULL);
+
+  if (cubin == NULL) {
+    std::cerr << "\nerror: no variant " << key << " in the kernel bundle\n";
+    exit(1);
+  }
+
+  checkCudaErrors(cuInit(0));
+  checkCudaErrors(cuCtxGetCurrent(&context));
+
+  if (context == NULL) {
+    checkCudaErrors(cuCtxCreate(&context, 0, cuDevice));
+  }
+
+  checkCudaErrors(cuModuleLoadData(&module, cubin));
+
+  return module;
+}
+
 CUmodule loadCUBIN(char *cubin, int argc, char **argv) {
   CUmodule module;
   CUcontext context;
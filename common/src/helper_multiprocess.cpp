@@ -1,6 +1,14 @@
 #include "helper_multiprocess.h"
 #include <cstdlib>
 #include <string>
+#include <atomic>
+#include <new>
+#include <thread>
+#if defined(__linux__)
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
 
 int sharedMemoryCreate(const char *name, size_t sz, sharedMemoryInfo *info) {
 #if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
@@ -514,3 +522,297 @@ int ipcCloseShareableHandle(ShareableHandle shHandle) {
 }
 
 #endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Shared-memory ring
+////////////////////////////////////////////////////////////////////////////////
+// Slot i of round r has sequence r * count + i while it is free and one more
+// once the frame in it is committed; releasing it moves it on to the next
+// round. head counts the reserved slots and tail the claimed ones, each on a
+// cache line of its own with the signal a blocked side waits on.
+#define SHM_RING_MAGIC 0x31474e4952485353ULL  // "SSHRING1"
+#define SHM_RING_LINE 64
+#define SHM_RING_SPIN 256
+
+#if defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64)
+#define SHM_RING_EINVAL ERROR_INVALID_PARAMETER
+#else
+#define SHM_RING_EINVAL EINVAL
+#endif
+
+typedef unsigned long long shmRingCounter;
+
+struct shmRingSlot_st {
+  std::atomic<shmRingCounter> sequence;
+  shmRingCounter size;
+};
+
+struct shmRingHeader_st {
+  std::atomic<shmRingCounter> magic;
+  shmRingCounter mappingSize;
+  shmRingCounter slotSize;
+  shmRingCounter slotStride;
+  unsigned int slotCount;
+
+  alignas(SHM_RING_LINE) std::atomic<shmRingCounter> head;
+  std::atomic<unsigned int> spaceSignal;
+  std::atomic<unsigned int> spaceWaiters;
+
+  alignas(SHM_RING_LINE) std::atomic<shmRingCounter> tail;
+  std::atomic<unsigned int> dataSignal;
+  std::atomic<unsigned int> dataWaiters;
+  std::atomic<unsigned int> closed;
+};
+
+static size_t shmRingHeaderSize() {
+  return (sizeof(shmRingHeader_st) + SHM_RING_LINE - 1) &
+         ~(size_t)(SHM_RING_LINE - 1);
+}
+
+static shmRingSlot_st *shmRingSlot(const shmRingInfo *ring,
+                                   shmRingCounter position) {
+  const shmRingHeader_st *header = ring->header;
+  return (shmRingSlot_st *)(ring->slots +
+                            (position & (header->slotCount - 1)) *
+                                header->slotStride);
+}
+
+static unsigned char *shmRingPayload(shmRingSlot_st *slot) {
+  return (unsigned char *)slot + SHM_RING_LINE;
+}
+
+static void shmRingWait(std::atomic<unsigned int> *signal,
+                        unsigned int value) {
+#if defined(__linux__)
+  // not FUTEX_PRIVATE_FLAG, the word is shared between processes
+  syscall(SYS_futex, reinterpret_cast<unsigned int *>(signal), FUTEX_WAIT,
+          value, NULL, NULL, 0);
+#else
+  if (signal->load() == value) {
+    std::this_thread::yield();
+  }
+#endif
+}
+
+static void shmRingWake(std::atomic<unsigned int> *signal,
+                        std::atomic<unsigned int> *waiters, int count) {
+  signal->fetch_add(1);
+
+  if (waiters->load() != 0) {
+#if defined(__linux__)
+    syscall(SYS_futex, reinterpret_cast<unsigned int *>(signal), FUTEX_WAKE,
+            count, NULL, NULL, 0);
+#endif
+  }
+}
+
+// Spins a little, then sleeps on signal until ready() holds. A waker makes
+// its change visible before it bumps signal and checks for waiters, so either
+// it sees this waiter or this waiter sees the change, or the bumped signal
+// fails the futex wait.
+template <typename Ready>
+static void shmRingBlock(std::atomic<unsigned int> *signal,
+                         std::atomic<unsigned int> *waiters, Ready ready) {
+  for (int i = 0; i < SHM_RING_SPIN; i++) {
+    if (ready()) {
+      return;
+    }
+  }
+
+  while (!ready()) {
+    waiters->fetch_add(1);
+    unsigned int value = signal->load();
+
+    if (!ready()) {
+      shmRingWait(signal, value);
+    }
+
+    waiters->fetch_sub(1);
+  }
+}
+
+int shmRingCreate(const char *name, size_t slotSize, unsigned int slotCount,
+                  shmRingInfo *ring) {
+  // a slot committed at position p carries sequence p + 1, the value a
+  // free slot of the next round has with a single slot; two tell them apart
+  unsigned int count = 2;
+
+  memset(ring, 0, sizeof(*ring));
+
+  if (slotCount == 0 || slotCount > (1u << 30) || slotSize == 0 ||
+      strlen(name) >= sizeof(ring->name)) {
+    return SHM_RING_EINVAL;
+  }
+
+  while (count < slotCount) {
+    count <<= 1;
+  }
+
+  size_t stride = SHM_RING_LINE + ((slotSize + SHM_RING_LINE - 1) &
+                                   ~(size_t)(SHM_RING_LINE - 1));
+  size_t size = shmRingHeaderSize() + (size_t)count * stride;
+
+  int status = sharedMemoryCreate(name, size, &ring->shm);
+  if (status != 0) {
+    return status;
+  }
+
+  ring->header = new (ring->shm.addr) shmRingHeader_st;
+  ring->slots = (unsigned char *)ring->shm.addr + shmRingHeaderSize();
+  ring->owner = 1;
+  memcpy(ring->name, name, strlen(name) + 1);
+
+  shmRingHeader_st *header = ring->header;
+  header->mappingSize = size;
+  header->slotSize = slotSize;
+  header->slotStride = stride;
+  header->slotCount = count;
+  header->head.store(0);
+  header->tail.store(0);
+  header->spaceSignal.store(0);
+  header->spaceWaiters.store(0);
+  header->dataSignal.store(0);
+  header->dataWaiters.store(0);
+  header->closed.store(0);
+
+  for (unsigned int i = 0; i < count; i++) {
+    shmRingSlot_st *slot =
+        new (ring->slots + (size_t)i * stride) shmRingSlot_st;
+    slot->sequence.store(i);
+    slot->size = 0;
+  }
+
+  // openers check the magic last
+  header->magic.store(SHM_RING_MAGIC, std::memory_order_release);
+  return 0;
+}
+
+int shmRingOpen(const char *name, shmRingInfo *ring) {
+  sharedMemoryInfo probe;
+  shmRingCounter size;
+
+  memset(ring, 0, sizeof(*ring));
+
+  if (strlen(name) >= sizeof(ring->name)) {
+    return SHM_RING_EINVAL;
+  }
+
+  // map the header to learn the size of the ring, then the whole ring
+  int status = sharedMemoryOpen(name, shmRingHeaderSize(), &probe);
+  if (status != 0) {
+    return status;
+  }
+
+  shmRingHeader_st *header = (shmRingHeader_st *)probe.addr;
+  bool valid =
+      header->magic.load(std::memory_order_acquire) == SHM_RING_MAGIC;
+  size = header->mappingSize;
+  sharedMemoryClose(&probe);
+
+  if (!valid) {
+    return SHM_RING_EINVAL;
+  }
+
+  status = sharedMemoryOpen(name, (size_t)size, &ring->shm);
+  if (status != 0) {
+    return status;
+  }
+
+  ring->header = (shmRingHeader_st *)ring->shm.addr;
+  ring->slots = (unsigned char *)ring->shm.addr + shmRingHeaderSize();
+  memcpy(ring->name, name, strlen(name) + 1);
+  return 0;
+}
+
+void shmRingClose(shmRingInfo *ring) {
+  sharedMemoryClose(&ring->shm);
+
+#if !(defined(WIN32) || defined(_WIN32) || defined(WIN64) || defined(_WIN64))
+  // the mappings of the consumers stay valid
+  if (ring->owner) {
+    shm_unlink(ring->name);
+  }
+#endif
+
+  memset(ring, 0, sizeof(*ring));
+}
+
+size_t shmRingSlotSize(const shmRingInfo *ring) {
+  return (size_t)ring->header->slotSize;
+}
+
+void *shmRingReserve(shmRingInfo *ring) {
+  shmRingHeader_st *header = ring->header;
+  shmRingCounter head = header->head.load(std::memory_order_relaxed);
+  shmRingSlot_st *slot = shmRingSlot(ring, head);
+
+  // full while the consumer of the previous round holds the slot
+  shmRingBlock(&header->spaceSignal, &header->spaceWaiters, [&]() {
+    return slot->sequence.load(std::memory_order_acquire) == head;
+  });
+
+  ring->position = head;
+  return shmRingPayload(slot);
+}
+
+void shmRingCommit(shmRingInfo *ring, size_t size) {
+  shmRingHeader_st *header = ring->header;
+  shmRingSlot_st *slot = shmRingSlot(ring, ring->position);
+
+  slot->size = size;
+  slot->sequence.store(ring->position + 1, std::memory_order_release);
+  header->head.store(ring->position + 1, std::memory_order_relaxed);
+  shmRingWake(&header->dataSignal, &header->dataWaiters, 1);
+}
+
+void shmRingShutdown(shmRingInfo *ring) {
+  shmRingHeader_st *header = ring->header;
+
+  header->closed.store(1, std::memory_order_release);
+  shmRingWake(&header->dataSignal, &header->dataWaiters, INT_MAX);
+}
+
+const void *shmRingAcquire(shmRingInfo *ring, size_t *size) {
+  shmRingHeader_st *header = ring->header;
+
+  for (;;) {
+    shmRingCounter tail = header->tail.load(std::memory_order_acquire);
+    shmRingSlot_st *slot = shmRingSlot(ring, tail);
+    shmRingCounter sequence = slot->sequence.load(std::memory_order_acquire);
+    long long state = (long long)(sequence - (tail + 1));
+
+    if (state == 0) {
+      // committed, claim it unless another consumer was faster
+      if (header->tail.compare_exchange_weak(tail, tail + 1)) {
+        ring->position = tail;
+        *size = (size_t)slot->size;
+        return shmRingPayload(slot);
+      }
+    } else if (state < 0) {
+      // empty; after a shutdown look once more for frames committed before it
+      if (header->closed.load(std::memory_order_acquire)) {
+        if ((long long)(slot->sequence.load(std::memory_order_acquire) -
+                        (tail + 1)) < 0 &&
+            header->tail.load() == tail) {
+          return NULL;
+        }
+
+        continue;
+      }
+
+      shmRingBlock(&header->dataSignal, &header->dataWaiters, [&]() {
+        return slot->sequence.load(std::memory_order_acquire) != sequence ||
+               header->tail.load() != tail || header->closed.load() != 0;
+      });
+    }
+  }
+}
+
+void shmRingRelease(shmRingInfo *ring) {
+  shmRingHeader_st *header = ring->header;
+  shmRingSlot_st *slot = shmRingSlot(ring, ring->position);
+
+  slot->sequence.store(ring->position + header->slotCount,
+                       std::memory_order_release);
+  shmRingWake(&header->spaceSignal, &header->spaceWaiters, 1);
+}